@@ -197,53 +197,60 @@ get_cpp_type() {
     esac
 }
 
-# Validation fonksiyonu oluştur
-create_validation_function() {
+# Alan adını sabit adına çevir (xVelocityECEF -> X_VELOCITY_ECEF)
+get_field_constant_name() {
+    echo "$1" | sed -E 's/([a-z0-9])([A-Z])/\1_\2/g' | tr '[:lower:]' '[:upper:]'
+}
+
+# noexcept aralık kontrolü oluştur (setter'lar ve validate() ortak kullanır)
+create_range_check_function() {
     local cpp_type="$1"
     local field_name="$2"
     local minimum="$3"
     local maximum="$4"
-    local var_name="$5"
-    
-    # Tip kategorisine göre validation oluştur
+    local class_name="$5"
+
     if [[ "$cpp_type" =~ ^(int8_t|int16_t|int32_t|int64_t)$ ]]; then
-        # Signed integer types - uygun suffix seç
-        local min_suffix="LL"
-        local max_suffix="LL"
-        
-        # int8_t ve int16_t için suffix gereksiz
+        # Signed integer types - int8_t ve int16_t için suffix gereksiz
+        local suffix="LL"
         if [[ "$cpp_type" =~ ^(int8_t|int16_t)$ ]]; then
-            min_suffix=""
-            max_suffix=""
+            suffix=""
         fi
-        
-        echo "    void validate${field_name}($cpp_type value) const {"
-        echo "        if (value < ${minimum}${min_suffix} || value > ${maximum}${max_suffix}) {"
-        echo "            throw std::out_of_range(\"${field_name} value is out of valid range: \" + std::to_string(value));"
-        echo "        }"
-        echo "    }"
+
+        echo "bool ${class_name}::is${field_name}InRange($cpp_type value) noexcept {"
+        echo "    return (value >= ${minimum}${suffix}) && (value <= ${maximum}${suffix});"
+        echo "}"
         echo ""
     elif [[ "$cpp_type" =~ ^(uint8_t|uint16_t|uint32_t|uint64_t)$ ]]; then
         # Unsigned integer types - uygun suffix seç
         local max_suffix="ULL"
-        
-        # uint8_t ve uint16_t için suffix gereksiz
         if [[ "$cpp_type" =~ ^(uint8_t|uint16_t)$ ]]; then
             max_suffix=""
         elif [[ "$cpp_type" == "uint32_t" ]]; then
             max_suffix="U"
         fi
-        
-        echo "    void validate${field_name}($cpp_type value) const {"
-        echo "        if (value > ${maximum}${max_suffix}) {"
-        echo "            throw std::out_of_range(\"${field_name} value is out of valid range: \" + std::to_string(value));"
-        echo "        }"
-        echo "    }"
+
+        echo "bool ${class_name}::is${field_name}InRange($cpp_type value) noexcept {"
+        echo "    return value <= ${maximum}${max_suffix};"
+        echo "}"
         echo ""
     elif [[ "$cpp_type" =~ ^(float|double)$ ]]; then
         # Floating point types
+        echo "bool ${class_name}::is${field_name}InRange($cpp_type value) noexcept {"
+        echo "    return !std::isnan(value) && (value >= $minimum) && (value <= $maximum);"
+        echo "}"
+        echo ""
+    fi
+}
+
+# Validation fonksiyonu oluştur (setter'lar için exception fırlatan sarmalayıcı)
+create_validation_function() {
+    local cpp_type="$1"
+    local field_name="$2"
+
+    if [[ "$cpp_type" =~ ^(int8_t|int16_t|int32_t|int64_t|uint8_t|uint16_t|uint32_t|uint64_t|float|double)$ ]]; then
         echo "    void validate${field_name}($cpp_type value) const {"
-        echo "        if (std::isnan(value) || value < $minimum || value > $maximum) {"
+        echo "        if (!is${field_name}InRange(value)) {"
         echo "            throw std::out_of_range(\"${field_name} value is out of valid range: \" + std::to_string(value));"
         echo "        }"
         echo "    }"
@@ -251,6 +258,75 @@ create_validation_function() {
     fi
 }
 
+# Unchecked constructor parametre listesi (son parametre ") noexcept" ile biter)
+emit_unchecked_params() {
+    local json_file="$1"
+    local indent="$2"
+    local params=()
+
+    while read -r field_name json_type minimum maximum format; do
+        if [ "$minimum" = "null" ]; then minimum="0"; fi
+        if [ "$maximum" = "null" ]; then maximum="1000000"; fi
+
+        cpp_type=$(get_cpp_type "$json_type" "$minimum" "$maximum" "$format")
+        if [ "$cpp_type" = "std::string" ]; then
+            params+=("const std::string& ${field_name}")
+        else
+            params+=("$cpp_type ${field_name}")
+        fi
+    done < <(jq -r '.properties | to_entries[] | "\(.key) \(.value.type) \(.value.minimum // "null") \(.value.maximum // "null") \(.value.format // "null")"' "$json_file")
+
+    local count=${#params[@]}
+    for i in "${!params[@]}"; do
+        if [ "$i" -lt $((count - 1)) ]; then
+            echo "${indent}${params[$i]},"
+        else
+            echo "${indent}${params[$i]}) noexcept"
+        fi
+    done
+}
+
+# Sabit boyutlu C++ tipinin byte cinsinden boyutu (string için 0)
+get_type_size() {
+    case "$1" in
+        "int8_t"|"uint8_t") echo 1 ;;
+        "int16_t"|"uint16_t") echo 2 ;;
+        "int32_t"|"uint32_t"|"float") echo 4 ;;
+        "int64_t"|"uint64_t"|"double") echo 8 ;;
+        *) echo 0 ;;
+    esac
+}
+
+# Modelin sabit wire boyutu; string alan varsa 0 (değişken düzen)
+get_wire_size() {
+    local json_file="$1"
+    local total=0
+
+    while read -r field_name json_type minimum maximum format; do
+        if [ "$minimum" = "null" ]; then minimum="0"; fi
+        if [ "$maximum" = "null" ]; then maximum="1000000"; fi
+
+        cpp_type=$(get_cpp_type "$json_type" "$minimum" "$maximum" "$format")
+        local size=$(get_type_size "$cpp_type")
+        if [ "$size" -eq 0 ]; then
+            echo 0
+            return
+        fi
+        total=$((total + size))
+    done < <(jq -r '.properties | to_entries[] | "\(.key) \(.value.type) \(.value.minimum // "null") \(.value.maximum // "null") \(.value.format // "null")"' "$json_file")
+
+    echo "$total"
+}
+
+# Yerel alanlar (x-local-fields): süreç içi meta veri, serileştirilmez ve doğrulanmaz.
+# İsteğe bağlı "direction" (outgoing/incoming) alanı yalnızca o yönde üretir.
+local_field_rows() {
+    local json_file="$1"
+    local model_direction="$2"
+
+    jq -r --arg dir "$model_direction" '(."x-local-fields" // {}) | to_entries[] | select((.value.direction // $dir) == $dir) | "\(.key) \(.value.type) \(.value.format // "null") \(.value.description)"' "$json_file"
+}
+
 # Tek JSON dosyasını işle (Gelişmiş sürüm - direction aware)
 process_json_file() {
     local json_file="$1"
@@ -270,7 +346,17 @@ process_json_file() {
     # x-service-metadata bilgilerini çıkar
     local multicast_address=$(jq -r '."x-service-metadata".multicast_address // "null"' "$json_file")
     local port=$(jq -r '."x-service-metadata".port // "null"' "$json_file")
-    
+
+    # validate() alan hatalarını uint32_t bit maskesi olarak döndürür
+    local field_count=$(jq -r '.properties | length' "$json_file")
+    if [ "$field_count" -gt 32 ]; then
+        echo -e "${RED}Hata: ${title} ${field_count} alan içeriyor, validate() bit maskesi en fazla 32 alan destekler${NC}"
+        exit 1
+    fi
+
+    # Sabit düzenli modeller tek memcpy ile kodlanır (packed Wire struct)
+    local wire_size=$(get_wire_size "$json_file")
+
     cat > "$header_file" << EOF
 #pragma once
 
@@ -281,6 +367,8 @@ process_json_file() {
 #include <cmath>
 #include <vector>
 #include <cstring>
+#include <cstddef>
+#include <type_traits>
 
 /**
  * @brief $description
@@ -329,7 +417,22 @@ EOF
     cat >> "$header_file" << EOF
     // MISRA C++ 2023 compliant constructors
     explicit $title() noexcept;
-    
+
+    /// @brief Tag selecting the unchecked constructor
+    struct UncheckedInit final {};
+    static constexpr UncheckedInit UNCHECKED{};
+
+    /**
+     * @brief Construct from values that already passed validate() upstream
+     * @details No range checks: stage-to-stage copies cost one store per field.
+     *          Only use for data validated at the ingress boundary.
+     */
+    $title(UncheckedInit,
+EOF
+    emit_unchecked_params "$json_file" "$(printf '%*s' $((${#title} + 5)) '')" | sed '$ s/$/;/' >> "$header_file"
+
+    cat >> "$header_file" << EOF
+
     // Copy constructor
     $title(const $title& other) = default;
     
@@ -364,14 +467,108 @@ EOF
         echo "" >> "$header_file"
     done
     
-    # isValid method declaration
+    # Local field declarations - wire formatı ve validate() dışında
+    local local_fields=$(local_field_rows "$json_file" "$model_direction")
+    if [ -n "$local_fields" ]; then
+        echo "    // Local fields - set in-process, not serialized or validated" >> "$header_file"
+        while read -r field_name json_type format description; do
+            cpp_type=$(get_cpp_type "$json_type" "0" "1000000" "$format")
+            field_name_cap="$(tr '[:lower:]' '[:upper:]' <<< ${field_name:0:1})${field_name:1}"
+
+            echo "    /// @brief $description" >> "$header_file"
+            echo "    $cpp_type get${field_name_cap}() const noexcept;" >> "$header_file"
+            echo "    void set${field_name_cap}(const $cpp_type& value) noexcept;" >> "$header_file"
+            echo "" >> "$header_file"
+        done <<< "$local_fields"
+    fi
+
+    # Validation declarations - alan bitleri, validate(), isValid(), aralık kontrolleri
+    echo "    // Validation - MISRA compliant, exception free" >> "$header_file"
+    echo "    /// @brief Field bits reported by validate()" >> "$header_file"
+    local bit=0
+    while read -r field_name json_type minimum maximum format; do
+        if [ "$minimum" = "null" ]; then minimum="0"; fi
+        if [ "$maximum" = "null" ]; then maximum="1000000"; fi
+
+        cpp_type=$(get_cpp_type "$json_type" "$minimum" "$maximum" "$format")
+        if [ "$cpp_type" != "std::string" ]; then
+            echo "    static constexpr uint32_t FIELD_$(get_field_constant_name "$field_name"){1U << ${bit}U};" >> "$header_file"
+            bit=$((bit + 1))
+        fi
+    done < <(jq -r '.properties | to_entries[] | "\(.key) \(.value.type) \(.value.minimum // "null") \(.value.maximum // "null") \(.value.format // "null")"' "$json_file")
+
     cat >> "$header_file" << EOF
-    // Validation - MISRA compliant
+
+    /**
+     * @brief Range-check every field without throwing
+     * @return 0 if valid, otherwise the FIELD_* bits of out-of-range fields
+     */
+    [[nodiscard]] uint32_t validate() const noexcept;
     [[nodiscard]] bool isValid() const noexcept;
 
+    // Per-field range checks (setters throw std::out_of_range when these fail)
+EOF
+
+    jq -r '.properties | to_entries[] | "\(.key) \(.value.type) \(.value.minimum // "null") \(.value.maximum // "null") \(.value.format // "null")"' "$json_file" | while read -r field_name json_type minimum maximum format; do
+        if [ "$minimum" = "null" ]; then minimum="0"; fi
+        if [ "$maximum" = "null" ]; then maximum="1000000"; fi
+
+        cpp_type=$(get_cpp_type "$json_type" "$minimum" "$maximum" "$format")
+        field_name_cap="$(tr '[:lower:]' '[:upper:]' <<< ${field_name:0:1})${field_name:1}"
+
+        if [ "$cpp_type" != "std::string" ]; then
+            echo "    [[nodiscard]] static bool is${field_name_cap}InRange($cpp_type value) noexcept;" >> "$header_file"
+        fi
+    done
+
+    cat >> "$header_file" << EOF
+
     // Binary Serialization - MISRA compliant
+EOF
+
+    if [ "$wire_size" -gt 0 ]; then
+        cat >> "$header_file" << EOF
+    /// @brief Fixed wire size in bytes (packed fields, native byte order)
+    static constexpr std::size_t kWireSize{${wire_size}U};
+
+    /**
+     * @brief Packed wire image of the serialized fields
+     * @details Trivially copyable: encode and decode are one memcpy of kWireSize bytes
+     */
+#pragma pack(push, 1)
+    struct Wire final {
+EOF
+        jq -r '.properties | to_entries[] | "\(.key) \(.value.type) \(.value.minimum // "null") \(.value.maximum // "null") \(.value.format // "null")"' "$json_file" | while read -r field_name json_type minimum maximum format; do
+            if [ "$minimum" = "null" ]; then minimum="0"; fi
+            if [ "$maximum" = "null" ]; then maximum="1000000"; fi
+
+            cpp_type=$(get_cpp_type "$json_type" "$minimum" "$maximum" "$format")
+            echo "        $cpp_type ${field_name};" >> "$header_file"
+        done
+        cat >> "$header_file" << EOF
+    };
+#pragma pack(pop)
+
+EOF
+    fi
+
+    cat >> "$header_file" << EOF
     [[nodiscard]] std::vector<uint8_t> serialize() const;
+EOF
+
+    if [ "$wire_size" -gt 0 ]; then
+        cat >> "$header_file" << EOF
+    /**
+     * @brief Encode into a caller-provided (pooled or stack) buffer
+     * @return Bytes written (kWireSize), or 0 if dst is null or cap < kWireSize
+     */
+    [[nodiscard]] std::size_t serializeInto(uint8_t* dst, std::size_t cap) const noexcept;
+EOF
+    fi
+
+    cat >> "$header_file" << EOF
     bool deserialize(const std::vector<uint8_t>& data) noexcept;
+    bool deserialize(const uint8_t* data, std::size_t size) noexcept;
     [[nodiscard]] std::size_t getSerializedSize() const noexcept;
 
 private:
@@ -387,6 +584,14 @@ EOF
         echo "    /// $description" >> "$header_file"
         echo "    $cpp_type ${field_name}_;" >> "$header_file"
     done
+    if [ -n "$local_fields" ]; then
+        echo "    // Local fields (not serialized)" >> "$header_file"
+        while read -r field_name json_type format description; do
+            cpp_type=$(get_cpp_type "$json_type" "0" "1000000" "$format")
+            echo "    /// $description" >> "$header_file"
+            echo "    $cpp_type ${field_name}_{};" >> "$header_file"
+        done <<< "$local_fields"
+    fi
     
     echo "" >> "$header_file"
     echo "    // Validation functions - MISRA compliant" >> "$header_file"
@@ -408,6 +613,14 @@ EOF
 };
 EOF
 
+    if [ "$wire_size" -gt 0 ]; then
+        cat >> "$header_file" << EOF
+
+static_assert(sizeof($title::Wire) == $title::kWireSize, "$title::Wire must have no padding");
+static_assert(std::is_trivially_copyable<$title::Wire>::value, "$title::Wire must be trivially copyable");
+EOF
+    fi
+
     # Source dosyası oluştur (.cpp)
     cat > "$source_file" << EOF
 #include "${title}.hpp"
@@ -429,7 +642,36 @@ EOF
     cat >> "$source_file" << EOF
 }
 
+// Unchecked constructor: caller guarantees the values are in range
+$title::$title(UncheckedInit,
 EOF
+    emit_unchecked_params "$json_file" "$(printf '%*s' $((${#title} * 2 + 3)) '')" >> "$source_file"
+
+    # Member initializer list
+    local separator=":"
+    while read -r field_name; do
+        echo "    ${separator} ${field_name}_(${field_name})" >> "$source_file"
+        separator=","
+    done < <(jq -r '.properties | keys_unsorted[]' "$json_file")
+    sed -i '$ s/$/ {/' "$source_file"
+
+    cat >> "$source_file" << EOF
+}
+
+// Range checks - noexcept, shared by setters and validate()
+EOF
+
+    jq -r '.properties | to_entries[] | "\(.key) \(.value.type) \(.value.minimum // "null") \(.value.maximum // "null") \(.value.format // "null")"' "$json_file" | while read -r field_name json_type minimum maximum format; do
+        if [ "$minimum" = "null" ]; then minimum="0"; fi
+        if [ "$maximum" = "null" ]; then maximum="1000000"; fi
+
+        cpp_type=$(get_cpp_type "$json_type" "$minimum" "$maximum" "$format")
+        field_name_cap="$(tr '[:lower:]' '[:upper:]' <<< ${field_name:0:1})${field_name:1}"
+
+        if [ "$cpp_type" != "std::string" ]; then
+            create_range_check_function "$cpp_type" "$field_name_cap" "$minimum" "$maximum" "$title" >> "$source_file"
+        fi
+    done
 
     # Validation functions implementation
     jq -r '.properties | to_entries[] | "\(.key) \(.value.type) \(.value.minimum // "null") \(.value.maximum // "null") \(.value.format // "null")"' "$json_file" | while read -r field_name json_type minimum maximum format; do
@@ -440,7 +682,7 @@ EOF
         field_name_cap="$(tr '[:lower:]' '[:upper:]' <<< ${field_name:0:1})${field_name:1}"
         
         if [ "$cpp_type" != "std::string" ]; then
-            create_validation_function "$cpp_type" "$field_name_cap" "$minimum" "$maximum" "$field_name" | sed "s/void validate/void $title::validate/" >> "$source_file"
+            create_validation_function "$cpp_type" "$field_name_cap" | sed "s/void validate/void $title::validate/" >> "$source_file"
         fi
     done
 
@@ -468,28 +710,108 @@ EOF
         echo "" >> "$source_file"
     done
     
-    # isValid method implementation
+    # Local field implementations - aralık kontrolü yok
+    if [ -n "$local_fields" ]; then
+        echo "// Local fields: plain stores, outside validate() and the wire format" >> "$source_file"
+        while read -r field_name json_type format description; do
+            cpp_type=$(get_cpp_type "$json_type" "0" "1000000" "$format")
+            field_name_cap="$(tr '[:lower:]' '[:upper:]' <<< ${field_name:0:1})${field_name:1}"
+
+            echo "$cpp_type $title::get${field_name_cap}() const noexcept {" >> "$source_file"
+            echo "    return ${field_name}_;" >> "$source_file"
+            echo "}" >> "$source_file"
+            echo "" >> "$source_file"
+            echo "void $title::set${field_name_cap}(const $cpp_type& value) noexcept {" >> "$source_file"
+            echo "    ${field_name}_ = value;" >> "$source_file"
+            echo "}" >> "$source_file"
+            echo "" >> "$source_file"
+        done <<< "$local_fields"
+    fi
+
+    # validate() / isValid() implementation - exception free
     cat >> "$source_file" << EOF
-bool $title::isValid() const noexcept {
-    try {
+uint32_t $title::validate() const noexcept {
+    uint32_t errors = 0U;
 EOF
 
-    jq -r '.properties | to_entries[] | "\(.key) \(.value.type) \(.value.format // "null")"' "$json_file" | while read -r field_name json_type format; do
-        cpp_type=$(get_cpp_type "$json_type" "0" "1000000" "$format")
+    jq -r '.properties | to_entries[] | "\(.key) \(.value.type) \(.value.minimum // "null") \(.value.maximum // "null") \(.value.format // "null")"' "$json_file" | while read -r field_name json_type minimum maximum format; do
+        if [ "$minimum" = "null" ]; then minimum="0"; fi
+        if [ "$maximum" = "null" ]; then maximum="1000000"; fi
+
+        cpp_type=$(get_cpp_type "$json_type" "$minimum" "$maximum" "$format")
         field_name_cap="$(tr '[:lower:]' '[:upper:]' <<< ${field_name:0:1})${field_name:1}"
-        
+
         if [ "$cpp_type" != "std::string" ]; then
-            echo "        validate${field_name_cap}(${field_name}_);" >> "$source_file"
+            echo "    if (!is${field_name_cap}InRange(${field_name}_)) {" >> "$source_file"
+            echo "        errors |= FIELD_$(get_field_constant_name "$field_name");" >> "$source_file"
+            echo "    }" >> "$source_file"
         fi
     done
-    
+
     cat >> "$source_file" << EOF
-        return true;
-    } catch (const std::exception&) {
+    return errors;
+}
+
+bool $title::isValid() const noexcept {
+    return validate() == 0U;
+}
+
+EOF
+
+    # deserialize() yerel alanları sıfırlar: yeniden kullanılan nesnede eski meta veri kalmaz
+    local local_reset=""
+    if [ -n "$local_fields" ]; then
+        local_reset=$(while read -r field_name rest; do
+            echo "    ${field_name}_ = {};"
+        done <<< "$local_fields")
+        local_reset="    // Local fields are never on the wire"$'\n'"${local_reset}"$'\n'
+    fi
+
+    if [ "$wire_size" -gt 0 ]; then
+        # Sabit düzen: Wire struct üzerinden tek memcpy
+        local wire_init=$(jq -r '.properties | keys_unsorted[]' "$json_file" | sed 's/$/_/' | paste -sd, - | sed 's/,/, /g')
+        local wire_assign=$(jq -r '.properties | keys_unsorted[]' "$json_file" | sed -E 's/^(.*)$/    \1_ = wire.\1;/')
+
+        cat >> "$source_file" << EOF
+// MISRA C++ 2023 compliant Binary Serialization Implementation
+// Layout: packed $title::Wire, kWireSize bytes, native byte order
+std::vector<uint8_t> $title::serialize() const {
+    std::vector<uint8_t> buffer(kWireSize);
+    static_cast<void>(serializeInto(buffer.data(), buffer.size()));
+    return buffer;
+}
+
+std::size_t $title::serializeInto(uint8_t* dst, std::size_t cap) const noexcept {
+    if ((dst == nullptr) || (cap < kWireSize)) {
+        return 0U;
+    }
+
+    const Wire wire{${wire_init}};
+    std::memcpy(dst, &wire, kWireSize);
+    return kWireSize;
+}
+
+bool $title::deserialize(const std::vector<uint8_t>& data) noexcept {
+    return deserialize(data.data(), data.size());
+}
+
+bool $title::deserialize(const uint8_t* data, std::size_t size) noexcept {
+    if ((data == nullptr) || (size < kWireSize)) {
         return false;
     }
+
+    Wire wire;
+    std::memcpy(&wire, data, kWireSize);
+${wire_assign}
+${local_reset}    return true;
 }
 
+std::size_t $title::getSerializedSize() const noexcept {
+    return kWireSize;
+}
+EOF
+    else
+        cat >> "$source_file" << EOF
 // MISRA C++ 2023 compliant Binary Serialization Implementation
 std::vector<uint8_t> $title::serialize() const {
     std::vector<uint8_t> buffer;
@@ -497,12 +819,12 @@ std::vector<uint8_t> $title::serialize() const {
     
 EOF
 
-    # Her field için serialize kodu oluştur
-    jq -r '.properties | to_entries[] | "\(.key) \(.value.type) \(.value.format // "null")"' "$json_file" | while read -r field_name json_type format; do
-        cpp_type=$(get_cpp_type "$json_type" "0" "1000000" "$format")
+        # Her field için serialize kodu oluştur
+        jq -r '.properties | to_entries[] | "\(.key) \(.value.type) \(.value.format // "null")"' "$json_file" | while read -r field_name json_type format; do
+            cpp_type=$(get_cpp_type "$json_type" "0" "1000000" "$format")
         
-        if [[ "$cpp_type" =~ int.*_t|float|double ]]; then
-            cat >> "$source_file" << EOF
+            if [[ "$cpp_type" =~ int.*_t|float|double ]]; then
+                cat >> "$source_file" << EOF
     // Serialize ${field_name}_
     {
         const uint8_t* ptr = reinterpret_cast<const uint8_t*>(&${field_name}_);
@@ -510,8 +832,8 @@ EOF
     }
     
 EOF
-        elif [ "$cpp_type" = "std::string" ]; then
-            cat >> "$source_file" << EOF
+            elif [ "$cpp_type" = "std::string" ]; then
+                cat >> "$source_file" << EOF
     // Serialize ${field_name}_ (string) - MISRA compliant
     {
         const std::uint32_t length = static_cast<std::uint32_t>(${field_name}_.length());
@@ -521,15 +843,19 @@ EOF
     }
     
 EOF
-        fi
-    done
+            fi
+        done
     
-    cat >> "$source_file" << EOF
+        cat >> "$source_file" << EOF
     return buffer;
 }
 
 bool $title::deserialize(const std::vector<uint8_t>& data) noexcept {
-    if (data.size() < getSerializedSize()) {
+    return deserialize(data.data(), data.size());
+}
+
+bool $title::deserialize(const uint8_t* data, std::size_t size) noexcept {
+    if ((data == nullptr) || (size < getSerializedSize())) {
         return false;
     }
     
@@ -537,14 +863,14 @@ bool $title::deserialize(const std::vector<uint8_t>& data) noexcept {
     
 EOF
 
-    # Her field için deserialize kodu oluştur
-    jq -r '.properties | to_entries[] | "\(.key) \(.value.type) \(.value.format // "null")"' "$json_file" | while read -r field_name json_type format; do
-        cpp_type=$(get_cpp_type "$json_type" "0" "1000000" "$format")
+        # Her field için deserialize kodu oluştur
+        jq -r '.properties | to_entries[] | "\(.key) \(.value.type) \(.value.format // "null")"' "$json_file" | while read -r field_name json_type format; do
+            cpp_type=$(get_cpp_type "$json_type" "0" "1000000" "$format")
         
-        if [[ "$cpp_type" =~ int.*_t|float|double ]]; then
-            cat >> "$source_file" << EOF
+            if [[ "$cpp_type" =~ int.*_t|float|double ]]; then
+                cat >> "$source_file" << EOF
     // Deserialize ${field_name}_
-    if (offset + sizeof(${field_name}_) <= data.size()) {
+    if (offset + sizeof(${field_name}_) <= size) {
         std::memcpy(&${field_name}_, &data[offset], sizeof(${field_name}_));
         offset += sizeof(${field_name}_);
     } else {
@@ -552,15 +878,15 @@ EOF
     }
     
 EOF
-        elif [ "$cpp_type" = "std::string" ]; then
-            cat >> "$source_file" << EOF
+            elif [ "$cpp_type" = "std::string" ]; then
+                cat >> "$source_file" << EOF
     // Deserialize ${field_name}_ (string) - MISRA compliant
-    if (offset + sizeof(std::uint32_t) <= data.size()) {
+    if (offset + sizeof(std::uint32_t) <= size) {
         std::uint32_t length{0U};
         std::memcpy(&length, &data[offset], sizeof(length));
         offset += sizeof(std::uint32_t);
         
-        if (offset + length <= data.size()) {
+        if (offset + length <= size) {
             ${field_name}_.assign(reinterpret_cast<const char*>(&data[offset]), length);
             offset += length;
         } else {
@@ -571,11 +897,11 @@ EOF
     }
     
 EOF
-        fi
-    done
+            fi
+        done
     
-    cat >> "$source_file" << EOF
-    return true;
+        cat >> "$source_file" << EOF
+${local_reset}    return true;
 }
 
 std::size_t $title::getSerializedSize() const noexcept {
@@ -583,26 +909,27 @@ std::size_t $title::getSerializedSize() const noexcept {
     
 EOF
 
-    # Her field için size hesaplama
-    jq -r '.properties | to_entries[] | "\(.key) \(.value.type) \(.value.format // "null")"' "$json_file" | while read -r field_name json_type format; do
-        cpp_type=$(get_cpp_type "$json_type" "0" "1000000" "$format")
+        # Her field için size hesaplama
+        jq -r '.properties | to_entries[] | "\(.key) \(.value.type) \(.value.format // "null")"' "$json_file" | while read -r field_name json_type format; do
+            cpp_type=$(get_cpp_type "$json_type" "0" "1000000" "$format")
         
-        if [[ "$cpp_type" =~ int.*_t|float|double ]]; then
-            cat >> "$source_file" << EOF
+            if [[ "$cpp_type" =~ int.*_t|float|double ]]; then
+                cat >> "$source_file" << EOF
     size += sizeof(${field_name}_);  // ${cpp_type}
 EOF
-        elif [ "$cpp_type" = "std::string" ]; then
-            cat >> "$source_file" << EOF
+            elif [ "$cpp_type" = "std::string" ]; then
+                cat >> "$source_file" << EOF
     size += sizeof(std::uint32_t) + ${field_name}_.length();  // string length + data
 EOF
-        fi
-    done
+            fi
+        done
     
-    cat >> "$source_file" << EOF
+        cat >> "$source_file" << EOF
     
     return size;
 }
 EOF
+    fi
 
     echo -e "${GREEN}✅ ${title}.hpp ve ${title}.cpp oluşturuldu${NC}"
 }
@@ -0,0 +1,233 @@
+/**
+ * @file BatchFrame.hpp
+ * @brief Multi-record batch frame wire format
+ * @details Packs several fixed-size serialized records into one message so a
+ *          tick of N tracks costs ceil(N / records-per-frame) datagrams instead
+ *          of N. Layout (native byte order, same as the model serializers):
+ *
+ * @code
+ * offset  size  field
+ *      0     2  magic        (0x4842, "HB")
+ *      2     1  version      (1)
+ *      3     1  modelType    (BatchModelType)
+ *      4     2  recordCount
+ *      6     2  recordSize   (bytes per record)
+ *      8     4  sequence     (per-publisher frame counter, gap detection)
+ *     12     4  reserved     (0)
+ *     16     -  recordCount * recordSize packed records
+ * @endcode
+ *
+ * A frame of one 76-byte record is 92 bytes, so frames never collide with
+ * legacy single-record messages by size.
+ *
+ * @author a_hexagon Team
+ * @version 1.0
+ * @date 2025
+ *
+ * @note MISRA C++ 2023 compliant implementation
+ */
+
+#ifndef A_HEXAGON_ADAPTERS_COMMON_MESSAGING_BATCH_FRAME_HPP
+#define A_HEXAGON_ADAPTERS_COMMON_MESSAGING_BATCH_FRAME_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+
+namespace adapters {
+namespace common {
+namespace messaging {
+
+/**
+ * @brief Record type carried by a batch frame
+ */
+enum class BatchModelType : uint8_t {
+    ExtrapTrackData = 1U,
+    DelayCalcTrackData = 2U,
+    FinalCalcTrackData = 3U
+};
+
+/**
+ * @struct BatchFrameHeader
+ * @brief Fixed 16-byte frame header
+ */
+struct BatchFrameHeader {
+    uint16_t magic{0U};
+    uint8_t version{0U};
+    uint8_t modelType{0U};
+    uint16_t recordCount{0U};
+    uint16_t recordSize{0U};
+    uint32_t sequence{0U};
+    uint32_t reserved{0U};
+};
+
+static_assert(sizeof(BatchFrameHeader) == 16U, "BatchFrameHeader must be 16 bytes on the wire");
+
+/// @brief Frame identification constants
+static constexpr uint16_t BATCH_FRAME_MAGIC{0x4842U};
+static constexpr uint8_t BATCH_FRAME_VERSION{1U};
+static constexpr std::size_t BATCH_FRAME_HEADER_SIZE{sizeof(BatchFrameHeader)};
+
+/**
+ * @class BatchFrameWriter
+ * @brief Accumulates records into a reusable frame buffer within a byte budget
+ */
+class BatchFrameWriter final {
+public:
+    /**
+     * @brief Construct writer
+     * @param budgetBytes Maximum frame size (header + records), e.g. MTU budget
+     * @throws std::invalid_argument if budget cannot hold the header
+     */
+    explicit BatchFrameWriter(std::size_t budgetBytes)
+        : budget_(budgetBytes) {
+        if (budgetBytes <= BATCH_FRAME_HEADER_SIZE) {
+            throw std::invalid_argument("Batch frame budget must exceed the 16-byte header");
+        }
+        buffer_.reserve(budget_);
+    }
+
+    /**
+     * @brief Start a new frame (discards any unfinished one)
+     */
+    void begin(BatchModelType type, uint16_t recordSize, uint32_t sequence) {
+        header_ = BatchFrameHeader{};
+        header_.magic = BATCH_FRAME_MAGIC;
+        header_.version = BATCH_FRAME_VERSION;
+        header_.modelType = static_cast<uint8_t>(type);
+        header_.recordSize = recordSize;
+        header_.sequence = sequence;
+        buffer_.resize(BATCH_FRAME_HEADER_SIZE);
+    }
+
+    /**
+     * @brief Append one serialized record
+     * @return false if the record does not fit the budget or has the wrong size
+     */
+    [[nodiscard]] bool append(const uint8_t* record, std::size_t size) {
+        if ((record == nullptr) || (size != header_.recordSize) ||
+            ((buffer_.size() + size) > budget_) || (header_.recordCount == UINT16_MAX)) {
+            return false;
+        }
+        buffer_.insert(buffer_.end(), record, record + size);
+        ++header_.recordCount;
+        return true;
+    }
+
+    /**
+     * @brief Reserve the next record slot for in-place serialization
+     * @return Pointer to recordSize writable bytes, or nullptr if the frame is full
+     */
+    [[nodiscard]] uint8_t* appendSlot() {
+        const std::size_t offset = buffer_.size();
+        if ((header_.recordSize == 0U) || ((offset + header_.recordSize) > budget_) ||
+            (header_.recordCount == UINT16_MAX)) {
+            return nullptr;
+        }
+        buffer_.resize(offset + header_.recordSize);  // Within reserved budget - no allocation
+        ++header_.recordCount;
+        return &buffer_[offset];
+    }
+
+    /**
+     * @brief Patch the header and expose the frame bytes
+     * @return Frame buffer, valid until the next begin()
+     */
+    [[nodiscard]] const std::vector<uint8_t>& finish() noexcept {
+        std::memcpy(buffer_.data(), &header_, BATCH_FRAME_HEADER_SIZE);
+        return buffer_;
+    }
+
+    [[nodiscard]] uint16_t recordCount() const noexcept {
+        return header_.recordCount;
+    }
+
+    [[nodiscard]] bool empty() const noexcept {
+        return header_.recordCount == 0U;
+    }
+
+    /**
+     * @brief Records of the given size that fit in one frame
+     */
+    [[nodiscard]] std::size_t capacityFor(std::size_t recordSize) const noexcept {
+        return (recordSize == 0U) ? 0U : ((budget_ - BATCH_FRAME_HEADER_SIZE) / recordSize);
+    }
+
+private:
+    std::size_t budget_;                ///< Max frame bytes
+    BatchFrameHeader header_{};         ///< Header of the frame being built
+    std::vector<uint8_t> buffer_;       ///< Reused frame storage
+};
+
+/**
+ * @class BatchFrameReader
+ * @brief Validates a received frame and exposes its records in place
+ */
+class BatchFrameReader final {
+public:
+    /**
+     * @brief Cheap check whether a message carries a batch frame
+     */
+    [[nodiscard]] static bool isBatchFrame(const uint8_t* data, std::size_t size) noexcept {
+        if ((data == nullptr) || (size < BATCH_FRAME_HEADER_SIZE)) {
+            return false;
+        }
+        uint16_t magic = 0U;
+        std::memcpy(&magic, data, sizeof(magic));
+        return magic == BATCH_FRAME_MAGIC;
+    }
+
+    /**
+     * @brief Parse and validate a frame (no copy of the records)
+     * @return false on bad magic/version, or if the length does not match
+     */
+    [[nodiscard]] bool parse(const uint8_t* data, std::size_t size) noexcept {
+        records_ = nullptr;
+        if (!isBatchFrame(data, size)) {
+            return false;
+        }
+        std::memcpy(&header_, data, BATCH_FRAME_HEADER_SIZE);
+        const std::size_t payload = static_cast<std::size_t>(header_.recordCount) * header_.recordSize;
+        if ((header_.version != BATCH_FRAME_VERSION) || (header_.recordSize == 0U) ||
+            ((BATCH_FRAME_HEADER_SIZE + payload) != size)) {
+            return false;
+        }
+        records_ = data + BATCH_FRAME_HEADER_SIZE;
+        return true;
+    }
+
+    [[nodiscard]] const BatchFrameHeader& header() const noexcept {
+        return header_;
+    }
+
+    [[nodiscard]] BatchModelType modelType() const noexcept {
+        return static_cast<BatchModelType>(header_.modelType);
+    }
+
+    [[nodiscard]] std::size_t recordCount() const noexcept {
+        return (records_ == nullptr) ? 0U : header_.recordCount;
+    }
+
+    [[nodiscard]] std::size_t recordSize() const noexcept {
+        return header_.recordSize;
+    }
+
+    /**
+     * @brief Pointer to record @p index (index < recordCount())
+     */
+    [[nodiscard]] const uint8_t* record(std::size_t index) const noexcept {
+        return records_ + (index * header_.recordSize);
+    }
+
+private:
+    BatchFrameHeader header_{};         ///< Parsed header
+    const uint8_t* records_{nullptr};   ///< First record (view into the message)
+};
+
+} // namespace messaging
+} // namespace common
+} // namespace adapters
+
+#endif // A_HEXAGON_ADAPTERS_COMMON_MESSAGING_BATCH_FRAME_HPP
@@ -35,11 +35,14 @@
 #ifndef A_HEXAGON_ADAPTERS_COMMON_MESSAGING_IMESSAGE_SOCKET_HPP
 #define A_HEXAGON_ADAPTERS_COMMON_MESSAGING_IMESSAGE_SOCKET_HPP
 
+#include "ReceivedFrame.hpp"
+
 #include <cstddef>
 #include <cstdint>
 #include <optional>
 #include <vector>
 #include <string>
+#include <utility>
 
 namespace adapters {
 namespace common {
@@ -103,6 +106,18 @@ public:
      */
     [[nodiscard]] virtual bool send(const std::vector<uint8_t>& data, const std::string& group) = 0;
 
+    /**
+     * @brief Send binary message with group/topic, taking the payload
+     * @param data Raw bytes to send (moved from)
+     * @param group Group/topic name for pub-sub patterns
+     * @return true on successful send, false on failure
+     * @details Implementations that queue the frame for another thread move it
+     *          instead of copying; the default forwards to the copying overload.
+     */
+    [[nodiscard]] virtual bool send(std::vector<uint8_t>&& data, const std::string& group) {
+        return send(static_cast<const std::vector<uint8_t>&>(data), group);
+    }
+
     /**
      * @brief Receive binary message with timeout
      * @param timeoutMs Timeout in milliseconds (0 = non-blocking, -1 = infinite)
@@ -112,6 +127,51 @@ public:
      */
     [[nodiscard]] virtual std::optional<std::vector<uint8_t>> receive(int32_t timeoutMs) = 0;
 
+    /**
+     * @brief Receive binary message as a read-only view (zero-copy)
+     * @param frame Caller-owned frame; previous contents are released
+     * @param timeoutMs Timeout in milliseconds (0 = non-blocking, -1 = infinite)
+     * @return true if a message was received into frame
+     * @details Default implementation adapts receive(); sockets that can lend
+     *          their native buffer override it to avoid the heap copy.
+     * @pre isConnected() == true
+     * @thread_safe No - single consumer pattern recommended
+     */
+    [[nodiscard]] virtual bool receiveFrame(ReceivedFrame& frame, int32_t timeoutMs) {
+        auto data = receive(timeoutMs);
+        if (!data.has_value()) {
+            frame.reset();
+            return false;
+        }
+        frame.assign(std::move(*data));
+        return true;
+    }
+
+    /**
+     * @brief Interrupt a receive() blocked in another thread
+     * @details Used on shutdown so stop latency does not depend on the receive
+     *          timeout. Default is a no-op (receive returns on its timeout).
+     * @thread_safe Yes
+     */
+    virtual void wakeReceiver() noexcept {}
+
+    /**
+     * @brief Make the calling thread the socket's I/O thread
+     * @details Sockets with a single-owner threading model run the attached
+     *          thread's send/receive without locks; other threads hand their
+     *          operations over. Default is a no-op.
+     * @thread_safe Yes
+     */
+    virtual void attachIoThread() {}
+
+    /**
+     * @brief Give up ownership taken with attachIoThread()
+     * @details Called by the I/O thread before it exits; afterwards any thread
+     *          may use the socket again. Default is a no-op.
+     * @thread_safe Yes - only the attached thread has an effect
+     */
+    virtual void detachIoThread() noexcept {}
+
     /**
      * @brief Close socket and release resources
      * @post isConnected() returns false
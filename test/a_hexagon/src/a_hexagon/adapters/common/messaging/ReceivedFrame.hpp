@@ -0,0 +1,155 @@
+/**
+ * @file ReceivedFrame.hpp
+ * @brief Read-only view over a received message frame
+ * @details Lets a socket hand its native message buffer to the caller without
+ *          copying it into a std::vector. The frame owns the backend handle
+ *          (e.g. a zmq::message_t constructed in-place in handleStorage_) and
+ *          releases it on reset(), on the next receive, or on destruction.
+ *
+ * Usage:
+ * @code
+ * ReceivedFrame frame;                       // reuse across receives
+ * while (running) {
+ *     if (socket->receiveFrame(frame, 100)) {
+ *         model.deserialize(frame.data(), frame.size());
+ *     }
+ * }
+ * @endcode
+ *
+ * @author a_hexagon Team
+ * @version 1.0
+ * @date 2025
+ *
+ * @note MISRA C++ 2023 compliant implementation
+ * @see IMessageSocket.hpp
+ */
+
+#ifndef A_HEXAGON_ADAPTERS_COMMON_MESSAGING_RECEIVED_FRAME_HPP
+#define A_HEXAGON_ADAPTERS_COMMON_MESSAGING_RECEIVED_FRAME_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace adapters {
+namespace common {
+namespace messaging {
+
+/**
+ * @class ReceivedFrame
+ * @brief Caller-owned, reusable frame holder (pointer, length, ownership handle)
+ * @details Non-copyable and non-movable: small frames may point into the
+ *          in-place handle storage, so the object must not change address
+ *          while a frame is attached.
+ *
+ * @invariant data() is valid until reset() or the next receive into this frame
+ */
+class ReceivedFrame final {
+public:
+    /// @brief In-place storage for the backend handle (fits zmq_msg_t)
+    static constexpr std::size_t HANDLE_STORAGE_SIZE = 64U;
+
+    /// @brief Releases the backend handle living in handleStorage_
+    using Releaser = void (*)(void* handle) noexcept;
+
+    ReceivedFrame() noexcept = default;
+
+    ~ReceivedFrame() {
+        reset();
+    }
+
+    ReceivedFrame(const ReceivedFrame&) = delete;
+    ReceivedFrame& operator=(const ReceivedFrame&) = delete;
+    ReceivedFrame(ReceivedFrame&&) = delete;
+    ReceivedFrame& operator=(ReceivedFrame&&) = delete;
+
+    // ==================== Caller Side ====================
+
+    [[nodiscard]] const uint8_t* data() const noexcept {
+        return data_;
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept {
+        return size_;
+    }
+
+    [[nodiscard]] bool empty() const noexcept {
+        return size_ == 0U;
+    }
+
+    /// @brief Kernel arrival time (CLOCK_REALTIME microseconds), 0 if the socket has none
+    [[nodiscard]] int64_t kernelReceiveTimeUs() const noexcept {
+        return kernelReceiveTimeUs_;
+    }
+
+    /**
+     * @brief Release the attached frame (idempotent)
+     */
+    void reset() noexcept {
+        if (releaser_ != nullptr) {
+            releaser_(static_cast<void*>(handleStorage_));
+            releaser_ = nullptr;
+        }
+        fallback_.clear();
+        data_ = nullptr;
+        size_ = 0U;
+        kernelReceiveTimeUs_ = 0;
+    }
+
+    // ==================== Socket (Backend) Side ====================
+
+    /**
+     * @brief Release any current frame and return the in-place handle storage
+     * @return Storage of HANDLE_STORAGE_SIZE bytes, max_align_t aligned
+     */
+    [[nodiscard]] void* prepareHandle() noexcept {
+        reset();
+        return static_cast<void*>(handleStorage_);
+    }
+
+    /**
+     * @brief Attach a view over a handle constructed in prepareHandle() storage
+     * @param data First byte of the frame payload
+     * @param size Payload length in bytes
+     * @param releaser Destroys the handle; called exactly once
+     */
+    void attach(const uint8_t* data, std::size_t size, Releaser releaser) noexcept {
+        data_ = data;
+        size_ = size;
+        releaser_ = releaser;
+    }
+
+    /**
+     * @brief Adopt an owned buffer (fallback for backends without zero-copy)
+     * @param bytes Received payload (moved, not copied)
+     */
+    void assign(std::vector<uint8_t>&& bytes) noexcept {
+        reset();
+        fallback_ = std::move(bytes);
+        data_ = fallback_.data();
+        size_ = fallback_.size();
+    }
+
+    /**
+     * @brief Stamp the attached frame with its kernel arrival time
+     * @param timeUs CLOCK_REALTIME microseconds (cleared by reset())
+     */
+    void setKernelReceiveTime(int64_t timeUs) noexcept {
+        kernelReceiveTimeUs_ = timeUs;
+    }
+
+private:
+    alignas(std::max_align_t) unsigned char handleStorage_[HANDLE_STORAGE_SIZE]{};
+    Releaser releaser_{nullptr};           ///< Non-null while a backend handle is live
+    std::vector<uint8_t> fallback_;        ///< Owned bytes for assign()
+    const uint8_t* data_{nullptr};         ///< Payload view
+    std::size_t size_{0U};                 ///< Payload length
+    int64_t kernelReceiveTimeUs_{0};       ///< Kernel RX timestamp, 0 if unknown
+};
+
+} // namespace messaging
+} // namespace common
+} // namespace adapters
+
+#endif // A_HEXAGON_ADAPTERS_COMMON_MESSAGING_RECEIVED_FRAME_HPP
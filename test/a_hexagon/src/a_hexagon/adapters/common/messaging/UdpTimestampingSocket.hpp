@@ -0,0 +1,285 @@
+/**
+ * @file UdpTimestampingSocket.hpp
+ * @brief Receive-only IMessageSocket over plain UDP with kernel RX timestamps
+ * @details A ZeroMQ DISH socket hides its file descriptor, so the receive time
+ *          the adapter can take already includes ZeroMQ I/O-thread queueing and
+ *          the receive loop's own wake-up. RADIO over udp:// sends one datagram
+ *          per message:
+ *
+ * @code
+ * [group length: 1 byte][group: n bytes][body]
+ * @endcode
+ *
+ *          so a plain UDP socket bound to the same endpoint receives the same
+ *          messages. This socket enables SO_TIMESTAMPING (software RX) and
+ *          stamps each ReceivedFrame with the kernel arrival time.
+ *
+ * Design:
+ * - connect() binds (multicast: INADDR_ANY:port + group join; unicast: the
+ *   address itself); send() is not supported.
+ * - Falls back to SO_TIMESTAMPNS, then to no timestamp (0).
+ * - receiveFrame() lends the socket's buffer: the frame is valid until the
+ *   next receive.
+ *
+ * @author a_hexagon Team
+ * @version 1.0
+ * @date 2025
+ *
+ * @note MISRA C++ 2023 compliant implementation
+ * @note Linux only (SO_TIMESTAMPING)
+ * @see IMessageSocket.hpp
+ */
+
+#ifndef A_HEXAGON_ADAPTERS_COMMON_MESSAGING_UDP_TIMESTAMPING_SOCKET_HPP
+#define A_HEXAGON_ADAPTERS_COMMON_MESSAGING_UDP_TIMESTAMPING_SOCKET_HPP
+
+#include "IMessageSocket.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <ctime>
+#include <optional>
+#include <string>
+#include <vector>
+#include <arpa/inet.h>
+#include <linux/net_tstamp.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace adapters {
+namespace common {
+namespace messaging {
+
+/**
+ * @class UdpTimestampingSocket
+ * @brief Receives RADIO datagrams of one group with kernel timestamps
+ */
+class UdpTimestampingSocket final : public IMessageSocket {
+public:
+    /// @brief Largest UDP payload
+    static constexpr std::size_t MAX_DATAGRAM_SIZE = 65536U;
+
+    /**
+     * @brief Constructor
+     * @param group RADIO group to accept; datagrams of other groups are skipped
+     */
+    explicit UdpTimestampingSocket(std::string group)
+        : group_(std::move(group))
+        , buffer_(MAX_DATAGRAM_SIZE) {
+    }
+
+    ~UdpTimestampingSocket() override {
+        close();
+    }
+
+    UdpTimestampingSocket(const UdpTimestampingSocket&) = delete;
+    UdpTimestampingSocket& operator=(const UdpTimestampingSocket&) = delete;
+    UdpTimestampingSocket(UdpTimestampingSocket&&) = delete;
+    UdpTimestampingSocket& operator=(UdpTimestampingSocket&&) = delete;
+
+    /**
+     * @brief Bind the endpoint and enable kernel RX timestamps
+     * @param endpoint "udp://<IPv4 address>:<port>" (same string the DISH binds)
+     */
+    [[nodiscard]] bool connect(const std::string& endpoint) override {
+        close();
+        sockaddr_in address{};
+        if (!parseEndpoint(endpoint, address) || (group_.size() > 255U)) {
+            return false;
+        }
+        fd_ = ::socket(AF_INET, SOCK_DGRAM | SOCK_CLOEXEC, 0);
+        if (fd_ < 0) {
+            return false;
+        }
+        const int enable = 1;
+        static_cast<void>(::setsockopt(fd_, SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(enable)));
+
+        const bool multicast = IN_MULTICAST(ntohl(address.sin_addr.s_addr));
+        sockaddr_in bindAddress = address;
+        if (multicast) {
+            bindAddress.sin_addr.s_addr = htonl(INADDR_ANY);
+        }
+        if (::bind(fd_, reinterpret_cast<const sockaddr*>(&bindAddress), sizeof(bindAddress)) != 0) {
+            close();
+            return false;
+        }
+        if (multicast) {
+            ip_mreq membership{};
+            membership.imr_multiaddr = address.sin_addr;
+            membership.imr_interface.s_addr = htonl(INADDR_ANY);
+            if (::setsockopt(fd_, IPPROTO_IP, IP_ADD_MEMBERSHIP, &membership, sizeof(membership)) != 0) {
+                close();
+                return false;
+            }
+        }
+
+        const int flags = SOF_TIMESTAMPING_RX_SOFTWARE | SOF_TIMESTAMPING_SOFTWARE;
+        timestampMode_ = "none";
+        if (::setsockopt(fd_, SOL_SOCKET, SO_TIMESTAMPING, &flags, sizeof(flags)) == 0) {
+            timestampMode_ = "SO_TIMESTAMPING";
+        } else if (::setsockopt(fd_, SOL_SOCKET, SO_TIMESTAMPNS, &enable, sizeof(enable)) == 0) {
+            timestampMode_ = "SO_TIMESTAMPNS";
+        }
+        return true;
+    }
+
+    /// @brief Not supported (receive-only socket)
+    [[nodiscard]] bool send(const std::vector<uint8_t>& data) override {
+        static_cast<void>(data);
+        return false;
+    }
+
+    /// @brief Not supported (receive-only socket)
+    [[nodiscard]] bool send(const std::vector<uint8_t>& data, const std::string& group) override {
+        static_cast<void>(data);
+        static_cast<void>(group);
+        return false;
+    }
+
+    [[nodiscard]] std::optional<std::vector<uint8_t>> receive(int32_t timeoutMs) override {
+        ReceivedFrame frame;
+        if (!receiveFrame(frame, timeoutMs)) {
+            return std::nullopt;
+        }
+        return std::vector<uint8_t>(frame.data(), frame.data() + frame.size());
+    }
+
+    /**
+     * @brief Receive the next datagram of our group, stamped with its arrival time
+     * @details The frame views the socket buffer (no copy, no releaser)
+     */
+    [[nodiscard]] bool receiveFrame(ReceivedFrame& frame, int32_t timeoutMs) override {
+        frame.reset();
+        if (fd_ < 0) {
+            return false;
+        }
+        if (tryReceive(frame)) {
+            return true;
+        }
+        pollfd item{fd_, POLLIN, 0};
+        if (::poll(&item, 1U, timeoutMs) <= 0) {
+            return false;
+        }
+        return tryReceive(frame);
+    }
+
+    void close() noexcept override {
+        if (fd_ >= 0) {
+            static_cast<void>(::close(fd_));
+            fd_ = -1;
+        }
+    }
+
+    [[nodiscard]] bool isConnected() const noexcept override {
+        return fd_ >= 0;
+    }
+
+    [[nodiscard]] std::string getSocketType() const noexcept override {
+        return "UDP_TIMESTAMPING";
+    }
+
+    /// @brief "SO_TIMESTAMPING", "SO_TIMESTAMPNS" or "none"
+    [[nodiscard]] const char* timestampModeName() const noexcept {
+        return timestampMode_;
+    }
+
+    /// @brief Datagrams skipped (other group or malformed header)
+    [[nodiscard]] uint64_t skippedCount() const noexcept {
+        return skipped_;
+    }
+
+    /**
+     * @brief Parse "udp://a.b.c.d:port"
+     */
+    static bool parseEndpoint(const std::string& endpoint, sockaddr_in& address) {
+        static const std::string scheme{"udp://"};
+        if (endpoint.compare(0U, scheme.size(), scheme) != 0) {
+            return false;
+        }
+        const std::size_t colon = endpoint.rfind(':');
+        if ((colon == std::string::npos) || (colon <= scheme.size())) {
+            return false;
+        }
+        const std::string host = endpoint.substr(scheme.size(), colon - scheme.size());
+        const std::string portText = endpoint.substr(colon + 1U);
+        if (portText.empty() || (portText.find_first_not_of("0123456789") != std::string::npos) ||
+            (portText.size() > 5U)) {
+            return false;
+        }
+        const unsigned long port = std::stoul(portText);
+        if ((port == 0UL) || (port > 65535UL)) {
+            return false;
+        }
+        address = sockaddr_in{};
+        address.sin_family = AF_INET;
+        address.sin_port = htons(static_cast<uint16_t>(port));
+        return ::inet_pton(AF_INET, host.c_str(), &address.sin_addr) == 1;
+    }
+
+private:
+    /**
+     * @brief Drain pending datagrams until one of our group is found
+     * @return false if nothing of our group was pending
+     */
+    bool tryReceive(ReceivedFrame& frame) {
+        for (;;) {
+            iovec vector{buffer_.data(), buffer_.size()};
+            alignas(cmsghdr) char control[256];
+            msghdr message{};
+            message.msg_iov = &vector;
+            message.msg_iovlen = 1U;
+            message.msg_control = control;
+            message.msg_controllen = sizeof(control);
+
+            const ssize_t received = ::recvmsg(fd_, &message, MSG_DONTWAIT);
+            if (received < 0) {
+                return false;
+            }
+
+            // [group length][group][body]
+            const std::size_t size = static_cast<std::size_t>(received);
+            const std::size_t groupSize = (size > 0U) ? buffer_[0U] : 0U;
+            if ((size < 1U) || ((1U + groupSize) > size) || (groupSize != group_.size()) ||
+                (std::memcmp(buffer_.data() + 1U, group_.data(), groupSize) != 0)) {
+                ++skipped_;
+                continue;
+            }
+
+            static_cast<void>(frame.prepareHandle());
+            frame.attach(buffer_.data() + 1U + groupSize, size - 1U - groupSize, nullptr);
+            frame.setKernelReceiveTime(kernelTimeUs(message));
+            return true;
+        }
+    }
+
+    static int64_t kernelTimeUs(msghdr& message) noexcept {
+        for (cmsghdr* header = CMSG_FIRSTHDR(&message); header != nullptr; header = CMSG_NXTHDR(&message, header)) {
+            if ((header->cmsg_level != SOL_SOCKET) ||
+                ((header->cmsg_type != SCM_TIMESTAMPING) && (header->cmsg_type != SCM_TIMESTAMPNS))) {
+                continue;
+            }
+            // SCM_TIMESTAMPING: ts[0] is the software timestamp
+            timespec stamp{};
+            std::memcpy(&stamp, CMSG_DATA(header), sizeof(stamp));
+            if ((stamp.tv_sec != 0) || (stamp.tv_nsec != 0)) {
+                return (static_cast<int64_t>(stamp.tv_sec) * 1000000LL) + (static_cast<int64_t>(stamp.tv_nsec) / 1000LL);
+            }
+        }
+        return 0;
+    }
+
+    int fd_{-1};                             ///< UDP socket
+    std::string group_;                      ///< Accepted RADIO group
+    std::vector<uint8_t> buffer_;            ///< Datagram buffer (frames view into it)
+    const char* timestampMode_{"none"};      ///< Enabled kernel timestamping
+    uint64_t skipped_{0U};                   ///< Skipped datagrams
+};
+
+} // namespace messaging
+} // namespace common
+} // namespace adapters
+
+#endif // A_HEXAGON_ADAPTERS_COMMON_MESSAGING_UDP_TIMESTAMPING_SOCKET_HPP
@@ -1,7 +1,9 @@
 /**
  * @file ZeroMQSocket.cpp
  * @brief ZeroMQ concrete implementation of IMessageSocket
- * @details Thread-safe wrapper around zmq::socket_t with RAII resource management
+ * @details Thread-safe wrapper around zmq::socket_t with RAII resource management.
+ *          ThreadOwned mode keeps the mutex off the data path: the I/O thread
+ *          owns the socket, other threads post commands to a lock-free mailbox.
  * 
  * @author a_hexagon Team
  * @version 1.0
@@ -11,11 +13,19 @@
  */
 
 #include "ZeroMQSocket.hpp"
-#include "utils/Logger.hpp"
+#include "ZmqContextRegistry.hpp"
 #include "utils/Logger.hpp"
 
+#include <chrono>
 #include <cstring>
+#include <new>
 #include <stdexcept>
+#include <thread>
+
+#ifdef __linux__
+#include <sys/eventfd.h>
+#include <unistd.h>
+#endif
 
 namespace adapters {
 namespace common {
@@ -37,12 +47,13 @@ namespace {
 
 // ==================== SocketType Enum Constructor ====================
 
-ZeroMQSocket::ZeroMQSocket(SocketType socketType, int ioThreads)
+ZeroMQSocket::ZeroMQSocket(SocketType socketType, std::shared_ptr<zmq::context_t> context)
     : socketType_{socketTypeEnumToZmq(socketType)}
     , mode_{ConnectionMode::Connect}  // Default, can be changed via connect() overload
 {
     try {
-        context_ = std::make_unique<zmq::context_t>(ioThreads);
+        context_ = context ? std::move(context) : ZmqContextRegistry::instance().acquire();
+        initWakeFd();
         LOG_DEBUG("ZeroMQSocket created - type: {}", getSocketTypeName());
     } catch (const zmq::error_t& e) {
         LOG_ERROR("Failed to create ZeroMQ context: {}", e.what());
@@ -52,12 +63,13 @@ ZeroMQSocket::ZeroMQSocket(SocketType socketType, int ioThreads)
 
 // ==================== Legacy Int Constructor ====================
 
-ZeroMQSocket::ZeroMQSocket(int socketType, ConnectionMode mode, int ioThreads)
+ZeroMQSocket::ZeroMQSocket(int socketType, ConnectionMode mode, std::shared_ptr<zmq::context_t> context)
     : socketType_{socketType}
     , mode_{mode}
 {
     try {
-        context_ = std::make_unique<zmq::context_t>(ioThreads);
+        context_ = context ? std::move(context) : ZmqContextRegistry::instance().acquire();
+        initWakeFd();
         LOG_DEBUG("ZeroMQSocket created - type: {}, mode: {}", 
                   getSocketTypeName(),
                   (mode_ == ConnectionMode::Connect) ? "Connect" : "Bind");
@@ -69,9 +81,138 @@ ZeroMQSocket::ZeroMQSocket(int socketType, ConnectionMode mode, int ioThreads)
 
 ZeroMQSocket::~ZeroMQSocket() {
     close();
+#ifdef __linux__
+    if (wakeFd_ >= 0) {
+        static_cast<void>(::close(wakeFd_));
+    }
+#endif
     LOG_DEBUG("ZeroMQSocket destroyed");
 }
 
+// ==================== Threading Model ====================
+
+void ZeroMQSocket::setThreadingModel(ThreadingModel model) noexcept {
+    threadingModel_ = model;
+}
+
+ZeroMQSocket::ThreadingModel ZeroMQSocket::getThreadingModel() const noexcept {
+    return threadingModel_;
+}
+
+void ZeroMQSocket::initWakeFd() noexcept {
+#ifdef __linux__
+    wakeFd_ = ::eventfd(0U, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (wakeFd_ < 0) {
+        LOG_WARN("eventfd unavailable - owner thread wakes only on receive timeout");
+    }
+#endif
+}
+
+void ZeroMQSocket::wakeReceiver() noexcept {
+#ifdef __linux__
+    if (wakeFd_ >= 0) {
+        const uint64_t one = 1U;
+        static_cast<void>(::write(wakeFd_, &one, sizeof(one)));
+    }
+#endif
+}
+
+void ZeroMQSocket::consumeWake() noexcept {
+#ifdef __linux__
+    if (wakeFd_ >= 0) {
+        uint64_t count = 0U;
+        static_cast<void>(::read(wakeFd_, &count, sizeof(count)));
+    }
+#endif
+}
+
+bool ZeroMQSocket::isOwnerThread() const noexcept {
+    return (threadingModel_ == ThreadingModel::ThreadOwned) &&
+           (ownerThread_.load(std::memory_order_acquire) == std::this_thread::get_id());
+}
+
+void ZeroMQSocket::attachIoThread() {
+    if (threadingModel_ != ThreadingModel::ThreadOwned) {
+        return;
+    }
+    
+    const std::thread::id self = std::this_thread::get_id();
+    // Serialised with control calls still taking the locked path
+    std::lock_guard<std::mutex> lock(mutex_);
+    const std::thread::id owner = ownerThread_.load(std::memory_order_relaxed);
+    if (owner == self) {
+        return;
+    }
+    if (owner != std::thread::id{}) {
+        LOG_WARN("ZeroMQ {} socket already has an I/O thread - attach ignored", getSocketTypeName());
+        return;
+    }
+    ownerThread_.store(self, std::memory_order_release);
+    LOG_DEBUG("ZeroMQ {} socket now owned by its I/O thread", getSocketTypeName());
+}
+
+void ZeroMQSocket::detachIoThread() noexcept {
+    if (!isOwnerThread()) {
+        return;
+    }
+    
+    try {
+        // Posting happens under mutex_, so nothing lands in the mailbox after
+        // this drain; later callers take the locked path
+        std::lock_guard<std::mutex> lock(mutex_);
+        drainCommands();
+        ownerThread_.store(std::thread::id{}, std::memory_order_release);
+        LOG_DEBUG("ZeroMQ {} socket released by its I/O thread", getSocketTypeName());
+    } catch (...) {
+        // Suppress exceptions in detach
+    }
+}
+
+bool ZeroMQSocket::hasForeignOwner() const noexcept {
+    const std::thread::id owner = ownerThread_.load(std::memory_order_acquire);
+    return (threadingModel_ == ThreadingModel::ThreadOwned) &&
+           (owner != std::thread::id{}) &&
+           (owner != std::this_thread::get_id());
+}
+
+bool ZeroMQSocket::enterOwnerIo() noexcept {
+    // Dekker-style handshake with close(): either close() sees ioActive_ and
+    // waits, or we see closeRequested_ and stay off the socket.
+    ioActive_.store(true, std::memory_order_seq_cst);
+    if (closeRequested_.load(std::memory_order_seq_cst) || !connected_.load()) {
+        ioActive_.store(false, std::memory_order_release);
+        return false;
+    }
+    return true;
+}
+
+void ZeroMQSocket::leaveOwnerIo() noexcept {
+    ioActive_.store(false, std::memory_order_release);
+}
+
+void ZeroMQSocket::postCommand(Command&& command) {
+    mailbox_.push(std::move(command));
+    wakeReceiver();
+}
+
+void ZeroMQSocket::drainCommands() {
+    while (auto command = mailbox_.tryPop()) {
+        switch (command->type) {
+            case Command::Type::Subscribe:
+                subscribeNow(command->text);
+                break;
+            case Command::Type::JoinGroup:
+                joinGroupNow(command->text);
+                break;
+            case Command::Type::Send:
+                static_cast<void>(sendNow(command->payload, command->text));
+                break;
+            default:
+                break;
+        }
+    }
+}
+
 // ==================== Connect Methods ====================
 
 bool ZeroMQSocket::connect(const std::string& endpoint) {
@@ -88,6 +229,7 @@ bool ZeroMQSocket::connect(const std::string& endpoint, ConnectionMode mode) {
     
     try {
         socket_ = std::make_unique<zmq::socket_t>(*context_, socketType_);
+        currentRcvTimeoutMs_ = INT32_MIN;
         
         // Set common socket options
         socket_->set(zmq::sockopt::linger, 0);
@@ -103,6 +245,8 @@ bool ZeroMQSocket::connect(const std::string& endpoint, ConnectionMode mode) {
         
         endpoint_ = endpoint;
         mode_ = mode;
+        ownerThread_.store(std::thread::id{}, std::memory_order_release);
+        closeRequested_.store(false, std::memory_order_seq_cst);
         connected_.store(true);
         return true;
         
@@ -118,13 +262,41 @@ bool ZeroMQSocket::send(const std::vector<uint8_t>& data) {
 }
 
 bool ZeroMQSocket::send(const std::vector<uint8_t>& data, const std::string& group) {
+    return sendFromAnyThread(data, group);
+}
+
+bool ZeroMQSocket::send(std::vector<uint8_t>&& data, const std::string& group) {
+    return sendFromAnyThread(std::move(data), group);
+}
+
+template <typename Payload>
+bool ZeroMQSocket::sendFromAnyThread(Payload&& data, const std::string& group) {
     if (!connected_.load()) {
         LOG_WARN("Cannot send - socket not connected");
         return false;
     }
     
-    std::lock_guard<std::mutex> lock(mutex_);
+    if (isOwnerThread()) {
+        if (!enterOwnerIo()) {
+            return false;
+        }
+        drainCommands();
+        const bool sent = sendNow(data, group);
+        leaveOwnerIo();
+        return sent;
+    }
     
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (hasForeignOwner()) {
+        // Only the owning thread touches the socket; hand the frame over
+        // (moved when the caller gave up the payload, copied otherwise)
+        postCommand(Command{Command::Type::Send, group, std::forward<Payload>(data)});
+        return true;
+    }
+    return sendNow(data, group);
+}
+
+bool ZeroMQSocket::sendNow(const std::vector<uint8_t>& data, const std::string& group) {
     if (!socket_) {
         LOG_WARN("Cannot send - socket is null");
         return false;
@@ -162,6 +334,14 @@ std::optional<std::vector<uint8_t>> ZeroMQSocket::receive(int32_t timeoutMs) {
         return std::nullopt;
     }
     
+    if (threadingModel_ == ThreadingModel::ThreadOwned) {
+        ReceivedFrame frame;
+        if (!receiveFrame(frame, timeoutMs)) {
+            return std::nullopt;
+        }
+        return std::vector<uint8_t>(frame.data(), frame.data() + frame.size());
+    }
+    
     std::lock_guard<std::mutex> lock(mutex_);
     
     if (!socket_) {
@@ -171,7 +351,7 @@ std::optional<std::vector<uint8_t>> ZeroMQSocket::receive(int32_t timeoutMs) {
     
     try {
         // Set receive timeout
-        socket_->set(zmq::sockopt::rcvtimeo, timeoutMs);
+        applyReceiveTimeout(timeoutMs);
         
         zmq::message_t message;
         auto result = socket_->recv(message, zmq::recv_flags::none);
@@ -198,7 +378,169 @@ std::optional<std::vector<uint8_t>> ZeroMQSocket::receive(int32_t timeoutMs) {
     }
 }
 
+bool ZeroMQSocket::receiveFrame(ReceivedFrame& frame, int32_t timeoutMs) {
+    static_assert(sizeof(zmq::message_t) <= ReceivedFrame::HANDLE_STORAGE_SIZE,
+                  "zmq::message_t must fit in ReceivedFrame handle storage");
+    
+    if (!connected_.load()) {
+        LOG_WARN("Cannot receive - socket not connected");
+        frame.reset();
+        return false;
+    }
+    
+    if (hasForeignOwner()) {
+        LOG_WARN("Cannot receive - socket is owned by another thread");
+        frame.reset();
+        return false;
+    }
+    
+    if (isOwnerThread()) {
+        if (!enterOwnerIo()) {
+            frame.reset();
+            return false;
+        }
+        const bool received = receiveOwned(frame, timeoutMs);
+        leaveOwnerIo();
+        return received;
+    }
+    
+    std::lock_guard<std::mutex> lock(mutex_);
+    
+    if (!socket_) {
+        LOG_WARN("Cannot receive - socket is null");
+        frame.reset();
+        return false;
+    }
+    
+    // The message lives inside the frame; its buffer is lent to the caller
+    // and released when the frame is reset or reused.
+    auto* message = new (frame.prepareHandle()) zmq::message_t();
+    
+    try {
+        applyReceiveTimeout(timeoutMs);
+        
+        auto result = socket_->recv(*message, zmq::recv_flags::none);
+        
+        if (!result.has_value()) {
+            // Timeout - normal condition, don't log
+            message->~message_t();
+            return false;
+        }
+        
+        frame.attach(static_cast<const uint8_t*>(message->data()), message->size(),
+                     [](void* handle) noexcept {
+                         static_cast<zmq::message_t*>(handle)->~message_t();
+                     });
+        
+        LOG_TRACE("Received {} bytes via ZeroMQ (zero-copy)", frame.size());
+        return true;
+        
+    } catch (const zmq::error_t& e) {
+        message->~message_t();
+        if (e.num() == EAGAIN || e.num() == ETIMEDOUT) {
+            return false;
+        }
+        LOG_ERROR("ZeroMQ receive failed: {}", e.what());
+        return false;
+    }
+}
+
+bool ZeroMQSocket::receiveOwned(ReceivedFrame& frame, int32_t timeoutMs) {
+    drainCommands();
+    
+    if (!socket_) {
+        frame.reset();
+        return false;
+    }
+    
+    auto* message = new (frame.prepareHandle()) zmq::message_t();
+    
+    try {
+        zmq::recv_result_t result;
+        if (wakeFd_ < 0) {
+            // Nothing else to wait on: a single blocking recv, rcvtimeo set only when it changes
+            applyReceiveTimeout(timeoutMs);
+            result = socket_->recv(*message, zmq::recv_flags::none);
+        } else {
+            // A queued message costs one recv; poll only when the socket is empty
+            result = socket_->recv(*message, zmq::recv_flags::dontwait);
+            if (!result.has_value() && waitReadable(timeoutMs)) {
+                result = socket_->recv(*message, zmq::recv_flags::dontwait);
+            }
+        }
+        
+        if (!result.has_value()) {
+            message->~message_t();
+            return false;
+        }
+        
+        frame.attach(static_cast<const uint8_t*>(message->data()), message->size(),
+                     [](void* handle) noexcept {
+                         static_cast<zmq::message_t*>(handle)->~message_t();
+                     });
+        
+        LOG_TRACE("Received {} bytes via ZeroMQ (owner thread)", frame.size());
+        return true;
+        
+    } catch (const zmq::error_t& e) {
+        message->~message_t();
+        if (e.num() == EAGAIN || e.num() == EINTR) {
+            return false;
+        }
+        LOG_ERROR("ZeroMQ receive failed: {}", e.what());
+        return false;
+    }
+}
+
+bool ZeroMQSocket::waitReadable(int32_t timeoutMs) {
+    // Wait on the socket and the wake fd together so close()/commands
+    // interrupt the wait immediately
+    zmq::pollitem_t items[2] = {
+        {socket_->handle(), 0, ZMQ_POLLIN, 0},
+        {nullptr, wakeFd_, ZMQ_POLLIN, 0}
+    };
+    static_cast<void>(zmq::poll(items, 2U, std::chrono::milliseconds(timeoutMs)));
+    
+    if ((items[1].revents & ZMQ_POLLIN) != 0) {
+        consumeWake();
+        drainCommands();
+    }
+    return (items[0].revents & ZMQ_POLLIN) != 0;
+}
+
+void ZeroMQSocket::applyReceiveTimeout(int32_t timeoutMs) {
+    if (timeoutMs != currentRcvTimeoutMs_) {
+        socket_->set(zmq::sockopt::rcvtimeo, timeoutMs);
+        currentRcvTimeoutMs_ = timeoutMs;
+    }
+}
+
 void ZeroMQSocket::close() noexcept {
+    bool waitForOwner = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (hasForeignOwner()) {
+            // Ask the owner to stay off the socket and wake it
+            closeRequested_.store(true, std::memory_order_seq_cst);
+            wakeReceiver();
+            waitForOwner = true;
+        }
+    }
+    
+    // Wait without mutex_ so foreign commands are not stalled behind the
+    // owner's current I/O call (bounded by one message, not the timeout)
+    if (waitForOwner) {
+        uint32_t spins = 0U;
+        while (ioActive_.load(std::memory_order_seq_cst)) {
+            if (spins < CLOSE_SPINS_BEFORE_SLEEP) {
+                ++spins;
+            } else {
+                std::this_thread::sleep_for(std::chrono::microseconds(CLOSE_WAIT_SLEEP_US));
+            }
+        }
+    }
+    
+    // Holding mutex_ also blocks a not-yet-owner thread from claiming the socket
     std::lock_guard<std::mutex> lock(mutex_);
     
     if (!connected_.load()) {
@@ -230,6 +572,14 @@ std::string ZeroMQSocket::getSocketType() const noexcept {
 void ZeroMQSocket::subscribe(const std::string& filter) {
     std::lock_guard<std::mutex> lock(mutex_);
     
+    if (hasForeignOwner()) {
+        postCommand(Command{Command::Type::Subscribe, filter, {}});
+        return;
+    }
+    subscribeNow(filter);
+}
+
+void ZeroMQSocket::subscribeNow(const std::string& filter) {
     if (!socket_) {
         LOG_WARN("Cannot subscribe - socket not initialized");
         return;
@@ -251,6 +601,14 @@ void ZeroMQSocket::subscribe(const std::string& filter) {
 void ZeroMQSocket::joinGroup(const std::string& group) {
     std::lock_guard<std::mutex> lock(mutex_);
     
+    if (hasForeignOwner()) {
+        postCommand(Command{Command::Type::JoinGroup, group, {}});
+        return;
+    }
+    joinGroupNow(group);
+}
+
+void ZeroMQSocket::joinGroupNow(const std::string& group) {
     if (!socket_) {
         LOG_WARN("Cannot join group - socket not initialized");
         return;
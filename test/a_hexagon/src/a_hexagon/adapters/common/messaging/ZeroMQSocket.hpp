@@ -16,6 +16,7 @@
 #define A_HEXAGON_ADAPTERS_COMMON_MESSAGING_ZEROMQ_SOCKET_HPP
 
 #include "IMessageSocket.hpp"
+#include "utils/MpscQueue.hpp"
 
 // ZMQ Draft API must be enabled before including zmq.hpp
 #include "zmq_config.hpp"
@@ -24,6 +25,8 @@
 #include <atomic>
 #include <string>
 #include <mutex>
+#include <thread>
+#include <vector>
 
 // ZMQ_DISH/ZMQ_RADIO draft API fallback
 #ifndef ZMQ_DISH
@@ -49,6 +52,19 @@ namespace messaging {
  * - ZMQ_DISH: UDP multicast subscribe (Draft API)
  * - ZMQ_RADIO: UDP multicast publish (Draft API)
  * 
+ * Threading models:
+ * - Shared      : every operation takes mutex_ (default, any thread may call)
+ * - ThreadOwned : the thread that calls attachIoThread() owns the socket and
+ *                 runs without locks. subscribe()/joinGroup()/send() from other
+ *                 threads are posted to a lock-free mailbox that the owner drains;
+ *                 close() and wakeReceiver() interrupt a blocked receive at once.
+ *                 Ownership is explicit: before attachIoThread() and after
+ *                 detachIoThread() (which runs pending commands) the socket
+ *                 behaves as Shared, so no thread holds it by accident.
+ *
+ * Sockets share the process-wide context from ZmqContextRegistry unless one is
+ * injected, so the process runs one set of ZeroMQ I/O threads.
+ *
  * @invariant context_ is always valid after construction
  * @invariant socket_ is null until connect() succeeds
  */
@@ -64,6 +80,14 @@ public:
         RADIO   ///< UDP multicast publish (Draft API)
     };
 
+    /**
+     * @brief Which threads may operate on the socket
+     */
+    enum class ThreadingModel {
+        Shared,      ///< Mutex-protected, callable from any thread
+        ThreadOwned  ///< Owned by one I/O thread, others use the command mailbox
+    };
+
     /**
      * @brief Connection mode for socket
      */
@@ -75,19 +99,20 @@ public:
     /**
      * @brief Construct ZeroMQ socket with specified type (enum version - preferred)
      * @param socketType Socket type enum
-     * @param ioThreads Number of IO threads (default: 1)
+     * @param context ZeroMQ context (default: process-wide shared context)
      */
-    explicit ZeroMQSocket(SocketType socketType, int ioThreads = 1);
+    explicit ZeroMQSocket(SocketType socketType,
+                          std::shared_ptr<zmq::context_t> context = nullptr);
 
     /**
      * @brief Construct ZeroMQ socket with specified type (int version - legacy)
      * @param socketType ZeroMQ socket type (ZMQ_SUB, ZMQ_PUB, ZMQ_DISH, ZMQ_RADIO)
      * @param mode Connection mode (Connect or Bind)
-     * @param ioThreads Number of IO threads (default: 1)
+     * @param context ZeroMQ context (default: process-wide shared context)
      */
     explicit ZeroMQSocket(int socketType, 
                           ConnectionMode mode = ConnectionMode::Connect,
-                          int ioThreads = 1);
+                          std::shared_ptr<zmq::context_t> context = nullptr);
 
     /**
      * @brief Destructor - closes socket and releases resources
@@ -118,6 +143,14 @@ public:
      */
     [[nodiscard]] bool send(const std::vector<uint8_t>& data, const std::string& group) override;
 
+    /**
+     * @brief Send binary message with group, taking the payload
+     * @param data Raw bytes to send (moved into the mailbox from foreign threads)
+     * @param group Group name (for RADIO socket)
+     * @return true on success, false on failure
+     */
+    [[nodiscard]] bool send(std::vector<uint8_t>&& data, const std::string& group) override;
+
     /**
      * @brief Receive binary message with timeout
      * @param timeoutMs Timeout in milliseconds
@@ -125,6 +158,33 @@ public:
      */
     [[nodiscard]] std::optional<std::vector<uint8_t>> receive(int32_t timeoutMs) override;
 
+    /**
+     * @brief Receive message into a frame without copying the payload
+     * @param frame Frame that takes ownership of the zmq::message_t
+     * @param timeoutMs Timeout in milliseconds
+     * @return true if a message was received
+     */
+    [[nodiscard]] bool receiveFrame(ReceivedFrame& frame, int32_t timeoutMs) override;
+
+    /**
+     * @brief Interrupt a receive blocked in the owner thread
+     * @details Effective in ThreadOwned mode on Linux (eventfd); otherwise the
+     *          receive returns on its timeout.
+     */
+    void wakeReceiver() noexcept override;
+
+    /**
+     * @brief Make the calling thread the owner (ThreadOwned mode)
+     * @details Ignored in Shared mode; refused while another thread is attached.
+     */
+    void attachIoThread() override;
+
+    /**
+     * @brief Run pending mailbox commands and release ownership
+     * @details No effect unless called by the attached thread.
+     */
+    void detachIoThread() noexcept override;
+
     /**
      * @brief Close socket
      */
@@ -164,6 +224,19 @@ public:
      */
     void joinGroup(const std::string& group);
 
+    /**
+     * @brief Select threading model
+     * @param model Threading model
+     * @pre Called before the I/O thread starts
+     */
+    void setThreadingModel(ThreadingModel model) noexcept;
+
+    /**
+     * @brief Get threading model
+     * @return Current threading model
+     */
+    [[nodiscard]] ThreadingModel getThreadingModel() const noexcept;
+
     // Delete copy/move for thread safety
     ZeroMQSocket(const ZeroMQSocket&) = delete;
     ZeroMQSocket& operator=(const ZeroMQSocket&) = delete;
@@ -177,13 +250,69 @@ private:
      */
     [[nodiscard]] std::string getSocketTypeName() const noexcept;
 
-    std::unique_ptr<zmq::context_t> context_;   ///< ZeroMQ context
+    /**
+     * @brief Apply receive timeout only when it changed
+     * @param timeoutMs Timeout in milliseconds
+     * @pre mutex_ held (or owner thread) and socket_ non-null
+     */
+    void applyReceiveTimeout(int32_t timeoutMs);
+
+    // close() waiting for the owner to leave its I/O call: spin, then sleep
+    // (yield() would not let a lower-priority owner run under SCHED_FIFO)
+    static constexpr uint32_t CLOSE_SPINS_BEFORE_SLEEP = 128U;
+    static constexpr int64_t CLOSE_WAIT_SLEEP_US = 50;
+
+    /**
+     * @brief Control command executed by the owner thread
+     */
+    struct Command {
+        enum class Type : uint8_t {
+            Subscribe,
+            JoinGroup,
+            Send
+        };
+        Type type{Type::Send};
+        std::string text;              ///< Filter, group name or send group
+        std::vector<uint8_t> payload;  ///< Send payload
+    };
+
+    // Shared send path: Payload is a const or rvalue vector reference and is
+    // forwarded into the mailbox command when a foreign thread sends
+    template <typename Payload>
+    [[nodiscard]] bool sendFromAnyThread(Payload&& data, const std::string& group);
+
+    // Operations without locking (caller holds mutex_ or owns the socket)
+    [[nodiscard]] bool sendNow(const std::vector<uint8_t>& data, const std::string& group);
+    void subscribeNow(const std::string& filter);
+    void joinGroupNow(const std::string& group);
+    [[nodiscard]] bool receiveOwned(ReceivedFrame& frame, int32_t timeoutMs);
+    [[nodiscard]] bool waitReadable(int32_t timeoutMs);
+
+    // ThreadOwned support
+    [[nodiscard]] bool isOwnerThread() const noexcept;
+    [[nodiscard]] bool hasForeignOwner() const noexcept;
+    [[nodiscard]] bool enterOwnerIo() noexcept;
+    void leaveOwnerIo() noexcept;
+    void postCommand(Command&& command);
+    void drainCommands();
+    void initWakeFd() noexcept;
+    void consumeWake() noexcept;
+
+    std::shared_ptr<zmq::context_t> context_;   ///< Shared ZeroMQ context (outlives socket_)
     std::unique_ptr<zmq::socket_t> socket_;     ///< ZeroMQ socket
     int socketType_;                             ///< Socket type (ZMQ_SUB, ZMQ_PUB, etc.)
     ConnectionMode mode_;                        ///< Connect or Bind mode
     std::atomic<bool> connected_{false};         ///< Connection state
     std::string endpoint_;                       ///< Current endpoint
-    mutable std::mutex mutex_;                   ///< Thread safety mutex
+    int32_t currentRcvTimeoutMs_{INT32_MIN};     ///< Last applied rcvtimeo (skips redundant setsockopt)
+    mutable std::mutex mutex_;                   ///< Thread safety mutex (Shared mode / control path)
+    
+    ThreadingModel threadingModel_{ThreadingModel::Shared};  ///< Threading model
+    std::atomic<std::thread::id> ownerThread_{};            ///< Owning I/O thread (ThreadOwned)
+    std::atomic<bool> ioActive_{false};          ///< Owner is inside an I/O call
+    std::atomic<bool> closeRequested_{false};    ///< close() pending from another thread
+    utils::MpscQueue<Command> mailbox_;          ///< Commands for the owner thread
+    int wakeFd_{-1};                             ///< eventfd interrupting owner polls (-1 if none)
 };
 
 } // namespace messaging
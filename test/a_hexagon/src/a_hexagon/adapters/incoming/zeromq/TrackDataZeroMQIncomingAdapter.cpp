@@ -16,6 +16,7 @@
 #include "adapters/incoming/zeromq/TrackDataZeroMQIncomingAdapter.hpp"
 #include "adapters/common/messaging/ZeroMQSocket.hpp"
 #include "utils/Logger.hpp"
+#include "utils/EventLog.hpp"
 
 #include <iostream>
 #include <cstring>
@@ -105,6 +106,8 @@ bool TrackDataZeroMQIncomingAdapter::initializeSocket() {
             ZMQ_DISH,
             adapters::common::messaging::ZeroMQSocket::ConnectionMode::Bind
         );
+        zmqSocket->setThreadingModel(
+            adapters::common::messaging::ZeroMQSocket::ThreadingModel::ThreadOwned);
         
         socket_ = std::move(zmqSocket);
         
@@ -208,6 +211,11 @@ void TrackDataZeroMQIncomingAdapter::stop() {
     stopRequested_.store(true);
     running_.store(false);
     
+    // Interrupt a blocked receive so shutdown does not wait for the timeout
+    if (socket_) {
+        socket_->wakeReceiver();
+    }
+    
     // Wait for receive thread to finish
     if (receiveThread_.joinable()) {
         receiveThread_.join();
@@ -235,40 +243,51 @@ std::string TrackDataZeroMQIncomingAdapter::getName() const noexcept {
 void TrackDataZeroMQIncomingAdapter::receiveLoop() {
     LOG_DEBUG("Receive loop started");
     
+    // Reused across receives: the frame lends the socket's buffer (no heap copy)
+    adapters::common::messaging::ReceivedFrame frame;
+    
+    // This thread does all socket I/O until it exits
+    socket_->attachIoThread();
+    
     while (!stopRequested_.load()) {
         try {
             // Receive via abstracted socket
-            auto result = socket_->receive(receiveTimeout_);
-            
-            if (result.has_value() && !result->empty()) {
-                // Record receive timestamp for latency calculation
-                auto receive_time = std::chrono::duration_cast<std::chrono::microseconds>(
-                    std::chrono::high_resolution_clock::now().time_since_epoch()).count();
-                
-                const auto& data = result.value();
+            if (socket_->receiveFrame(frame, receiveTimeout_) && !frame.empty()) {
+                // Record receive timestamp for latency calculation: the kernel
+                // arrival time when the socket provides one, else user space now
+                const int64_t kernel_time = frame.kernelReceiveTimeUs();
+                auto receive_time = (kernel_time > 0) ? kernel_time
+                    : std::chrono::duration_cast<std::chrono::microseconds>(
+                          std::chrono::high_resolution_clock::now().time_since_epoch()).count();
+                metricReceived_.add();
+                metricBytes_.add(frame.size());
                 
-                // Deserialize using model's built-in deserialization
+                // Deserialize straight from the received frame
                 domain::model::TrackData trackData;
-                if (trackData.deserialize(data)) {
+                if (trackData.deserialize(frame.data(), frame.size())) {
                     if (trackData.isValid() && incomingPort_) {
                         // Calculate latency
                         auto latency_us = receive_time - trackData.getOriginalUpdateTime();
                         
-                        LOG_INFO("[a_hexagon] TrackData received - TrackID: {}, Size: {} bytes", 
-                                 trackData.getTrackId(), data.size());
+                        LOG_INFO_EVERY_MS(RECEIVE_LOG_INTERVAL_MS, "[a_hexagon] TrackData received - TrackID: {}, Size: {} bytes", 
+                                 trackData.getTrackId(), frame.size());
                         
                         // Log latency metrics (async, ~20ns overhead)
                         utils::Logger::logTrackReceived(trackData.getTrackId(), latency_us);
+                        utils::EventLog::instance().record(utils::EventId::TrackReceived, trackData.getTrackId(),
+                                                           latency_us, static_cast<int64_t>(frame.size()));
                         
                         // Forward to domain service via hexagonal architecture port
                         incomingPort_->processAndForwardTrackData(trackData);
                         
                         LOG_TRACE("Processed TrackData - ID: {}", trackData.getTrackId());
                     } else {
+                        metricInvalid_.add();
                         LOG_WARN("Invalid TrackData received or incoming port null");
                     }
                 } else {
-                    LOG_WARN("Failed to deserialize TrackData message ({} bytes)", data.size());
+                    metricDecodeFailures_.add();
+                    LOG_WARN("Failed to deserialize TrackData message ({} bytes)", frame.size());
                 }
             }
             // Timeout is normal, just continue loop
@@ -282,6 +301,7 @@ void TrackDataZeroMQIncomingAdapter::receiveLoop() {
         }
     }
     
+    socket_->detachIoThread();
     LOG_DEBUG("Receive loop ended");
 }
 
@@ -33,6 +33,7 @@
 #include "adapters/common/messaging/IMessageSocket.hpp"
 #include "domain/ports/incoming/ITrackDataIncomingPort.hpp"
 #include "domain/ports/TrackData.hpp"
+#include "utils/Metrics.hpp"
 
 #include <thread>
 #include <atomic>
@@ -179,11 +180,18 @@ private:
     // Flag to track if we own the socket (for legacy constructors)
     bool ownsSocket_{false};
 
+    // Process-wide metrics (receive thread is the only writer)
+    utils::Metric& metricReceived_{utils::MetricsRegistry::instance().counter("incoming.received")};
+    utils::Metric& metricBytes_{utils::MetricsRegistry::instance().counter("incoming.bytes")};
+    utils::Metric& metricDecodeFailures_{utils::MetricsRegistry::instance().counter("incoming.decode_failures")};
+    utils::Metric& metricInvalid_{utils::MetricsRegistry::instance().counter("incoming.invalid")};
+
     // ==================== Socket Configuration Constants ====================
     // UDP Multicast with DISH socket (Draft API)
     static constexpr const char* DEFAULT_ENDPOINT{"udp://239.1.1.1:9000"};
     static constexpr const char* DEFAULT_GROUP{"TrackData"};
     static constexpr int32_t DEFAULT_RECEIVE_TIMEOUT{100};    ///< Receive timeout (ms)
+    static constexpr int64_t RECEIVE_LOG_INTERVAL_MS{1000};   ///< Per-message log sampling period
     
     // Thread Configuration
     static constexpr int32_t REALTIME_THREAD_PRIORITY{95};    ///< SCHED_FIFO priority
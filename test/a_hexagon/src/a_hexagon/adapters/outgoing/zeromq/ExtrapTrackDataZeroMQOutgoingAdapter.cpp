@@ -15,6 +15,8 @@
 #include "adapters/outgoing/zeromq/ExtrapTrackDataZeroMQOutgoingAdapter.hpp"
 #include "adapters/common/messaging/ZeroMQSocket.hpp"
 #include "utils/Logger.hpp"
+#include "utils/EventLog.hpp"
+#include "utils/WaitStrategy.hpp"
 
 #include <iostream>
 #include <sstream>
@@ -33,15 +35,18 @@ namespace zeromq {
 // ==================== DIP Compliant Constructor ====================
 
 ExtrapTrackDataZeroMQOutgoingAdapter::ExtrapTrackDataZeroMQOutgoingAdapter(
-    std::unique_ptr<adapters::common::messaging::IMessageSocket> socket)
+    std::unique_ptr<adapters::common::messaging::IMessageSocket> socket,
+    std::shared_ptr<utils::WaitStrategy> waitStrategy)
     : endpoint_("")
     , group_(DEFAULT_GROUP)
     , socket_(std::move(socket))
     , running_(false)
     , ready_(false)
-    , ownsSocket_(false) {  // Socket is already configured externally
+    , ownsSocket_(false)  // Socket is already configured externally
+    , messageQueue_(MAX_QUEUE_SIZE, std::move(waitStrategy)) {
     
-    LOG_INFO("ExtrapTrackDataZeroMQOutgoingAdapter created with injected socket (DIP)");
+    LOG_INFO("ExtrapTrackDataZeroMQOutgoingAdapter created with injected socket (DIP), {} wait",
+             messageQueue_.waitStrategy().name());
 }
 
 // ==================== Legacy Constructor ====================
@@ -87,6 +92,8 @@ bool ExtrapTrackDataZeroMQOutgoingAdapter::initializeSocket() {
         // Create ZeroMQSocket with RADIO type (PUB for TCP fallback)
         auto zmqSocket = std::make_unique<adapters::common::messaging::ZeroMQSocket>(
             adapters::common::messaging::ZeroMQSocket::SocketType::PUB);  // Use PUB for TCP
+        zmqSocket->setThreadingModel(
+            adapters::common::messaging::ZeroMQSocket::ThreadingModel::ThreadOwned);
         
         // Connect to endpoint
         if (!zmqSocket->connect(endpoint_, adapters::common::messaging::ZeroMQSocket::ConnectionMode::Connect)) {
@@ -123,6 +130,7 @@ bool ExtrapTrackDataZeroMQOutgoingAdapter::start() {
     
     running_.store(true);
     ready_.store(true);
+    messageQueue_.resetWake();
     
     // Start background publisher thread
     publisherThread_ = std::thread([this]() {
@@ -160,7 +168,7 @@ void ExtrapTrackDataZeroMQOutgoingAdapter::stop() {
     ready_.store(false);
     
     // Wake up the worker thread
-    queueCV_.notify_all();
+    messageQueue_.wakeConsumer();
     
     if (publisherThread_.joinable()) {
         publisherThread_.join();
@@ -186,6 +194,41 @@ std::string ExtrapTrackDataZeroMQOutgoingAdapter::getName() const noexcept {
     return "ExtrapTrackDataZeroMQOutgoingAdapter";
 }
 
+bool ExtrapTrackDataZeroMQOutgoingAdapter::setBatching(bool enabled,
+                                                       std::size_t mtuBudgetBytes,
+                                                       std::chrono::microseconds flushBudget) {
+    if (running_.load()) {
+        LOG_WARN("Batching cannot change while the adapter is running");
+        return false;
+    }
+    
+    if (!enabled) {
+        batchingEnabled_ = false;
+        batchWriter_.reset();
+        LOG_INFO("ExtrapTrackData batching disabled - one record per message");
+        return true;
+    }
+    
+    constexpr std::size_t recordSize = domain::model::ExtrapTrackData::kWireSize;
+    if (mtuBudgetBytes < (adapters::common::messaging::BATCH_FRAME_HEADER_SIZE + recordSize)) {
+        LOG_ERROR("Batch MTU budget {} bytes cannot hold one {}-byte record", mtuBudgetBytes, recordSize);
+        return false;
+    }
+    
+    batchWriter_ = std::make_unique<adapters::common::messaging::BatchFrameWriter>(mtuBudgetBytes);
+    batchRecordSize_ = static_cast<uint16_t>(recordSize);
+    batchFlushBudget_ = (flushBudget.count() > 0) ? flushBudget : std::chrono::microseconds(0);
+    batchingEnabled_ = true;
+    
+    LOG_INFO("ExtrapTrackData batching enabled - budget: {} bytes ({} records/frame), flush budget: {} us",
+             mtuBudgetBytes, batchWriter_->capacityFor(recordSize), batchFlushBudget_.count());
+    return true;
+}
+
+bool ExtrapTrackDataZeroMQOutgoingAdapter::isBatching() const noexcept {
+    return batchingEnabled_;
+}
+
 // ==================== Non-blocking Send (~20ns enqueue) ====================
 
 void ExtrapTrackDataZeroMQOutgoingAdapter::sendExtrapTrackData(
@@ -196,9 +239,7 @@ void ExtrapTrackDataZeroMQOutgoingAdapter::sendExtrapTrackData(
         return;
     }
     
-    for (const auto& item : data) {
-        enqueueMessage(item);
-    }
+    enqueueMessages(data.data(), data.size());
 }
 
 void ExtrapTrackDataZeroMQOutgoingAdapter::sendExtrapTrackData(
@@ -210,24 +251,32 @@ void ExtrapTrackDataZeroMQOutgoingAdapter::sendExtrapTrackData(
     }
     
     // Non-blocking enqueue (~20ns)
-    enqueueMessage(data);
+    enqueueMessages(&data, 1U);
 }
 
-void ExtrapTrackDataZeroMQOutgoingAdapter::enqueueMessage(
-    const domain::model::ExtrapTrackData& data) {
+void ExtrapTrackDataZeroMQOutgoingAdapter::enqueueMessages(
+    const domain::model::ExtrapTrackData* data, std::size_t count) {
+    if (count == 0U) {
+        return;
+    }
+    
+    std::size_t evicted = 0U;
+    activeProducers_.fetch_add(1U, std::memory_order_acq_rel);
     {
-        std::lock_guard<std::mutex> lock(queueMutex_);
+        std::lock_guard<utils::SpinLock> guard(producerLock_);
         
-        // Prevent unbounded queue growth
-        if (messageQueue_.size() >= MAX_QUEUE_SIZE) {
-            LOG_WARN("Message queue full, dropping oldest message");
-            messageQueue_.pop();
-        }
-        
-        messageQueue_.push(data);
+        // Bounded ring: evicts the oldest message when full. One wake-up per
+        // call, so the worker sees the whole tick rather than its first record
+        evicted = messageQueue_.pushBatch(data, count);
+        metricQueueDrops_.add(evicted);
     }
+    // Release: the worker sees every record of this call once the count drops
+    activeProducers_.fetch_sub(1U, std::memory_order_release);
     
-    queueCV_.notify_one();
+    if (evicted > 0U) {
+        utils::EventLog::instance().record(utils::EventId::QueueDrop, -1, static_cast<int64_t>(evicted));
+        LOG_WARN_EVERY_MS(DROP_LOG_INTERVAL_MS, "Message queue full, dropped {} oldest message(s)", evicted);
+    }
 }
 
 // ==================== Background Worker Thread ====================
@@ -235,54 +284,170 @@ void ExtrapTrackDataZeroMQOutgoingAdapter::enqueueMessage(
 void ExtrapTrackDataZeroMQOutgoingAdapter::publisherWorker() {
     LOG_DEBUG("Publisher worker started: ExtrapTrackDataAdapter");
     
+    // This thread does all socket I/O until it exits
+    socket_->attachIoThread();
+    
+    if (batchingEnabled_) {
+        publishBatches();
+        socket_->detachIoThread();
+        LOG_DEBUG("Publisher worker stopped: ExtrapTrackDataAdapter");
+        return;
+    }
+    
     while (running_.load()) {
-        domain::model::ExtrapTrackData data;
+        // Wait for messages with timeout (timeout lets us re-check running flag),
+        // then take everything pending up to one drain buffer with a single claim
+        const std::size_t count = messageQueue_.waitPopBatch(drainBuffer_.data(), drainBuffer_.size(),
+                                                             std::chrono::milliseconds(QUEUE_WAIT_TIMEOUT_MS));
+        for (std::size_t i = 0U; i < count; ++i) {
+            publishRecord(drainBuffer_[i]);
+        }
+    }
+    
+    socket_->detachIoThread();
+    LOG_DEBUG("Publisher worker stopped: ExtrapTrackDataAdapter");
+}
+
+void ExtrapTrackDataZeroMQOutgoingAdapter::publishRecord(
+    const domain::model::ExtrapTrackData& data) {
+    // Serialize and send (outside lock)
+    try {
+        // Encode into the reused worker buffer (no allocation per record)
+        if (data.serializeInto(sendBuffer_.data(), sendBuffer_.size()) == 0U) {
+            LOG_ERROR("Empty payload for track ID: {}", data.getTrackId());
+            return;
+        }
         
-        // Wait for message with timeout
-        {
-            std::unique_lock<std::mutex> lock(queueMutex_);
-            
-            if (queueCV_.wait_for(lock, std::chrono::milliseconds(100),
-                [this]() { return !messageQueue_.empty() || !running_.load(); })) {
-                
-                if (!running_.load()) {
-                    break;
-                }
-                
-                if (!messageQueue_.empty()) {
-                    data = std::move(messageQueue_.front());
-                    messageQueue_.pop();
-                } else {
-                    continue;
-                }
-            } else {
-                continue;  // Timeout, check running flag
-            }
+        // Send via IMessageSocket abstraction
+        if (socket_->send(sendBuffer_, group_)) {
+            metricSent_.add();
+            metricBytes_.add(sendBuffer_.size());
+            utils::EventLog::instance().record(utils::EventId::RecordSent, data.getTrackId(),
+                                               static_cast<int64_t>(sendBuffer_.size()));
+            LOG_DEBUG("[a_hexagon] ExtrapTrackData sent - TrackID: {}, Size: {} bytes", 
+                     data.getTrackId(), sendBuffer_.size());
+        } else {
+            metricSendFailures_.add();
+            utils::EventLog::instance().record(utils::EventId::SendFailed, data.getTrackId(), 1);
+            LOG_WARN("Failed to send ExtrapTrackData - TrackID: {}", data.getTrackId());
         }
         
-        // Serialize and send (outside lock)
-        try {
-            std::vector<uint8_t> binaryData = data.serialize();
-            
-            if (binaryData.empty()) {
-                LOG_ERROR("Empty payload for track ID: {}", data.getTrackId());
+    } catch (const std::exception& e) {
+        LOG_ERROR("Failed to send message: {}", e.what());
+    }
+}
+
+void ExtrapTrackDataZeroMQOutgoingAdapter::publishBatches() {
+    const bool perTick = (batchFlushBudget_.count() == 0);
+    const std::chrono::microseconds holdLimit = perTick
+        ? std::chrono::microseconds(BATCH_MAX_HOLD_US)
+        : batchFlushBudget_;
+    
+    // Records are taken from the ring a drain buffer at a time
+    const auto addDrained = [this](std::size_t count) {
+        for (std::size_t i = 0U; i < count; ++i) {
+            addToBatch(drainBuffer_[i]);
+        }
+    };
+    
+    while (running_.load()) {
+        std::size_t count = messageQueue_.waitPopBatch(drainBuffer_.data(), drainBuffer_.size(),
+                                                       std::chrono::milliseconds(QUEUE_WAIT_TIMEOUT_MS));
+        if (count == 0U) {
+            continue;
+        }
+        
+        beginBatch();
+        addDrained(count);
+        
+        // Collect the rest of the tick (per-tick) or of the flush budget window
+        const auto deadline = std::chrono::steady_clock::now() + holdLimit;
+        for (;;) {
+            count = messageQueue_.tryPopBatch(drainBuffer_.data(), drainBuffer_.size());
+            if (count != 0U) {
+                addDrained(count);
                 continue;
             }
             
-            // Send via IMessageSocket abstraction
-            if (socket_->send(binaryData, group_)) {
-                LOG_DEBUG("[a_hexagon] ExtrapTrackData sent - TrackID: {}, Size: {} bytes", 
-                         data.getTrackId(), binaryData.size());
-            } else {
-                LOG_WARN("Failed to send ExtrapTrackData - TrackID: {}", data.getTrackId());
+            const auto now = std::chrono::steady_clock::now();
+            if (now >= deadline) {
+                break;
             }
             
-        } catch (const std::exception& e) {
-            LOG_ERROR("Failed to send message: {}", e.what());
+            if (perTick) {
+                if (activeProducers_.load(std::memory_order_acquire) == 0U) {
+                    // Send call finished - take any record it pushed last, then flush
+                    count = messageQueue_.tryPopBatch(drainBuffer_.data(), drainBuffer_.size());
+                    if (count != 0U) {
+                        addDrained(count);
+                        continue;
+                    }
+                    break;
+                }
+                utils::cpuRelax();  // Producer is mid-burst
+            } else {
+                const auto remaining = std::chrono::duration_cast<std::chrono::microseconds>(deadline - now);
+                count = messageQueue_.waitPopBatch(drainBuffer_.data(), drainBuffer_.size(), remaining);
+                if (count == 0U) {
+                    break;
+                }
+                addDrained(count);
+            }
         }
+        
+        flushBatch();
+    }
+}
+
+void ExtrapTrackDataZeroMQOutgoingAdapter::beginBatch() {
+    batchWriter_->begin(adapters::common::messaging::BatchModelType::ExtrapTrackData,
+                        batchRecordSize_, batchSequence_++);
+}
+
+void ExtrapTrackDataZeroMQOutgoingAdapter::addToBatch(
+    const domain::model::ExtrapTrackData& data) {
+    // Serialize straight into the frame buffer
+    uint8_t* slot = batchWriter_->appendSlot();
+    if (slot == nullptr) {
+        // Frame full - send it and continue in a fresh frame
+        flushBatch();
+        beginBatch();
+        slot = batchWriter_->appendSlot();
     }
     
-    LOG_DEBUG("Publisher worker stopped: ExtrapTrackDataAdapter");
+    if (slot == nullptr) {
+        LOG_ERROR("Record does not fit an empty batch frame - TrackID: {}", data.getTrackId());
+        return;
+    }
+    static_cast<void>(data.serializeInto(slot, batchRecordSize_));
+}
+
+void ExtrapTrackDataZeroMQOutgoingAdapter::flushBatch() {
+    if (batchWriter_->empty()) {
+        return;
+    }
+    
+    try {
+        const std::vector<uint8_t>& frame = batchWriter_->finish();
+        if (socket_->send(frame, group_)) {
+            metricSent_.add(batchWriter_->recordCount());
+            metricBytes_.add(frame.size());
+            metricBatches_.add();
+            utils::EventLog::instance().record(utils::EventId::BatchSent, -1,
+                                               static_cast<int64_t>(batchWriter_->recordCount()),
+                                               static_cast<int64_t>(frame.size()),
+                                               static_cast<int64_t>(batchSequence_ - 1U));
+            LOG_DEBUG("[a_hexagon] ExtrapTrackData batch sent - Records: {}, Size: {} bytes",
+                     batchWriter_->recordCount(), frame.size());
+        } else {
+            metricSendFailures_.add(batchWriter_->recordCount());
+            utils::EventLog::instance().record(utils::EventId::SendFailed, -1,
+                                               static_cast<int64_t>(batchWriter_->recordCount()));
+            LOG_WARN("Failed to send ExtrapTrackData batch - Records: {}", batchWriter_->recordCount());
+        }
+    } catch (const std::exception& e) {
+        LOG_ERROR("Failed to send batch: {}", e.what());
+    }
 }
 
 } // namespace zeromq
@@ -31,18 +31,21 @@
 
 #include "adapters/common/IAdapter.hpp"
 #include "adapters/common/messaging/IMessageSocket.hpp"
+#include "adapters/common/messaging/BatchFrame.hpp"
 #include "domain/ports/outgoing/IExtrapTrackDataOutgoingPort.hpp"
 #include "domain/model/ExtrapTrackData.hpp"
+#include "utils/SpscRingBuffer.hpp"
+#include "utils/WaitStrategy.hpp"
+#include "utils/SpinLock.hpp"
+#include "utils/Metrics.hpp"
 
 #include <string>
 #include <vector>
 #include <atomic>
 #include <memory>
 #include <cstdint>  // MISRA Rule 9-3-1: Fixed-width integers
+#include <chrono>
 #include <thread>
-#include <queue>
-#include <mutex>
-#include <condition_variable>
 
 namespace adapters {
 namespace outgoing {
@@ -56,10 +59,17 @@ namespace zeromq {
  *          Uses background worker thread for non-blocking sends (~20ns enqueue).
  * 
  * Thread Safety:
- * - Uses mutex-protected queue for thread-safe message passing
+ * - Uses lock-free SPSC ring buffer (drop-oldest) for message passing
+ * - Concurrent senders are serialised by a producer-side spin lock
  * - Background worker thread handles actual ZMQ transmission
  * - Non-blocking sendExtrapTrackData() for real-time performance
  * 
+ * Batching (optional, see setBatching()):
+ * - Records are packed into BatchFrame messages up to an MTU budget
+ * - Flush budget 0: flush once the queue drains and no send call is mid-enqueue
+ *   (one sendExtrapTrackData() call = one tick)
+ * - Flush budget > 0: keep collecting for up to that long after the first record
+ * 
  * @invariant When running_, socket is connected and ready to send
  */
 class ExtrapTrackDataZeroMQOutgoingAdapter 
@@ -69,11 +79,13 @@ public:
     /**
      * @brief Construct adapter with DIP - socket injection (preferred for testing)
      * @param socket Message socket abstraction (ZeroMQ or Mock)
+     * @param waitStrategy How the publisher worker waits for data (blocking if null)
      * @pre socket is not null
      * @post Adapter is configured but not started
      */
     explicit ExtrapTrackDataZeroMQOutgoingAdapter(
-        std::unique_ptr<adapters::common::messaging::IMessageSocket> socket);
+        std::unique_ptr<adapters::common::messaging::IMessageSocket> socket,
+        std::shared_ptr<utils::WaitStrategy> waitStrategy = nullptr);
 
     /**
      * @brief Default constructor (legacy - creates ZeroMQ socket internally)
@@ -136,6 +148,22 @@ public:
      */
     [[nodiscard]] bool isReady() const noexcept;
 
+    /**
+     * @brief Enable or disable multi-record batch frames
+     * @param enabled true to send BatchFrame messages instead of one record per send
+     * @param mtuBudgetBytes Maximum frame size including the 16-byte header
+     * @param flushBudget Extra collection time after the first record (0 = per tick)
+     * @return false if running or the budget cannot hold one record (unchanged)
+     */
+    bool setBatching(bool enabled,
+                     std::size_t mtuBudgetBytes = DEFAULT_BATCH_MTU_BYTES,
+                     std::chrono::microseconds flushBudget = std::chrono::microseconds(0));
+
+    /**
+     * @brief Check if batch frames are enabled
+     */
+    [[nodiscard]] bool isBatching() const noexcept;
+
     // Delete copy/move for thread safety
     ExtrapTrackDataZeroMQOutgoingAdapter(const ExtrapTrackDataZeroMQOutgoingAdapter&) = delete;
     ExtrapTrackDataZeroMQOutgoingAdapter& operator=(const ExtrapTrackDataZeroMQOutgoingAdapter&) = delete;
@@ -161,10 +189,36 @@ private:
     void publisherWorker();
 
     /**
-     * @brief Enqueue message for transmission (non-blocking ~20ns)
-     * @param data Track data to send
+     * @brief Worker loop body when batching is enabled
+     */
+    void publishBatches();
+
+    /**
+     * @brief Serialize and send one record as its own message
+     */
+    void publishRecord(const domain::model::ExtrapTrackData& data);
+
+    /**
+     * @brief Start a new frame with the next sequence number
+     */
+    void beginBatch();
+
+    /**
+     * @brief Serialize a record into the current frame, sending it first if full
+     */
+    void addToBatch(const domain::model::ExtrapTrackData& data);
+
+    /**
+     * @brief Send the current frame if it holds any record
+     */
+    void flushBatch();
+
+    /**
+     * @brief Enqueue one send call's records for transmission (non-blocking ~20ns each)
+     * @param data First record
+     * @param count Number of records
      */
-    void enqueueMessage(const domain::model::ExtrapTrackData& data);
+    void enqueueMessages(const domain::model::ExtrapTrackData* data, std::size_t count);
 
     // Configuration
     std::string endpoint_;          ///< ZeroMQ endpoint
@@ -180,15 +234,38 @@ private:
 
     // Background worker thread infrastructure
     std::thread publisherThread_;                       ///< Background publisher thread
-    std::queue<domain::model::ExtrapTrackData> messageQueue_;  ///< Message queue
-    mutable std::mutex queueMutex_;                     ///< Queue protection mutex
-    std::condition_variable queueCV_;                   ///< Queue notification
+    utils::SpscRingBuffer<domain::model::ExtrapTrackData> messageQueue_{MAX_QUEUE_SIZE};  ///< Lock-free message ring
+    utils::SpinLock producerLock_;                      ///< Serialises concurrent senders
+    std::vector<uint8_t> sendBuffer_ =
+        std::vector<uint8_t>(domain::model::ExtrapTrackData::kWireSize);  ///< Worker-owned encode buffer
+    std::vector<domain::model::ExtrapTrackData> drainBuffer_ =
+        std::vector<domain::model::ExtrapTrackData>(DRAIN_BATCH_SIZE);    ///< Worker-owned dequeue buffer
+    std::atomic<uint32_t> activeProducers_{0U};         ///< Send calls mid-enqueue (tick boundary)
+
+    // Batch frames (configured while stopped, used by the worker only)
+    bool batchingEnabled_{false};                       ///< Pack records into BatchFrame messages
+    std::chrono::microseconds batchFlushBudget_{0};     ///< Collection window after first record
+    std::unique_ptr<adapters::common::messaging::BatchFrameWriter> batchWriter_;  ///< Frame builder
+    uint16_t batchRecordSize_{0U};                      ///< Serialized record size
+    uint32_t batchSequence_{0U};                        ///< Next frame sequence number
+
+    // Metrics (drops under producerLock_, the rest by the worker)
+    utils::Metric& metricQueueDrops_{utils::MetricsRegistry::instance().counter("outgoing.queue_drops")};
+    utils::Metric& metricSent_{utils::MetricsRegistry::instance().counter("outgoing.sent")};
+    utils::Metric& metricBytes_{utils::MetricsRegistry::instance().counter("outgoing.bytes")};
+    utils::Metric& metricSendFailures_{utils::MetricsRegistry::instance().counter("outgoing.send_failures")};
+    utils::Metric& metricBatches_{utils::MetricsRegistry::instance().counter("outgoing.batches")};
 
     // ==================== Configuration Constants ====================
     // Real-time thread configuration
     static constexpr int32_t REALTIME_THREAD_PRIORITY{80};  ///< SCHED_FIFO priority
     static constexpr int32_t DEDICATED_CPU_CORE{2};         ///< CPU affinity core
     static constexpr std::size_t MAX_QUEUE_SIZE{1000};      ///< Max queue size before drop
+    static constexpr int32_t QUEUE_WAIT_TIMEOUT_MS{100};    ///< Worker wake-up period for shutdown checks
+    static constexpr std::size_t DRAIN_BATCH_SIZE{32};      ///< Records taken from the ring per dequeue
+    static constexpr int64_t DROP_LOG_INTERVAL_MS{1000};    ///< Queue-full warning sampling period
+    static constexpr std::size_t DEFAULT_BATCH_MTU_BYTES{1400};  ///< Fits one Ethernet frame with UDP/IP and group overhead
+    static constexpr int32_t BATCH_MAX_HOLD_US{1000};       ///< Upper bound on holding a per-tick frame open
 
     // Production Environment (UDP Multicast)
     // static constexpr const char* DEFAULT_ENDPOINT = "udp://239.1.1.5:9596";
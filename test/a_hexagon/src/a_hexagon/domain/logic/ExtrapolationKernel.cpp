@@ -0,0 +1,94 @@
+/**
+ * @file ExtrapolationKernel.cpp
+ * @brief Scalar and AVX2 implementations of the extrapolation kernel
+ * @details The AVX2 path is compiled with a function-level target attribute so
+ *          the rest of the build does not need -mavx2; it is only called after
+ *          a runtime CPU feature check.
+ *
+ * @author a_hexagon Team
+ * @version 1.0
+ * @date 2025
+ *
+ * @note MISRA C++ 2023 compliant implementation
+ */
+
+#include "domain/logic/ExtrapolationKernel.hpp"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define A_HEXAGON_HAS_AVX2_KERNEL 1
+#include <immintrin.h>
+#else
+#define A_HEXAGON_HAS_AVX2_KERNEL 0
+#endif
+
+namespace domain {
+namespace logic {
+namespace kernel {
+
+void extrapolateAxisScalar(const double* pos, const double* vel, const double* baseTime,
+                           double time, double* out, std::size_t count) noexcept {
+    for (std::size_t i = 0U; i < count; ++i) {
+        const double dt = time - baseTime[i];
+        const double displacement = vel[i] * dt;
+        out[i] = pos[i] + displacement;
+    }
+}
+
+#if A_HEXAGON_HAS_AVX2_KERNEL
+
+namespace {
+
+__attribute__((target("avx2")))
+void extrapolateAxisAvx2(const double* pos, const double* vel, const double* baseTime,
+                         double time, double* out, std::size_t count) noexcept {
+    constexpr std::size_t LANES = 4U;
+    const __m256d target = _mm256_set1_pd(time);
+
+    std::size_t i = 0U;
+    for (; (i + LANES) <= count; i += LANES) {
+        const __m256d p = _mm256_loadu_pd(pos + i);
+        const __m256d v = _mm256_loadu_pd(vel + i);
+        const __m256d dt = _mm256_sub_pd(target, _mm256_loadu_pd(baseTime + i));
+        _mm256_storeu_pd(out + i, _mm256_add_pd(p, _mm256_mul_pd(v, dt)));
+    }
+
+    // Tail (count not a multiple of 4)
+    extrapolateAxisScalar(pos + i, vel + i, baseTime + i, time, out + i, count - i);
+}
+
+KernelPath detectKernelPath() noexcept {
+    __builtin_cpu_init();
+    return (__builtin_cpu_supports("avx2") != 0) ? KernelPath::Avx2 : KernelPath::Scalar;
+}
+
+} // namespace
+
+#endif // A_HEXAGON_HAS_AVX2_KERNEL
+
+KernelPath activeKernelPath() noexcept {
+#if A_HEXAGON_HAS_AVX2_KERNEL
+    static const KernelPath path = detectKernelPath();
+    return path;
+#else
+    return KernelPath::Scalar;
+#endif
+}
+
+void extrapolateAxis(const double* pos, const double* vel, const double* baseTime,
+                     double time, double* out, std::size_t count) noexcept {
+#if A_HEXAGON_HAS_AVX2_KERNEL
+    if (activeKernelPath() == KernelPath::Avx2) {
+        extrapolateAxisAvx2(pos, vel, baseTime, time, out, count);
+        return;
+    }
+#endif
+    extrapolateAxisScalar(pos, vel, baseTime, time, out, count);
+}
+
+const char* kernelPathName(KernelPath path) noexcept {
+    return (path == KernelPath::Avx2) ? "AVX2" : "Scalar";
+}
+
+} // namespace kernel
+} // namespace logic
+} // namespace domain
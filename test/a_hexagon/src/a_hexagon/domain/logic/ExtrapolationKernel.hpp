@@ -0,0 +1,66 @@
+/**
+ * @file ExtrapolationKernel.hpp
+ * @brief Vectorised constant-velocity extrapolation kernel
+ * @details Computes out[i] = pos[i] + vel[i] * (t - base[i]) over contiguous
+ *          structure-of-arrays columns. An AVX2 implementation is selected at
+ *          runtime on CPUs that support it; otherwise a portable scalar loop
+ *          is used. Both paths produce identical results (no FMA contraction).
+ *
+ * @author a_hexagon Team
+ * @version 1.0
+ * @date 2025
+ *
+ * @note MISRA C++ 2023 compliant implementation
+ * @see TrackStateTable.hpp
+ */
+
+#ifndef A_HEXAGON_DOMAIN_LOGIC_EXTRAPOLATION_KERNEL_HPP
+#define A_HEXAGON_DOMAIN_LOGIC_EXTRAPOLATION_KERNEL_HPP
+
+#include <cstddef>
+
+namespace domain {
+namespace logic {
+namespace kernel {
+
+/**
+ * @brief Kernel implementation selected for the running CPU
+ */
+enum class KernelPath {
+    Scalar,
+    Avx2
+};
+
+/**
+ * @brief Extrapolate one axis for count tracks
+ * @param pos Position column (m)
+ * @param vel Velocity column (m/s)
+ * @param baseTime Per-track reference time column (s)
+ * @param time Target time (s)
+ * @param out Output column (may not alias inputs)
+ * @param count Number of tracks
+ */
+void extrapolateAxis(const double* pos, const double* vel, const double* baseTime,
+                     double time, double* out, std::size_t count) noexcept;
+
+/**
+ * @brief Portable scalar implementation (always available)
+ */
+void extrapolateAxisScalar(const double* pos, const double* vel, const double* baseTime,
+                           double time, double* out, std::size_t count) noexcept;
+
+/**
+ * @brief Implementation used by extrapolateAxis() on this CPU
+ */
+[[nodiscard]] KernelPath activeKernelPath() noexcept;
+
+/**
+ * @brief Human readable kernel path name for logging
+ */
+[[nodiscard]] const char* kernelPathName(KernelPath path) noexcept;
+
+} // namespace kernel
+} // namespace logic
+} // namespace domain
+
+#endif // A_HEXAGON_DOMAIN_LOGIC_EXTRAPOLATION_KERNEL_HPP
@@ -0,0 +1,368 @@
+/**
+ * @file ExtrapolationScheduler.cpp
+ * @brief Implementation of the timing-wheel driven extrapolation scheduler
+ * @details The scheduler thread wakes once per SCHEDULER_TICK_US, applies the
+ *          TrackData updates handed over by the receive path, then advances the
+ *          timing wheel up to the current time, emitting every due sample.
+ *
+ * @author a_hexagon Team
+ * @version 1.0
+ * @date 2025
+ *
+ * @note MISRA C++ 2023 compliant implementation
+ */
+
+#include "domain/logic/ExtrapolationScheduler.hpp"
+#include "utils/Logger.hpp"
+#include "utils/EventLog.hpp"
+#include <cmath>
+#include <stdexcept>
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#include <cstring>
+#endif
+
+namespace domain {
+namespace logic {
+
+using domain::model::TrackData;
+
+ExtrapolationScheduler::ExtrapolationScheduler(EmitCallback emit,
+                                               double inputFrequency,
+                                               double outputFrequency,
+                                               std::chrono::microseconds idleTimeout)
+    : ExtrapolationScheduler(std::move(emit), TickCallback{}, inputFrequency, outputFrequency, idleTimeout) {
+    if (!emit_) {
+        throw std::invalid_argument("ExtrapolationScheduler emit callback cannot be empty");
+    }
+}
+
+ExtrapolationScheduler::ExtrapolationScheduler(BatchedTick,
+                                               TickCallback onTick,
+                                               double inputFrequency,
+                                               double outputFrequency,
+                                               std::chrono::microseconds idleTimeout)
+    : ExtrapolationScheduler(EmitCallback{}, std::move(onTick), inputFrequency, outputFrequency, idleTimeout) {
+    if (!onTick_) {
+        throw std::invalid_argument("ExtrapolationScheduler tick callback cannot be empty");
+    }
+}
+
+ExtrapolationScheduler::ExtrapolationScheduler(EmitCallback emit,
+                                               TickCallback onTick,
+                                               double inputFrequency,
+                                               double outputFrequency,
+                                               std::chrono::microseconds idleTimeout)
+    : emit_(std::move(emit))
+    , onTick_(std::move(onTick))
+    , outputInterval_(0.0)
+    , samplesPerBurst_(0U)
+    , sampleIntervalTicks_(1U)
+    , idleTimeoutTicks_(0U)
+    , nextSweepTick_(EVICTION_SWEEP_TICKS)
+    , nextOutputTick_(0U)
+    , wheel_(0U)
+    , tracks_()
+    , activeTable_(INITIAL_TRACK_CAPACITY)
+    , epoch_(std::chrono::steady_clock::now()) {
+    if ((inputFrequency <= 0.0) || (outputFrequency <= 0.0)) {
+        throw std::invalid_argument("ExtrapolationScheduler frequencies must be positive");
+    }
+
+    const double inputInterval = 1.0 / inputFrequency;
+    outputInterval_ = 1.0 / outputFrequency;
+
+    // Same sample offsets as the synchronous loop: t = 0, dt, 2dt, ... < inputInterval
+    samplesPerBurst_ = static_cast<uint32_t>(std::ceil((inputInterval / outputInterval_) - 1e-9));
+    if (samplesPerBurst_ == 0U) {
+        samplesPerBurst_ = 1U;
+    }
+
+    const auto intervalTicks = std::llround((outputInterval_ * 1e6) / static_cast<double>(SCHEDULER_TICK_US));
+    sampleIntervalTicks_ = (intervalTicks > 0) ? static_cast<uint64_t>(intervalTicks) : 1U;
+    nextOutputTick_ = sampleIntervalTicks_;
+
+    // An evicted track must have no timers left in the wheel: the last burst and
+    // any timer of a burst it replaced expire within one burst plus one interval
+    const uint64_t minIdleTicks = (static_cast<uint64_t>(samplesPerBurst_) + 1U) * sampleIntervalTicks_;
+    const auto requestedIdleTicks = idleTimeout.count() / SCHEDULER_TICK_US;
+    idleTimeoutTicks_ = (requestedIdleTicks > static_cast<int64_t>(minIdleTicks))
+                            ? static_cast<uint64_t>(requestedIdleTicks)
+                            : minIdleTicks;
+
+    tracks_.reserve(INITIAL_TRACK_CAPACITY);
+    pendingUpdates_.reserve(INITIAL_TRACK_CAPACITY);
+    drainBuffer_.reserve(INITIAL_TRACK_CAPACITY);
+}
+
+ExtrapolationScheduler::~ExtrapolationScheduler() {
+    stop();
+}
+
+// ==================== Lifecycle Management ====================
+
+bool ExtrapolationScheduler::start() {
+    if (running_.load()) {
+        return true;
+    }
+
+    running_.store(true);
+
+    // Align the wheel with wall time so a restarted scheduler resumes at its current tick
+    epoch_ = std::chrono::steady_clock::now() -
+             std::chrono::microseconds(static_cast<int64_t>(wheel_.currentTick()) * SCHEDULER_TICK_US);
+
+    schedulerThread_ = std::thread([this]() {
+        #ifdef __linux__
+        struct sched_param param;
+        param.sched_priority = SCHEDULER_THREAD_PRIORITY;
+        int ret = pthread_setschedparam(pthread_self(), SCHED_FIFO, &param);
+        if (ret != 0) {
+            LOG_DEBUG("RT scheduling not available (priority {}): {} - running with default scheduling", SCHEDULER_THREAD_PRIORITY, std::strerror(ret));
+        } else {
+            LOG_DEBUG("Extrapolation scheduler thread RT priority set to {}", SCHEDULER_THREAD_PRIORITY);
+        }
+
+        cpu_set_t cpuset;
+        CPU_ZERO(&cpuset);
+        CPU_SET(SCHEDULER_CPU_CORE, &cpuset);
+        ret = pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuset);
+        if (ret != 0) {
+            LOG_DEBUG("CPU affinity not set (core {}): {} - running on any available core", SCHEDULER_CPU_CORE, std::strerror(ret));
+        } else {
+            LOG_DEBUG("Extrapolation scheduler thread pinned to CPU core {}", SCHEDULER_CPU_CORE);
+        }
+        #endif
+
+        run();
+    });
+
+    LOG_INFO("ExtrapolationScheduler started - {} samples per burst, {} tick(s) apart",
+             samplesPerBurst_, sampleIntervalTicks_);
+    return true;
+}
+
+void ExtrapolationScheduler::stop() {
+    if (!running_.load()) {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(pendingMutex_);
+        running_.store(false);
+    }
+    stopCV_.notify_all();
+
+    if (schedulerThread_.joinable()) {
+        schedulerThread_.join();
+    }
+
+    LOG_INFO("ExtrapolationScheduler stopped - replaced bursts: {}, evicted tracks: {}",
+             replacedBursts_.load(), evictedTracks_.load());
+}
+
+bool ExtrapolationScheduler::isRunning() const {
+    return running_.load();
+}
+
+// ==================== Receive Path ====================
+
+void ExtrapolationScheduler::scheduleTrack(const TrackData& trackData) {
+    std::lock_guard<std::mutex> lock(pendingMutex_);
+    pendingUpdates_.push_back(trackData);
+}
+
+uint32_t ExtrapolationScheduler::getSamplesPerBurst() const noexcept {
+    return samplesPerBurst_;
+}
+
+std::size_t ExtrapolationScheduler::getActiveTrackCount() const noexcept {
+    return activeTracks_.load(std::memory_order_relaxed);
+}
+
+uint64_t ExtrapolationScheduler::getReplacedBurstCount() const noexcept {
+    return replacedBursts_.load(std::memory_order_relaxed);
+}
+
+std::size_t ExtrapolationScheduler::getTrackedCount() const noexcept {
+    return trackedTracks_.load(std::memory_order_relaxed);
+}
+
+uint64_t ExtrapolationScheduler::getEvictedTrackCount() const noexcept {
+    return evictedTracks_.load(std::memory_order_relaxed);
+}
+
+// ==================== Scheduler Thread ====================
+
+void ExtrapolationScheduler::run() {
+    LOG_DEBUG("Extrapolation scheduler thread started");
+
+    auto nextWake = epoch_;
+    const auto tick = std::chrono::microseconds(SCHEDULER_TICK_US);
+
+    while (running_.load()) {
+        nextWake += tick;
+        {
+            std::unique_lock<std::mutex> lock(pendingMutex_);
+            if (stopCV_.wait_until(lock, nextWake, [this]() { return !running_.load(); })) {
+                break;
+            }
+            drainBuffer_.swap(pendingUpdates_);
+        }
+
+        applyPendingUpdates();
+
+        // Catch up on every tick elapsed since the last wake (never skip deadlines)
+        const uint64_t targetTick = elapsedTicks();
+        while (wheel_.currentTick() < targetTick) {
+            wheel_.advance([this](const SampleTimer& timer) { onSampleDue(timer); });
+            if (onTick_ && (wheel_.currentTick() >= nextOutputTick_)) {
+                onOutputTick();
+                nextOutputTick_ += sampleIntervalTicks_;
+            }
+        }
+
+        if (wheel_.currentTick() >= nextSweepTick_) {
+            evictIdleTracks();
+            nextSweepTick_ = wheel_.currentTick() + EVICTION_SWEEP_TICKS;
+        }
+
+        // Resynchronise if the thread was preempted for longer than one tick
+        const auto now = std::chrono::steady_clock::now();
+        if (nextWake < now) {
+            nextWake = now;
+        }
+    }
+
+    // Invalidate timers still in the wheel so a restart never emits stale bursts
+    for (auto& entry : tracks_) {
+        ++entry.second.generation;
+        entry.second.active = false;
+    }
+    activeTable_.clear();
+    activeTracks_.store(0U, std::memory_order_relaxed);
+    LOG_DEBUG("Extrapolation scheduler thread stopped");
+}
+
+void ExtrapolationScheduler::applyPendingUpdates() {
+    for (const TrackData& update : drainBuffer_) {
+        auto result = tracks_.try_emplace(update.getTrackId());
+        TrackSlot& slot = result.first->second;
+        if (result.second) {
+            trackedTracks_.fetch_add(1U, std::memory_order_relaxed);
+        }
+        if (onTick_) {
+            applyBatchedUpdate(update, slot);
+            continue;
+        }
+
+        if (slot.active) {
+            // Newer data supersedes the unfinished burst; old timers become stale
+            replacedBursts_.fetch_add(1U, std::memory_order_relaxed);
+            utils::EventLog::instance().record(utils::EventId::BurstReplaced, update.getTrackId(),
+                                               static_cast<int64_t>(slot.generation));
+        } else {
+            slot.active = true;
+            activeTracks_.fetch_add(1U, std::memory_order_relaxed);
+        }
+
+        slot.latest = update;
+        slot.lastUpdateTick = wheel_.currentTick();
+        ++slot.generation;
+        wheel_.schedule(SampleTimer{update.getTrackId(), slot.generation, 0U}, wheel_.currentTick());
+    }
+    drainBuffer_.clear();
+}
+
+void ExtrapolationScheduler::applyBatchedUpdate(const TrackData& update, TrackSlot& slot) {
+    if (slot.active) {
+        replacedBursts_.fetch_add(1U, std::memory_order_relaxed);
+        utils::EventLog::instance().record(utils::EventId::BurstReplaced, update.getTrackId(),
+                                           static_cast<int64_t>(slot.generation));
+    } else {
+        slot.active = true;
+        activeTracks_.fetch_add(1U, std::memory_order_relaxed);
+    }
+
+    // Offset 0 falls on the next output tick, as a per-track burst starts on the next tick
+    const double burstStart = static_cast<double>(nextOutputTick_ * static_cast<uint64_t>(SCHEDULER_TICK_US)) / 1e6;
+    static_cast<void>(activeTable_.upsert(update, burstStart));
+    slot.lastUpdateTick = wheel_.currentTick();
+    slot.samplesLeft = samplesPerBurst_;
+    ++slot.generation;
+}
+
+void ExtrapolationScheduler::onOutputTick() {
+    if (activeTable_.size() == 0U) {
+        return;
+    }
+
+    const double tickTime = static_cast<double>(nextOutputTick_ * static_cast<uint64_t>(SCHEDULER_TICK_US)) / 1e6;
+    try {
+        onTick_(activeTable_, tickTime);
+    } catch (const std::exception& e) {
+        LOG_ERROR("Extrapolation output tick failed - tracks: {}, error: {}", activeTable_.size(), e.what());
+    }
+
+    // Walk backwards: remove() moves the last (already visited) slot into the hole
+    for (std::size_t index = activeTable_.size(); index > 0U; --index) {
+        const int32_t trackId = activeTable_.trackIds()[index - 1U];
+        TrackSlot& slot = tracks_[trackId];
+        --slot.samplesLeft;
+        if (slot.samplesLeft == 0U) {
+            static_cast<void>(activeTable_.remove(trackId));
+            slot.active = false;
+            activeTracks_.fetch_sub(1U, std::memory_order_relaxed);
+        }
+    }
+}
+
+void ExtrapolationScheduler::onSampleDue(const SampleTimer& timer) {
+    auto it = tracks_.find(timer.trackId);
+    if ((it == tracks_.end()) || (it->second.generation != timer.generation)) {
+        return;  // Burst was replaced by newer TrackData
+    }
+
+    TrackSlot& slot = it->second;
+    try {
+        emit_(slot.latest, static_cast<double>(timer.sampleIndex) * outputInterval_);
+        utils::EventLog::instance().record(utils::EventId::SampleExtrapolated, timer.trackId,
+                                           static_cast<int64_t>(timer.sampleIndex),
+                                           static_cast<int64_t>(timer.generation));
+    } catch (const std::exception& e) {
+        LOG_ERROR("Extrapolation sample emission failed - TrackID: {}, error: {}", timer.trackId, e.what());
+    }
+
+    const uint32_t nextIndex = timer.sampleIndex + 1U;
+    if (nextIndex < samplesPerBurst_) {
+        wheel_.schedule(SampleTimer{timer.trackId, timer.generation, nextIndex},
+                        wheel_.currentTick() + sampleIntervalTicks_);
+    } else {
+        slot.active = false;
+        activeTracks_.fetch_sub(1U, std::memory_order_relaxed);
+    }
+}
+
+void ExtrapolationScheduler::evictIdleTracks() {
+    const uint64_t now = wheel_.currentTick();
+    for (auto it = tracks_.begin(); it != tracks_.end();) {
+        const TrackSlot& slot = it->second;
+        if (!slot.active && ((now - slot.lastUpdateTick) >= idleTimeoutTicks_)) {
+            it = tracks_.erase(it);
+            trackedTracks_.fetch_sub(1U, std::memory_order_relaxed);
+            evictedTracks_.fetch_add(1U, std::memory_order_relaxed);
+        } else {
+            ++it;
+        }
+    }
+}
+
+uint64_t ExtrapolationScheduler::elapsedTicks() const {
+    const auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - epoch_).count();
+    return (elapsed > 0) ? static_cast<uint64_t>(elapsed / SCHEDULER_TICK_US) : 0U;
+}
+
+} // namespace logic
+} // namespace domain
@@ -0,0 +1,276 @@
+/**
+ * @file ExtrapolationScheduler.hpp
+ * @brief Multi-track extrapolation scheduler driven by a timing wheel
+ * @details Decouples extrapolated sample emission from the receive thread.
+ *          The receive path only records the latest TrackData per track; a
+ *          dedicated scheduler thread emits each track's samples at the
+ *          output frequency, either per track from deadlines in a TimingWheel
+ *          or, in batched mode, for all active tracks at once on a shared
+ *          output tick through a TrackStateTable.
+ *
+ * Data Flow:
+ * ┌────────────────────┐   scheduleTrack()   ┌───────────────────────────┐
+ * │ Receive thread     │ ──────────────────► │ pending updates (swap)    │
+ * └────────────────────┘                     └─────────────┬─────────────┘
+ *                                                          │ every tick
+ *                                            ┌─────────────▼─────────────┐
+ *                                            │ Scheduler thread          │
+ *                                            │  track table + wheel      │
+ *                                            │  → EmitCallback(sample)   │
+ *                                            └───────────────────────────┘
+ *
+ * @author a_hexagon Team
+ * @version 1.0
+ * @date 2025
+ *
+ * @note MISRA C++ 2023 compliant implementation
+ * @see TimingWheel.hpp
+ * @see TrackDataExtrapolator.hpp
+ */
+
+#ifndef A_HEXAGON_DOMAIN_LOGIC_EXTRAPOLATION_SCHEDULER_HPP
+#define A_HEXAGON_DOMAIN_LOGIC_EXTRAPOLATION_SCHEDULER_HPP
+
+#include "domain/logic/TimingWheel.hpp"
+#include "domain/logic/TrackStateTable.hpp"
+#include "domain/model/TrackData.hpp"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace domain {
+namespace logic {
+
+/**
+ * @class ExtrapolationScheduler
+ * @brief Emits per-track extrapolation bursts from a single scheduler thread
+ * @details Each received TrackData starts a burst of samples at offsets
+ *          0, 1/outputFrequency, ... below 1/inputFrequency. A newer TrackData
+ *          for the same trackId replaces the pending burst: outstanding timers
+ *          of the old burst are invalidated by a per-track generation counter.
+ *          Tracks without an update for the idle timeout are evicted so the
+ *          track table only holds live tracks.
+ *
+ * Batched mode (constructed with BATCHED): bursts are aligned to a shared
+ * output tick every 1/outputFrequency. Tracks with an active burst live in a
+ * TrackStateTable whose reference time is the tick that started the burst,
+ * and the TickCallback receives the whole table once per output tick so a
+ * single SoA kernel pass extrapolates every active track.
+ *
+ * Thread Safety:
+ * - scheduleTrack() may be called from any thread (short critical section)
+ * - EmitCallback is invoked only on the scheduler thread
+ */
+class ExtrapolationScheduler {
+public:
+    /**
+     * @brief Sample emission callback
+     * @details Invoked with the latest TrackData of a track and the sample
+     *          offset in seconds relative to that TrackData.
+     */
+    using EmitCallback = std::function<void(const domain::model::TrackData&, double)>;
+
+    /**
+     * @brief Output tick callback (batched mode)
+     * @details Invoked with every track that has an active burst and the tick
+     *          time in seconds; a track's sample offset is the tick time minus
+     *          its table reference time.
+     */
+    using TickCallback = std::function<void(const TrackStateTable&, double)>;
+
+    /// @brief Tag selecting the batched (per output tick) constructor
+    struct BatchedTick final {};
+    static constexpr BatchedTick BATCHED{};
+
+    // ==================== Configuration Constants ====================
+    static constexpr int64_t SCHEDULER_TICK_US = 1000;          ///< Wheel resolution (1ms)
+    static constexpr int SCHEDULER_THREAD_PRIORITY = 90;
+    static constexpr int SCHEDULER_CPU_CORE = 3;
+    static constexpr std::size_t INITIAL_TRACK_CAPACITY = 4096;
+    static constexpr int64_t TRACK_IDLE_TIMEOUT_US = 1000000;   ///< Evict tracks silent this long (1s)
+    static constexpr uint64_t EVICTION_SWEEP_TICKS = 100U;      ///< Idle sweep period (100ms)
+
+    /**
+     * @brief Constructor
+     * @param emit Callback receiving each due sample
+     * @param inputFrequency Input TrackData frequency (Hz)
+     * @param outputFrequency Output ExtrapTrackData frequency (Hz)
+     * @param idleTimeout Time without TrackData after which a track is evicted;
+     *        raised to at least one full burst plus one sample interval
+     * @throws std::invalid_argument if emit is empty or frequencies are not positive
+     */
+    ExtrapolationScheduler(EmitCallback emit, double inputFrequency, double outputFrequency,
+                           std::chrono::microseconds idleTimeout = std::chrono::microseconds(TRACK_IDLE_TIMEOUT_US));
+
+    /**
+     * @brief Constructor for batched mode
+     * @param onTick Callback receiving the active track table once per output tick
+     * @param inputFrequency Input TrackData frequency (Hz)
+     * @param outputFrequency Output ExtrapTrackData frequency (Hz)
+     * @param idleTimeout Time without TrackData after which a track is evicted
+     * @throws std::invalid_argument if onTick is empty or frequencies are not positive
+     */
+    ExtrapolationScheduler(BatchedTick, TickCallback onTick, double inputFrequency, double outputFrequency,
+                           std::chrono::microseconds idleTimeout = std::chrono::microseconds(TRACK_IDLE_TIMEOUT_US));
+
+    /**
+     * @brief Destructor - stops the scheduler thread
+     */
+    ~ExtrapolationScheduler();
+
+    // Delete copy/move - scheduler thread captures this
+    ExtrapolationScheduler(const ExtrapolationScheduler&) = delete;
+    ExtrapolationScheduler& operator=(const ExtrapolationScheduler&) = delete;
+    ExtrapolationScheduler(ExtrapolationScheduler&&) = delete;
+    ExtrapolationScheduler& operator=(ExtrapolationScheduler&&) = delete;
+
+    /**
+     * @brief Start the scheduler thread
+     * @return true if started (or already running)
+     */
+    [[nodiscard]] bool start();
+
+    /**
+     * @brief Stop the scheduler thread and discard pending bursts
+     */
+    void stop();
+
+    /**
+     * @brief Check if scheduler thread is running
+     */
+    [[nodiscard]] bool isRunning() const;
+
+    /**
+     * @brief Record latest TrackData for its track and (re)start its burst
+     * @param trackData Latest received TrackData
+     * @details Non-blocking apart from a short mutex-protected push; the burst
+     *          starts on the next scheduler tick.
+     */
+    void scheduleTrack(const domain::model::TrackData& trackData);
+
+    /**
+     * @brief Number of samples emitted per input TrackData
+     */
+    [[nodiscard]] uint32_t getSamplesPerBurst() const noexcept;
+
+    /**
+     * @brief Number of tracks with an active burst (approximate, lock-free read)
+     */
+    [[nodiscard]] std::size_t getActiveTrackCount() const noexcept;
+
+    /**
+     * @brief Number of bursts replaced by newer TrackData before completion
+     */
+    [[nodiscard]] uint64_t getReplacedBurstCount() const noexcept;
+
+    /**
+     * @brief Number of tracks held by the scheduler, active or idle (lock-free read)
+     */
+    [[nodiscard]] std::size_t getTrackedCount() const noexcept;
+
+    /**
+     * @brief Number of tracks evicted after the idle timeout
+     */
+    [[nodiscard]] uint64_t getEvictedTrackCount() const noexcept;
+
+private:
+    /**
+     * @brief Common constructor: exactly one of emit / onTick is set
+     */
+    ExtrapolationScheduler(EmitCallback emit, TickCallback onTick, double inputFrequency,
+                           double outputFrequency, std::chrono::microseconds idleTimeout);
+
+    /**
+     * @brief Timer payload stored in the wheel
+     */
+    struct SampleTimer {
+        int32_t trackId;
+        uint32_t generation;
+        uint32_t sampleIndex;
+    };
+
+    /**
+     * @brief Per-track state owned by the scheduler thread
+     */
+    struct TrackSlot {
+        domain::model::TrackData latest;
+        uint64_t lastUpdateTick{0U};
+        uint32_t generation{0U};
+        uint32_t samplesLeft{0U};   ///< Remaining output ticks of the burst (batched mode)
+        bool active{false};
+    };
+
+    /**
+     * @brief Scheduler thread main loop
+     */
+    void run();
+
+    /**
+     * @brief Apply pending TrackData updates collected from the receive path
+     */
+    void applyPendingUpdates();
+
+    /**
+     * @brief Handle an expired sample timer
+     */
+    void onSampleDue(const SampleTimer& timer);
+
+    /**
+     * @brief Start or replace a track's burst on the next output tick (batched mode)
+     */
+    void applyBatchedUpdate(const domain::model::TrackData& update, TrackSlot& slot);
+
+    /**
+     * @brief Emit the active track table and retire finished bursts (batched mode)
+     */
+    void onOutputTick();
+
+    /**
+     * @brief Drop idle tracks whose last update is older than the idle timeout
+     */
+    void evictIdleTracks();
+
+    /**
+     * @brief Convert elapsed time since scheduler start to a wheel tick
+     */
+    [[nodiscard]] uint64_t elapsedTicks() const;
+
+    EmitCallback emit_;
+    TickCallback onTick_;
+    double outputInterval_;
+    uint32_t samplesPerBurst_;
+    uint64_t sampleIntervalTicks_;
+    uint64_t idleTimeoutTicks_;
+    uint64_t nextSweepTick_;
+    uint64_t nextOutputTick_;
+
+    // Receive path → scheduler thread hand-off
+    std::mutex pendingMutex_;
+    std::condition_variable stopCV_;
+    std::vector<domain::model::TrackData> pendingUpdates_;
+    std::vector<domain::model::TrackData> drainBuffer_;
+
+    // Scheduler thread state
+    TimingWheel<SampleTimer> wheel_;
+    std::unordered_map<int32_t, TrackSlot> tracks_;
+    TrackStateTable activeTable_;   ///< Tracks with an active burst (batched mode)
+    std::chrono::steady_clock::time_point epoch_;
+
+    std::thread schedulerThread_;
+    std::atomic<bool> running_{false};
+    std::atomic<std::size_t> activeTracks_{0U};
+    std::atomic<uint64_t> replacedBursts_{0U};
+    std::atomic<std::size_t> trackedTracks_{0U};
+    std::atomic<uint64_t> evictedTracks_{0U};
+};
+
+} // namespace logic
+} // namespace domain
+
+#endif // A_HEXAGON_DOMAIN_LOGIC_EXTRAPOLATION_SCHEDULER_HPP
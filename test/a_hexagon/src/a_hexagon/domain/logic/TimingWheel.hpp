@@ -0,0 +1,160 @@
+/**
+ * @file TimingWheel.hpp
+ * @brief Hierarchical timing wheel for tick-based deadline scheduling
+ * @details Two-level hashed timing wheel with an overflow list. Insertion and
+ *          expiry are O(1) per timer; far deadlines cascade down one level every
+ *          LEVEL0_SLOTS ticks. Slot storage is reused so that steady-state
+ *          scheduling does not allocate.
+ *
+ * Layout:
+ * ┌───────────────────────────────────────────────────────────────┐
+ * │ Level 0: LEVEL0_SLOTS x 1 tick   (current block of ticks)     │
+ * │ Level 1: LEVEL1_SLOTS x LEVEL0_SLOTS ticks (next blocks)      │
+ * │ Overflow: everything beyond LEVEL1_SLOTS blocks               │
+ * └───────────────────────────────────────────────────────────────┘
+ *
+ * @author a_hexagon Team
+ * @version 1.0
+ * @date 2025
+ *
+ * @note MISRA C++ 2023 compliant implementation
+ * @note Not thread-safe - owned and driven by a single scheduler thread
+ */
+
+#ifndef A_HEXAGON_DOMAIN_LOGIC_TIMING_WHEEL_HPP
+#define A_HEXAGON_DOMAIN_LOGIC_TIMING_WHEEL_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace domain {
+namespace logic {
+
+/**
+ * @class TimingWheel
+ * @brief Two-level hierarchical timing wheel
+ * @tparam Entry Payload stored per timer (copied on cascade)
+ * @tparam LEVEL0_SLOTS Number of single-tick slots
+ * @tparam LEVEL1_SLOTS Number of block slots (each LEVEL0_SLOTS ticks wide)
+ */
+template <typename Entry, std::size_t LEVEL0_SLOTS = 256U, std::size_t LEVEL1_SLOTS = 64U>
+class TimingWheel {
+public:
+    /**
+     * @brief Constructor
+     * @param reservePerSlot Capacity reserved in each level-0 slot up front
+     */
+    explicit TimingWheel(std::size_t reservePerSlot = 0U) {
+        for (auto& slot : level0_) {
+            slot.reserve(reservePerSlot);
+        }
+        expired_.reserve(reservePerSlot);
+    }
+
+    /**
+     * @brief Schedule an entry to expire at the given tick
+     * @param entry Payload delivered on expiry
+     * @param deadlineTick Absolute tick; past or current ticks expire on the next advance()
+     */
+    void schedule(const Entry& entry, uint64_t deadlineTick) {
+        const uint64_t earliest = currentTick_ + 1U;
+        insert(Timer{entry, (deadlineTick < earliest) ? earliest : deadlineTick});
+        ++size_;
+    }
+
+    /**
+     * @brief Advance the wheel by one tick and deliver expired entries
+     * @param onExpired Callable invoked as onExpired(const Entry&) for each expired timer.
+     *        May call schedule() for future ticks.
+     */
+    template <typename Callback>
+    void advance(Callback&& onExpired) {
+        ++currentTick_;
+
+        if ((currentTick_ % LEVEL0_SLOTS) == 0U) {
+            const uint64_t block = currentTick_ / LEVEL0_SLOTS;
+            if ((block % LEVEL1_SLOTS) == 0U) {
+                redistribute(overflow_);
+            }
+            redistribute(level1_[block % LEVEL1_SLOTS]);
+        }
+
+        expired_.swap(level0_[currentTick_ % LEVEL0_SLOTS]);
+        size_ -= expired_.size();
+        for (const Timer& timer : expired_) {
+            onExpired(timer.entry);
+        }
+        expired_.clear();
+    }
+
+    /**
+     * @brief Get the tick most recently processed by advance()
+     */
+    [[nodiscard]] uint64_t currentTick() const noexcept {
+        return currentTick_;
+    }
+
+    /**
+     * @brief Get number of pending timers
+     */
+    [[nodiscard]] std::size_t size() const noexcept {
+        return size_;
+    }
+
+    /**
+     * @brief Check whether any timers are pending
+     */
+    [[nodiscard]] bool empty() const noexcept {
+        return size_ == 0U;
+    }
+
+private:
+    struct Timer {
+        Entry entry;
+        uint64_t deadline;
+    };
+
+    /**
+     * @brief Place a timer into the level matching its distance from now
+     * @details A deadline equal to the current tick lands in the slot that
+     *          advance() is about to fire (only reachable during cascade).
+     */
+    void insert(Timer&& timer) {
+        const uint64_t blockDiff = (timer.deadline / LEVEL0_SLOTS) - (currentTick_ / LEVEL0_SLOTS);
+
+        if (blockDiff == 0U) {
+            level0_[timer.deadline % LEVEL0_SLOTS].push_back(std::move(timer));
+        } else if (blockDiff < LEVEL1_SLOTS) {
+            level1_[(timer.deadline / LEVEL0_SLOTS) % LEVEL1_SLOTS].push_back(std::move(timer));
+        } else {
+            overflow_.push_back(std::move(timer));
+        }
+    }
+
+    /**
+     * @brief Re-insert every timer of a coarse slot relative to the current tick
+     */
+    void redistribute(std::vector<Timer>& bucket) {
+        cascade_.swap(bucket);
+        for (Timer& timer : cascade_) {
+            insert(std::move(timer));
+        }
+        cascade_.clear();
+    }
+
+    std::array<std::vector<Timer>, LEVEL0_SLOTS> level0_{};
+    std::array<std::vector<Timer>, LEVEL1_SLOTS> level1_{};
+    std::vector<Timer> overflow_;
+    std::vector<Timer> expired_;   ///< Scratch buffer for the slot being fired
+    std::vector<Timer> cascade_;   ///< Scratch buffer for cascading coarse slots
+    uint64_t currentTick_{0U};
+    std::size_t size_{0U};
+};
+
+} // namespace logic
+} // namespace domain
+
+#endif // A_HEXAGON_DOMAIN_LOGIC_TIMING_WHEEL_HPP
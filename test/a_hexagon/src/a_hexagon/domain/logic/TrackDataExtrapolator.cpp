@@ -13,6 +13,8 @@
  */
 
 #include "domain/logic/TrackDataExtrapolator.hpp"
+#include "utils/EventLog.hpp"
+#include "utils/Logger.hpp"
 #include <chrono>
 #include <thread>
 
@@ -35,50 +37,125 @@ TrackDataExtrapolator::TrackDataExtrapolator(
     // Note: This constructor does NOT take ownership
     // For legacy code compatibility only - use unique_ptr constructor for new code
 }
-void TrackDataExtrapolator::extrapolateTrackData(const TrackData& trackData, double inputFrequency,double outputFrequency) {
-	double inputInterval = 1.0 / inputFrequency;
-	double outputInterval = 1.0 / outputFrequency;
+TrackDataExtrapolator::~TrackDataExtrapolator() {
+    stop();
+}
 
-	auto startTime = std::chrono::high_resolution_clock::now();
+bool TrackDataExtrapolator::start() {
+    if (scheduler_ == nullptr) {
+        // One SoA kernel pass and one batch send per output tick for all active tracks
+        scheduler_ = std::make_unique<ExtrapolationScheduler>(
+            ExtrapolationScheduler::BATCHED,
+            [this](const TrackStateTable& table, double tickSeconds) {
+                extrapolateTrackTable(table, tickSeconds);
+            },
+            INPUT_FREQUENCY_HZ,
+            OUTPUT_FREQUENCY_HZ);
+    }
+    return scheduler_->start();
+}
 
-	    for (double t = 0; t < inputInterval; t += outputInterval) {
-	        ExtrapTrackData extrap;
+void TrackDataExtrapolator::stop() {
+    if (scheduler_ != nullptr) {
+        scheduler_->stop();
+    }
+}
 
+bool TrackDataExtrapolator::isRunning() const {
+    return (scheduler_ != nullptr) && scheduler_->isRunning();
+}
 
-	        // Track data kopyala
-	        extrap.setTrackId(trackData.getTrackId());
-	        extrap.setXVelocityECEF(trackData.getXVelocityECEF());
-	        extrap.setYVelocityECEF(trackData.getYVelocityECEF());
-	        extrap.setZVelocityECEF(trackData.getZVelocityECEF());
+ExtrapTrackData TrackDataExtrapolator::createExtrapolatedSample(const TrackData& trackData, double offsetSeconds) const {
+	ExtrapTrackData extrap;
 
-	        // Position'ı velocity ile extrapole et
-	        extrap.setXPositionECEF(trackData.getXPositionECEF() + trackData.getXVelocityECEF() * t);
-	        extrap.setYPositionECEF(trackData.getYPositionECEF() + trackData.getYVelocityECEF() * t);
-	        extrap.setZPositionECEF(trackData.getZPositionECEF() + trackData.getZVelocityECEF() * t);
+	// Track data kopyala
+	extrap.setTrackId(trackData.getTrackId());
+	extrap.setXVelocityECEF(trackData.getXVelocityECEF());
+	extrap.setYVelocityECEF(trackData.getYVelocityECEF());
+	extrap.setZVelocityECEF(trackData.getZVelocityECEF());
 
-	        // Timestamp'leri ayarla
-	        extrap.setUpdateTime(trackData.getOriginalUpdateTime() * 1000 + static_cast<long>(t * 1000000)); // ms to μs + offset
-	        extrap.setOriginalUpdateTime(trackData.getOriginalUpdateTime()); // milisaniye olarak kalsın
+	// Position'ı velocity ile extrapole et
+	extrap.setXPositionECEF(trackData.getXPositionECEF() + trackData.getXVelocityECEF() * offsetSeconds);
+	extrap.setYPositionECEF(trackData.getYPositionECEF() + trackData.getYVelocityECEF() * offsetSeconds);
+	extrap.setZPositionECEF(trackData.getZPositionECEF() + trackData.getZVelocityECEF() * offsetSeconds);
 
-	        auto now = std::chrono::high_resolution_clock::now();
-	        auto micros = std::chrono::duration_cast<std::chrono::microseconds>(now.time_since_epoch()).count();
-	        extrap.setFirstHopSentTime(micros); // mikrosaniye cinsinden
+	// Timestamp'leri ayarla
+	extrap.setUpdateTime(trackData.getOriginalUpdateTime() * 1000 + static_cast<long>(offsetSeconds * 1000000)); // ms to μs + offset
+	extrap.setOriginalUpdateTime(trackData.getOriginalUpdateTime()); // milisaniye olarak kalsın
 
-        // Her veriyi hemen gönder (tek tek)
-        if (outgoingPort_ != nullptr) {
-            outgoingPort_->sendExtrapTrackData(extrap);
-        } else if (rawOutgoingPort_ != nullptr) {
-            rawOutgoingPort_->sendExtrapTrackData(extrap);
+	auto now = std::chrono::high_resolution_clock::now();
+	auto micros = std::chrono::duration_cast<std::chrono::microseconds>(now.time_since_epoch()).count();
+	extrap.setFirstHopSentTime(micros); // mikrosaniye cinsinden
+
+	return extrap;
+}
+
+void TrackDataExtrapolator::extrapolateTrackTable(const TrackStateTable& table, double timeSeconds) {
+    table.extrapolateAll(timeSeconds, tablePositions_);
+
+    const auto micros = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::high_resolution_clock::now().time_since_epoch()).count();
+
+    // Build each row unchecked, then one validate() mask per row instead of per-field setters
+    tableBatch_.resize(table.size());
+    std::size_t valid = 0U;
+    for (std::size_t slot = 0U; slot < table.size(); ++slot) {
+        table.materialize(slot, tablePositions_, timeSeconds, micros, tableBatch_[valid]);
+        const uint32_t invalidFields = tableBatch_[valid].validate();
+        if (invalidFields == 0U) {
+            ++valid;
+        } else {
+            metricInvalidSamples_.add();
+            LOG_WARN_EVERY_MS(1000, "Dropped out-of-range extrapolated sample - TrackID: {}, invalid fields: {:#x}",
+                              table.trackIds()[slot], invalidFields);
         }
-        // 200Hz için 5ms bekle (gerçek zamanlı extrapolation)
+    }
+    tableBatch_.resize(valid);
+
+    if (tableBatch_.empty()) {
+        return;
+    }
+    utils::EventLog::instance().record(utils::EventId::TableExtrapolated, -1,
+                                       static_cast<int64_t>(tableBatch_.size()),
+                                       static_cast<int64_t>(timeSeconds * 1e6));
+    if (outgoingPort_ != nullptr) {
+        outgoingPort_->sendExtrapTrackData(tableBatch_);
+    } else if (rawOutgoingPort_ != nullptr) {
+        rawOutgoingPort_->sendExtrapTrackData(tableBatch_);
+    }
+}
+
+void TrackDataExtrapolator::forwardExtrapTrackData(const ExtrapTrackData& extrap) {
+    if (outgoingPort_ != nullptr) {
+        outgoingPort_->sendExtrapTrackData(extrap);
+    } else if (rawOutgoingPort_ != nullptr) {
+        rawOutgoingPort_->sendExtrapTrackData(extrap);
+    }
+}
+
+void TrackDataExtrapolator::extrapolateTrackData(const TrackData& trackData, double inputFrequency,double outputFrequency) {
+	double inputInterval = 1.0 / inputFrequency;
+	double outputInterval = 1.0 / outputFrequency;
+
+	    for (double t = 0; t < inputInterval; t += outputInterval) {
+        // Her veriyi hemen gönder (tek tek)
+        forwardExtrapTrackData(createExtrapolatedSample(trackData, t));
+
+        // 100Hz için 10ms bekle (senkron mod - scheduler kullanılmıyorsa)
 	        std::this_thread::sleep_for(std::chrono::milliseconds(10));
 
     }
 }
 void TrackDataExtrapolator::processAndForwardTrackData(const TrackData& trackData) {
 
+	// Scheduler aktifse sadece track durumunu güncelle (alım thread'i bloklanmaz)
+	if (isRunning()) {
+		scheduler_->scheduleTrack(trackData);
+		return;
+	}
+
 	// 8Hz TrackData'yı alıp 100Hz ExtrapTrackData olarak gönder
-	extrapolateTrackData(trackData,8.0,100.0);
+	extrapolateTrackData(trackData, INPUT_FREQUENCY_HZ, OUTPUT_FREQUENCY_HZ);
 }
 }
 }
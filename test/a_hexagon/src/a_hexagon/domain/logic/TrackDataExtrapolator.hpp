@@ -23,6 +23,9 @@
 #include <memory>
 #include "domain/model/TrackData.hpp"
 #include "domain/model/ExtrapTrackData.hpp"
+#include "domain/logic/ExtrapolationScheduler.hpp"
+#include "domain/logic/TrackStateTable.hpp"
+#include "utils/Metrics.hpp"
 
 namespace domain {
 namespace logic {
@@ -34,10 +37,24 @@ using std::vector;
 /**
  * @class TrackDataExtrapolator
  * @brief Domain service for extrapolating track data
- * @details Implements ITrackDataIncomingPort for hexagonal architecture
+ * @details Implements ITrackDataIncomingPort for hexagonal architecture.
+ *
+ * Operating Modes:
+ * - Synchronous (default): processAndForwardTrackData() emits the whole burst
+ *   on the caller's thread, pacing samples with sleep_for (legacy behaviour).
+ * - Scheduled (after start()): processAndForwardTrackData() only hands the
+ *   TrackData to an ExtrapolationScheduler; on every output tick the scheduler
+ *   thread extrapolates all active tracks with extrapolateTrackTable(), and
+ *   newer data replaces a track's pending burst.
+ *
  * @note MISRA C++ 2023 compliant implementation
  */
 class TrackDataExtrapolator : public domain::ports::incoming::ITrackDataIncomingPort {
+public:
+    // ==================== Configuration Constants ====================
+    static constexpr double INPUT_FREQUENCY_HZ = 8.0;     ///< TrackData input rate
+    static constexpr double OUTPUT_FREQUENCY_HZ = 100.0;  ///< ExtrapTrackData output rate
+
 private:
     /// @brief Outgoing port for sending extrapolated data - MISRA compliant smart pointer
     std::unique_ptr<domain::ports::outgoing::IExtrapTrackDataOutgoingPort> outgoingPort_;
@@ -45,6 +62,16 @@ private:
     /// @brief Raw pointer for legacy compatibility (non-owning)
     domain::ports::outgoing::IExtrapTrackDataOutgoingPort* rawOutgoingPort_ = nullptr;
 
+    /// @brief Scheduler used in scheduled mode (created by start())
+    std::unique_ptr<ExtrapolationScheduler> scheduler_;
+
+    /// @brief Scratch buffers reused by extrapolateTrackTable()
+    ExtrapolatedPositions tablePositions_;
+    std::vector<ExtrapTrackData> tableBatch_;
+
+    /// @brief Samples dropped by validate() (scheduler thread is the only writer)
+    utils::Metric& metricInvalidSamples_{utils::MetricsRegistry::instance().counter("extrapolation.invalid_samples")};
+
 public: 
     /**
      * @brief Constructor with ownership transfer
@@ -64,8 +91,47 @@ public:
     /**
      * @brief Process and forward track data
      * @param trackData Input track data to process
+     * @details In scheduled mode this only updates the track's state and returns
+     *          immediately; otherwise the burst is emitted synchronously.
+     */
+    void processAndForwardTrackData(const domain::model::TrackData& trackData) override;
+
+    // ==================== Lifecycle Management ====================
+    /**
+     * @brief Switch to scheduled mode and start the scheduler thread
+     * @return true if the scheduler is running
+     */
+    [[nodiscard]] bool start();
+
+    /**
+     * @brief Stop the scheduler thread and return to synchronous mode
      */
-    void processAndForwardTrackData(const domain::model::TrackData& trackData);
+    void stop();
+
+    /**
+     * @brief Check if scheduled mode is active
+     * @return true if the scheduler thread is running
+     */
+    [[nodiscard]] bool isRunning() const;
+
+    /**
+     * @brief Build one extrapolated sample
+     * @param trackData Source track data
+     * @param offsetSeconds Time offset from the source update time (seconds)
+     * @return ExtrapTrackData with position advanced by velocity * offset
+     */
+    [[nodiscard]] ExtrapTrackData createExtrapolatedSample(const TrackData& trackData, double offsetSeconds) const;
+
+    /**
+     * @brief Extrapolate every track of a SoA table to one output tick
+     * @param table Active track states
+     * @param timeSeconds Output tick time (scheduler-relative seconds, the time
+     *        base of the table's reference times - not originalUpdateTime)
+     * @details Positions for all tracks are computed in a single vectorised
+     *          pass; rows failing validate() are dropped and counted, the rest
+     *          are sent with one vector send call.
+     */
+    void extrapolateTrackTable(const TrackStateTable& table, double timeSeconds);
     
     /**
      * @brief Extrapolate track data at specified frequencies
@@ -79,11 +145,18 @@ public:
     TrackDataExtrapolator(const TrackDataExtrapolator&) = delete;
     TrackDataExtrapolator& operator=(const TrackDataExtrapolator&) = delete;
     
-    // Default move operations
-    TrackDataExtrapolator(TrackDataExtrapolator&&) = default;
-    TrackDataExtrapolator& operator=(TrackDataExtrapolator&&) = default;
+    // Delete move operations - scheduler callback captures this
+    TrackDataExtrapolator(TrackDataExtrapolator&&) = delete;
+    TrackDataExtrapolator& operator=(TrackDataExtrapolator&&) = delete;
     
-    ~TrackDataExtrapolator() = default;
+    ~TrackDataExtrapolator() override;
+
+private:
+    /**
+     * @brief Send a single sample through whichever outgoing port is configured
+     * @param extrap Sample to send
+     */
+    void forwardExtrapTrackData(const ExtrapTrackData& extrap);
 };
 
 } // namespace logic
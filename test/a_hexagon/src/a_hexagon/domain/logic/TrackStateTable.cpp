@@ -0,0 +1,157 @@
+/**
+ * @file TrackStateTable.cpp
+ * @brief Implementation of the structure-of-arrays track state table
+ *
+ * @author a_hexagon Team
+ * @version 1.0
+ * @date 2025
+ *
+ * @note MISRA C++ 2023 compliant implementation
+ */
+
+#include "domain/logic/TrackStateTable.hpp"
+#include "domain/logic/ExtrapolationKernel.hpp"
+#include <cmath>
+
+namespace domain {
+namespace logic {
+
+using domain::model::TrackData;
+using domain::model::ExtrapTrackData;
+
+namespace {
+    constexpr double MILLISECONDS_PER_SECOND = 1000.0;
+    constexpr double MICROSECONDS_PER_SECOND = 1000000.0;
+
+    template <typename T>
+    void moveLastInto(std::vector<T>& column, std::size_t slot) {
+        column[slot] = column.back();
+        column.pop_back();
+    }
+}
+
+TrackStateTable::TrackStateTable(std::size_t initialCapacity) {
+    trackId_.reserve(initialCapacity);
+    posX_.reserve(initialCapacity);
+    posY_.reserve(initialCapacity);
+    posZ_.reserve(initialCapacity);
+    velX_.reserve(initialCapacity);
+    velY_.reserve(initialCapacity);
+    velZ_.reserve(initialCapacity);
+    baseTime_.reserve(initialCapacity);
+    originalUpdateTime_.reserve(initialCapacity);
+    slotByTrackId_.reserve(initialCapacity);
+}
+
+std::size_t TrackStateTable::upsert(const TrackData& trackData) {
+    return upsert(trackData, static_cast<double>(trackData.getOriginalUpdateTime()) / MILLISECONDS_PER_SECOND);
+}
+
+std::size_t TrackStateTable::upsert(const TrackData& trackData, double baseTimeSeconds) {
+    const auto inserted = slotByTrackId_.try_emplace(trackData.getTrackId(), trackId_.size());
+    const std::size_t slot = inserted.first->second;
+
+    if (inserted.second) {
+        trackId_.push_back(trackData.getTrackId());
+        posX_.push_back(0.0);
+        posY_.push_back(0.0);
+        posZ_.push_back(0.0);
+        velX_.push_back(0.0);
+        velY_.push_back(0.0);
+        velZ_.push_back(0.0);
+        baseTime_.push_back(0.0);
+        originalUpdateTime_.push_back(0);
+    }
+
+    posX_[slot] = trackData.getXPositionECEF();
+    posY_[slot] = trackData.getYPositionECEF();
+    posZ_[slot] = trackData.getZPositionECEF();
+    velX_[slot] = trackData.getXVelocityECEF();
+    velY_[slot] = trackData.getYVelocityECEF();
+    velZ_[slot] = trackData.getZVelocityECEF();
+    originalUpdateTime_[slot] = trackData.getOriginalUpdateTime();
+    baseTime_[slot] = baseTimeSeconds;
+
+    return slot;
+}
+
+bool TrackStateTable::remove(int32_t trackId) {
+    const auto it = slotByTrackId_.find(trackId);
+    if (it == slotByTrackId_.end()) {
+        return false;
+    }
+
+    const std::size_t slot = it->second;
+    slotByTrackId_.erase(it);
+
+    // Keep columns dense: move the last slot into the hole
+    const std::size_t last = trackId_.size() - 1U;
+    if (slot != last) {
+        slotByTrackId_[trackId_[last]] = slot;
+    }
+    moveLastInto(trackId_, slot);
+    moveLastInto(posX_, slot);
+    moveLastInto(posY_, slot);
+    moveLastInto(posZ_, slot);
+    moveLastInto(velX_, slot);
+    moveLastInto(velY_, slot);
+    moveLastInto(velZ_, slot);
+    moveLastInto(baseTime_, slot);
+    moveLastInto(originalUpdateTime_, slot);
+
+    return true;
+}
+
+std::size_t TrackStateTable::findSlot(int32_t trackId) const {
+    const auto it = slotByTrackId_.find(trackId);
+    return (it != slotByTrackId_.end()) ? it->second : NO_SLOT;
+}
+
+void TrackStateTable::clear() noexcept {
+    trackId_.clear();
+    posX_.clear();
+    posY_.clear();
+    posZ_.clear();
+    velX_.clear();
+    velY_.clear();
+    velZ_.clear();
+    baseTime_.clear();
+    originalUpdateTime_.clear();
+    slotByTrackId_.clear();
+}
+
+std::size_t TrackStateTable::size() const noexcept {
+    return trackId_.size();
+}
+
+void TrackStateTable::extrapolateAll(double timeSeconds, ExtrapolatedPositions& out) const {
+    const std::size_t count = trackId_.size();
+    out.x.resize(count);
+    out.y.resize(count);
+    out.z.resize(count);
+
+    kernel::extrapolateAxis(posX_.data(), velX_.data(), baseTime_.data(), timeSeconds, out.x.data(), count);
+    kernel::extrapolateAxis(posY_.data(), velY_.data(), baseTime_.data(), timeSeconds, out.y.data(), count);
+    kernel::extrapolateAxis(posZ_.data(), velZ_.data(), baseTime_.data(), timeSeconds, out.z.data(), count);
+}
+
+void TrackStateTable::materialize(std::size_t slot, const ExtrapolatedPositions& positions, double timeSeconds,
+                                  int64_t firstHopSentTime, ExtrapTrackData& out) const noexcept {
+    const double offsetSeconds = timeSeconds - baseTime_[slot];
+
+    out = ExtrapTrackData(ExtrapTrackData::UNCHECKED,
+                          trackId_[slot],
+                          velX_[slot],
+                          velY_[slot],
+                          velZ_[slot],
+                          positions.x[slot],
+                          positions.y[slot],
+                          positions.z[slot],
+                          originalUpdateTime_[slot],
+                          originalUpdateTime_[slot] * 1000 +
+                              std::llround(offsetSeconds * MICROSECONDS_PER_SECOND),  // ms to μs + offset
+                          firstHopSentTime);
+}
+
+} // namespace logic
+} // namespace domain
@@ -0,0 +1,150 @@
+/**
+ * @file TrackStateTable.hpp
+ * @brief Structure-of-arrays table of active track states
+ * @details Keeps the latest kinematic state of every active track in dense,
+ *          separate columns (x/y/z position, velocity, reference time) so that
+ *          one pass of the vectorised ExtrapolationKernel extrapolates all
+ *          tracks for an output tick. Slots stay dense: removing a track moves
+ *          the last slot into the hole.
+ *
+ * Layout (N active tracks, one contiguous column each):
+ * - trackId[N]
+ * - posX[N], posY[N], posZ[N]
+ * - velX[N], velY[N], velZ[N]
+ * - baseTime[N] (s), originalUpdateTime[N] (ms)
+ *
+ * Time base: baseTime and the timeSeconds passed to extrapolateAll() and
+ * materialize() share one clock chosen by the writer. upsert(trackData) uses
+ * originalUpdateTime; the batched scheduler uses upsert(trackData, base) with
+ * scheduler-relative seconds. Do not mix both forms in one table.
+ *
+ * @author a_hexagon Team
+ * @version 1.0
+ * @date 2025
+ *
+ * @note MISRA C++ 2023 compliant implementation
+ * @note Not thread-safe - owned by a single domain thread
+ * @see ExtrapolationKernel.hpp
+ */
+
+#ifndef A_HEXAGON_DOMAIN_LOGIC_TRACK_STATE_TABLE_HPP
+#define A_HEXAGON_DOMAIN_LOGIC_TRACK_STATE_TABLE_HPP
+
+#include "domain/model/TrackData.hpp"
+#include "domain/model/ExtrapTrackData.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace domain {
+namespace logic {
+
+/**
+ * @brief Output columns of one extrapolation pass
+ */
+struct ExtrapolatedPositions {
+    std::vector<double> x;
+    std::vector<double> y;
+    std::vector<double> z;
+};
+
+/**
+ * @class TrackStateTable
+ * @brief Dense SoA storage of track kinematics keyed by trackId
+ */
+class TrackStateTable {
+public:
+    /// @brief Returned by findSlot() when the track is not present
+    static constexpr std::size_t NO_SLOT = static_cast<std::size_t>(-1);
+
+    /**
+     * @brief Constructor
+     * @param initialCapacity Number of tracks reserved up front
+     */
+    explicit TrackStateTable(std::size_t initialCapacity = 0U);
+
+    /**
+     * @brief Insert or update the state of a track
+     * @param trackData Latest TrackData (originalUpdateTime in ms)
+     * @return Slot index holding the track
+     * @details Reference time is originalUpdateTime converted to seconds
+     */
+    std::size_t upsert(const domain::model::TrackData& trackData);
+
+    /**
+     * @brief Insert or update a track with an explicit reference time
+     * @param trackData Latest TrackData
+     * @param baseTimeSeconds Time at which the extrapolation offset is zero, in
+     *        the caller's time base (the batched scheduler passes its output
+     *        tick in scheduler-relative seconds, not originalUpdateTime)
+     * @return Slot index holding the track
+     */
+    std::size_t upsert(const domain::model::TrackData& trackData, double baseTimeSeconds);
+
+    /**
+     * @brief Remove a track
+     * @param trackId Track identifier
+     * @return true if the track was present
+     */
+    bool remove(int32_t trackId);
+
+    /**
+     * @brief Find the slot of a track
+     * @return Slot index or NO_SLOT
+     */
+    [[nodiscard]] std::size_t findSlot(int32_t trackId) const;
+
+    /**
+     * @brief Remove all tracks (keeps capacity)
+     */
+    void clear() noexcept;
+
+    /**
+     * @brief Number of active tracks
+     */
+    [[nodiscard]] std::size_t size() const noexcept;
+
+    /**
+     * @brief Extrapolate every active track to the given time in one pass
+     * @param timeSeconds Target time (seconds, same time base as the reference
+     *        times given to upsert())
+     * @param out Output columns, resized to size()
+     */
+    void extrapolateAll(double timeSeconds, ExtrapolatedPositions& out) const;
+
+    /**
+     * @brief Build the ExtrapTrackData of one slot from an extrapolation pass
+     * @details Uses the unchecked constructor: the caller range-checks the
+     *          result once with validate() instead of per-field setters.
+     * @param slot Slot index (< size())
+     * @param positions Result of extrapolateAll() for timeSeconds
+     * @param timeSeconds Time used for the pass
+     * @param firstHopSentTime Send timestamp (μs)
+     * @param out Destination sample
+     */
+    void materialize(std::size_t slot, const ExtrapolatedPositions& positions, double timeSeconds,
+                     int64_t firstHopSentTime, domain::model::ExtrapTrackData& out) const noexcept;
+
+    // ==================== Column Access ====================
+    [[nodiscard]] const std::vector<int32_t>& trackIds() const noexcept { return trackId_; }
+    [[nodiscard]] const std::vector<double>& baseTimes() const noexcept { return baseTime_; }
+
+private:
+    std::vector<int32_t> trackId_;
+    std::vector<double> posX_;
+    std::vector<double> posY_;
+    std::vector<double> posZ_;
+    std::vector<double> velX_;
+    std::vector<double> velY_;
+    std::vector<double> velZ_;
+    std::vector<double> baseTime_;            ///< Reference time (s) in the writer's time base, see file header
+    std::vector<int64_t> originalUpdateTime_; ///< originalUpdateTime in ms (wire value)
+
+    std::unordered_map<int32_t, std::size_t> slotByTrackId_;
+};
+
+} // namespace logic
+} // namespace domain
+
+#endif // A_HEXAGON_DOMAIN_LOGIC_TRACK_STATE_TABLE_HPP
@@ -17,62 +17,127 @@ ExtrapTrackData::ExtrapTrackData() noexcept {
     firstHopSentTime_ = static_cast<int64_t>(0);
 }
 
+// Unchecked constructor: caller guarantees the values are in range
+ExtrapTrackData::ExtrapTrackData(UncheckedInit,
+                                  int32_t trackId,
+                                  double xVelocityECEF,
+                                  double yVelocityECEF,
+                                  double zVelocityECEF,
+                                  double xPositionECEF,
+                                  double yPositionECEF,
+                                  double zPositionECEF,
+                                  int64_t originalUpdateTime,
+                                  int64_t updateTime,
+                                  int64_t firstHopSentTime) noexcept
+    : trackId_(trackId)
+    , xVelocityECEF_(xVelocityECEF)
+    , yVelocityECEF_(yVelocityECEF)
+    , zVelocityECEF_(zVelocityECEF)
+    , xPositionECEF_(xPositionECEF)
+    , yPositionECEF_(yPositionECEF)
+    , zPositionECEF_(zPositionECEF)
+    , originalUpdateTime_(originalUpdateTime)
+    , updateTime_(updateTime)
+    , firstHopSentTime_(firstHopSentTime) {
+}
+
+// Range checks - noexcept, shared by setters and validate()
+bool ExtrapTrackData::isTrackIdInRange(int32_t value) noexcept {
+    return (value >= 1LL) && (value <= 4294967295LL);
+}
+
+bool ExtrapTrackData::isXVelocityECEFInRange(double value) noexcept {
+    return !std::isnan(value) && (value >= -1.0E+6) && (value <= 1.0E+6);
+}
+
+bool ExtrapTrackData::isYVelocityECEFInRange(double value) noexcept {
+    return !std::isnan(value) && (value >= -1.0E+6) && (value <= 1.0E+6);
+}
+
+bool ExtrapTrackData::isZVelocityECEFInRange(double value) noexcept {
+    return !std::isnan(value) && (value >= -1.0E+6) && (value <= 1.0E+6);
+}
+
+bool ExtrapTrackData::isXPositionECEFInRange(double value) noexcept {
+    return !std::isnan(value) && (value >= -9.9E+10) && (value <= 9.9E+10);
+}
+
+bool ExtrapTrackData::isYPositionECEFInRange(double value) noexcept {
+    return !std::isnan(value) && (value >= -9.9E+10) && (value <= 9.9E+10);
+}
+
+bool ExtrapTrackData::isZPositionECEFInRange(double value) noexcept {
+    return !std::isnan(value) && (value >= -9.9E+10) && (value <= 9.9E+10);
+}
+
+bool ExtrapTrackData::isOriginalUpdateTimeInRange(int64_t value) noexcept {
+    return (value >= 0LL) && (value <= 9223372036854775LL);
+}
+
+bool ExtrapTrackData::isUpdateTimeInRange(int64_t value) noexcept {
+    return (value >= 0LL) && (value <= 9223372036854775LL);
+}
+
+bool ExtrapTrackData::isFirstHopSentTimeInRange(int64_t value) noexcept {
+    return (value >= 0LL) && (value <= 9223372036854775LL);
+}
+
     void ExtrapTrackData::validateTrackId(int32_t value) const {
-        if (value < 1LL || value > 4294967295LL) {
+        if (!isTrackIdInRange(value)) {
             throw std::out_of_range("TrackId value is out of valid range: " + std::to_string(value));
         }
     }
 
     void ExtrapTrackData::validateXVelocityECEF(double value) const {
-        if (std::isnan(value) || value < -1.0E+6 || value > 1.0E+6) {
+        if (!isXVelocityECEFInRange(value)) {
             throw std::out_of_range("XVelocityECEF value is out of valid range: " + std::to_string(value));
         }
     }
 
     void ExtrapTrackData::validateYVelocityECEF(double value) const {
-        if (std::isnan(value) || value < -1.0E+6 || value > 1.0E+6) {
+        if (!isYVelocityECEFInRange(value)) {
             throw std::out_of_range("YVelocityECEF value is out of valid range: " + std::to_string(value));
         }
     }
 
     void ExtrapTrackData::validateZVelocityECEF(double value) const {
-        if (std::isnan(value) || value < -1.0E+6 || value > 1.0E+6) {
+        if (!isZVelocityECEFInRange(value)) {
             throw std::out_of_range("ZVelocityECEF value is out of valid range: " + std::to_string(value));
         }
     }
 
     void ExtrapTrackData::validateXPositionECEF(double value) const {
-        if (std::isnan(value) || value < -9.9E+10 || value > 9.9E+10) {
+        if (!isXPositionECEFInRange(value)) {
             throw std::out_of_range("XPositionECEF value is out of valid range: " + std::to_string(value));
         }
     }
 
     void ExtrapTrackData::validateYPositionECEF(double value) const {
-        if (std::isnan(value) || value < -9.9E+10 || value > 9.9E+10) {
+        if (!isYPositionECEFInRange(value)) {
             throw std::out_of_range("YPositionECEF value is out of valid range: " + std::to_string(value));
         }
     }
 
     void ExtrapTrackData::validateZPositionECEF(double value) const {
-        if (std::isnan(value) || value < -9.9E+10 || value > 9.9E+10) {
+        if (!isZPositionECEFInRange(value)) {
             throw std::out_of_range("ZPositionECEF value is out of valid range: " + std::to_string(value));
         }
     }
 
     void ExtrapTrackData::validateOriginalUpdateTime(int64_t value) const {
-        if (value < 0LL || value > 9223372036854775LL) {  // Microsecond epoch time için yeterli
+        if (!isOriginalUpdateTimeInRange(value)) {  // Microsecond epoch time için yeterli
             throw std::out_of_range("OriginalUpdateTime value is out of valid range: " + std::to_string(value));
         }
     }
 
     void ExtrapTrackData::validateUpdateTime(int64_t value) const {
-        if (value < 0LL || value > 9223372036854775LL) {  // Microsecond epoch time için yeterli
+        if (!isUpdateTimeInRange(value)) {  // Microsecond epoch time için yeterli
             throw std::out_of_range("UpdateTime value is out of valid range: " + std::to_string(value));
         }
     }
 
     void ExtrapTrackData::validateFirstHopSentTime(int64_t value) const {
-        if (value < 0LL || value > 9223372036854775LL) {  // Microsecond epoch time için yeterli
+        if (!isFirstHopSentTimeInRange(value)) {  // Microsecond epoch time için yeterli
             throw std::out_of_range("FirstHopSentTime value is out of valid range: " + std::to_string(value));
         }
     }
@@ -167,197 +232,89 @@ void ExtrapTrackData::setFirstHopSentTime(const int64_t& value) {
     firstHopSentTime_ = value;
 }
 
-bool ExtrapTrackData::isValid() const noexcept {
-    try {
-        validateTrackId(trackId_);
-        validateXVelocityECEF(xVelocityECEF_);
-        validateYVelocityECEF(yVelocityECEF_);
-        validateZVelocityECEF(zVelocityECEF_);
-        validateXPositionECEF(xPositionECEF_);
-        validateYPositionECEF(yPositionECEF_);
-        validateZPositionECEF(zPositionECEF_);
-        validateOriginalUpdateTime(originalUpdateTime_);
-        validateUpdateTime(updateTime_);
-        validateFirstHopSentTime(firstHopSentTime_);
-        return true;
-    } catch (const std::exception&) {
-        return false;
-    }
-}
-
-// MISRA C++ 2023 compliant Binary Serialization Implementation
-std::vector<uint8_t> ExtrapTrackData::serialize() const {
-    std::vector<uint8_t> buffer;
-    buffer.reserve(getSerializedSize());
-    
-    // Serialize trackId_
-    {
-        const uint8_t* ptr = reinterpret_cast<const uint8_t*>(&trackId_);
-        buffer.insert(buffer.end(), ptr, ptr + sizeof(trackId_));
+uint32_t ExtrapTrackData::validate() const noexcept {
+    uint32_t errors = 0U;
+    if (!isTrackIdInRange(trackId_)) {
+        errors |= FIELD_TRACK_ID;
     }
-    
-    // Serialize xVelocityECEF_
-    {
-        const uint8_t* ptr = reinterpret_cast<const uint8_t*>(&xVelocityECEF_);
-        buffer.insert(buffer.end(), ptr, ptr + sizeof(xVelocityECEF_));
+    if (!isXVelocityECEFInRange(xVelocityECEF_)) {
+        errors |= FIELD_X_VELOCITY_ECEF;
     }
-    
-    // Serialize yVelocityECEF_
-    {
-        const uint8_t* ptr = reinterpret_cast<const uint8_t*>(&yVelocityECEF_);
-        buffer.insert(buffer.end(), ptr, ptr + sizeof(yVelocityECEF_));
+    if (!isYVelocityECEFInRange(yVelocityECEF_)) {
+        errors |= FIELD_Y_VELOCITY_ECEF;
     }
-    
-    // Serialize zVelocityECEF_
-    {
-        const uint8_t* ptr = reinterpret_cast<const uint8_t*>(&zVelocityECEF_);
-        buffer.insert(buffer.end(), ptr, ptr + sizeof(zVelocityECEF_));
+    if (!isZVelocityECEFInRange(zVelocityECEF_)) {
+        errors |= FIELD_Z_VELOCITY_ECEF;
     }
-    
-    // Serialize xPositionECEF_
-    {
-        const uint8_t* ptr = reinterpret_cast<const uint8_t*>(&xPositionECEF_);
-        buffer.insert(buffer.end(), ptr, ptr + sizeof(xPositionECEF_));
+    if (!isXPositionECEFInRange(xPositionECEF_)) {
+        errors |= FIELD_X_POSITION_ECEF;
     }
-    
-    // Serialize yPositionECEF_
-    {
-        const uint8_t* ptr = reinterpret_cast<const uint8_t*>(&yPositionECEF_);
-        buffer.insert(buffer.end(), ptr, ptr + sizeof(yPositionECEF_));
+    if (!isYPositionECEFInRange(yPositionECEF_)) {
+        errors |= FIELD_Y_POSITION_ECEF;
     }
-    
-    // Serialize zPositionECEF_
-    {
-        const uint8_t* ptr = reinterpret_cast<const uint8_t*>(&zPositionECEF_);
-        buffer.insert(buffer.end(), ptr, ptr + sizeof(zPositionECEF_));
+    if (!isZPositionECEFInRange(zPositionECEF_)) {
+        errors |= FIELD_Z_POSITION_ECEF;
     }
-    
-    // Serialize originalUpdateTime_
-    {
-        const uint8_t* ptr = reinterpret_cast<const uint8_t*>(&originalUpdateTime_);
-        buffer.insert(buffer.end(), ptr, ptr + sizeof(originalUpdateTime_));
+    if (!isOriginalUpdateTimeInRange(originalUpdateTime_)) {
+        errors |= FIELD_ORIGINAL_UPDATE_TIME;
     }
-    
-    // Serialize updateTime_
-    {
-        const uint8_t* ptr = reinterpret_cast<const uint8_t*>(&updateTime_);
-        buffer.insert(buffer.end(), ptr, ptr + sizeof(updateTime_));
+    if (!isUpdateTimeInRange(updateTime_)) {
+        errors |= FIELD_UPDATE_TIME;
     }
-    
-    // Serialize firstHopSentTime_
-    {
-        const uint8_t* ptr = reinterpret_cast<const uint8_t*>(&firstHopSentTime_);
-        buffer.insert(buffer.end(), ptr, ptr + sizeof(firstHopSentTime_));
+    if (!isFirstHopSentTimeInRange(firstHopSentTime_)) {
+        errors |= FIELD_FIRST_HOP_SENT_TIME;
     }
-    
+    return errors;
+}
+
+bool ExtrapTrackData::isValid() const noexcept {
+    return validate() == 0U;
+}
+
+// MISRA C++ 2023 compliant Binary Serialization Implementation
+// Layout: packed ExtrapTrackData::Wire, kWireSize bytes, native byte order
+std::vector<uint8_t> ExtrapTrackData::serialize() const {
+    std::vector<uint8_t> buffer(kWireSize);
+    static_cast<void>(serializeInto(buffer.data(), buffer.size()));
     return buffer;
 }
 
-bool ExtrapTrackData::deserialize(const std::vector<uint8_t>& data) noexcept {
-    if (data.size() < getSerializedSize()) {
-        return false;
-    }
-    
-    std::size_t offset = 0U;
-    
-    // Deserialize trackId_
-    if (offset + sizeof(trackId_) <= data.size()) {
-        std::memcpy(&trackId_, &data[offset], sizeof(trackId_));
-        offset += sizeof(trackId_);
-    } else {
-        return false;
-    }
-    
-    // Deserialize xVelocityECEF_
-    if (offset + sizeof(xVelocityECEF_) <= data.size()) {
-        std::memcpy(&xVelocityECEF_, &data[offset], sizeof(xVelocityECEF_));
-        offset += sizeof(xVelocityECEF_);
-    } else {
-        return false;
-    }
-    
-    // Deserialize yVelocityECEF_
-    if (offset + sizeof(yVelocityECEF_) <= data.size()) {
-        std::memcpy(&yVelocityECEF_, &data[offset], sizeof(yVelocityECEF_));
-        offset += sizeof(yVelocityECEF_);
-    } else {
-        return false;
-    }
-    
-    // Deserialize zVelocityECEF_
-    if (offset + sizeof(zVelocityECEF_) <= data.size()) {
-        std::memcpy(&zVelocityECEF_, &data[offset], sizeof(zVelocityECEF_));
-        offset += sizeof(zVelocityECEF_);
-    } else {
-        return false;
-    }
-    
-    // Deserialize xPositionECEF_
-    if (offset + sizeof(xPositionECEF_) <= data.size()) {
-        std::memcpy(&xPositionECEF_, &data[offset], sizeof(xPositionECEF_));
-        offset += sizeof(xPositionECEF_);
-    } else {
-        return false;
+std::size_t ExtrapTrackData::serializeInto(uint8_t* dst, std::size_t cap) const noexcept {
+    if ((dst == nullptr) || (cap < kWireSize)) {
+        return 0U;
     }
-    
-    // Deserialize yPositionECEF_
-    if (offset + sizeof(yPositionECEF_) <= data.size()) {
-        std::memcpy(&yPositionECEF_, &data[offset], sizeof(yPositionECEF_));
-        offset += sizeof(yPositionECEF_);
-    } else {
-        return false;
-    }
-    
-    // Deserialize zPositionECEF_
-    if (offset + sizeof(zPositionECEF_) <= data.size()) {
-        std::memcpy(&zPositionECEF_, &data[offset], sizeof(zPositionECEF_));
-        offset += sizeof(zPositionECEF_);
-    } else {
-        return false;
-    }
-    
-    // Deserialize originalUpdateTime_
-    if (offset + sizeof(originalUpdateTime_) <= data.size()) {
-        std::memcpy(&originalUpdateTime_, &data[offset], sizeof(originalUpdateTime_));
-        offset += sizeof(originalUpdateTime_);
-    } else {
-        return false;
-    }
-    
-    // Deserialize updateTime_
-    if (offset + sizeof(updateTime_) <= data.size()) {
-        std::memcpy(&updateTime_, &data[offset], sizeof(updateTime_));
-        offset += sizeof(updateTime_);
-    } else {
-        return false;
-    }
-    
-    // Deserialize firstHopSentTime_
-    if (offset + sizeof(firstHopSentTime_) <= data.size()) {
-        std::memcpy(&firstHopSentTime_, &data[offset], sizeof(firstHopSentTime_));
-        offset += sizeof(firstHopSentTime_);
-    } else {
+
+    const Wire wire{trackId_, xVelocityECEF_, yVelocityECEF_, zVelocityECEF_, xPositionECEF_, yPositionECEF_, zPositionECEF_, originalUpdateTime_, updateTime_, firstHopSentTime_};
+    std::memcpy(dst, &wire, kWireSize);
+    return kWireSize;
+}
+
+bool ExtrapTrackData::deserialize(const std::vector<uint8_t>& data) noexcept {
+    return deserialize(data.data(), data.size());
+}
+
+bool ExtrapTrackData::deserialize(const uint8_t* data, std::size_t size) noexcept {
+    if ((data == nullptr) || (size < kWireSize)) {
         return false;
     }
-    
+
+    Wire wire;
+    std::memcpy(&wire, data, kWireSize);
+    trackId_ = wire.trackId;
+    xVelocityECEF_ = wire.xVelocityECEF;
+    yVelocityECEF_ = wire.yVelocityECEF;
+    zVelocityECEF_ = wire.zVelocityECEF;
+    xPositionECEF_ = wire.xPositionECEF;
+    yPositionECEF_ = wire.yPositionECEF;
+    zPositionECEF_ = wire.zPositionECEF;
+    originalUpdateTime_ = wire.originalUpdateTime;
+    updateTime_ = wire.updateTime;
+    firstHopSentTime_ = wire.firstHopSentTime;
     return true;
 }
 
 std::size_t ExtrapTrackData::getSerializedSize() const noexcept {
-    std::size_t size = 0U;
-    
-    size += sizeof(trackId_);  // int32_t
-    size += sizeof(xVelocityECEF_);  // double
-    size += sizeof(yVelocityECEF_);  // double
-    size += sizeof(zVelocityECEF_);  // double
-    size += sizeof(xPositionECEF_);  // double
-    size += sizeof(yPositionECEF_);  // double
-    size += sizeof(zPositionECEF_);  // double
-    size += sizeof(originalUpdateTime_);  // int64_t
-    size += sizeof(updateTime_);  // int64_t
-    size += sizeof(firstHopSentTime_);  // int64_t
-    
-    return size;
+    return kWireSize;
 }
 
 }  // namespace model
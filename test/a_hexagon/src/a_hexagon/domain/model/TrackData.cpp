@@ -163,7 +163,11 @@ std::vector<uint8_t> TrackData::serialize() const {
 }
 
 bool TrackData::deserialize(const std::vector<uint8_t>& data) noexcept {
-    if (data.size() < getSerializedSize()) {
+    return deserialize(data.data(), data.size());
+}
+
+bool TrackData::deserialize(const uint8_t* data, std::size_t size) noexcept {
+    if ((data == nullptr) || (size < getSerializedSize())) {
         return false;
     }
     
@@ -171,27 +175,27 @@ bool TrackData::deserialize(const std::vector<uint8_t>& data) noexcept {
         std::size_t offset = 0;
         
         // TrackId
-        std::memcpy(&trackId_, data.data() + offset, sizeof(int32_t));
+        std::memcpy(&trackId_, data + offset, sizeof(int32_t));
         offset += sizeof(int32_t);
         
         // Velocities
-        std::memcpy(&xVelocityECEF_, data.data() + offset, sizeof(double));
+        std::memcpy(&xVelocityECEF_, data + offset, sizeof(double));
         offset += sizeof(double);
-        std::memcpy(&yVelocityECEF_, data.data() + offset, sizeof(double));
+        std::memcpy(&yVelocityECEF_, data + offset, sizeof(double));
         offset += sizeof(double);
-        std::memcpy(&zVelocityECEF_, data.data() + offset, sizeof(double));
+        std::memcpy(&zVelocityECEF_, data + offset, sizeof(double));
         offset += sizeof(double);
         
         // Positions
-        std::memcpy(&xPositionECEF_, data.data() + offset, sizeof(double));
+        std::memcpy(&xPositionECEF_, data + offset, sizeof(double));
         offset += sizeof(double);
-        std::memcpy(&yPositionECEF_, data.data() + offset, sizeof(double));
+        std::memcpy(&yPositionECEF_, data + offset, sizeof(double));
         offset += sizeof(double);
-        std::memcpy(&zPositionECEF_, data.data() + offset, sizeof(double));
+        std::memcpy(&zPositionECEF_, data + offset, sizeof(double));
         offset += sizeof(double);
         
         // Timestamp
-        std::memcpy(&originalUpdateTime_, data.data() + offset, sizeof(int64_t));
+        std::memcpy(&originalUpdateTime_, data + offset, sizeof(int64_t));
         
         return isValid();
         
@@ -21,6 +21,8 @@
 #include <cmath>
 #include <vector>
 #include <cstring>
+#include <cstddef>
+#include <type_traits>
 
 namespace domain {
 namespace model {
@@ -44,6 +46,27 @@ class ExtrapTrackData final {
 public:
     // MISRA C++ 2023 compliant constructors
     explicit ExtrapTrackData() noexcept;
+
+    /// @brief Tag selecting the unchecked constructor
+    struct UncheckedInit final {};
+    static constexpr UncheckedInit UNCHECKED{};
+
+    /**
+     * @brief Construct from values that already passed validate() upstream
+     * @details No range checks: stage-to-stage copies cost one store per field.
+     *          Only use for data validated at the ingress boundary.
+     */
+    ExtrapTrackData(UncheckedInit,
+                    int32_t trackId,
+                    double xVelocityECEF,
+                    double yVelocityECEF,
+                    double zVelocityECEF,
+                    double xPositionECEF,
+                    double yPositionECEF,
+                    double zPositionECEF,
+                    int64_t originalUpdateTime,
+                    int64_t updateTime,
+                    int64_t firstHopSentTime) noexcept;
     
     // Copy constructor
     ExtrapTrackData(const ExtrapTrackData& other) = default;
@@ -91,12 +114,69 @@ public:
     int64_t getFirstHopSentTime() const noexcept;
     void setFirstHopSentTime(const int64_t& value);
 
-    // Validation - MISRA compliant
+    // Validation - MISRA compliant, exception free
+    /// @brief Field bits reported by validate()
+    static constexpr uint32_t FIELD_TRACK_ID{1U << 0U};
+    static constexpr uint32_t FIELD_X_VELOCITY_ECEF{1U << 1U};
+    static constexpr uint32_t FIELD_Y_VELOCITY_ECEF{1U << 2U};
+    static constexpr uint32_t FIELD_Z_VELOCITY_ECEF{1U << 3U};
+    static constexpr uint32_t FIELD_X_POSITION_ECEF{1U << 4U};
+    static constexpr uint32_t FIELD_Y_POSITION_ECEF{1U << 5U};
+    static constexpr uint32_t FIELD_Z_POSITION_ECEF{1U << 6U};
+    static constexpr uint32_t FIELD_ORIGINAL_UPDATE_TIME{1U << 7U};
+    static constexpr uint32_t FIELD_UPDATE_TIME{1U << 8U};
+    static constexpr uint32_t FIELD_FIRST_HOP_SENT_TIME{1U << 9U};
+
+    /**
+     * @brief Range-check every field without throwing
+     * @return 0 if valid, otherwise the FIELD_* bits of out-of-range fields
+     */
+    [[nodiscard]] uint32_t validate() const noexcept;
     [[nodiscard]] bool isValid() const noexcept;
 
+    // Per-field range checks (setters throw std::out_of_range when these fail)
+    [[nodiscard]] static bool isTrackIdInRange(int32_t value) noexcept;
+    [[nodiscard]] static bool isXVelocityECEFInRange(double value) noexcept;
+    [[nodiscard]] static bool isYVelocityECEFInRange(double value) noexcept;
+    [[nodiscard]] static bool isZVelocityECEFInRange(double value) noexcept;
+    [[nodiscard]] static bool isXPositionECEFInRange(double value) noexcept;
+    [[nodiscard]] static bool isYPositionECEFInRange(double value) noexcept;
+    [[nodiscard]] static bool isZPositionECEFInRange(double value) noexcept;
+    [[nodiscard]] static bool isOriginalUpdateTimeInRange(int64_t value) noexcept;
+    [[nodiscard]] static bool isUpdateTimeInRange(int64_t value) noexcept;
+    [[nodiscard]] static bool isFirstHopSentTimeInRange(int64_t value) noexcept;
+
     // Binary Serialization - MISRA compliant
+    /// @brief Fixed wire size in bytes (packed fields, native byte order)
+    static constexpr std::size_t kWireSize{76U};
+
+    /**
+     * @brief Packed wire image of the serialized fields
+     * @details Trivially copyable: encode and decode are one memcpy of kWireSize bytes
+     */
+#pragma pack(push, 1)
+    struct Wire final {
+        int32_t trackId;
+        double xVelocityECEF;
+        double yVelocityECEF;
+        double zVelocityECEF;
+        double xPositionECEF;
+        double yPositionECEF;
+        double zPositionECEF;
+        int64_t originalUpdateTime;
+        int64_t updateTime;
+        int64_t firstHopSentTime;
+    };
+#pragma pack(pop)
+
     [[nodiscard]] std::vector<uint8_t> serialize() const;
+    /**
+     * @brief Encode into a caller-provided (pooled or stack) buffer
+     * @return Bytes written (kWireSize), or 0 if dst is null or cap < kWireSize
+     */
+    [[nodiscard]] std::size_t serializeInto(uint8_t* dst, std::size_t cap) const noexcept;
     bool deserialize(const std::vector<uint8_t>& data) noexcept;
+    bool deserialize(const uint8_t* data, std::size_t size) noexcept;
     [[nodiscard]] std::size_t getSerializedSize() const noexcept;
 
 private:
@@ -135,5 +215,8 @@ private:
     void validateFirstHopSentTime(int64_t value) const;
 };
 
+static_assert(sizeof(ExtrapTrackData::Wire) == ExtrapTrackData::kWireSize, "ExtrapTrackData::Wire must have no padding");
+static_assert(std::is_trivially_copyable<ExtrapTrackData::Wire>::value, "ExtrapTrackData::Wire must be trivially copyable");
+
 }  // namespace model
 }  // namespace domain
@@ -82,6 +82,7 @@ public:
     // Binary Serialization - MISRA compliant
     [[nodiscard]] std::vector<uint8_t> serialize() const;
     bool deserialize(const std::vector<uint8_t>& data) noexcept;
+    bool deserialize(const uint8_t* data, std::size_t size) noexcept;
     [[nodiscard]] std::size_t getSerializedSize() const noexcept;
 
 private:
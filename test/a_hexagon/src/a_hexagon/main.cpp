@@ -15,6 +15,7 @@
  * │  │  TrackDataZeroMQIncomingAdapter (Thread T1)                 │   │
  * │  │           ↓                                                 │   │
  * │  │  TrackDataExtrapolator (Domain Service)                     │   │
+ * │  │    └─ ExtrapolationScheduler (Thread T2, timing wheel)      │   │
  * │  │           ↓                                                 │   │
  * │  │  ExtrapTrackDataZeroMQOutgoingAdapter                       │   │
  * │  └─────────────────────────────────────────────────────────────┘   │
@@ -41,6 +42,10 @@
 #include <memory>
 
 #include "utils/Logger.hpp"
+#include "utils/MetricsPublisher.hpp"
+#include "utils/EventLog.hpp"
+#include "utils/ClockSync.hpp"
+#include "utils/InstrumentedWaitStrategy.hpp"
 
 // Adapter infrastructure
 #include "adapters/common/AdapterManager.hpp"
@@ -49,6 +54,8 @@
 // Socket abstraction (DIP)
 #include "adapters/common/messaging/IMessageSocket.hpp"
 #include "adapters/common/messaging/ZeroMQSocket.hpp"
+#include "adapters/common/messaging/UdpTimestampingSocket.hpp"
+#include "adapters/common/messaging/ZmqContextRegistry.hpp"
 
 // Incoming adapters
 #include "adapters/incoming/zeromq/TrackDataZeroMQIncomingAdapter.hpp"
@@ -64,6 +71,7 @@ static std::atomic<bool> g_running{true};
 
 // Implementation - see main.hpp for documentation
 void signalHandler(int signum) {
+    static_cast<void>(signum);  // Only used by LOG_INFO, which may be compiled out
     LOG_INFO("Received signal {}, initiating graceful shutdown...", signum);
     g_running.store(false);
 }
@@ -76,21 +84,70 @@ namespace config {
     static constexpr const char* TRACK_DATA_INCOMING_ENDPOINT = "udp://239.1.1.1:9000";
     static constexpr const char* TRACK_DATA_INCOMING_GROUP = "TrackData";
     
+    // Kernel RX timestamps: receive the RADIO datagrams on a plain UDP socket so
+    // first-hop latency excludes ZeroMQ queueing and receive-loop wake-up
+    static constexpr bool TRACK_DATA_KERNEL_TIMESTAMPS = false;
+    
     // ExtrapTrackData outgoing socket configuration (UDP RADIO for multicast)
     // NOTE: b_hexagon DISH binds to this endpoint - must match!
     static constexpr const char* EXTRAP_DATA_OUTGOING_ENDPOINT = "udp://239.1.1.2:9001";
     static constexpr const char* EXTRAP_DATA_OUTGOING_GROUP = "ExtrapTrackData";
+    
+    // ExtrapTrackData batch frames (b_hexagon unpacks both batch and single-record messages)
+    static constexpr bool EXTRAP_DATA_BATCHING = true;
+    static constexpr std::size_t EXTRAP_DATA_BATCH_MTU_BYTES = 1400U;
+    
+    // Publisher worker wait strategy: Blocking frees the core at idle but pays a
+    // futex wake-up per tick; SpinThenPark spins the budget first; BusySpin only
+    // on an isolated core. Wake-up latency is logged at shutdown
+    static constexpr utils::WaitStrategyKind EXTRAP_DATA_WAIT_STRATEGY = utils::WaitStrategyKind::Blocking;
+    static constexpr int64_t EXTRAP_DATA_WAIT_SPIN_BUDGET_US = 50;
+    static constexpr bool WAKE_LATENCY_HISTOGRAMS_ENABLED = true;
+    
+    // Shared ZeroMQ context: I/O thread kept off the pipeline cores (1-3)
+    static constexpr int32_t MESSAGING_IO_THREADS = 1;
+    static constexpr int32_t MESSAGING_IO_THREAD_CPU = 0;
+    
+    // Runtime counters (receive/drop/send) snapshot to the hexagon_metrics CLI
+    static constexpr const char* METRICS_SOURCE_NAME = "a_hexagon";
+    static constexpr int64_t METRICS_PUBLISH_INTERVAL_MS = 1000;
+    
+    // Binary per-message event log (decode with hexagon_eventlog), one ring file per thread
+    static constexpr bool EVENT_LOG_ENABLED = false;
+    static constexpr const char* EVENT_LOG_DIRECTORY = "/tmp";
+    static constexpr uint32_t EVENT_LOG_CAPACITY = 1U << 16;  // Records per thread (3 MiB)
+    
+    // Clock sync responder: b_hexagon pings it to estimate our clock offset
+    // and correct the first hop delay
+    static constexpr bool CLOCK_SYNC_ENABLED = true;
+    static constexpr const char* CLOCK_SYNC_RESPONDER_ENDPOINT = "udp://0.0.0.0:15100";
 }
 
 /**
  * @brief Create socket for incoming TrackData (DIP compliant)
- * @return Configured socket ready for binding (UDP DISH)
+ * @return Configured socket ready for binding (UDP DISH, or kernel-timestamped UDP)
  */
 std::unique_ptr<adapters::common::messaging::IMessageSocket> createIncomingSocket() {
+    if (config::TRACK_DATA_KERNEL_TIMESTAMPS) {
+        auto udpSocket = std::make_unique<adapters::common::messaging::UdpTimestampingSocket>(
+            config::TRACK_DATA_INCOMING_GROUP);
+        if (!udpSocket->connect(config::TRACK_DATA_INCOMING_ENDPOINT)) {
+            LOG_ERROR("Failed to bind timestamped UDP socket to {}", config::TRACK_DATA_INCOMING_ENDPOINT);
+            return nullptr;
+        }
+        LOG_INFO("Incoming UDP socket bound to {} with group {} - kernel timestamps: {}",
+                 config::TRACK_DATA_INCOMING_ENDPOINT, config::TRACK_DATA_INCOMING_GROUP,
+                 udpSocket->timestampModeName());
+        return udpSocket;
+    }
+    
     auto socket = std::make_unique<adapters::common::messaging::ZeroMQSocket>(
         adapters::common::messaging::ZeroMQSocket::SocketType::DISH
     );
     
+    // Only the adapter's worker thread touches the socket after setup
+    socket->setThreadingModel(adapters::common::messaging::ZeroMQSocket::ThreadingModel::ThreadOwned);
+    
     // Bind to UDP multicast endpoint first
     if (!socket->connect(config::TRACK_DATA_INCOMING_ENDPOINT, 
                          adapters::common::messaging::ZeroMQSocket::ConnectionMode::Bind)) {
@@ -115,6 +172,9 @@ std::unique_ptr<adapters::common::messaging::IMessageSocket> createOutgoingSocke
         adapters::common::messaging::ZeroMQSocket::SocketType::RADIO
     );
     
+    // Only the adapter's worker thread touches the socket after setup
+    socket->setThreadingModel(adapters::common::messaging::ZeroMQSocket::ThreadingModel::ThreadOwned);
+    
     // Connect to UDP multicast endpoint (b_hexagon DISH socket binds)
     if (!socket->connect(config::EXTRAP_DATA_OUTGOING_ENDPOINT,
                          adapters::common::messaging::ZeroMQSocket::ConnectionMode::Connect)) {
@@ -137,6 +197,11 @@ int main() {
         LOG_INFO("  Thread-per-Type Architecture (DIP Compliant)");
         LOG_INFO("=================================================");
         
+        if (config::EVENT_LOG_ENABLED) {
+            utils::EventLog::instance().enable(config::EVENT_LOG_DIRECTORY, "a_hexagon", config::EVENT_LOG_CAPACITY);
+            LOG_INFO("Binary event log enabled - directory: {}", config::EVENT_LOG_DIRECTORY);
+        }
+        
         // Register signal handlers for graceful shutdown
         std::signal(SIGINT, signalHandler);
         std::signal(SIGTERM, signalHandler);
@@ -149,6 +214,12 @@ int main() {
         // ========================================
         LOG_INFO("Creating TrackData processing pipeline with DIP...");
         
+        // All sockets share one ZeroMQ context - configure before the first socket
+        adapters::common::messaging::ZmqContextConfig zmqConfig;
+        zmqConfig.ioThreads = config::MESSAGING_IO_THREADS;
+        zmqConfig.ioThreadCpus = {config::MESSAGING_IO_THREAD_CPU};
+        static_cast<void>(adapters::common::messaging::ZmqContextRegistry::instance().configure(zmqConfig));
+        
         // Create sockets via factory functions (DIP compliant)
         auto outgoingSocket = createOutgoingSocket();
         if (!outgoingSocket) {
@@ -164,10 +235,23 @@ int main() {
             return 1;
         }
         
+        // Publisher worker wait strategy, wrapped to record wake-up latency
+        std::shared_ptr<utils::WaitStrategy> publisher_wait = utils::makeWaitStrategy(
+            config::EXTRAP_DATA_WAIT_STRATEGY, std::chrono::microseconds(config::EXTRAP_DATA_WAIT_SPIN_BUDGET_US));
+        std::shared_ptr<utils::InstrumentedWaitStrategy> publisher_wait_probe;
+        if (config::WAKE_LATENCY_HISTOGRAMS_ENABLED) {
+            publisher_wait_probe = std::make_shared<utils::InstrumentedWaitStrategy>(publisher_wait);
+            publisher_wait = publisher_wait_probe;
+        }
+        
         // Create outgoing adapter with injected socket (DIP)
         auto outgoing_adapter = std::make_shared<adapters::outgoing::zeromq::ExtrapTrackDataZeroMQOutgoingAdapter>(
-            std::move(outgoingSocket)
+            std::move(outgoingSocket),
+            publisher_wait
         );
+        if (config::EXTRAP_DATA_BATCHING) {
+            static_cast<void>(outgoing_adapter->setBatching(true, config::EXTRAP_DATA_BATCH_MTU_BYTES));
+        }
         
         // Create domain service with outgoing port
         auto extrapolator = std::make_shared<domain::logic::TrackDataExtrapolator>(outgoing_adapter.get());
@@ -196,6 +280,14 @@ int main() {
         //     sensor_service, std::move(sensorSocket));
         // adapter_manager.registerPipeline(MessagePipeline::create("SensorData", sensor_adapter));
         
+        // Start extrapolation scheduler before data starts flowing so the
+        // receive thread never blocks on a synchronous extrapolation burst
+        if (!extrapolator->start()) {
+            LOG_ERROR("Failed to start extrapolation scheduler");
+            utils::Logger::shutdown();
+            return 1;
+        }
+        
         // Start all registered pipelines
         LOG_INFO("Starting all pipelines...");
         if (!adapter_manager.startAll()) {
@@ -208,14 +300,40 @@ int main() {
         LOG_INFO("Registered pipelines: {}", adapter_manager.getPipelineCount());
         LOG_INFO("Press Ctrl+C to shutdown gracefully");
         
+        // Metrics snapshots are best effort: the pipeline runs without them
+        utils::MetricsPublisher metrics_publisher(config::METRICS_SOURCE_NAME, utils::DEFAULT_METRICS_SOCKET_PATH,
+                                                  std::chrono::milliseconds(config::METRICS_PUBLISH_INTERVAL_MS));
+        if (!metrics_publisher.start()) {
+            LOG_WARN("Metrics publisher unavailable, runtime counters not exported");
+        }
+        
+        utils::ClockSyncResponder clock_responder(config::CLOCK_SYNC_RESPONDER_ENDPOINT);
+        if (config::CLOCK_SYNC_ENABLED && !clock_responder.start()) {
+            LOG_WARN("Clock sync responder could not bind {}", config::CLOCK_SYNC_RESPONDER_ENDPOINT);
+        }
+        
         // Main loop - wait for shutdown signal
         while (g_running.load()) {
             std::this_thread::sleep_for(std::chrono::milliseconds(100));
         }
         
         // Graceful shutdown
+        // Stop the receiver first so no TrackData reaches the extrapolator, then
+        // the scheduler so no sample is emitted into a stopped outgoing adapter
         LOG_INFO("Stopping all pipelines...");
+        incoming_adapter->stop();
+        extrapolator->stop();
         adapter_manager.stopAll();
+        metrics_publisher.stop();
+        clock_responder.stop();
+        LOG_INFO("Clock sync: answered {} b_hexagon pings", clock_responder.answeredCount());
+        if (publisher_wait_probe) {
+            const utils::HdrHistogram& wake_latency = publisher_wait_probe->wakeLatency();
+            static_cast<void>(wake_latency);  // Only used by LOG_INFO, which may be compiled out
+            LOG_INFO("Wake-up latency publisher ({}) | n={} | p50: {} ns | p99: {} ns | max: {} ns",
+                     publisher_wait_probe->name(), wake_latency.count(), wake_latency.valueAtPercentile(50.0),
+                     wake_latency.valueAtPercentile(99.0), wake_latency.max());
+        }
         
         LOG_INFO("=================================================");
         LOG_INFO("  A_Hexagon Application Shutdown Complete");
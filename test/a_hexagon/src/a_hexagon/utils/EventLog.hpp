@@ -0,0 +1,312 @@
+/**
+ * @file EventLog.hpp
+ * @brief Binary structured hot-path event log in per-thread mmap'd ring files
+ * @details Per-message text logging formats and prints every record; this log
+ *          stores fixed 48-byte binary records instead, so tracing every
+ *          message stays affordable. Each thread that records gets its own
+ *          file, mapped MAP_SHARED, laid out as:
+ *
+ * @code
+ * offset  size  field
+ *      0    64  EventLogFileHeader (magic "HEVL", version, capacity,
+ *               records written so far, thread id, clock bases, source)
+ *     64     -  capacity * EventRecord ring (slot = sequence % capacity)
+ * @endcode
+ *
+ * The hexagon_eventlog tool decodes the files offline to text or CSV. Pages
+ * live in the page cache, so a crashed process still leaves a readable log.
+ *
+ * Design:
+ * - record() is a memcpy into the thread's own ring plus one release store
+ *   of the write count: no locks, no syscalls, no formatting.
+ * - A thread's file is created on its first record() after enable(); the
+ *   ring overwrites the oldest records once full.
+ * - Timestamps are CLOCK_MONOTONIC ns; the header stores a wall/monotonic
+ *   pair taken at file creation for conversion.
+ *
+ * @author a_hexagon Team
+ * @version 1.0
+ * @date 2025
+ *
+ * @note MISRA C++ 2023 compliant implementation
+ * @note Linux/POSIX only (mmap, gettid)
+ */
+
+#ifndef A_HEXAGON_UTILS_EVENT_LOG_HPP
+#define A_HEXAGON_UTILS_EVENT_LOG_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <ctime>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace utils {
+
+/**
+ * @brief Event identifiers (stable: the decoder maps them to names)
+ */
+enum class EventId : uint16_t {
+    TrackReceived = 1U,       ///< args: latency us, frame bytes
+    BurstReplaced = 2U,       ///< args: generation
+    SampleExtrapolated = 3U,  ///< args: sample index, generation
+    TableExtrapolated = 4U,   ///< args: table size, extrapolation time us
+    RecordSent = 5U,          ///< args: bytes
+    BatchSent = 6U,           ///< args: records, bytes, sequence
+    QueueDrop = 7U,           ///< args: evicted records
+    SendFailed = 8U           ///< args: records
+};
+
+/**
+ * @struct EventRecord
+ * @brief Fixed 48-byte event record
+ */
+struct EventRecord {
+    int64_t timestampNs{0};   ///< CLOCK_MONOTONIC
+    uint16_t eventId{0U};     ///< EventId
+    uint16_t reserved{0U};
+    int32_t trackId{0};       ///< -1 when the event is not about one track
+    int64_t args[4]{};        ///< Event-specific numeric arguments
+};
+
+/**
+ * @struct EventLogFileHeader
+ * @brief Fixed 64-byte file header
+ */
+struct EventLogFileHeader {
+    uint32_t magic{0U};
+    uint16_t version{0U};
+    uint16_t recordSize{0U};
+    uint32_t capacity{0U};            ///< Ring slots
+    uint32_t reserved{0U};
+    uint64_t writeCount{0U};          ///< Records written (release-stored after each record)
+    int64_t threadId{0};              ///< Kernel thread id of the writer
+    int64_t wallBaseNs{0};            ///< CLOCK_REALTIME at creation
+    int64_t monoBaseNs{0};            ///< CLOCK_MONOTONIC at creation
+    char source[16]{};                ///< Process name, NUL padded
+};
+
+static_assert(sizeof(EventRecord) == 48U, "EventRecord must be 48 bytes on the wire");
+static_assert(sizeof(EventLogFileHeader) == 64U, "EventLogFileHeader must be 64 bytes on the wire");
+
+/// @brief File identification constants ("HEVL")
+static constexpr uint32_t EVENT_LOG_MAGIC{0x4C564548U};
+static constexpr uint16_t EVENT_LOG_VERSION{1U};
+static constexpr uint32_t DEFAULT_EVENT_LOG_CAPACITY{1U << 16};  ///< 3 MiB per thread
+
+/**
+ * @class EventLogRing
+ * @brief One thread's mapped ring file (single writer)
+ */
+class EventLogRing final {
+public:
+    EventLogRing() = default;
+
+    // Non-copyable, non-movable (owns a mapping)
+    EventLogRing(const EventLogRing&) = delete;
+    EventLogRing& operator=(const EventLogRing&) = delete;
+    EventLogRing(EventLogRing&&) = delete;
+    EventLogRing& operator=(EventLogRing&&) = delete;
+
+    ~EventLogRing() {
+        close();
+    }
+
+    /**
+     * @brief Create, size and map the ring file
+     * @return false if the file cannot be created or mapped
+     */
+    [[nodiscard]] bool open(const std::string& path, const char* source, uint32_t capacity) {
+        const int fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+        if (fd < 0) {
+            return false;
+        }
+        const std::size_t bytes = sizeof(EventLogFileHeader) + (static_cast<std::size_t>(capacity) * sizeof(EventRecord));
+        void* mapping = MAP_FAILED;
+        if (::ftruncate(fd, static_cast<off_t>(bytes)) == 0) {
+            mapping = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        }
+        static_cast<void>(::close(fd));  // The mapping keeps the file alive
+        if (mapping == MAP_FAILED) {
+            return false;
+        }
+
+        mapping_ = mapping;
+        bytes_ = bytes;
+        capacity_ = capacity;
+        header_ = static_cast<EventLogFileHeader*>(mapping);
+        records_ = reinterpret_cast<EventRecord*>(static_cast<uint8_t*>(mapping) + sizeof(EventLogFileHeader));
+
+        EventLogFileHeader header;
+        header.magic = EVENT_LOG_MAGIC;
+        header.version = EVENT_LOG_VERSION;
+        header.recordSize = static_cast<uint16_t>(sizeof(EventRecord));
+        header.capacity = capacity;
+        header.threadId = static_cast<int64_t>(::syscall(SYS_gettid));
+        header.wallBaseNs = clockNs(CLOCK_REALTIME);
+        header.monoBaseNs = clockNs(CLOCK_MONOTONIC);
+        std::strncpy(header.source, source, sizeof(header.source) - 1U);
+        std::memcpy(header_, &header, sizeof(header));
+        return true;
+    }
+
+    /**
+     * @brief Append one record, overwriting the oldest when full
+     */
+    void write(const EventRecord& record) noexcept {
+        std::memcpy(&records_[sequence_ % capacity_], &record, sizeof(EventRecord));
+        ++sequence_;
+        __atomic_store_n(&header_->writeCount, sequence_, __ATOMIC_RELEASE);
+    }
+
+    [[nodiscard]] bool isOpen() const noexcept {
+        return mapping_ != nullptr;
+    }
+
+    [[nodiscard]] uint64_t writeCount() const noexcept {
+        return sequence_;
+    }
+
+    void close() noexcept {
+        if (mapping_ != nullptr) {
+            static_cast<void>(::munmap(mapping_, bytes_));
+            mapping_ = nullptr;
+            header_ = nullptr;
+            records_ = nullptr;
+        }
+    }
+
+    static int64_t clockNs(clockid_t clock) noexcept {
+        timespec ts{};
+        static_cast<void>(::clock_gettime(clock, &ts));
+        return (static_cast<int64_t>(ts.tv_sec) * 1000000000LL) + static_cast<int64_t>(ts.tv_nsec);
+    }
+
+private:
+    void* mapping_{nullptr};                  ///< Whole file mapping
+    std::size_t bytes_{0U};                   ///< Mapping length
+    uint32_t capacity_{0U};                   ///< Ring slots
+    uint64_t sequence_{0U};                   ///< Records written by this thread
+    EventLogFileHeader* header_{nullptr};     ///< Header view
+    EventRecord* records_{nullptr};           ///< Ring view
+};
+
+/**
+ * @class EventLog
+ * @brief Process-wide switch and per-thread ring files
+ */
+class EventLog final {
+public:
+    static EventLog& instance() {
+        static EventLog log;
+        return log;
+    }
+
+    /**
+     * @brief Enable recording (call before the pipeline threads start)
+     * @param directory Where thread files are created
+     * @param source Process name, also the file name prefix
+     * @param capacity Records per thread file
+     */
+    void enable(const std::string& directory, const std::string& source,
+                uint32_t capacity = DEFAULT_EVENT_LOG_CAPACITY) {
+        std::lock_guard<std::mutex> lock(configMutex_);
+        directory_ = directory;
+        source_ = source;
+        capacity_ = (capacity == 0U) ? DEFAULT_EVENT_LOG_CAPACITY : capacity;
+        enabled_.store(true, std::memory_order_release);
+    }
+
+    /**
+     * @brief Stop recording (existing files stay on disk)
+     */
+    void disable() noexcept {
+        enabled_.store(false, std::memory_order_release);
+    }
+
+    [[nodiscard]] bool isEnabled() const noexcept {
+        return enabled_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Record one event from the calling thread
+     * @param id Event identifier
+     * @param trackId Track the event is about (-1 if none)
+     */
+    void record(EventId id, int32_t trackId, int64_t arg0 = 0, int64_t arg1 = 0,
+                int64_t arg2 = 0, int64_t arg3 = 0) noexcept {
+        if (!enabled_.load(std::memory_order_relaxed)) {
+            return;
+        }
+        EventLogRing* ring = threadRing();
+        if (ring == nullptr) {
+            return;
+        }
+        EventRecord event;
+        event.timestampNs = EventLogRing::clockNs(CLOCK_MONOTONIC);
+        event.eventId = static_cast<uint16_t>(id);
+        event.trackId = trackId;
+        event.args[0] = arg0;
+        event.args[1] = arg1;
+        event.args[2] = arg2;
+        event.args[3] = arg3;
+        ring->write(event);
+    }
+
+    /// @brief Threads whose ring file could not be created
+    [[nodiscard]] uint64_t failedThreadCount() const noexcept {
+        return failedThreads_.load(std::memory_order_relaxed);
+    }
+
+private:
+    EventLog() = default;
+
+    /**
+     * @brief Calling thread's ring, created on first use
+     * @return nullptr if the file could not be created (not retried)
+     */
+    EventLogRing* threadRing() noexcept {
+        thread_local std::unique_ptr<EventLogRing> ring;
+        thread_local bool failed = false;
+        if ((ring == nullptr) && !failed) {
+            failed = !openThreadRing(ring);
+        }
+        return ring.get();
+    }
+
+    bool openThreadRing(std::unique_ptr<EventLogRing>& ring) noexcept {
+        try {
+            std::lock_guard<std::mutex> lock(configMutex_);
+            const std::string path = directory_ + "/" + source_ + "_events_" +
+                                     std::to_string(::getpid()) + "_" +
+                                     std::to_string(::syscall(SYS_gettid)) + ".bin";
+            auto created = std::make_unique<EventLogRing>();
+            if (created->open(path, source_.c_str(), capacity_)) {
+                ring = std::move(created);
+                return true;
+            }
+        } catch (...) {
+            // Allocation failure: fall through and stop trying on this thread
+        }
+        failedThreads_.fetch_add(1U, std::memory_order_relaxed);
+        return false;
+    }
+
+    std::atomic<bool> enabled_{false};            ///< Master switch
+    std::mutex configMutex_;                      ///< Guards the file settings
+    std::string directory_{"/tmp"};               ///< Output directory
+    std::string source_{"hexagon"};               ///< File name prefix / header source
+    uint32_t capacity_{DEFAULT_EVENT_LOG_CAPACITY};  ///< Records per thread file
+    std::atomic<uint64_t> failedThreads_{0U};     ///< Threads without a ring
+};
+
+} // namespace utils
+
+#endif // A_HEXAGON_UTILS_EVENT_LOG_HPP
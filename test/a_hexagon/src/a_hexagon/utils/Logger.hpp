@@ -30,11 +30,27 @@
 
 #pragma once
 
+// Compile-time minimum level (spdlog convention): LOG_* call sites below it
+// expand to ((void)0) and their arguments are never evaluated. Build with
+// -DSPDLOG_ACTIVE_LEVEL=SPDLOG_LEVEL_WARN to keep warnings and above only.
+// The legacy ENABLE_TRACE_LOG / ENABLE_DEBUG_LOG flags lower it; default: info.
+#ifndef SPDLOG_ACTIVE_LEVEL
+    #if defined(ENABLE_TRACE_LOG)
+        #define SPDLOG_ACTIVE_LEVEL 0
+    #elif defined(ENABLE_DEBUG_LOG)
+        #define SPDLOG_ACTIVE_LEVEL 1
+    #endif
+#endif
+
 #include <spdlog/spdlog.h>
 #include <spdlog/async.h>
 #include <spdlog/sinks/stdout_color_sinks.h>
 #include <spdlog/sinks/rotating_file_sink.h>
+#include <spdlog/sinks/null_sink.h>
 #include <memory>
+#include <atomic>
+#include <chrono>
+#include <limits>
 #include <string>
 #include <vector>
 #include <cstdint>
@@ -149,10 +165,15 @@ public:
 
     /**
      * @brief Shutdown logger and flush all pending messages
+     * @details spdlog::shutdown() drops the default logger; a discarding one is
+     *          installed in its place so late LOG_* calls (worker threads still
+     *          stopping, later test suites) are no-ops instead of crashes.
      * @note Call at application shutdown
      */
     static void shutdown() {
         spdlog::shutdown();
+        spdlog::set_default_logger(
+            std::make_shared<spdlog::logger>("", std::make_shared<spdlog::sinks::null_sink_mt>()));
         initialized_ = false;
     }
 
@@ -235,26 +256,122 @@ private:
     static inline bool initialized_{false};  // MISRA: Brace initialization
 };
 
+/**
+ * @brief Per-call-site state behind the LOG_*_EVERY_N / LOG_*_EVERY_MS macros
+ * @details Every macro expansion owns one function-local static instance, so
+ *          each call site is sampled on its own. Lock-free and callable from
+ *          any thread; under contention exactly one caller wins each window.
+ */
+class LogRateLimiter final {
+public:
+    /**
+     * @brief Pass the 1st, (n+1)th, (2n+1)th ... call
+     */
+    [[nodiscard]] bool everyN(uint64_t n) noexcept {
+        const uint64_t call = calls_.fetch_add(1U, std::memory_order_relaxed);
+        return (n <= 1U) || ((call % n) == 0U);
+    }
+
+    /**
+     * @brief Pass the first call, then at most one call per interval
+     */
+    [[nodiscard]] bool everyMs(int64_t intervalMs) noexcept {
+        const int64_t now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+        int64_t next = nextNs_.load(std::memory_order_relaxed);
+        if (now < next) {
+            return false;
+        }
+        return nextNs_.compare_exchange_strong(next, now + (intervalMs * 1000000),
+                                               std::memory_order_relaxed);
+    }
+
+private:
+    std::atomic<uint64_t> calls_{0U};                                    ///< Calls seen (EVERY_N)
+    std::atomic<int64_t> nextNs_{std::numeric_limits<int64_t>::min()};   ///< Next allowed time (EVERY_MS)
+};
+
 } // namespace utils
 
-// Convenience macros for conditional compilation
-#ifdef ENABLE_TRACE_LOG
+// Per-call-site sampling for per-message logs, e.g.
+//   LOG_INFO_EVERY_N(1000, "Track {} received", id);      // 1 in 1000 calls
+//   LOG_WARN_EVERY_MS(1000, "Queue full, dropping {}", id); // at most 1/s
+#define LOG_EVERY_N_IMPL(logMacro, n, ...) \
+    do { \
+        static utils::LogRateLimiter logRateLimiter_; \
+        if (logRateLimiter_.everyN(static_cast<uint64_t>(n))) { \
+            logMacro(__VA_ARGS__); \
+        } \
+    } while (false)
+
+#define LOG_EVERY_MS_IMPL(logMacro, ms, ...) \
+    do { \
+        static utils::LogRateLimiter logRateLimiter_; \
+        if (logRateLimiter_.everyMs(static_cast<int64_t>(ms))) { \
+            logMacro(__VA_ARGS__); \
+        } \
+    } while (false)
+
+// Level macros (compiled out below SPDLOG_ACTIVE_LEVEL)
+#if SPDLOG_ACTIVE_LEVEL <= SPDLOG_LEVEL_TRACE
     #define LOG_TRACE(...) utils::Logger::trace(__VA_ARGS__)
+    #define LOG_TRACE_EVERY_N(n, ...) LOG_EVERY_N_IMPL(LOG_TRACE, n, __VA_ARGS__)
+    #define LOG_TRACE_EVERY_MS(ms, ...) LOG_EVERY_MS_IMPL(LOG_TRACE, ms, __VA_ARGS__)
 #else
     #define LOG_TRACE(...) ((void)0)
+    #define LOG_TRACE_EVERY_N(n, ...) ((void)0)
+    #define LOG_TRACE_EVERY_MS(ms, ...) ((void)0)
 #endif
 
-#ifdef ENABLE_DEBUG_LOG
+#if SPDLOG_ACTIVE_LEVEL <= SPDLOG_LEVEL_DEBUG
     #define LOG_DEBUG(...) utils::Logger::debug(__VA_ARGS__)
+    #define LOG_DEBUG_EVERY_N(n, ...) LOG_EVERY_N_IMPL(LOG_DEBUG, n, __VA_ARGS__)
+    #define LOG_DEBUG_EVERY_MS(ms, ...) LOG_EVERY_MS_IMPL(LOG_DEBUG, ms, __VA_ARGS__)
 #else
-    #define LOG_DEBUG(...) utils::Logger::debug(__VA_ARGS__)
+    #define LOG_DEBUG(...) ((void)0)
+    #define LOG_DEBUG_EVERY_N(n, ...) ((void)0)
+    #define LOG_DEBUG_EVERY_MS(ms, ...) ((void)0)
+#endif
+
+#if SPDLOG_ACTIVE_LEVEL <= SPDLOG_LEVEL_INFO
+    #define LOG_INFO(...) utils::Logger::info(__VA_ARGS__)
+    #define LOG_INFO_EVERY_N(n, ...) LOG_EVERY_N_IMPL(LOG_INFO, n, __VA_ARGS__)
+    #define LOG_INFO_EVERY_MS(ms, ...) LOG_EVERY_MS_IMPL(LOG_INFO, ms, __VA_ARGS__)
+#else
+    #define LOG_INFO(...) ((void)0)
+    #define LOG_INFO_EVERY_N(n, ...) ((void)0)
+    #define LOG_INFO_EVERY_MS(ms, ...) ((void)0)
+#endif
+
+#if SPDLOG_ACTIVE_LEVEL <= SPDLOG_LEVEL_WARN
+    #define LOG_WARN(...) utils::Logger::warn(__VA_ARGS__)
+    #define LOG_WARN_EVERY_N(n, ...) LOG_EVERY_N_IMPL(LOG_WARN, n, __VA_ARGS__)
+    #define LOG_WARN_EVERY_MS(ms, ...) LOG_EVERY_MS_IMPL(LOG_WARN, ms, __VA_ARGS__)
+#else
+    #define LOG_WARN(...) ((void)0)
+    #define LOG_WARN_EVERY_N(n, ...) ((void)0)
+    #define LOG_WARN_EVERY_MS(ms, ...) ((void)0)
 #endif
 
-// Always enabled logs
-#define LOG_INFO(...) utils::Logger::info(__VA_ARGS__)
-#define LOG_WARN(...) utils::Logger::warn(__VA_ARGS__)
-#define LOG_ERROR(...) utils::Logger::error(__VA_ARGS__)
-#define LOG_CRITICAL(...) utils::Logger::critical(__VA_ARGS__)
+#if SPDLOG_ACTIVE_LEVEL <= SPDLOG_LEVEL_ERROR
+    #define LOG_ERROR(...) utils::Logger::error(__VA_ARGS__)
+    #define LOG_ERROR_EVERY_N(n, ...) LOG_EVERY_N_IMPL(LOG_ERROR, n, __VA_ARGS__)
+    #define LOG_ERROR_EVERY_MS(ms, ...) LOG_EVERY_MS_IMPL(LOG_ERROR, ms, __VA_ARGS__)
+#else
+    #define LOG_ERROR(...) ((void)0)
+    #define LOG_ERROR_EVERY_N(n, ...) ((void)0)
+    #define LOG_ERROR_EVERY_MS(ms, ...) ((void)0)
+#endif
+
+#if SPDLOG_ACTIVE_LEVEL <= SPDLOG_LEVEL_CRITICAL
+    #define LOG_CRITICAL(...) utils::Logger::critical(__VA_ARGS__)
+    #define LOG_CRITICAL_EVERY_N(n, ...) LOG_EVERY_N_IMPL(LOG_CRITICAL, n, __VA_ARGS__)
+    #define LOG_CRITICAL_EVERY_MS(ms, ...) LOG_EVERY_MS_IMPL(LOG_CRITICAL, ms, __VA_ARGS__)
+#else
+    #define LOG_CRITICAL(...) ((void)0)
+    #define LOG_CRITICAL_EVERY_N(n, ...) ((void)0)
+    #define LOG_CRITICAL_EVERY_MS(ms, ...) ((void)0)
+#endif
 
 // Legacy compatibility - Logger singleton wrapper
 class Logger {
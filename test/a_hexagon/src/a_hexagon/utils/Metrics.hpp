@@ -0,0 +1,239 @@
+/**
+ * @file Metrics.hpp
+ * @brief Lock-free runtime counters and gauges with a snapshot wire format
+ * @details Adapters and domain services register named metrics once (at
+ *          construction) and update them on the hot path with one relaxed
+ *          atomic operation. MetricsPublisher snapshots the registry periodically.
+ *
+ * Design:
+ * - Every Metric sits on its own cache line, so no false sharing between
+ *   stages. Counters use a relaxed fetch_add: safe from any number of
+ *   threads, and uncontended when (as usual) one stage thread writes it.
+ * - Registration and snapshots take the registry mutex; updates never do.
+ * - Metrics live for the whole process: references stay valid and a
+ *   re-created component with the same metric names continues the counts.
+ *
+ * @author a_hexagon Team
+ * @version 1.0
+ * @date 2025
+ *
+ * @note MISRA C++ 2023 compliant implementation
+ * @see MetricsPublisher.hpp
+ */
+
+#ifndef A_HEXAGON_UTILS_METRICS_HPP
+#define A_HEXAGON_UTILS_METRICS_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace utils {
+
+/**
+ * @brief Metric semantics (drives rate calculation and display)
+ */
+enum class MetricKind : uint8_t {
+    Counter = 1U,  ///< Monotonic total; publisher adds a per-second rate
+    Gauge = 2U     ///< Last sampled level (e.g. queue depth)
+};
+
+/**
+ * @class Metric
+ * @brief One cache-line-aligned counter or gauge
+ */
+class alignas(64) Metric final {
+public:
+    Metric(std::string name, MetricKind kind)
+        : name_(std::move(name))
+        , kind_(kind) {
+    }
+
+    // Non-copyable, non-movable (components hold references)
+    Metric(const Metric&) = delete;
+    Metric& operator=(const Metric&) = delete;
+    Metric(Metric&&) = delete;
+    Metric& operator=(Metric&&) = delete;
+    ~Metric() = default;
+
+    /**
+     * @brief Increment a counter (any thread, wait-free)
+     */
+    void add(uint64_t amount = 1U) noexcept {
+        value_.fetch_add(static_cast<int64_t>(amount), std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Set a gauge level
+     */
+    void set(int64_t value) noexcept {
+        value_.store(value, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] int64_t value() const noexcept {
+        return value_.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] const std::string& name() const noexcept {
+        return name_;
+    }
+
+    [[nodiscard]] MetricKind kind() const noexcept {
+        return kind_;
+    }
+
+private:
+    std::atomic<int64_t> value_{0};  ///< Hot field, first on the line
+    std::string name_;               ///< Dotted name, e.g. "incoming.received"
+    MetricKind kind_;                ///< Counter or gauge
+};
+
+/**
+ * @struct MetricSample
+ * @brief Point-in-time value of one metric
+ */
+struct MetricSample {
+    const Metric* metric{nullptr};
+    int64_t value{0};
+};
+
+/**
+ * @class MetricsRegistry
+ * @brief Process-wide, append-only set of named metrics
+ */
+class MetricsRegistry final {
+public:
+    static MetricsRegistry& instance() {
+        static MetricsRegistry registry;
+        return registry;
+    }
+
+    // Non-copyable, non-movable (singleton)
+    MetricsRegistry(const MetricsRegistry&) = delete;
+    MetricsRegistry& operator=(const MetricsRegistry&) = delete;
+    MetricsRegistry(MetricsRegistry&&) = delete;
+    MetricsRegistry& operator=(MetricsRegistry&&) = delete;
+
+    /**
+     * @brief Counter with this name (created on first request)
+     * @details Not for the hot path: look the metric up once and keep the reference
+     */
+    Metric& counter(const std::string& name) {
+        return findOrCreate(name, MetricKind::Counter);
+    }
+
+    /**
+     * @brief Gauge with this name (created on first request)
+     */
+    Metric& gauge(const std::string& name) {
+        return findOrCreate(name, MetricKind::Gauge);
+    }
+
+    /**
+     * @brief Read every metric in registration order
+     * @param out Replaced with one sample per metric
+     */
+    void snapshot(std::vector<MetricSample>& out) const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        out.clear();
+        for (const auto& metric : metrics_) {
+            out.push_back(MetricSample{metric.get(), metric->value()});
+        }
+    }
+
+    [[nodiscard]] std::size_t size() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return metrics_.size();
+    }
+
+private:
+    MetricsRegistry() = default;
+    ~MetricsRegistry() = default;
+
+    Metric& findOrCreate(const std::string& name, MetricKind kind) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (const auto& metric : metrics_) {
+            if (metric->name() == name) {
+                return *metric;
+            }
+        }
+        metrics_.push_back(std::make_unique<Metric>(name, kind));
+        return *metrics_.back();
+    }
+
+    mutable std::mutex mutex_;                        ///< Guards metrics_
+    std::vector<std::unique_ptr<Metric>> metrics_;    ///< Stable addresses
+};
+
+// ==================== Snapshot Wire Format ====================
+//
+// One datagram per snapshot, native byte order:
+//   MetricsFrameHeader (32 bytes) + recordCount * MetricRecord (64 bytes)
+
+/// @brief Frame identification constants ("HMTR")
+static constexpr uint32_t METRICS_FRAME_MAGIC{0x484D5452U};
+static constexpr uint16_t METRICS_FRAME_VERSION{1U};
+static constexpr std::size_t METRICS_SOURCE_SIZE{16U};
+static constexpr std::size_t METRICS_NAME_SIZE{47U};
+static constexpr std::size_t METRICS_MAX_RECORDS{128U};
+
+/**
+ * @struct MetricsFrameHeader
+ * @brief Fixed 32-byte snapshot header
+ */
+struct MetricsFrameHeader {
+    uint32_t magic{0U};
+    uint16_t version{0U};
+    uint16_t recordCount{0U};
+    int64_t timestampUs{0};                    ///< Wall clock of the snapshot
+    char source[METRICS_SOURCE_SIZE]{};        ///< Publishing process, NUL padded
+};
+
+/**
+ * @struct MetricRecord
+ * @brief Fixed 64-byte metric record
+ */
+struct MetricRecord {
+    char name[METRICS_NAME_SIZE]{};            ///< NUL padded, truncated if longer
+    uint8_t kind{0U};                          ///< MetricKind
+    int64_t value{0};                          ///< Counter total or gauge level
+    double ratePerSec{0.0};                    ///< Counter delta / interval (0 for gauges)
+};
+
+static_assert(sizeof(MetricsFrameHeader) == 32U, "MetricsFrameHeader must be 32 bytes on the wire");
+static_assert(sizeof(MetricRecord) == 64U, "MetricRecord must be 64 bytes on the wire");
+
+/**
+ * @brief Copy a string into a fixed NUL-padded field (always terminated)
+ */
+inline void copyMetricsField(char* dst, std::size_t size, const std::string& src) noexcept {
+    const std::size_t length = (src.size() < (size - 1U)) ? src.size() : (size - 1U);
+    std::memset(dst, 0, size);
+    std::memcpy(dst, src.data(), length);
+}
+
+/**
+ * @brief Validate a received snapshot frame
+ * @return Number of records, or -1 if the frame is malformed
+ */
+inline int32_t parseMetricsFrame(const uint8_t* data, std::size_t size, MetricsFrameHeader& header) noexcept {
+    if ((data == nullptr) || (size < sizeof(MetricsFrameHeader))) {
+        return -1;
+    }
+    std::memcpy(&header, data, sizeof(MetricsFrameHeader));
+    if ((header.magic != METRICS_FRAME_MAGIC) || (header.version != METRICS_FRAME_VERSION) ||
+        (size != (sizeof(MetricsFrameHeader) + (header.recordCount * sizeof(MetricRecord))))) {
+        return -1;
+    }
+    header.source[METRICS_SOURCE_SIZE - 1U] = '\0';
+    return static_cast<int32_t>(header.recordCount);
+}
+
+} // namespace utils
+
+#endif // A_HEXAGON_UTILS_METRICS_HPP
@@ -0,0 +1,98 @@
+/**
+ * @file MpscQueue.hpp
+ * @brief Unbounded lock-free multi-producer/single-consumer queue
+ * @details Intrusive linked queue (Vyukov): push is one atomic exchange,
+ *          pop is wait-free for the single consumer. Intended for low-rate
+ *          control traffic (e.g. socket command mailboxes), not for the data
+ *          path - every push allocates one node.
+ *
+ * @author a_hexagon Team
+ * @version 1.0
+ * @date 2025
+ *
+ * @note MISRA C++ 2023 compliant implementation
+ * @note Any number of producers, exactly one consumer thread at a time
+ */
+
+#ifndef A_HEXAGON_UTILS_MPSC_QUEUE_HPP
+#define A_HEXAGON_UTILS_MPSC_QUEUE_HPP
+
+#include <atomic>
+#include <optional>
+#include <utility>
+
+namespace utils {
+
+/**
+ * @class MpscQueue
+ * @brief Lock-free MPSC FIFO
+ * @tparam T Movable element type
+ */
+template <typename T>
+class MpscQueue {
+public:
+    MpscQueue()
+        : head_(new Node())
+        , tail_(head_.load(std::memory_order_relaxed)) {}
+
+    ~MpscQueue() {
+        while (tryPop().has_value()) {
+        }
+        delete tail_;
+    }
+
+    MpscQueue(const MpscQueue&) = delete;
+    MpscQueue& operator=(const MpscQueue&) = delete;
+    MpscQueue(MpscQueue&&) = delete;
+    MpscQueue& operator=(MpscQueue&&) = delete;
+
+    /**
+     * @brief Enqueue an item (any thread)
+     * @param value Item to move into the queue
+     * @throws std::bad_alloc if the node cannot be allocated
+     */
+    void push(T value) {
+        Node* node = new Node(std::move(value));
+        Node* previous = head_.exchange(node, std::memory_order_acq_rel);
+        previous->next.store(node, std::memory_order_release);
+    }
+
+    /**
+     * @brief Dequeue the oldest item (consumer thread only)
+     * @return Item, or std::nullopt if empty or a push is mid-publish
+     */
+    [[nodiscard]] std::optional<T> tryPop() {
+        Node* tail = tail_;
+        Node* next = tail->next.load(std::memory_order_acquire);
+        if (next == nullptr) {
+            return std::nullopt;
+        }
+        std::optional<T> value(std::move(next->value));
+        tail_ = next;
+        delete tail;
+        return value;
+    }
+
+    /**
+     * @brief Emptiness check (consumer thread only)
+     */
+    [[nodiscard]] bool empty() const noexcept {
+        return tail_->next.load(std::memory_order_acquire) == nullptr;
+    }
+
+private:
+    struct Node {
+        Node() = default;
+        explicit Node(T&& item) : value(std::move(item)) {}
+
+        std::atomic<Node*> next{nullptr};
+        T value{};
+    };
+
+    std::atomic<Node*> head_;    ///< Producers append here
+    Node* tail_;                 ///< Consumer-owned sentinel
+};
+
+} // namespace utils
+
+#endif // A_HEXAGON_UTILS_MPSC_QUEUE_HPP
@@ -0,0 +1,77 @@
+/**
+ * @file SpinLock.hpp
+ * @brief Minimal test-and-test-and-set spin lock
+ * @details Serialises the producer side of an SpscRingBuffer when a port
+ *          contract allows concurrent callers. In the normal single-producer
+ *          case it costs one uncontended atomic exchange per push.
+ *          A waiter spins for a bounded number of checks, then sleeps with
+ *          exponential backoff. It never relies on yield(): under SCHED_FIFO
+ *          yield() only hands the core to peers of the same priority, so a
+ *          lower-priority holder on the same core would never get to unlock.
+ *
+ * @author a_hexagon Team
+ * @version 1.0
+ * @date 2025
+ *
+ * @note MISRA C++ 2023 compliant implementation
+ * @note Satisfies the Lockable requirements (usable with std::lock_guard)
+ */
+
+#ifndef A_HEXAGON_UTILS_SPIN_LOCK_HPP
+#define A_HEXAGON_UTILS_SPIN_LOCK_HPP
+
+#include "utils/WaitStrategy.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+namespace utils {
+
+/**
+ * @class SpinLock
+ * @brief Short critical-section lock; enters the kernel only when a wait drags on
+ */
+class SpinLock {
+public:
+    static constexpr unsigned SPINS_BEFORE_SLEEP = 128U;
+    static constexpr std::chrono::microseconds MIN_BACKOFF{1};
+    static constexpr std::chrono::microseconds MAX_BACKOFF{128};
+
+    SpinLock() = default;
+    SpinLock(const SpinLock&) = delete;
+    SpinLock& operator=(const SpinLock&) = delete;
+
+    void lock() noexcept {
+        unsigned spins = 0U;
+        std::chrono::microseconds backoff = MIN_BACKOFF;
+        while (locked_.exchange(true, std::memory_order_acquire)) {
+            while (locked_.load(std::memory_order_relaxed)) {
+                if (spins < SPINS_BEFORE_SLEEP) {
+                    ++spins;
+                    cpuRelax();
+                } else {
+                    // Sleeping leaves the run queue, so any holder can run
+                    std::this_thread::sleep_for(backoff);
+                    backoff = std::min(backoff * 2, MAX_BACKOFF);
+                }
+            }
+        }
+    }
+
+    [[nodiscard]] bool try_lock() noexcept {
+        return !locked_.load(std::memory_order_relaxed) &&
+               !locked_.exchange(true, std::memory_order_acquire);
+    }
+
+    void unlock() noexcept {
+        locked_.store(false, std::memory_order_release);
+    }
+
+private:
+    std::atomic<bool> locked_{false};
+};
+
+} // namespace utils
+
+#endif // A_HEXAGON_UTILS_SPIN_LOCK_HPP
@@ -0,0 +1,112 @@
+/**
+ * @file BatchFrameTest.cpp
+ * @brief Unit tests for the multi-record batch frame format
+ * @details GTest based tests for BatchFrameWriter / BatchFrameReader
+ *
+ * @author a_hexagon Team
+ * @version 1.0
+ * @date 2025
+ */
+
+#include <gtest/gtest.h>
+#include "adapters/common/messaging/BatchFrame.hpp"
+#include "domain/ports/ExtrapTrackData.hpp"
+#include <cstdint>
+#include <vector>
+
+using namespace adapters::common::messaging;
+using domain::model::ExtrapTrackData;
+
+namespace {
+    ExtrapTrackData makeRecord(int32_t trackId) {
+        ExtrapTrackData record;
+        record.setTrackId(trackId);
+        record.setXPositionECEF(1000.0 * trackId);
+        record.setUpdateTime(1700000000000000 + trackId);
+        return record;
+    }
+}
+
+TEST(BatchFrameTest, WriteRead_RoundTrip_RecordsPreserved) {
+    BatchFrameWriter writer(1400U);
+    const std::size_t recordSize = makeRecord(1).getSerializedSize();
+    writer.begin(BatchModelType::ExtrapTrackData, static_cast<uint16_t>(recordSize), 7U);
+
+    for (int32_t id = 1; id <= 3; ++id) {
+        const std::vector<uint8_t> bytes = makeRecord(id).serialize();
+        ASSERT_TRUE(writer.append(bytes.data(), bytes.size()));
+    }
+    const std::vector<uint8_t>& frame = writer.finish();
+
+    BatchFrameReader reader;
+    ASSERT_TRUE(reader.parse(frame.data(), frame.size()));
+    EXPECT_EQ(reader.modelType(), BatchModelType::ExtrapTrackData);
+    EXPECT_EQ(reader.header().sequence, 7U);
+    ASSERT_EQ(reader.recordCount(), 3U);
+
+    for (std::size_t i = 0U; i < reader.recordCount(); ++i) {
+        ExtrapTrackData decoded;
+        ASSERT_TRUE(decoded.deserialize(reader.record(i), reader.recordSize()));
+        EXPECT_EQ(decoded.getTrackId(), static_cast<int32_t>(i + 1U));
+        EXPECT_DOUBLE_EQ(decoded.getXPositionECEF(), 1000.0 * static_cast<double>(i + 1U));
+    }
+}
+
+TEST(BatchFrameTest, Append_BeyondBudget_ReturnsFalse) {
+    const std::vector<uint8_t> bytes = makeRecord(1).serialize();
+    BatchFrameWriter writer(BATCH_FRAME_HEADER_SIZE + (2U * bytes.size()));
+    writer.begin(BatchModelType::ExtrapTrackData, static_cast<uint16_t>(bytes.size()), 0U);
+
+    EXPECT_EQ(writer.capacityFor(bytes.size()), 2U);
+    EXPECT_TRUE(writer.append(bytes.data(), bytes.size()));
+    EXPECT_TRUE(writer.append(bytes.data(), bytes.size()));
+    EXPECT_FALSE(writer.append(bytes.data(), bytes.size()));
+    EXPECT_EQ(writer.recordCount(), 2U);
+}
+
+TEST(BatchFrameTest, AppendSlot_SerializesInPlaceUntilBudget) {
+    BatchFrameWriter writer(BATCH_FRAME_HEADER_SIZE + (2U * ExtrapTrackData::kWireSize));
+    writer.begin(BatchModelType::ExtrapTrackData, static_cast<uint16_t>(ExtrapTrackData::kWireSize), 0U);
+
+    for (int32_t id = 1; id <= 2; ++id) {
+        uint8_t* slot = writer.appendSlot();
+        ASSERT_NE(slot, nullptr);
+        EXPECT_EQ(makeRecord(id).serializeInto(slot, ExtrapTrackData::kWireSize), ExtrapTrackData::kWireSize);
+    }
+    EXPECT_EQ(writer.appendSlot(), nullptr);
+
+    const std::vector<uint8_t>& frame = writer.finish();
+    BatchFrameReader reader;
+    ASSERT_TRUE(reader.parse(frame.data(), frame.size()));
+    ASSERT_EQ(reader.recordCount(), 2U);
+
+    ExtrapTrackData decoded;
+    ASSERT_TRUE(decoded.deserialize(reader.record(1U), reader.recordSize()));
+    EXPECT_EQ(decoded.getTrackId(), 2);
+}
+
+TEST(BatchFrameTest, Append_WrongRecordSize_ReturnsFalse) {
+    BatchFrameWriter writer(1400U);
+    writer.begin(BatchModelType::ExtrapTrackData, 76U, 0U);
+    const std::vector<uint8_t> shortRecord(60U, 0U);
+
+    EXPECT_FALSE(writer.append(shortRecord.data(), shortRecord.size()));
+    EXPECT_TRUE(writer.empty());
+}
+
+TEST(BatchFrameTest, Parse_LegacySingleRecordOrTruncated_Rejected) {
+    BatchFrameReader reader;
+    const std::vector<uint8_t> legacy = makeRecord(42).serialize();
+    EXPECT_FALSE(reader.parse(legacy.data(), legacy.size()));
+
+    BatchFrameWriter writer(1400U);
+    writer.begin(BatchModelType::ExtrapTrackData, static_cast<uint16_t>(legacy.size()), 1U);
+    ASSERT_TRUE(writer.append(legacy.data(), legacy.size()));
+    const std::vector<uint8_t>& frame = writer.finish();
+    EXPECT_FALSE(reader.parse(frame.data(), frame.size() - 1U));
+    EXPECT_EQ(reader.recordCount(), 0U);
+}
+
+TEST(BatchFrameTest, Constructor_BudgetBelowHeader_Throws) {
+    EXPECT_THROW({ BatchFrameWriter writer(BATCH_FRAME_HEADER_SIZE); }, std::invalid_argument);
+}
@@ -0,0 +1,78 @@
+/**
+ * @file UdpTimestampingSocketTest.cpp
+ * @brief Unit tests for the kernel-timestamped UDP receive socket
+ * @details Sends RADIO-framed datagrams over loopback the way a ZeroMQ RADIO
+ *          socket does and reads them back through IMessageSocket
+ *
+ * @author a_hexagon Team
+ * @version 1.0
+ * @date 2025
+ */
+
+#include <gtest/gtest.h>
+#include "adapters/common/messaging/UdpTimestampingSocket.hpp"
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using adapters::common::messaging::ReceivedFrame;
+using adapters::common::messaging::UdpTimestampingSocket;
+
+namespace {
+    const char* const kEndpoint = "udp://127.0.0.1:19900";
+
+    int64_t nowUs() {
+        return std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+    }
+
+    /// Send [group length][group][body] to the test endpoint
+    void sendRadio(const std::string& group, const std::vector<uint8_t>& body) {
+        sockaddr_in address{};
+        ASSERT_TRUE(UdpTimestampingSocket::parseEndpoint(kEndpoint, address));
+        std::vector<uint8_t> datagram;
+        datagram.push_back(static_cast<uint8_t>(group.size()));
+        datagram.insert(datagram.end(), group.begin(), group.end());
+        datagram.insert(datagram.end(), body.begin(), body.end());
+
+        const int fd = ::socket(AF_INET, SOCK_DGRAM, 0);
+        ASSERT_GE(fd, 0);
+        EXPECT_EQ(::sendto(fd, datagram.data(), datagram.size(), 0,
+                           reinterpret_cast<const sockaddr*>(&address), sizeof(address)),
+                  static_cast<ssize_t>(datagram.size()));
+        ::close(fd);
+    }
+}
+
+TEST(UdpTimestampingSocketTest, ReceiveFrame_SkipsOtherGroupsAndStampsArrival) {
+    UdpTimestampingSocket socket("TrackData");
+    ASSERT_TRUE(socket.connect(kEndpoint));
+    EXPECT_TRUE(socket.isConnected());
+
+    const int64_t before = nowUs();
+    sendRadio("Other", {9U});
+    sendRadio("TrackData", {1U, 2U, 3U});
+
+    ReceivedFrame frame;
+    ASSERT_TRUE(socket.receiveFrame(frame, 1000));
+    ASSERT_EQ(frame.size(), 3U);
+    EXPECT_EQ(frame.data()[2], 3U);
+    EXPECT_EQ(socket.skippedCount(), 1U);
+    if (std::string(socket.timestampModeName()) != "none") {
+        EXPECT_GE(frame.kernelReceiveTimeUs(), before - 1000);
+        EXPECT_LE(frame.kernelReceiveTimeUs(), nowUs() + 1000);
+    }
+
+    frame.reset();
+    EXPECT_EQ(frame.kernelReceiveTimeUs(), 0);
+    EXPECT_FALSE(socket.receiveFrame(frame, 10));
+}
+
+TEST(UdpTimestampingSocketTest, ReceiveOnly_SendFailsAndBadEndpointRejected) {
+    UdpTimestampingSocket socket("TrackData");
+    EXPECT_FALSE(socket.connect("udp://localhost:9000"));
+    EXPECT_FALSE(socket.connect("tcp://127.0.0.1:9000"));
+    EXPECT_FALSE(socket.isConnected());
+    EXPECT_FALSE(socket.send(std::vector<uint8_t>{1U}));
+}
@@ -432,3 +432,45 @@ TEST_F(ExtrapTrackDataZeroMQOutgoingAdapterTest, ConcurrentStartStop_IsThreadSaf
     
     EXPECT_FALSE(adapter_->isRunning());
 }
+
+// ==================== Batch Frame Tests ====================
+
+TEST_F(ExtrapTrackDataZeroMQOutgoingAdapterTest, Batching_TickBurst_PackedIntoFramesWithinBudget) {
+    createAdapter();
+    // Budget for 4 records per frame: 16-byte header + 4 * 76 bytes
+    ASSERT_TRUE(adapter_->setBatching(true, 16U + (4U * 76U)));
+    adapter_->start();
+    
+    std::vector<ExtrapTrackData> tick;
+    for (int i = 1; i <= 10; ++i) {
+        tick.push_back(createTestExtrapTrackData(i));
+    }
+    adapter_->sendExtrapTrackData(tick);
+    
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    adapter_->stop();
+    
+    // 10 records -> frames of 4 + 4 + 2 (at least 3 sends, never one per record)
+    auto sent = mockSocketPtr_->getSentMessages();
+    ASSERT_GE(sent.size(), 3U);
+    EXPECT_LT(sent.size(), 10U);
+    
+    std::size_t records = 0U;
+    adapters::common::messaging::BatchFrameReader reader;
+    while (!sent.empty()) {
+        const auto& message = sent.front();
+        ASSERT_TRUE(reader.parse(message.data.data(), message.data.size()));
+        EXPECT_LE(message.data.size(), 16U + (4U * 76U));
+        EXPECT_EQ(message.group, "ExtrapTrackData");
+        records += reader.recordCount();
+        sent.pop();
+    }
+    EXPECT_EQ(records, 10U);
+}
+
+TEST_F(ExtrapTrackDataZeroMQOutgoingAdapterTest, Batching_BudgetBelowOneRecord_Rejected) {
+    createAdapter();
+    
+    EXPECT_FALSE(adapter_->setBatching(true, 16U + 75U));
+    EXPECT_FALSE(adapter_->isBatching());
+}
@@ -0,0 +1,287 @@
+/**
+ * @file ExtrapolationSchedulerTest.cpp
+ * @brief Unit tests for TimingWheel and ExtrapolationScheduler
+ * @details Verifies deadline ordering/cascading of the timing wheel and the
+ *          per-track burst scheduling (including burst replacement) used by
+ *          TrackDataExtrapolator in scheduled mode.
+ *
+ * @author a_hexagon Team
+ * @version 1.0
+ * @date 2025
+ *
+ * @note MISRA C++ 2023 compliant test implementation
+ */
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "domain/logic/TimingWheel.hpp"
+#include "domain/logic/ExtrapolationScheduler.hpp"
+#include "domain/logic/TrackDataExtrapolator.hpp"
+#include "../../mocks/MockOutgoingPort.hpp"
+
+using namespace domain::logic;
+using namespace domain::model;
+using namespace a_hexagon::test::mocks;
+
+namespace {
+
+TrackData createTestTrackData(int32_t trackId, double xPosition = 4000000.0) {
+    TrackData trackData;
+    trackData.setTrackId(trackId);
+    trackData.setXPositionECEF(xPosition);
+    trackData.setYPositionECEF(3000000.0);
+    trackData.setZPositionECEF(5000000.0);
+    trackData.setXVelocityECEF(100.0);
+    trackData.setYVelocityECEF(200.0);
+    trackData.setZVelocityECEF(50.0);
+    trackData.setOriginalUpdateTime(1700000000);
+    return trackData;
+}
+
+/**
+ * @brief Advance wheel until tick, collecting (tick, value) pairs
+ */
+template <typename Wheel>
+std::vector<std::pair<uint64_t, int>> runUntil(Wheel& wheel, uint64_t tick) {
+    std::vector<std::pair<uint64_t, int>> fired;
+    while (wheel.currentTick() < tick) {
+        wheel.advance([&](const int& value) { fired.emplace_back(wheel.currentTick(), value); });
+    }
+    return fired;
+}
+
+} // namespace
+
+// ==================== TimingWheel Tests ====================
+
+TEST(TimingWheelTest, Schedule_NearDeadline_FiresAtExactTick) {
+    TimingWheel<int, 8U, 4U> wheel;
+    wheel.schedule(7, 5U);
+
+    auto fired = runUntil(wheel, 10U);
+
+    ASSERT_EQ(fired.size(), 1U);
+    EXPECT_EQ(fired[0].first, 5U);
+    EXPECT_EQ(fired[0].second, 7);
+    EXPECT_TRUE(wheel.empty());
+}
+
+TEST(TimingWheelTest, Schedule_PastDeadline_FiresOnNextAdvance) {
+    TimingWheel<int, 8U, 4U> wheel;
+    runUntil(wheel, 3U);
+
+    wheel.schedule(1, 0U);
+    auto fired = runUntil(wheel, 4U);
+
+    ASSERT_EQ(fired.size(), 1U);
+    EXPECT_EQ(fired[0].first, 4U);
+}
+
+TEST(TimingWheelTest, Schedule_AcrossLevels_CascadesToExactTick) {
+    TimingWheel<int, 8U, 4U> wheel;
+    const std::vector<uint64_t> deadlines{3U, 8U, 9U, 15U, 16U, 31U, 32U, 33U, 100U, 257U};
+    for (std::size_t i = 0U; i < deadlines.size(); ++i) {
+        wheel.schedule(static_cast<int>(i), deadlines[i]);
+    }
+    EXPECT_EQ(wheel.size(), deadlines.size());
+
+    auto fired = runUntil(wheel, 300U);
+
+    ASSERT_EQ(fired.size(), deadlines.size());
+    for (std::size_t i = 0U; i < deadlines.size(); ++i) {
+        EXPECT_EQ(fired[i].first, deadlines[i]) << "entry " << i;
+        EXPECT_EQ(fired[i].second, static_cast<int>(i));
+    }
+    EXPECT_TRUE(wheel.empty());
+}
+
+TEST(TimingWheelTest, Advance_CallbackReschedules_PeriodicTimer) {
+    TimingWheel<int, 8U, 4U> wheel;
+    std::vector<uint64_t> ticks;
+    wheel.schedule(0, 2U);
+
+    while (wheel.currentTick() < 60U) {
+        wheel.advance([&](const int& count) {
+            ticks.push_back(wheel.currentTick());
+            if (count < 5) {
+                wheel.schedule(count + 1, wheel.currentTick() + 10U);
+            }
+        });
+    }
+
+    EXPECT_EQ(ticks, (std::vector<uint64_t>{2U, 12U, 22U, 32U, 42U, 52U}));
+}
+
+// ==================== ExtrapolationScheduler Tests ====================
+
+TEST(ExtrapolationSchedulerTest, Constructor_EmptyCallback_Throws) {
+    EXPECT_THROW(ExtrapolationScheduler(nullptr, 8.0, 100.0), std::invalid_argument);
+}
+
+TEST(ExtrapolationSchedulerTest, Constructor_InvalidFrequency_Throws) {
+    auto emit = [](const TrackData&, double) {};
+    EXPECT_THROW(ExtrapolationScheduler(emit, 0.0, 100.0), std::invalid_argument);
+    EXPECT_THROW(ExtrapolationScheduler(emit, 8.0, -1.0), std::invalid_argument);
+}
+
+TEST(ExtrapolationSchedulerTest, SamplesPerBurst_MatchesSynchronousLoop) {
+    auto emit = [](const TrackData&, double) {};
+    ExtrapolationScheduler scheduler(emit, 8.0, 100.0);
+
+    // t = 0, 0.01, ..., 0.12 < 0.125
+    EXPECT_EQ(scheduler.getSamplesPerBurst(), 13U);
+}
+
+TEST(ExtrapolationSchedulerTest, ScheduleTrack_EmitsFullBurstWithIncreasingOffsets) {
+    MockOutgoingPort port;
+    TrackDataExtrapolator extrapolator(&port);
+    ASSERT_TRUE(extrapolator.start());
+
+    extrapolator.processAndForwardTrackData(createTestTrackData(1001));
+
+    ASSERT_TRUE(port.waitForSentData(13U, 1000));
+    std::this_thread::sleep_for(std::chrono::milliseconds(30));
+    extrapolator.stop();
+
+    auto sent = port.getAllSentData();
+    ASSERT_EQ(sent.size(), 13U);
+    for (std::size_t i = 0U; i < sent.size(); ++i) {
+        EXPECT_EQ(sent[i].getTrackId(), 1001);
+        EXPECT_NEAR(sent[i].getXPositionECEF(), 4000000.0 + 100.0 * 0.01 * static_cast<double>(i), 1e-6);
+    }
+}
+
+TEST(ExtrapolationSchedulerTest, ScheduleTrack_DoesNotBlockCaller) {
+    MockOutgoingPort port;
+    TrackDataExtrapolator extrapolator(&port);
+    ASSERT_TRUE(extrapolator.start());
+
+    auto begin = std::chrono::steady_clock::now();
+    for (int32_t id = 1; id <= 100; ++id) {
+        extrapolator.processAndForwardTrackData(createTestTrackData(id));
+    }
+    auto elapsed = std::chrono::steady_clock::now() - begin;
+
+    // Synchronous mode would take ~130ms per track
+    EXPECT_LT(std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count(), 50);
+
+    ASSERT_TRUE(port.waitForSentData(1300U, 2000));
+    extrapolator.stop();
+
+    for (int32_t id = 1; id <= 100; ++id) {
+        EXPECT_EQ(port.getSentDataByTrackId(id).size(), 13U) << "track " << id;
+    }
+}
+
+TEST(ExtrapolationSchedulerTest, ScheduleTrack_NewerDataReplacesPendingBurst) {
+    MockOutgoingPort port;
+    TrackDataExtrapolator extrapolator(&port);
+    ASSERT_TRUE(extrapolator.start());
+
+    extrapolator.processAndForwardTrackData(createTestTrackData(7, 1000.0));
+    ASSERT_TRUE(port.waitForSentData(2U, 1000));
+    extrapolator.processAndForwardTrackData(createTestTrackData(7, 2000.0));
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(250));
+    extrapolator.stop();
+
+    auto sent = port.getSentDataByTrackId(7);
+    ASSERT_FALSE(sent.empty());
+
+    // Old burst was cut short and the new burst ran to completion
+    std::size_t oldSamples = 0U;
+    std::size_t newSamples = 0U;
+    for (const auto& sample : sent) {
+        if (sample.getXPositionECEF() < 1500.0) {
+            ++oldSamples;
+        } else {
+            ++newSamples;
+        }
+    }
+    EXPECT_LT(oldSamples, 13U);
+    EXPECT_EQ(newSamples, 13U);
+    EXPECT_NEAR(sent.back().getXPositionECEF(), 2000.0 + 100.0 * 0.12, 1e-6);
+}
+
+TEST(ExtrapolationSchedulerTest, Stop_ReturnsExtrapolatorToSynchronousMode) {
+    MockOutgoingPort port;
+    TrackDataExtrapolator extrapolator(&port);
+    ASSERT_TRUE(extrapolator.start());
+    EXPECT_TRUE(extrapolator.isRunning());
+
+    extrapolator.stop();
+    EXPECT_FALSE(extrapolator.isRunning());
+
+    extrapolator.processAndForwardTrackData(createTestTrackData(55));
+    EXPECT_EQ(port.getSentDataCount(), 13U);
+}
+
+TEST(ExtrapolationSchedulerTest, IdleTrack_IsEvictedAfterTimeout) {
+    std::atomic<std::size_t> emitted{0U};
+    ExtrapolationScheduler scheduler([&emitted](const TrackData&, double) { ++emitted; },
+                                     8.0, 100.0, std::chrono::microseconds(1));
+    ASSERT_TRUE(scheduler.start());
+
+    scheduler.scheduleTrack(createTestTrackData(11));
+    scheduler.scheduleTrack(createTestTrackData(12));
+
+    // Timeout is raised to one burst plus one interval (140ms), swept every 100ms
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+    while ((scheduler.getEvictedTrackCount() < 2U) && (std::chrono::steady_clock::now() < deadline)) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    scheduler.stop();
+
+    EXPECT_EQ(emitted.load(), 26U);
+    EXPECT_EQ(scheduler.getEvictedTrackCount(), 2U);
+    EXPECT_EQ(scheduler.getTrackedCount(), 0U);
+}
+
+TEST(ExtrapolationSchedulerTest, Batched_EmitsAllActiveTracksPerOutputTick) {
+    std::mutex mutex;
+    std::vector<std::pair<std::size_t, double>> ticks;  // (table size, offset of first slot)
+    ExtrapolationScheduler scheduler(
+        ExtrapolationScheduler::BATCHED,
+        [&](const TrackStateTable& table, double tickSeconds) {
+            std::lock_guard<std::mutex> lock(mutex);
+            ticks.emplace_back(table.size(), tickSeconds - table.baseTimes()[0]);
+        },
+        8.0, 100.0);
+
+    // Queued before start: all three bursts begin on the same output tick
+    scheduler.scheduleTrack(createTestTrackData(1));
+    scheduler.scheduleTrack(createTestTrackData(2));
+    scheduler.scheduleTrack(createTestTrackData(3));
+    ASSERT_TRUE(scheduler.start());
+    std::this_thread::sleep_for(std::chrono::milliseconds(250));
+    scheduler.stop();
+
+    std::lock_guard<std::mutex> lock(mutex);
+    ASSERT_EQ(ticks.size(), 13U);
+    for (std::size_t i = 0U; i < ticks.size(); ++i) {
+        EXPECT_EQ(ticks[i].first, 3U) << "tick " << i;
+        EXPECT_NEAR(ticks[i].second, 0.01 * static_cast<double>(i), 1e-9) << "tick " << i;
+    }
+    EXPECT_EQ(scheduler.getActiveTrackCount(), 0U);
+}
+
+TEST(ExtrapolationSchedulerTest, ScheduleTrack_SendsOneBatchPerOutputTick) {
+    MockOutgoingPort port;
+    TrackDataExtrapolator extrapolator(&port);
+    ASSERT_TRUE(extrapolator.start());
+    for (int32_t id = 1; id <= 20; ++id) {
+        extrapolator.processAndForwardTrackData(createTestTrackData(id));
+    }
+
+    ASSERT_TRUE(port.waitForSentData(20U * 13U, 1000));
+    extrapolator.stop();
+
+    EXPECT_EQ(port.getSendSingleCallCount(), 0);
+    EXPECT_LT(port.getSendVectorCallCount(), 20 * 13);
+}
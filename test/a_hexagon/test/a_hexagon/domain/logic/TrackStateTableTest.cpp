@@ -0,0 +1,161 @@
+/**
+ * @file TrackStateTableTest.cpp
+ * @brief Unit tests for TrackStateTable and the extrapolation kernel
+ * @details Verifies SoA slot management and that the vectorised kernel
+ *          matches the per-object TrackDataExtrapolator results.
+ *
+ * @author a_hexagon Team
+ * @version 1.0
+ * @date 2025
+ *
+ * @note MISRA C++ 2023 compliant test implementation
+ */
+
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "domain/logic/TrackStateTable.hpp"
+#include "domain/logic/ExtrapolationKernel.hpp"
+#include "domain/logic/TrackDataExtrapolator.hpp"
+#include "../../mocks/MockOutgoingPort.hpp"
+
+using namespace domain::logic;
+using namespace domain::model;
+using namespace a_hexagon::test::mocks;
+
+namespace {
+
+TrackData createTestTrackData(int32_t trackId) {
+    TrackData trackData;
+    trackData.setTrackId(trackId);
+    trackData.setXPositionECEF(4000000.0 + trackId);
+    trackData.setYPositionECEF(3000000.0 - trackId);
+    trackData.setZPositionECEF(5000000.0);
+    trackData.setXVelocityECEF(100.0 + trackId);
+    trackData.setYVelocityECEF(-200.0);
+    trackData.setZVelocityECEF(50.0);
+    trackData.setOriginalUpdateTime(1700000000 + trackId);
+    return trackData;
+}
+
+} // namespace
+
+// ==================== Kernel Tests ====================
+
+TEST(ExtrapolationKernelTest, ActivePath_MatchesScalarForAllTailLengths) {
+    for (std::size_t count = 0U; count < 19U; ++count) {
+        std::vector<double> pos(count);
+        std::vector<double> vel(count);
+        std::vector<double> base(count);
+        for (std::size_t i = 0U; i < count; ++i) {
+            pos[i] = 1000.0 * static_cast<double>(i);
+            vel[i] = -3.5 + static_cast<double>(i);
+            base[i] = 10.0 + 0.001 * static_cast<double>(i);
+        }
+
+        std::vector<double> expected(count);
+        std::vector<double> actual(count);
+        kernel::extrapolateAxisScalar(pos.data(), vel.data(), base.data(), 10.125, expected.data(), count);
+        kernel::extrapolateAxis(pos.data(), vel.data(), base.data(), 10.125, actual.data(), count);
+
+        EXPECT_EQ(actual, expected) << "count " << count
+                                    << " path " << kernel::kernelPathName(kernel::activeKernelPath());
+    }
+}
+
+// ==================== TrackStateTable Tests ====================
+
+TEST(TrackStateTableTest, Upsert_SameTrack_UpdatesInPlace) {
+    TrackStateTable table(4U);
+
+    const std::size_t first = table.upsert(createTestTrackData(5));
+    const std::size_t second = table.upsert(createTestTrackData(5));
+
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(table.size(), 1U);
+}
+
+TEST(TrackStateTableTest, Remove_KeepsSlotsDenseAndIndexed) {
+    TrackStateTable table;
+    for (int32_t id = 1; id <= 5; ++id) {
+        table.upsert(createTestTrackData(id));
+    }
+
+    EXPECT_TRUE(table.remove(2));
+    EXPECT_FALSE(table.remove(2));
+
+    EXPECT_EQ(table.size(), 4U);
+    EXPECT_EQ(table.findSlot(2), TrackStateTable::NO_SLOT);
+    for (int32_t id : {1, 3, 4, 5}) {
+        const std::size_t slot = table.findSlot(id);
+        ASSERT_NE(slot, TrackStateTable::NO_SLOT);
+        EXPECT_EQ(table.trackIds()[slot], id);
+    }
+}
+
+TEST(TrackStateTableTest, ExtrapolateAll_MatchesPerObjectSample) {
+    MockOutgoingPort port;
+    TrackDataExtrapolator extrapolator(&port);
+    TrackStateTable table;
+
+    std::vector<TrackData> tracks;
+    for (int32_t id = 1; id <= 37; ++id) {
+        tracks.push_back(createTestTrackData(id));
+        table.upsert(tracks.back());
+    }
+
+    ExtrapolatedPositions positions;
+    for (const TrackData& track : tracks) {
+        const double offset = 0.05;
+        const double time = static_cast<double>(track.getOriginalUpdateTime()) / 1000.0 + offset;
+        table.extrapolateAll(time, positions);
+
+        ExtrapTrackData fromTable;
+        const std::size_t slot = table.findSlot(track.getTrackId());
+        table.materialize(slot, positions, time, 0, fromTable);
+        const ExtrapTrackData reference = extrapolator.createExtrapolatedSample(track, offset);
+
+        EXPECT_EQ(fromTable.getTrackId(), reference.getTrackId());
+        EXPECT_NEAR(fromTable.getXPositionECEF(), reference.getXPositionECEF(), 1e-3);
+        EXPECT_NEAR(fromTable.getYPositionECEF(), reference.getYPositionECEF(), 1e-3);
+        EXPECT_NEAR(fromTable.getZPositionECEF(), reference.getZPositionECEF(), 1e-3);
+        EXPECT_NEAR(static_cast<double>(fromTable.getUpdateTime()),
+                    static_cast<double>(reference.getUpdateTime()), 1.0);
+    }
+}
+
+TEST(TrackStateTableTest, ExtrapolateTrackTable_SendsOneBatch) {
+    MockOutgoingPort port;
+    TrackDataExtrapolator extrapolator(&port);
+    TrackStateTable table;
+    for (int32_t id = 1; id <= 10; ++id) {
+        table.upsert(createTestTrackData(id));
+    }
+
+    extrapolator.extrapolateTrackTable(table, 1700000.1);
+
+    EXPECT_EQ(port.getSendVectorCallCount(), 1);
+    EXPECT_EQ(port.getSentDataCount(), 10U);
+}
+
+TEST(TrackStateTableTest, ExtrapolateTrackTable_DropsOnlyOutOfRangeRows) {
+    MockOutgoingPort port;
+    TrackDataExtrapolator extrapolator(&port);
+    TrackStateTable table;
+    table.upsert(createTestTrackData(1));
+
+    // Leaves the position range within the first 0.1s of extrapolation
+    TrackData runaway = createTestTrackData(2);
+    runaway.setXPositionECEF(9.9E+10 - 1.0);
+    runaway.setXVelocityECEF(1.0E+6);
+    table.upsert(runaway);
+    table.upsert(createTestTrackData(3));
+
+    extrapolator.extrapolateTrackTable(table, 1700000.1);
+
+    EXPECT_EQ(port.getSendVectorCallCount(), 1);
+    EXPECT_EQ(port.getSentDataCount(), 2U);
+    EXPECT_EQ(port.getSentDataByTrackId(1).size(), 1U);
+    EXPECT_TRUE(port.getSentDataByTrackId(2).empty());
+    EXPECT_EQ(port.getSentDataByTrackId(3).size(), 1U);
+}
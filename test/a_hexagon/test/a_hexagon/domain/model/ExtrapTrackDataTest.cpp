@@ -11,6 +11,8 @@
 #include <gtest/gtest.h>
 #include "domain/ports/ExtrapTrackData.hpp"
 #include <vector>
+#include <array>
+#include <algorithm>
 #include <cstdint>
 #include <limits>
 
@@ -149,6 +151,40 @@ TEST_F(ExtrapTrackDataTest, IsValid_DefaultConstructed_ReturnsFalse) {
     EXPECT_FALSE(extrap.isValid());
 }
 
+TEST_F(ExtrapTrackDataTest, Validate_ReportsEachOutOfRangeField) {
+    EXPECT_EQ(validExtrapData_.validate(), 0U);
+
+    // Default trackId 0 is below the minimum of 1
+    ExtrapTrackData extrap;
+    EXPECT_EQ(extrap.validate(), ExtrapTrackData::FIELD_TRACK_ID);
+
+    const ExtrapTrackData bad(ExtrapTrackData::UNCHECKED, 2001,
+                              std::numeric_limits<double>::quiet_NaN(), 0.0, 0.0,
+                              0.0, 0.0, 1.0E+11,
+                              -1, 0, 0);
+    EXPECT_EQ(bad.validate(), ExtrapTrackData::FIELD_X_VELOCITY_ECEF |
+                              ExtrapTrackData::FIELD_Z_POSITION_ECEF |
+                              ExtrapTrackData::FIELD_ORIGINAL_UPDATE_TIME);
+    EXPECT_FALSE(bad.isValid());
+}
+
+TEST_F(ExtrapTrackDataTest, UncheckedConstructor_MatchesSetterPath) {
+    const ExtrapTrackData copy(ExtrapTrackData::UNCHECKED,
+                               validExtrapData_.getTrackId(),
+                               validExtrapData_.getXVelocityECEF(),
+                               validExtrapData_.getYVelocityECEF(),
+                               validExtrapData_.getZVelocityECEF(),
+                               validExtrapData_.getXPositionECEF(),
+                               validExtrapData_.getYPositionECEF(),
+                               validExtrapData_.getZPositionECEF(),
+                               validExtrapData_.getOriginalUpdateTime(),
+                               validExtrapData_.getUpdateTime(),
+                               validExtrapData_.getFirstHopSentTime());
+
+    EXPECT_TRUE(copy.isValid());
+    EXPECT_EQ(copy.serialize(), validExtrapData_.serialize());
+}
+
 // ==================== Serialization Tests ====================
 
 TEST_F(ExtrapTrackDataTest, Serialize_ReturnsNonEmptyVector) {
@@ -186,6 +222,22 @@ TEST_F(ExtrapTrackDataTest, SerializeDeserialize_RoundTrip_DataPreserved) {
     EXPECT_EQ(deserialized.getFirstHopSentTime(), validExtrapData_.getFirstHopSentTime());
 }
 
+TEST_F(ExtrapTrackDataTest, SerializeInto_MatchesSerializeAndRejectsSmallBuffer) {
+    std::array<uint8_t, ExtrapTrackData::kWireSize> buffer{};
+
+    ASSERT_EQ(validExtrapData_.serializeInto(buffer.data(), buffer.size()), ExtrapTrackData::kWireSize);
+    const std::vector<uint8_t> serialized = validExtrapData_.serialize();
+    EXPECT_TRUE(std::equal(buffer.cbegin(), buffer.cend(), serialized.cbegin(), serialized.cend()));
+
+    EXPECT_EQ(validExtrapData_.serializeInto(buffer.data(), buffer.size() - 1U), 0U);
+    EXPECT_EQ(validExtrapData_.serializeInto(nullptr, buffer.size()), 0U);
+
+    ExtrapTrackData decoded;
+    ASSERT_TRUE(decoded.deserialize(buffer.data(), buffer.size()));
+    EXPECT_EQ(decoded.getTrackId(), validExtrapData_.getTrackId());
+    EXPECT_EQ(decoded.getFirstHopSentTime(), validExtrapData_.getFirstHopSentTime());
+}
+
 TEST_F(ExtrapTrackDataTest, Deserialize_InvalidSize_ReturnsFalse) {
     ExtrapTrackData extrap;
     std::vector<uint8_t> tooSmall = {0x01, 0x02, 0x03};
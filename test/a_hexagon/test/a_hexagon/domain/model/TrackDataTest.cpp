@@ -187,10 +187,30 @@ TEST_F(TrackDataTest, Deserialize_EmptyVector_ReturnsFalse) {
     std::vector<uint8_t> empty;
     
     bool success = track.deserialize(empty);
-    
+
     EXPECT_FALSE(success);
 }
 
+TEST_F(TrackDataTest, DeserializeSpan_RoundTrip_DataPreserved) {
+    std::vector<uint8_t> serialized = validTrackData_.serialize();
+
+    TrackData deserialized;
+    bool success = deserialized.deserialize(serialized.data(), serialized.size());
+
+    EXPECT_TRUE(success);
+    EXPECT_EQ(deserialized.getTrackId(), validTrackData_.getTrackId());
+    EXPECT_DOUBLE_EQ(deserialized.getZVelocityECEF(), validTrackData_.getZVelocityECEF());
+    EXPECT_EQ(deserialized.getOriginalUpdateTime(), validTrackData_.getOriginalUpdateTime());
+}
+
+TEST_F(TrackDataTest, DeserializeSpan_NullOrShort_ReturnsFalse) {
+    TrackData track;
+    std::vector<uint8_t> serialized = validTrackData_.serialize();
+
+    EXPECT_FALSE(track.deserialize(nullptr, serialized.size()));
+    EXPECT_FALSE(track.deserialize(serialized.data(), serialized.size() - 1U));
+}
+
 // ==================== Boundary Value Tests ====================
 
 TEST_F(TrackDataTest, SetTrackId_MaxInt32_Succeeds) {
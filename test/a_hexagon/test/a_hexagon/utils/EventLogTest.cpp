@@ -0,0 +1,109 @@
+/**
+ * @file EventLogTest.cpp
+ * @brief Unit tests for the binary mmap'd event log
+ * @details Records events, then reads the ring file back the way the
+ *          hexagon_eventlog decoder does (header, write count, ring wrap)
+ *
+ * @author a_hexagon Team
+ * @version 1.0
+ * @date 2025
+ */
+
+#include <gtest/gtest.h>
+#include "utils/EventLog.hpp"
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+using utils::EventId;
+using utils::EventLogFileHeader;
+using utils::EventLogRing;
+using utils::EventRecord;
+
+namespace {
+    std::vector<uint8_t> readFile(const std::string& path) {
+        std::ifstream file(path, std::ios::binary);
+        return std::vector<uint8_t>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+
+    EventRecord makeEvent(int32_t trackId, int64_t arg0) {
+        EventRecord event;
+        event.timestampNs = EventLogRing::clockNs(CLOCK_MONOTONIC);
+        event.eventId = static_cast<uint16_t>(EventId::TrackReceived);
+        event.trackId = trackId;
+        event.args[0] = arg0;
+        return event;
+    }
+
+    const std::string kRingPath = "/tmp/a_hexagon_event_log_test.bin";
+}
+
+TEST(EventLogTest, Ring_WritesHeaderAndRecords) {
+    {
+        EventLogRing ring;
+        ASSERT_TRUE(ring.open(kRingPath, "a_hexagon", 8U));
+        ring.write(makeEvent(1001, 250));
+        ring.write(makeEvent(1002, 300));
+    }
+
+    const std::vector<uint8_t> bytes = readFile(kRingPath);
+    ASSERT_EQ(bytes.size(), sizeof(EventLogFileHeader) + (8U * sizeof(EventRecord)));
+
+    EventLogFileHeader header;
+    std::memcpy(&header, bytes.data(), sizeof(header));
+    EXPECT_EQ(header.magic, utils::EVENT_LOG_MAGIC);
+    EXPECT_EQ(header.version, utils::EVENT_LOG_VERSION);
+    EXPECT_EQ(header.recordSize, sizeof(EventRecord));
+    EXPECT_EQ(header.capacity, 8U);
+    EXPECT_EQ(header.writeCount, 2U);
+    EXPECT_STREQ(header.source, "a_hexagon");
+
+    EventRecord second;
+    std::memcpy(&second, bytes.data() + sizeof(header) + sizeof(EventRecord), sizeof(second));
+    EXPECT_EQ(second.eventId, static_cast<uint16_t>(EventId::TrackReceived));
+    EXPECT_EQ(second.trackId, 1002);
+    EXPECT_EQ(second.args[0], 300);
+    std::remove(kRingPath.c_str());
+}
+
+TEST(EventLogTest, Ring_OverwritesOldestWhenFull) {
+    {
+        EventLogRing ring;
+        ASSERT_TRUE(ring.open(kRingPath, "a_hexagon", 4U));
+        for (int32_t i = 0; i < 6; ++i) {
+            ring.write(makeEvent(i, i));
+        }
+        EXPECT_EQ(ring.writeCount(), 6U);
+    }
+
+    const std::vector<uint8_t> bytes = readFile(kRingPath);
+    EventLogFileHeader header;
+    std::memcpy(&header, bytes.data(), sizeof(header));
+    ASSERT_EQ(header.writeCount, 6U);
+
+    // Oldest surviving record is #2, in slot 2 % 4
+    const uint64_t oldest = header.writeCount - header.capacity;
+    for (uint64_t sequence = oldest; sequence < header.writeCount; ++sequence) {
+        EventRecord event;
+        std::memcpy(&event, bytes.data() + sizeof(header) + ((sequence % header.capacity) * sizeof(EventRecord)),
+                    sizeof(event));
+        EXPECT_EQ(event.trackId, static_cast<int32_t>(sequence));
+    }
+    std::remove(kRingPath.c_str());
+}
+
+TEST(EventLogTest, Ring_OpenFailsForMissingDirectory) {
+    EventLogRing ring;
+    EXPECT_FALSE(ring.open("/nonexistent_dir/events.bin", "a_hexagon", 4U));
+    EXPECT_FALSE(ring.isOpen());
+}
+
+TEST(EventLogTest, Disabled_RecordIsNoOp) {
+    utils::EventLog::instance().disable();
+    EXPECT_FALSE(utils::EventLog::instance().isEnabled());
+    EXPECT_NO_THROW(utils::EventLog::instance().record(EventId::RecordSent, 1, 76));
+}
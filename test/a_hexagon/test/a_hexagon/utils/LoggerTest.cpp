@@ -14,6 +14,7 @@
 #include <thread>
 #include <chrono>
 #include <atomic>
+#include <vector>
 
 /**
  * @brief Test fixture for Logger tests
@@ -103,6 +104,18 @@ TEST_F(LoggerTest, DoubleShutdown_NoError) {
     });
 }
 
+TEST_F(LoggerTest, LogAfterShutdown_IsDiscarded) {
+    utils::Logger::init("test_app");
+    utils::Logger::shutdown();
+    
+    // Late log calls (e.g. worker threads still stopping) must not crash
+    EXPECT_NO_THROW({
+        utils::Logger::info("Message after shutdown {}", 1);
+        utils::Logger::error("Error after shutdown");
+    });
+    EXPECT_FALSE(utils::Logger::isInitialized());
+}
+
 // ==================== Log Level Tests ====================
 
 TEST_F(LoggerTest, SetLevel_AllLevels_NoError) {
@@ -333,6 +346,65 @@ TEST_F(LoggerTest, LOG_ERROR_Macro_Works) {
     });
 }
 
+TEST_F(LoggerTest, LOG_INFO_EVERY_N_Macro_Works) {
+    utils::Logger::init("test_app");
+    
+    EXPECT_NO_THROW({
+        for (int32_t i = 0; i < 10; ++i) {
+            LOG_INFO_EVERY_N(5, "Sampled message {}", i);
+            LOG_WARN_EVERY_MS(1000, "Throttled message {}", i);
+        }
+    });
+}
+
+// ==================== Rate Limiter Tests ====================
+
+TEST_F(LoggerTest, RateLimiter_EveryN_PassesOneInN) {
+    utils::LogRateLimiter limiter;
+    int32_t passed = 0;
+    for (int32_t i = 0; i < 100; ++i) {
+        if (limiter.everyN(10U)) {
+            ++passed;
+        }
+    }
+    EXPECT_EQ(passed, 10);
+}
+
+TEST_F(LoggerTest, RateLimiter_EveryNOfOne_PassesAll) {
+    utils::LogRateLimiter limiter;
+    EXPECT_TRUE(limiter.everyN(1U));
+    EXPECT_TRUE(limiter.everyN(1U));
+    EXPECT_TRUE(limiter.everyN(0U));
+}
+
+TEST_F(LoggerTest, RateLimiter_EveryMs_PassesFirstThenThrottles) {
+    utils::LogRateLimiter limiter;
+    EXPECT_TRUE(limiter.everyMs(20));
+    EXPECT_FALSE(limiter.everyMs(20));
+    
+    std::this_thread::sleep_for(std::chrono::milliseconds(30));
+    EXPECT_TRUE(limiter.everyMs(20));
+}
+
+TEST_F(LoggerTest, RateLimiter_EveryN_ConcurrentCallers_ExactCount) {
+    utils::LogRateLimiter limiter;
+    std::atomic<int32_t> passed{0};
+    std::vector<std::thread> threads;
+    for (int32_t t = 0; t < 4; ++t) {
+        threads.emplace_back([&limiter, &passed]() {
+            for (int32_t i = 0; i < 1000; ++i) {
+                if (limiter.everyN(100U)) {
+                    passed.fetch_add(1);
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(passed.load(), 40);
+}
+
 // ==================== isInitialized Tests ====================
 
 TEST_F(LoggerTest, IsInitialized_BeforeInit_ReturnsFalse) {
@@ -0,0 +1,74 @@
+/**
+ * @file MpscQueueTest.cpp
+ * @brief Unit tests for MpscQueue (socket command mailbox)
+ * @details GTest based tests for FIFO order and concurrent producers
+ *
+ * @author a_hexagon Team
+ * @version 1.0
+ * @date 2025
+ */
+
+#include <gtest/gtest.h>
+#include "utils/MpscQueue.hpp"
+#include <string>
+#include <thread>
+#include <vector>
+
+using utils::MpscQueue;
+
+TEST(MpscQueueTest, TryPop_Empty_ReturnsNullopt) {
+    MpscQueue<std::string> queue;
+
+    EXPECT_TRUE(queue.empty());
+    EXPECT_FALSE(queue.tryPop().has_value());
+}
+
+TEST(MpscQueueTest, PushPop_PreservesFifoOrder) {
+    MpscQueue<std::string> queue;
+    queue.push("join");
+    queue.push("subscribe");
+
+    auto first = queue.tryPop();
+    auto second = queue.tryPop();
+
+    ASSERT_TRUE(first.has_value());
+    ASSERT_TRUE(second.has_value());
+    EXPECT_EQ(*first, "join");
+    EXPECT_EQ(*second, "subscribe");
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST(MpscQueueTest, ConcurrentProducers_DeliverEveryItemInPerProducerOrder) {
+    MpscQueue<int> queue;
+    constexpr int PRODUCERS = 4;
+    constexpr int PER_PRODUCER = 5000;
+
+    std::vector<std::thread> producers;
+    for (int p = 0; p < PRODUCERS; ++p) {
+        producers.emplace_back([&queue, p]() {
+            for (int i = 0; i < PER_PRODUCER; ++i) {
+                queue.push((p * PER_PRODUCER) + i);
+            }
+        });
+    }
+
+    std::vector<int> lastSeen(PRODUCERS, -1);
+    int received = 0;
+    while (received < (PRODUCERS * PER_PRODUCER)) {
+        auto item = queue.tryPop();
+        if (!item.has_value()) {
+            std::this_thread::yield();
+            continue;
+        }
+        const int producer = *item / PER_PRODUCER;
+        const int sequence = *item % PER_PRODUCER;
+        EXPECT_GT(sequence, lastSeen[producer]);
+        lastSeen[producer] = sequence;
+        ++received;
+    }
+
+    for (auto& producer : producers) {
+        producer.join();
+    }
+    EXPECT_FALSE(queue.tryPop().has_value());
+}
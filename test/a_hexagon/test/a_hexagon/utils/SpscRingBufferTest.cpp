@@ -0,0 +1,289 @@
+/**
+ * @file SpscRingBufferTest.cpp
+ * @brief Unit tests for SpscRingBuffer and wait strategies
+ * @details GTest based tests for ordering, drop-oldest overflow and
+ *          cross-thread hand-off of the lock-free stage queue
+ *
+ * @author a_hexagon Team
+ * @version 1.0
+ * @date 2025
+ */
+
+#include <gtest/gtest.h>
+#include "utils/SpscRingBuffer.hpp"
+#include "utils/SpinLock.hpp"
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using utils::SpscRingBuffer;
+
+namespace {
+
+/**
+ * @brief Trivially copyable payload (mirrors queued model types)
+ */
+struct Sample {
+    int64_t sequence;
+    double value;
+};
+
+/**
+ * @brief Payload large enough that a copy can overlap a producer write
+ */
+struct WideSample {
+    std::array<int64_t, 32> words;
+};
+
+} // namespace
+
+TEST(SpscRingBufferTest, Constructor_ZeroCapacity_Throws) {
+    EXPECT_THROW(SpscRingBuffer<Sample>(0U), std::invalid_argument);
+}
+
+TEST(SpscRingBufferTest, PushPop_PreservesFifoOrder) {
+    SpscRingBuffer<Sample> ring(8U);
+
+    for (int64_t i = 0; i < 5; ++i) {
+        EXPECT_TRUE(ring.push(Sample{i, 0.5 * static_cast<double>(i)}));
+    }
+    EXPECT_EQ(ring.size(), 5U);
+
+    Sample out{};
+    for (int64_t i = 0; i < 5; ++i) {
+        ASSERT_TRUE(ring.tryPop(out));
+        EXPECT_EQ(out.sequence, i);
+    }
+    EXPECT_FALSE(ring.tryPop(out));
+    EXPECT_TRUE(ring.empty());
+}
+
+TEST(SpscRingBufferTest, Push_WhenFull_DropsOldest) {
+    SpscRingBuffer<Sample> ring(3U);
+
+    EXPECT_TRUE(ring.push(Sample{1, 0.0}));
+    EXPECT_TRUE(ring.push(Sample{2, 0.0}));
+    EXPECT_TRUE(ring.push(Sample{3, 0.0}));
+    EXPECT_FALSE(ring.push(Sample{4, 0.0}));
+
+    EXPECT_EQ(ring.size(), 3U);
+    EXPECT_EQ(ring.droppedCount(), 1U);
+
+    Sample out{};
+    ASSERT_TRUE(ring.tryPop(out));
+    EXPECT_EQ(out.sequence, 2);
+}
+
+TEST(SpscRingBufferTest, PushBatch_WhenOverflowing_ReportsEvictionsAndKeepsNewest) {
+    SpscRingBuffer<Sample> ring(3U);
+    const std::vector<Sample> burst{{1, 0.0}, {2, 0.0}, {3, 0.0}, {4, 0.0}, {5, 0.0}};
+
+    EXPECT_EQ(ring.pushBatch(burst.data(), burst.size()), 2U);
+    EXPECT_EQ(ring.size(), 3U);
+
+    Sample out{};
+    for (int64_t expected = 3; expected <= 5; ++expected) {
+        ASSERT_TRUE(ring.tryPop(out));
+        EXPECT_EQ(out.sequence, expected);
+    }
+    EXPECT_EQ(ring.pushBatch(burst.data(), 0U), 0U);
+    EXPECT_TRUE(ring.empty());
+}
+
+TEST(SpscRingBufferTest, TryPopBatch_DrainsUpToMaxInFifoOrder) {
+    SpscRingBuffer<Sample> ring(8U);
+    for (int64_t i = 0; i < 5; ++i) {
+        ring.push(Sample{i, 0.0});
+    }
+
+    Sample out[4]{};
+    EXPECT_EQ(ring.tryPopBatch(out, 0U), 0U);
+    ASSERT_EQ(ring.tryPopBatch(out, 4U), 4U);
+    for (int64_t i = 0; i < 4; ++i) {
+        EXPECT_EQ(out[i].sequence, i);
+    }
+    ASSERT_EQ(ring.tryPopBatch(out, 4U), 1U);
+    EXPECT_EQ(out[0].sequence, 4);
+    EXPECT_EQ(ring.tryPopBatch(out, 4U), 0U);
+    EXPECT_EQ(ring.waitPopBatch(out, 4U, std::chrono::milliseconds(5)), 0U);
+}
+
+TEST(SpscRingBufferTest, WaitPop_TimesOutWhenEmpty) {
+    SpscRingBuffer<Sample> ring(4U);
+    Sample out{};
+
+    EXPECT_FALSE(ring.waitPop(out, std::chrono::milliseconds(5)));
+}
+
+TEST(SpscRingBufferTest, WakeConsumer_ReleasesBlockedWait) {
+    SpscRingBuffer<Sample> ring(4U);
+    Sample out{};
+
+    std::thread waker([&ring]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        ring.wakeConsumer();
+    });
+
+    const auto start = std::chrono::steady_clock::now();
+    EXPECT_FALSE(ring.waitPop(out, std::chrono::seconds(5)));
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    waker.join();
+
+    EXPECT_LT(elapsed, std::chrono::seconds(2));
+}
+
+TEST(SpscRingBufferTest, CrossThread_DeliversEveryItemOnce_AllStrategies) {
+    const std::vector<std::shared_ptr<utils::WaitStrategy>> strategies = {
+        std::make_shared<utils::BlockingWaitStrategy>(),
+        std::make_shared<utils::YieldingWaitStrategy>(),
+        std::make_shared<utils::BusySpinWaitStrategy>()
+    };
+    constexpr int64_t ITEM_COUNT = 20000;
+
+    for (const auto& strategy : strategies) {
+        // Capacity covers the whole run, so nothing may be dropped
+        SpscRingBuffer<Sample> ring(static_cast<std::size_t>(ITEM_COUNT), strategy);
+
+        std::thread producer([&ring]() {
+            for (int64_t i = 0; i < ITEM_COUNT; ++i) {
+                ring.push(Sample{i, 0.0});
+            }
+        });
+
+        int64_t expected = 0;
+        Sample out{};
+        while (expected < ITEM_COUNT) {
+            ASSERT_TRUE(ring.waitPop(out, std::chrono::seconds(5))) << strategy->name();
+            ASSERT_EQ(out.sequence, expected) << strategy->name();
+            ++expected;
+        }
+        producer.join();
+
+        EXPECT_EQ(ring.droppedCount(), 0U) << strategy->name();
+    }
+}
+
+TEST(SpscRingBufferTest, CrossThread_Overflow_NeverDuplicatesOrReorders) {
+    SpscRingBuffer<Sample> ring(16U);
+    constexpr int64_t ITEM_COUNT = 50000;
+
+    std::thread producer([&ring]() {
+        for (int64_t i = 0; i < ITEM_COUNT; ++i) {
+            ring.push(Sample{i, 0.0});
+        }
+    });
+
+    int64_t last = -1;
+    int64_t received = 0;
+    Sample out{};
+    while (last < (ITEM_COUNT - 1)) {
+        if (!ring.waitPop(out, std::chrono::seconds(5))) {
+            break;
+        }
+        ASSERT_GT(out.sequence, last);
+        last = out.sequence;
+        ++received;
+    }
+    producer.join();
+
+    EXPECT_EQ(last, ITEM_COUNT - 1);
+    EXPECT_EQ(static_cast<uint64_t>(received) + ring.droppedCount(),
+              static_cast<uint64_t>(ITEM_COUNT));
+}
+
+TEST(SpscRingBufferTest, CrossThread_OverflowBatches_NeverDuplicateOrReorder) {
+    SpscRingBuffer<Sample> ring(16U);
+    constexpr int64_t ITEM_COUNT = 50000;
+    constexpr std::size_t BATCH_SIZE = 8U;
+
+    std::thread producer([&ring]() {
+        for (int64_t i = 0; i < ITEM_COUNT; ++i) {
+            ring.push(Sample{i, 0.0});
+        }
+    });
+
+    int64_t last = -1;
+    int64_t received = 0;
+    Sample batch[BATCH_SIZE]{};
+    while (last < (ITEM_COUNT - 1)) {
+        const std::size_t count = ring.waitPopBatch(batch, BATCH_SIZE, std::chrono::seconds(5));
+        if (count == 0U) {
+            break;
+        }
+        for (std::size_t i = 0U; i < count; ++i) {
+            ASSERT_GT(batch[i].sequence, last);
+            last = batch[i].sequence;
+        }
+        received += static_cast<int64_t>(count);
+    }
+    producer.join();
+
+    EXPECT_EQ(last, ITEM_COUNT - 1);
+    EXPECT_EQ(static_cast<uint64_t>(received) + ring.droppedCount(),
+              static_cast<uint64_t>(ITEM_COUNT));
+}
+
+TEST(SpscRingBufferTest, CrossThread_OverflowDuringBatchCopy_NeverTearsItems) {
+    SpscRingBuffer<WideSample> ring(2U);
+    constexpr int64_t ITEM_COUNT = 100000;
+    constexpr std::size_t BATCH_SIZE = 2U;
+
+    std::thread producer([&ring]() {
+        WideSample sample{};
+        for (int64_t i = 0; i < ITEM_COUNT; ++i) {
+            sample.words.fill(i);
+            ring.push(sample);
+        }
+    });
+
+    int64_t last = -1;
+    WideSample batch[BATCH_SIZE]{};
+    while (last < (ITEM_COUNT - 1)) {
+        const std::size_t count = ring.waitPopBatch(batch, BATCH_SIZE, std::chrono::seconds(5));
+        if (count == 0U) {
+            break;
+        }
+        for (std::size_t i = 0U; i < count; ++i) {
+            for (const int64_t word : batch[i].words) {
+                ASSERT_EQ(word, batch[i].words[0U]);
+            }
+            ASSERT_GT(batch[i].words[0U], last);
+            last = batch[i].words[0U];
+        }
+    }
+    producer.join();
+
+    EXPECT_EQ(last, ITEM_COUNT - 1);
+}
+
+TEST(SpscRingBufferTest, SpinLockGuardedProducers_DeliverAll) {
+    SpscRingBuffer<Sample> ring(1024U);
+    utils::SpinLock producerLock;
+    constexpr int PRODUCERS = 4;
+    constexpr int PER_PRODUCER = 200;
+
+    std::vector<std::thread> producers;
+    for (int p = 0; p < PRODUCERS; ++p) {
+        producers.emplace_back([&ring, &producerLock, p]() {
+            for (int i = 0; i < PER_PRODUCER; ++i) {
+                std::lock_guard<utils::SpinLock> guard(producerLock);
+                ring.push(Sample{p, static_cast<double>(i)});
+            }
+        });
+    }
+    for (auto& producer : producers) {
+        producer.join();
+    }
+
+    int received = 0;
+    Sample out{};
+    while (ring.tryPop(out)) {
+        ++received;
+    }
+    EXPECT_EQ(received, PRODUCERS * PER_PRODUCER);
+}
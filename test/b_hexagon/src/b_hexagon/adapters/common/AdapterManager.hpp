@@ -105,7 +105,7 @@ public:
      */
     void registerPipeline(MessagePipeline pipeline) {
         std::unique_lock<std::shared_mutex> lock(pipelines_mutex_);
-        Logger::info("Registering pipeline: ", pipeline.getName());
+        Logger::info("Registering pipeline: {}", pipeline.getName());
         pipelines_.push_back(std::move(pipeline));
     }
 
@@ -123,21 +123,21 @@ public:
         bool success = true;
         size_t started = 0;
         
-        Logger::info("Starting ", pipelines_.size(), " pipeline(s)...");
+        Logger::info("Starting {} pipeline(s)...", pipelines_.size());
         
         for (auto& pipeline : pipelines_) {
-            Logger::debug("Starting pipeline: ", pipeline.getName());
+            Logger::debug("Starting pipeline: {}", pipeline.getName());
             if (pipeline.start()) {
                 started++;
-                Logger::info("Pipeline started: ", pipeline.getName());
+                Logger::info("Pipeline started: {}", pipeline.getName());
             } else {
-                Logger::error("Failed to start pipeline: ", pipeline.getName());
+                Logger::error("Failed to start pipeline: {}", pipeline.getName());
                 success = false;
             }
         }
         
         running_.store(success);
-        Logger::info("Started ", started, "/", pipelines_.size(), " pipelines");
+        Logger::info("Started {}/{} pipelines", started, pipelines_.size());
         
         return success;
     }
@@ -151,11 +151,11 @@ public:
     void stopAll() noexcept {
         std::unique_lock<std::shared_mutex> lock(pipelines_mutex_);
         
-        Logger::info("Stopping all ", pipelines_.size(), " pipeline(s)...");
+        Logger::info("Stopping all {} pipeline(s)...", pipelines_.size());
         running_.store(false);
         
         for (auto& pipeline : pipelines_) {
-            Logger::debug("Stopping pipeline: ", pipeline.getName());
+            Logger::debug("Stopping pipeline: {}", pipeline.getName());
             pipeline.stop();
         }
         
@@ -0,0 +1,136 @@
+/**
+ * @file ZmqContextRegistry.hpp
+ * @brief Process-wide shared ZeroMQ context
+ * @details A zmq::context_t owns its I/O and reaper threads. One context per
+ *          socket multiplies those threads and lets them float onto the cores
+ *          reserved for SCHED_FIFO pipeline workers. All sockets of the process
+ *          share the context handed out here; its I/O thread count and CPU set
+ *          are configured once at startup.
+ *
+ * Usage:
+ * @code
+ * ZmqContextConfig config;
+ * config.ioThreads = 1;
+ * config.ioThreadCpus = {0};
+ * ZmqContextRegistry::instance().configure(config);   // before creating sockets
+ * auto context = ZmqContextRegistry::instance().acquire();
+ * @endcode
+ *
+ * @author b_hexagon Team
+ * @version 1.0
+ * @date 2025
+ *
+ * @note MISRA C++ 2023 compliant implementation
+ * @note The context lives while at least one holder keeps its shared_ptr
+ */
+
+#pragma once
+
+#include "zmq_config.hpp"
+#include <zmq.hpp>
+#include "utils/Logger.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace adapters {
+
+/**
+ * @struct ZmqContextConfig
+ * @brief I/O thread settings applied when the shared context is created
+ */
+struct ZmqContextConfig {
+    int32_t ioThreads{1};                 ///< ZMQ_IO_THREADS
+    std::vector<int32_t> ioThreadCpus{};  ///< ZMQ_THREAD_AFFINITY_CPU_ADD set (empty = no pinning)
+};
+
+/**
+ * @class ZmqContextRegistry
+ * @brief Hands out one zmq::context_t per process
+ * @details Holders keep the context alive through std::shared_ptr; the
+ *          registry keeps only a weak reference, so the context terminates
+ *          once the last socket owner releases it (never during static
+ *          destruction with sockets still open).
+ */
+class ZmqContextRegistry final {
+public:
+    /**
+     * @brief Process-wide instance
+     */
+    static ZmqContextRegistry& instance() {
+        static ZmqContextRegistry registry;
+        return registry;
+    }
+
+    /**
+     * @brief Set I/O thread count and affinity for the shared context
+     * @param config Settings to apply on next context creation
+     * @return false if a context is already live (settings not applied)
+     */
+    bool configure(const ZmqContextConfig& config) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!context_.expired()) {
+            Logger::warn("ZeroMQ context already in use - I/O thread config ignored");
+            return false;
+        }
+        config_ = config;
+        return true;
+    }
+
+    /**
+     * @brief Get the shared context, creating it on first use
+     * @return Shared context (never null)
+     * @throws zmq::error_t if the context cannot be created
+     */
+    [[nodiscard]] std::shared_ptr<zmq::context_t> acquire() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::shared_ptr<zmq::context_t> context = context_.lock();
+        if (!context) {
+            context = createContext();
+            context_ = context;
+        }
+        return context;
+    }
+
+    ZmqContextRegistry(const ZmqContextRegistry&) = delete;
+    ZmqContextRegistry& operator=(const ZmqContextRegistry&) = delete;
+    ZmqContextRegistry(ZmqContextRegistry&&) = delete;
+    ZmqContextRegistry& operator=(ZmqContextRegistry&&) = delete;
+
+private:
+    ZmqContextRegistry() = default;
+    ~ZmqContextRegistry() = default;
+
+    /**
+     * @brief Create the context; options take effect when the first socket
+     *        starts the I/O threads
+     */
+    std::shared_ptr<zmq::context_t> createContext() const {
+        const int32_t ioThreads = (config_.ioThreads > 0) ? config_.ioThreads : 1;
+        auto context = std::make_shared<zmq::context_t>(ioThreads);
+
+#ifdef ZMQ_THREAD_AFFINITY_CPU_ADD
+        for (const int32_t cpu : config_.ioThreadCpus) {
+            if (zmq_ctx_set(context->handle(), ZMQ_THREAD_AFFINITY_CPU_ADD, cpu) != 0) {
+                Logger::warn("ZeroMQ I/O thread affinity to CPU {} failed: {}", cpu, zmq_strerror(zmq_errno()));
+            }
+        }
+#else
+        if (!config_.ioThreadCpus.empty()) {
+            Logger::warn("ZMQ_THREAD_AFFINITY_CPU_ADD unavailable - I/O threads not pinned");
+        }
+#endif
+
+        Logger::info("Shared ZeroMQ context created - I/O threads: {}, pinned CPUs: {}",
+                     ioThreads, config_.ioThreadCpus.size());
+        return context;
+    }
+
+    mutable std::mutex mutex_;                ///< Guards config_ and context_
+    ZmqContextConfig config_{};               ///< Applied on creation
+    std::weak_ptr<zmq::context_t> context_;   ///< Live shared context, if any
+};
+
+} // namespace adapters
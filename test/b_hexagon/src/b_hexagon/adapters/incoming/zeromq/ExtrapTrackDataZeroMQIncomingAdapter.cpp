@@ -7,6 +7,8 @@
 #include <zmq.hpp>
 #include "ExtrapTrackDataZeroMQIncomingAdapter.hpp"
 #include "../../../utils/Logger.hpp"
+#include "../../../utils/StageTracer.hpp"
+#include "../../../utils/FlightRecorder.hpp"
 #include <stdexcept>
 #include <cstring>
 #include <sstream>
@@ -26,12 +28,12 @@ ExtrapTrackDataZeroMQIncomingAdapter::ExtrapTrackDataZeroMQIncomingAdapter(
     : endpoint_(std::string(ZMQ_PROTOCOL) + "://" + ZMQ_MULTICAST_ADDRESS + ":" + std::to_string(ZMQ_PORT))
     , group_(ZMQ_GROUP)
     , adapterName_(std::string(ZMQ_GROUP) + "-InAdapter")
-    , zmqContext_(1)
+    , zmqContext_(adapters::ZmqContextRegistry::instance().acquire())
     , zmqSocket_(nullptr)
     , dataReceiver_(std::move(dataReceiver))
     , running_{false} {
     
-    Logger::info("ExtrapTrackDataZeroMQIncomingAdapter created - endpoint: ", endpoint_, ", group: ", group_);
+    Logger::info("ExtrapTrackDataZeroMQIncomingAdapter created - endpoint: {}, group: {}", endpoint_, group_);
 }
 
 ExtrapTrackDataZeroMQIncomingAdapter::ExtrapTrackDataZeroMQIncomingAdapter(
@@ -41,24 +43,25 @@ ExtrapTrackDataZeroMQIncomingAdapter::ExtrapTrackDataZeroMQIncomingAdapter(
     : endpoint_(endpoint)
     , group_(group)
     , adapterName_(group + "-InAdapter")
-    , zmqContext_(1)
+    , zmqContext_(adapters::ZmqContextRegistry::instance().acquire())
     , zmqSocket_(nullptr)
     , dataReceiver_(std::move(dataReceiver))
     , running_{false} {
     
-    Logger::info("ExtrapTrackDataZeroMQIncomingAdapter created (custom) - endpoint: ", endpoint_, ", group: ", group_);
+    Logger::info("ExtrapTrackDataZeroMQIncomingAdapter created (custom) - endpoint: {}, group: {}",
+                 endpoint_, group_);
 }
 
 ExtrapTrackDataZeroMQIncomingAdapter::~ExtrapTrackDataZeroMQIncomingAdapter() noexcept {
     stop();
-    Logger::debug("ExtrapTrackDataZeroMQIncomingAdapter destroyed: ", adapterName_);
+    Logger::debug("ExtrapTrackDataZeroMQIncomingAdapter destroyed: {}", adapterName_);
 }
 
 // ==================== IAdapter Interface ====================
 
 bool ExtrapTrackDataZeroMQIncomingAdapter::start() {
     if (running_.load()) {
-        Logger::warn("Adapter already running: ", adapterName_);
+        Logger::warn("Adapter already running: {}", adapterName_);
         return true;
     }
     
@@ -73,7 +76,7 @@ bool ExtrapTrackDataZeroMQIncomingAdapter::start() {
         // - Receives messages from RADIO publishers
         // - Supports group-based filtering (like topic subscription)
         // - UDP multicast for efficient one-to-many communication
-        zmqSocket_ = std::make_unique<zmq::socket_t>(zmqContext_, ZMQ_DISH);
+        zmqSocket_ = std::make_unique<zmq::socket_t>(*zmqContext_, ZMQ_DISH);
         
         // Set receive high water mark to prevent unbounded memory growth
         // If queue fills, oldest messages are dropped (prevents out-of-memory)
@@ -86,10 +89,10 @@ bool ExtrapTrackDataZeroMQIncomingAdapter::start() {
         // Only messages sent to this group will be received
         zmqSocket_->join(group_.c_str());
         
-        Logger::info("DISH socket bound to: ", endpoint_, ", group: ", group_);
+        Logger::info("DISH socket bound to: {}, group: {}", endpoint_, group_);
         
     } catch (const zmq::error_t& e) {
-        Logger::error("Failed to setup DISH socket: ", e.what());
+        Logger::error("Failed to setup DISH socket: {}", e.what());
         return false;
     }
     
@@ -100,7 +103,7 @@ bool ExtrapTrackDataZeroMQIncomingAdapter::start() {
         process();
     });
     
-    Logger::info("Adapter started: ", adapterName_);
+    Logger::info("Adapter started: {}", adapterName_);
     return true;
 }
 
@@ -121,7 +124,7 @@ void ExtrapTrackDataZeroMQIncomingAdapter::stop() {
         zmqSocket_.reset();
     }
     
-    Logger::info("Adapter stopped: ", adapterName_);
+    Logger::info("Adapter stopped: {}", adapterName_);
 }
 
 bool ExtrapTrackDataZeroMQIncomingAdapter::isRunning() const noexcept {
@@ -135,17 +138,24 @@ std::string ExtrapTrackDataZeroMQIncomingAdapter::getName() const noexcept {
 // ==================== Worker Thread ====================
 
 void ExtrapTrackDataZeroMQIncomingAdapter::process() {
-    Logger::debug("Worker thread started: ", adapterName_);
+    Logger::debug("Worker thread started: {}", adapterName_);
+    
+    // Set receive timeout once to allow periodic shutdown check
+    // Without timeout, recv() would block indefinitely
+    try {
+        zmqSocket_->set(zmq::sockopt::rcvtimeo, RECEIVE_TIMEOUT_MS);
+    } catch (const zmq::error_t& e) {
+        Logger::error("Failed to set receive timeout: {}", e.what());
+    }
+    
+    // Reused across receives; recv() releases the previous frame
+    zmq::message_t msg;
+    utils::StageTracer& tracer = utils::StageTracer::instance();
     
     // Main reception loop - continues until stop() is called
     while (running_.load()) {
         try {
-            // Set receive timeout to allow periodic shutdown check
-            // Without timeout, recv() would block indefinitely
-            zmqSocket_->set(zmq::sockopt::rcvtimeo, RECEIVE_TIMEOUT_MS);
-            
             // Receive message from ZeroMQ (blocking with timeout)
-            zmq::message_t msg;
             auto result = zmqSocket_->recv(msg, zmq::recv_flags::none);
             
             // Check if message was actually received (timeout returns nullopt)
@@ -153,26 +163,99 @@ void ExtrapTrackDataZeroMQIncomingAdapter::process() {
                 continue;  // Timeout or empty message - continue loop
             }
             
-            // Deserialize binary payload to domain object
-            auto data = deserializeBinary(static_cast<const uint8_t*>(msg.data()), msg.size());
+            const uint8_t* payload = static_cast<const uint8_t*>(msg.data());
+            metricReceived_.add();
+            metricBytes_.add(msg.size());
+            const int64_t receiveNs = tracer.isEnabled() ? utils::StageTracer::nowNs() : 0;
+            
+            // Batch frames carry many records; single-record messages are 76 bytes.
+            // A frame with the batch magic is consumed here even when malformed
+            if ((msg.size() != SINGLE_RECORD_SIZE) && submitBatchFrame(payload, msg.size(), receiveNs)) {
+                continue;
+            }
+            
+            // Deserialize binary payload straight from the ZeroMQ frame (no copy)
+            auto data = deserializeBinary(payload, msg.size());
             
             // Submit to domain layer for processing (via IExtrapTrackDataIncomingPort)
             // This call is non-blocking (~20ns) - data is queued for processing
+            tracer.record(utils::TraceStage::Receive, data.getTrackId(), data.getUpdateTime(), receiveNs);
+            utils::FlightRecorder::instance().record(utils::FlightEventKind::Receive, data.getTrackId(),
+                                                     data.getUpdateTime());
             dataReceiver_->submitExtrapTrackData(data);
             
         } catch (const zmq::error_t& e) {
             // ZeroMQ errors - typically timeout (EAGAIN) during normal operation
             // Only log non-timeout errors to avoid spam
             if (e.num() != EAGAIN && running_.load()) {
-                Logger::error("ZMQ receive error: ", e.what());
+                Logger::error("ZMQ receive error: {}", e.what());
             }
         } catch (const std::exception& e) {
             // Deserialization or other errors - log but continue receiving
-            Logger::error("Processing error: ", e.what());
+            metricDecodeFailures_.add();
+            Logger::error("Processing error: {}", e.what());
         }
     }
     
-    Logger::debug("Worker thread stopped: ", adapterName_);
+    Logger::debug("Worker thread stopped: {}", adapterName_);
+}
+
+// ==================== Batch Frames ====================
+
+bool ExtrapTrackDataZeroMQIncomingAdapter::submitBatchFrame(const uint8_t* data, std::size_t size,
+                                                            int64_t receiveNs) {
+    if (!adapters::BatchFrameReader::isBatchFrame(data, size)) {
+        return false;
+    }
+    if (!batchReader_.parse(data, size)) {
+        // Batch magic but bad version, count or length: never a single record
+        metricDecodeFailures_.add();
+        LOG_WARN_EVERY_MS(1000, "Dropping malformed batch frame - {} bytes", size);
+        return true;
+    }
+    if ((batchReader_.modelType() != adapters::BatchModelType::ExtrapTrackData) ||
+        (batchReader_.recordSize() != SINGLE_RECORD_SIZE)) {
+        LOG_WARN_EVERY_MS(1000, "Unexpected batch frame - model type: {}, record size: {}",
+                          static_cast<int>(batchReader_.header().modelType), batchReader_.recordSize());
+        return true;  // Consumed: not a single-record message either
+    }
+    
+    // Sequence gap detection (UDP multicast may drop or reorder whole frames)
+    const uint32_t sequence = batchReader_.header().sequence;
+    const uint32_t expected = batchSequence_.expected();
+    switch (batchSequence_.observe(sequence)) {
+        case adapters::BatchSequenceResult::Gap:
+            metricLostFrames_.add(batchSequence_.lastGap());
+            LOG_WARN_EVERY_MS(1000, "Batch frame gap - expected seq {}, got {} ({} frames lost so far)",
+                              expected, sequence, batchSequence_.lostCount());
+            break;
+        case adapters::BatchSequenceResult::Reordered:
+            metricReorderedFrames_.add();
+            LOG_DEBUG("Late batch frame - expected seq {}, got {}", expected, sequence);
+            break;
+        case adapters::BatchSequenceResult::Reset:
+            metricSequenceResets_.add();
+            Logger::info("Batch sequence reset - expected seq {}, got {} (publisher restart?), resynchronised",
+                         expected, sequence);
+            break;
+        default:
+            break;
+    }
+    
+    ExtrapTrackData record;
+    for (std::size_t index = 0U; index < batchReader_.recordCount(); ++index) {
+        if (record.deserialize(batchReader_.record(index), batchReader_.recordSize())) {
+            utils::StageTracer::instance().record(utils::TraceStage::Receive, record.getTrackId(),
+                                                  record.getUpdateTime(), receiveNs);
+            utils::FlightRecorder::instance().record(utils::FlightEventKind::Receive, record.getTrackId(),
+                                                     record.getUpdateTime());
+            dataReceiver_->submitExtrapTrackData(record);
+        } else {
+            metricDecodeFailures_.add();
+            LOG_WARN_EVERY_MS(1000, "Skipping undecodable record {} in batch frame {}", index, sequence);
+        }
+    }
+    return true;
 }
 
 // ==================== Deserialization ====================
@@ -180,14 +263,11 @@ void ExtrapTrackDataZeroMQIncomingAdapter::process() {
 ExtrapTrackData ExtrapTrackDataZeroMQIncomingAdapter::deserializeBinary(
     const uint8_t* data, std::size_t size) {
     
-    // Convert raw pointer to vector for deserialize method
-    std::vector<uint8_t> buffer(data, data + size);
-    
     ExtrapTrackData trackData;
     
     // Attempt deserialization - validates size and data integrity
     // Expected size: 76 bytes (1x int32 + 6x double + 3x int64)
-    if (!trackData.deserialize(buffer)) {
+    if (!trackData.deserialize(data, size)) {
         // Size mismatch or corrupted data - throw exception
         std::string errorMsg = "Failed to deserialize ExtrapTrackData - received " + 
                                std::to_string(size) + " bytes, expected " + 
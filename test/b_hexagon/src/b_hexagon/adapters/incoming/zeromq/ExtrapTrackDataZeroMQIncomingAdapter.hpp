@@ -11,8 +11,11 @@
 #pragma once
 
 #include "adapters/common/IAdapter.hpp"                           // IAdapter interface
+#include "adapters/common/ZmqContextRegistry.hpp"                 // Shared ZeroMQ context
+#include "adapters/common/BatchFrame.hpp"                         // Multi-record frames
 #include "domain/ports/incoming/IExtrapTrackDataIncomingPort.hpp" // Inbound port interface
 #include "domain/ports/incoming/ExtrapTrackData.hpp"              // Domain data model
+#include "utils/Metrics.hpp"                                      // Runtime counters
 #include <zmq_config.hpp>
 #include <zmq.hpp>
 #include <string>
@@ -80,6 +83,7 @@ public:
 private:
     // Thread configuration
     static constexpr int RECEIVE_TIMEOUT_MS = 100;        ///< Socket receive timeout (allows graceful shutdown check)
+    static constexpr std::size_t SINGLE_RECORD_SIZE = 76U; ///< Serialized ExtrapTrackData (legacy one-record message)
     
     // Network configuration constants
     // ZeroMQ DISH Pattern: Distributed subscriber pattern for UDP multicast
@@ -105,17 +109,35 @@ private:
     // Total size: 76 bytes (1x int32 + 6x double + 3x int64)
     static ExtrapTrackData deserializeBinary(const uint8_t* data, std::size_t size);
 
+    // Unpack a BatchFrame and submit every record (records are deserialized in place)
+    // receiveNs: StageTracer timestamp of the frame, applied to every record
+    // Returns false if the message lacks the batch magic (single-record message);
+    // malformed batch frames are counted as decode failures and dropped
+    bool submitBatchFrame(const uint8_t* data, std::size_t size, int64_t receiveNs);
+
     // Configuration
     std::string endpoint_;             // ZeroMQ endpoint
     std::string group_;                // Group identifier for filtering
     std::string adapterName_;          // Adapter name for logging
     
     // ZeroMQ socket (direct implementation - no abstraction layer)
-    zmq::context_t zmqContext_;
+    std::shared_ptr<zmq::context_t> zmqContext_;  // Process-wide shared context
     std::unique_ptr<zmq::socket_t> zmqSocket_;
     
     // Thread-safe lifecycle management
     std::shared_ptr<domain::ports::incoming::IExtrapTrackDataIncomingPort> dataReceiver_;
     std::thread workerThread_;         // Dedicated worker thread
     std::atomic<bool> running_{false}; // Thread-safe running flag
+    
+    // Batch frame bookkeeping (worker thread only)
+    adapters::BatchFrameReader batchReader_;   // Reused frame parser
+    adapters::BatchSequenceTracker batchSequence_;  // Gap / reorder / restart detection
+    
+    // Process-wide metrics (worker thread is the only writer)
+    utils::Metric& metricReceived_{utils::MetricsRegistry::instance().counter("incoming.received")};
+    utils::Metric& metricBytes_{utils::MetricsRegistry::instance().counter("incoming.bytes")};
+    utils::Metric& metricDecodeFailures_{utils::MetricsRegistry::instance().counter("incoming.decode_failures")};
+    utils::Metric& metricLostFrames_{utils::MetricsRegistry::instance().counter("incoming.lost_batch_frames")};
+    utils::Metric& metricReorderedFrames_{utils::MetricsRegistry::instance().counter("incoming.reordered_batch_frames")};
+    utils::Metric& metricSequenceResets_{utils::MetricsRegistry::instance().counter("incoming.batch_sequence_resets")};
 };
\ No newline at end of file
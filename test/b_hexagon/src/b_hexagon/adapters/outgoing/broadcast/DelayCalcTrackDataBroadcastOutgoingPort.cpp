@@ -0,0 +1,47 @@
+/**
+ * @file DelayCalcTrackDataBroadcastOutgoingPort.cpp
+ * @brief Composite outgoing port writing each result once for all adapters
+ * @details Validation happens once here instead of once per adapter queue.
+ */
+
+#include "DelayCalcTrackDataBroadcastOutgoingPort.hpp"
+#include "utils/Logger.hpp"
+#include <mutex>
+
+using domain::ports::DelayCalcTrackData;
+
+DelayCalcTrackDataBroadcastOutgoingPort::DelayCalcTrackDataBroadcastOutgoingPort(std::size_t capacity)
+    : ring_(std::make_shared<Ring>(capacity)) {
+    Logger::info("DelayCalcTrackDataBroadcastOutgoingPort created - ring size: {}", ring_->capacity());
+}
+
+void DelayCalcTrackDataBroadcastOutgoingPort::sendDelayCalcTrackData(const DelayCalcTrackData& data) {
+    std::lock_guard<utils::SpinLock> guard(producerLock_);
+    if (!data.isValid()) {
+        metricInvalid_.add();
+        LOG_ERROR_EVERY_MS(1000, "Invalid DelayCalcTrackData for track ID: {}", data.getTrackId());
+        return;
+    }
+
+    // One copy into the ring; each adapter reads it through its own cursor
+    ring_->publish(data);
+    metricPublished_.add();
+}
+
+void DelayCalcTrackDataBroadcastOutgoingPort::sendDelayCalcTrackData(const std::vector<DelayCalcTrackData>& data) {
+    std::lock_guard<utils::SpinLock> guard(producerLock_);
+    for (const DelayCalcTrackData& item : data) {
+        if (!item.isValid()) {
+            metricInvalid_.add();
+            LOG_ERROR_EVERY_MS(1000, "Invalid DelayCalcTrackData for track ID: {}", item.getTrackId());
+            continue;
+        }
+        ring_->publish(item);
+        metricPublished_.add();
+    }
+}
+
+std::shared_ptr<DelayCalcTrackDataBroadcastOutgoingPort::Ring>
+DelayCalcTrackDataBroadcastOutgoingPort::ring() const noexcept {
+    return ring_;
+}
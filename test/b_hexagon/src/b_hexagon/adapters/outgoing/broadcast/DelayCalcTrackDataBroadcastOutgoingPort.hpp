@@ -0,0 +1,92 @@
+/**
+ * @file DelayCalcTrackDataBroadcastOutgoingPort.hpp
+ * @brief Composite outgoing port fanning DelayCalcTrackData out to several adapters
+ * @details The domain writes each result once into a utils::BroadcastRing;
+ *          every attached adapter reads it through its own cursor on its own
+ *          worker thread. Fan-out to K adapters costs one write instead of K
+ *          queue copies.
+ *
+ * Thread Architecture:
+ * ┌─────────────────────────────────────────────────────────────────┐
+ * │  Domain Thread              Adapter Worker Threads             │
+ * │  ─────────────              ──────────────────────              │
+ * │  sendDelayCalcTrackData()        ┌──→ cursor 0 → ZeroMQ send    │
+ * │       └──→ [Broadcast Ring] ─────┤                              │
+ * │            (one write)           └──→ cursor 1 → Moving average │
+ * └─────────────────────────────────────────────────────────────────┘
+ *
+ * @author b_hexagon Team
+ * @version 1.0
+ * @date 2025
+ *
+ * @note MISRA C++ 2023 compliant implementation
+ * @see BroadcastRing.hpp
+ */
+
+#pragma once
+
+#include "domain/ports/outgoing/IDelayCalcTrackDataOutgoingPort.hpp" // Outbound port interface
+#include "domain/ports/outgoing/DelayCalcTrackData.hpp"              // Domain data model
+#include "utils/BroadcastRing.hpp"                                  // Single-write fan-out ring
+#include "utils/SpinLock.hpp"                                       // Producer serialisation
+#include "utils/Metrics.hpp"                                        // Runtime counters
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+using domain::ports::DelayCalcTrackData;
+
+/**
+ * @class DelayCalcTrackDataBroadcastOutgoingPort
+ * @brief IDelayCalcTrackDataOutgoingPort backed by one broadcast ring
+ * @details Adapters subscribe with attachBroadcast(port.ring(), policy)
+ *          before they start; the port itself owns no thread.
+ */
+class DelayCalcTrackDataBroadcastOutgoingPort final
+    : public domain::ports::outgoing::IDelayCalcTrackDataOutgoingPort {
+public:
+    /// @brief Default ring size (messages buffered for the slowest cursor)
+    static constexpr std::size_t DEFAULT_RING_CAPACITY = 1024U;
+
+    using Ring = utils::BroadcastRing<DelayCalcTrackData>;
+
+    /**
+     * @brief Constructor
+     * @param capacity Ring size (rounded up to a power of two)
+     */
+    explicit DelayCalcTrackDataBroadcastOutgoingPort(std::size_t capacity = DEFAULT_RING_CAPACITY);
+
+    ~DelayCalcTrackDataBroadcastOutgoingPort() override = default;
+
+    DelayCalcTrackDataBroadcastOutgoingPort(const DelayCalcTrackDataBroadcastOutgoingPort&) = delete;
+    DelayCalcTrackDataBroadcastOutgoingPort& operator=(const DelayCalcTrackDataBroadcastOutgoingPort&) = delete;
+    DelayCalcTrackDataBroadcastOutgoingPort(DelayCalcTrackDataBroadcastOutgoingPort&&) = delete;
+    DelayCalcTrackDataBroadcastOutgoingPort& operator=(DelayCalcTrackDataBroadcastOutgoingPort&&) = delete;
+
+    /**
+     * @brief Publish one result to every attached adapter
+     * @param data Result to broadcast (validated once here)
+     * @thread_safe Yes - concurrent callers are serialised by a producer spin lock
+     */
+    void sendDelayCalcTrackData(const DelayCalcTrackData& data) override;
+
+    /**
+     * @brief Publish a batch of results under one producer lock acquisition
+     * @param data Results to broadcast, in order (each validated here)
+     * @thread_safe Yes - concurrent callers are serialised by a producer spin lock
+     */
+    void sendDelayCalcTrackData(const std::vector<DelayCalcTrackData>& data) override;
+
+    /**
+     * @brief Ring the adapters attach their cursors to
+     */
+    [[nodiscard]] std::shared_ptr<Ring> ring() const noexcept;
+
+private:
+    std::shared_ptr<Ring> ring_;        ///< Shared with the attached adapters
+    utils::SpinLock producerLock_;      ///< Serialises concurrent senders
+
+    // Metrics (under producerLock_)
+    utils::Metric& metricPublished_{utils::MetricsRegistry::instance().counter("outgoing.broadcast_published")};
+    utils::Metric& metricInvalid_{utils::MetricsRegistry::instance().counter("outgoing.broadcast_invalid")};
+};
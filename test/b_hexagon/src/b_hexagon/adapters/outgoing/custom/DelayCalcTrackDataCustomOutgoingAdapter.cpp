@@ -17,20 +17,24 @@ using domain::ports::DelayCalcTrackData;
 
 // ==================== Constructors ====================
 
-DelayCalcTrackDataCustomOutgoingAdapter::DelayCalcTrackDataCustomOutgoingAdapter()
+DelayCalcTrackDataCustomOutgoingAdapter::DelayCalcTrackDataCustomOutgoingAdapter(
+    std::shared_ptr<utils::WaitStrategy> waitStrategy)
     : adapterName_("DelayCalcTrackData-Custom-OutAdapter")
     , running_{false}
     , ready_{false}
+    , waitStrategy_(waitStrategy ? std::move(waitStrategy) : std::make_shared<utils::BlockingWaitStrategy>())
+    , messageQueue_(MAX_QUEUE_SIZE, waitStrategy_)
     , movingAverage_{0.0} {
     
-    Logger::info("DelayCalcTrackDataCustomOutgoingAdapter created - moving average buffer size: ", SAMPLE_BUFFER_SIZE);
+    Logger::info("DelayCalcTrackDataCustomOutgoingAdapter created - moving average buffer size: {}, {} wait",
+                 SAMPLE_BUFFER_SIZE, waitStrategy_->name());
 }
 
 
 
 DelayCalcTrackDataCustomOutgoingAdapter::~DelayCalcTrackDataCustomOutgoingAdapter() noexcept {
     stop();
-    Logger::debug("DelayCalcTrackDataCustomOutgoingAdapter destroyed: ", adapterName_);
+    Logger::debug("DelayCalcTrackDataCustomOutgoingAdapter destroyed: {}", adapterName_);
 }
 
 
@@ -39,11 +43,15 @@ DelayCalcTrackDataCustomOutgoingAdapter::~DelayCalcTrackDataCustomOutgoingAdapte
 
 bool DelayCalcTrackDataCustomOutgoingAdapter::start() {
     if (running_.load()) {
-        Logger::warn("Adapter already running: ", adapterName_);
+        Logger::warn("Adapter already running: {}", adapterName_);
         return true;
     }
     
     running_.store(true);
+    messageQueue_.resetWake();
+    if (broadcast_) {
+        broadcast_->setActive(broadcastConsumer_, true);
+    }
     ready_.store(true);
     
     // Start background processing thread
@@ -51,7 +59,7 @@ bool DelayCalcTrackDataCustomOutgoingAdapter::start() {
         process();
     });
     
-    Logger::info("Adapter started with background worker: ", adapterName_);
+    Logger::info("Adapter started with background worker: {}", adapterName_);
     return true;
 }
 
@@ -60,18 +68,21 @@ void DelayCalcTrackDataCustomOutgoingAdapter::stop() {
         return;
     }
     
-    Logger::info("Stopping adapter: ", adapterName_);
+    Logger::info("Stopping adapter: {}", adapterName_);
     running_.store(false);
     ready_.store(false);
     
     // Wake up the worker thread
-    queueCV_.notify_all();
+    messageQueue_.wakeConsumer();
+    if (broadcast_) {
+        broadcast_->setActive(broadcastConsumer_, false);
+    }
     
     if (publisherThread_.joinable()) {
         publisherThread_.join();
     }
     
-    Logger::info("Adapter stopped: ", adapterName_);
+    Logger::info("Adapter stopped: {}", adapterName_);
 }
 
 bool DelayCalcTrackDataCustomOutgoingAdapter::isRunning() const {
@@ -86,17 +97,44 @@ std::string DelayCalcTrackDataCustomOutgoingAdapter::getName() const noexcept {
     return adapterName_;
 }
 
+// ==================== Broadcast Subscription ====================
+
+bool DelayCalcTrackDataCustomOutgoingAdapter::attachBroadcast(
+    std::shared_ptr<utils::BroadcastRing<DelayCalcTrackData>> ring,
+    utils::SlowConsumerPolicy policy) {
+    if (running_.load() || !ring) {
+        Logger::error("[{}] Broadcast ring can only be attached while stopped", adapterName_);
+        return false;
+    }
+    try {
+        broadcastConsumer_ = ring->addConsumer(policy, waitStrategy_);
+    } catch (const std::length_error& e) {
+        Logger::error("[{}] Cannot attach to broadcast ring: {}", adapterName_, e.what());
+        return false;
+    }
+    broadcast_ = std::move(ring);
+    Logger::info("[{}] Attached to broadcast ring (slow-consumer policy: {})",
+                 adapterName_, utils::slowConsumerPolicyName(policy));
+    return true;
+}
+
 // ==================== Non-blocking Send (~20ns enqueue) ====================
 
 void DelayCalcTrackDataCustomOutgoingAdapter::sendDelayCalcTrackData(const DelayCalcTrackData& data) {
     if (!isReady()) {
-        Logger::warn("Adapter not ready, dropping message for track: ", data.getTrackId());
+        LOG_WARN_EVERY_MS(1000, "Adapter not ready, dropping message for track: {}", data.getTrackId());
+        return;
+    }
+    
+    if (broadcast_) {
+        LOG_WARN_EVERY_MS(1000, "[{}] Fed by broadcast ring, ignoring direct send for track: {}",
+                          adapterName_, data.getTrackId());
         return;
     }
     
     // Validate input data
     if (!data.isValid()) {
-        Logger::error("Invalid DelayCalcTrackData for track ID: ", data.getTrackId());
+        LOG_ERROR_EVERY_MS(1000, "Invalid DelayCalcTrackData for track ID: {}", data.getTrackId());
         return;
     }
     
@@ -105,32 +143,60 @@ void DelayCalcTrackDataCustomOutgoingAdapter::sendDelayCalcTrackData(const Delay
     enqueueMessage(data);
 }
 
-void DelayCalcTrackDataCustomOutgoingAdapter::enqueueMessage(const DelayCalcTrackData& data) {
+void DelayCalcTrackDataCustomOutgoingAdapter::sendDelayCalcTrackData(const std::vector<DelayCalcTrackData>& data) {
+    if (data.empty()) {
+        return;
+    }
+    if (!isReady()) {
+        LOG_WARN_EVERY_MS(1000, "Adapter not ready, dropping {} messages", data.size());
+        return;
+    }
+    
+    if (broadcast_) {
+        LOG_WARN_EVERY_MS(1000, "[{}] Fed by broadcast ring, ignoring direct send of {} messages",
+                          adapterName_, data.size());
+        return;
+    }
+    
+    std::size_t dropped = 0U;
     {
-        std::lock_guard<std::mutex> lock(queueMutex_);
+        std::lock_guard<utils::SpinLock> guard(producerLock_);
         
-        // Prevent unbounded queue growth
-        // Overflow strategy: Drop oldest message (FIFO eviction)
-        // This prevents memory exhaustion and ensures latest data is processed
-        // Alternative: Drop newest (better for historical analysis)
-        // Choice: Drop oldest - prioritizes recent data for real-time systems
-        if (messageQueue_.size() >= MAX_QUEUE_SIZE) {
-            Logger::warn("Message queue full, dropping oldest message");
-            messageQueue_.pop();  // Remove oldest element
+        for (const DelayCalcTrackData& item : data) {
+            if (!item.isValid()) {
+                LOG_ERROR_EVERY_MS(1000, "Invalid DelayCalcTrackData for track ID: {}", item.getTrackId());
+                continue;
+            }
+            if (!messageQueue_.push(item)) {
+                ++dropped;
+            }
         }
+    }
+    
+    if (dropped != 0U) {
+        LOG_WARN_EVERY_MS(1000, "Message queue full, dropped {} oldest messages", dropped);
+    }
+}
+
+void DelayCalcTrackDataCustomOutgoingAdapter::enqueueMessage(const DelayCalcTrackData& data) {
+    bool accepted = false;
+    {
+        std::lock_guard<utils::SpinLock> guard(producerLock_);
         
-        messageQueue_.push(data);
+        // Bounded ring: evicts the oldest message when full
+        // Drop oldest - prioritizes recent data for real-time systems
+        accepted = messageQueue_.push(data);
     }
     
-    // Notify background worker thread that new data is available
-    // Only one thread needs to wake up (notify_one vs notify_all)
-    queueCV_.notify_one();
+    if (!accepted) {
+        LOG_WARN_EVERY_MS(1000, "Message queue full, dropping oldest message");
+    }
 }
 
 // ==================== Background Processing Loop ====================
 
 void DelayCalcTrackDataCustomOutgoingAdapter::process() {
-    Logger::debug("Custom adapter processing thread started: ", adapterName_);
+    Logger::debug("Custom adapter processing thread started: {}", adapterName_);
     
     // Main processing loop - runs until stop() sets running_ to false
     // Pattern: Event queue with condition variable wait
@@ -139,38 +205,14 @@ void DelayCalcTrackDataCustomOutgoingAdapter::process() {
         
         // Wait for message with timeout
         // Timeout allows periodic check of running_ flag for graceful shutdown
-        // Without timeout, thread would block indefinitely on empty queue
-        {
-            std::unique_lock<std::mutex> lock(queueMutex_);
-            
-            // wait_for with predicate:
-            // - Atomically releases lock and waits for notification OR timeout
-            // - Predicate prevents spurious wakeups (must return true to proceed)
-            // - Predicate: (!messageQueue_.empty() || !running_)
-            //   * Queue has data: Process it
-            //   * Adapter stopping: Exit loop
-            // Timeout: QUEUE_WAIT_TIMEOUT_MS (100ms) - balance between responsiveness and CPU usage
-            if (queueCV_.wait_for(lock, std::chrono::milliseconds(QUEUE_WAIT_TIMEOUT_MS),
-                [this]() { return !messageQueue_.empty() || !running_.load(); })) {
-                
-                // Check stop condition first (higher priority than data processing)
-                if (!running_.load()) {
-                    break;
-                }
-                
-                // Dequeue message for processing
-                if (!messageQueue_.empty()) {
-                    data = std::move(messageQueue_.front());  // Move semantics for efficiency
-                    messageQueue_.pop();
-                } else {
-                    continue;  // Spurious wakeup with empty queue - retry
-                }
-            } else {
-                continue;  // Timeout - check running flag and retry
-            }
+        const bool received = broadcast_
+            ? broadcast_->waitConsume(broadcastConsumer_, data, std::chrono::milliseconds(QUEUE_WAIT_TIMEOUT_MS))
+            : messageQueue_.waitPop(data, std::chrono::milliseconds(QUEUE_WAIT_TIMEOUT_MS));
+        if (!received) {
+            continue;
         }
         
-        // Process FirstHopDelayTime (outside lock)
+        // Process FirstHopDelayTime
         // Extract delay metric from DelayCalcTrackData
         // FirstHopDelayTime = time between data generation and first reception (microseconds)
         try {
@@ -180,17 +222,15 @@ void DelayCalcTrackDataCustomOutgoingAdapter::process() {
             // This recalculates average across last 100 samples
             updateMovingAverage(firstHopDelay);
             
-            Logger::debug("[", adapterName_, "] Processed TrackID: ", data.getTrackId(), 
-                         ", FirstHopDelay: ", firstHopDelay, " µs",
-                         ", MovingAverage: ", movingAverage_, " µs",
-                         ", Samples: ", sampleBuffer_.size());
+            LOG_DEBUG("[{}] Processed TrackID: {}, FirstHopDelay: {} µs, MovingAverage: {} µs, Samples: {}",
+                      adapterName_, data.getTrackId(), firstHopDelay, movingAverage_, sampleBuffer_.size());
             
         } catch (const std::exception& e) {
-            Logger::error("[", adapterName_, "] Processing error: ", e.what());
+            LOG_ERROR_EVERY_MS(1000, "[{}] Processing error: {}", adapterName_, e.what());
         }
     }
     
-    Logger::debug("Custom adapter processing thread stopped: ", adapterName_);
+    Logger::debug("Custom adapter processing thread stopped: {}", adapterName_);
 }
 
 // ==================== Moving Average Calculation ====================
@@ -10,14 +10,16 @@
 #include "adapters/common/IAdapter.hpp"                              // IAdapter interface
 #include "domain/ports/outgoing/IDelayCalcTrackDataOutgoingPort.hpp" // Outbound port interface
 #include "domain/ports/outgoing/DelayCalcTrackData.hpp"              // Domain data model
+#include "utils/SpscRingBuffer.hpp"                                 // Lock-free stage queue
+#include "utils/SpinLock.hpp"                                       // Producer serialisation
+#include "utils/BroadcastRing.hpp"                                  // Shared fan-out ring
+#include "utils/WaitStrategy.hpp"                                   // Worker wait policy
 #include <string>
 #include <memory>
 #include <atomic>
 #include <mutex>
 #include <thread>
-#include <queue>
 #include <deque>
-#include <condition_variable>
 #include <vector>
 #include <cstdint>
 
@@ -38,7 +40,7 @@ using domain::ports::DelayCalcTrackData;
  * Real-time Features:
  * - Non-blocking sendDelayCalcTrackData() (~20ns enqueue)
  * - Background worker thread for moving average calculation
- * - Bounded queue with overflow protection
+ * - Bounded lock-free SPSC ring with drop-oldest overflow protection
  * - Circular buffer of 100 samples for moving average
  * 
  * Processing Logic:
@@ -51,9 +53,11 @@ class DelayCalcTrackDataCustomOutgoingAdapter final
     , public domain::ports::outgoing::IDelayCalcTrackDataOutgoingPort {
 public:
     /**
-     * @brief Default constructor
+     * @brief Constructor
+     * @param waitStrategy How the worker waits for data, on its own queue or
+     *                     the broadcast ring (blocking if null)
      */
-    explicit DelayCalcTrackDataCustomOutgoingAdapter();
+    explicit DelayCalcTrackDataCustomOutgoingAdapter(std::shared_ptr<utils::WaitStrategy> waitStrategy = nullptr);
 
     // Destructor - RAII cleanup
     ~DelayCalcTrackDataCustomOutgoingAdapter() noexcept override;
@@ -80,16 +84,35 @@ public:
      * @param data Data to process
      * @details Enqueues message for background moving average calculation (~20ns latency)
      *          Domain thread returns immediately without blocking
-     * @thread_safe Yes - uses mutex-protected queue
+     * @thread_safe Yes - concurrent callers are serialised by a producer spin lock
      */
     void sendDelayCalcTrackData(const DelayCalcTrackData& data) override;
 
+    /**
+     * @brief Send a batch of results for processing (non-blocking)
+     * @param data Results to process, in order
+     * @details Enqueues the whole batch under one producer lock acquisition
+     * @thread_safe Yes - concurrent callers are serialised by a producer spin lock
+     */
+    void sendDelayCalcTrackData(const std::vector<DelayCalcTrackData>& data) override;
+
     /**
      * @brief Check if adapter is ready to accept messages
      * @return true if running and ready
      */
     [[nodiscard]] bool isReady() const noexcept;
 
+    /**
+     * @brief Read from a broadcast ring instead of the adapter's own queue
+     * @param ring Ring written by DelayCalcTrackDataBroadcastOutgoingPort
+     * @param policy What the ring does when this adapter falls a full ring behind
+     * @return false if the adapter is running or the ring has no free cursor
+     * @details Call before start(). While attached, the ring is the only input:
+     *          direct sendDelayCalcTrackData() calls are ignored.
+     */
+    [[nodiscard]] bool attachBroadcast(std::shared_ptr<utils::BroadcastRing<DelayCalcTrackData>> ring,
+                                       utils::SlowConsumerPolicy policy);
+
     /**
      * @brief Get current moving average of FirstHopDelayTime
      * @return Moving average in microseconds (0.0 if no samples)
@@ -143,10 +166,14 @@ private:
     std::atomic<bool> running_{false}; ///< Running state
     std::atomic<bool> ready_{false};   ///< Ready state
 
-    // Thread-safe message queue
-    mutable std::mutex queueMutex_;              ///< Queue protection
-    std::condition_variable queueCV_;            ///< Queue notification
-    std::queue<DelayCalcTrackData> messageQueue_; ///< Pending messages
+    // Lock-free message queue
+    std::shared_ptr<utils::WaitStrategy> waitStrategy_;                      ///< Worker wait policy
+    utils::SpscRingBuffer<DelayCalcTrackData> messageQueue_;                  ///< Pending messages
+    utils::SpinLock producerLock_;               ///< Serialises concurrent senders
+
+    // Broadcast subscription (set before start)
+    std::shared_ptr<utils::BroadcastRing<DelayCalcTrackData>> broadcast_;  ///< Fan-out ring (optional)
+    std::size_t broadcastConsumer_{0U};                                     ///< Cursor in broadcast_
     
     // Moving average calculation
     mutable std::mutex sampleMutex_;             ///< Sample buffer protection
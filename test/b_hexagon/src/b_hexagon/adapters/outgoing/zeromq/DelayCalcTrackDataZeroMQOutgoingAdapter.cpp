@@ -3,13 +3,15 @@
  * @brief ZeroMQ RADIO adapter for outbound data transmission
  * @details Thread-per-Type architecture compliant with background worker thread
  *          SOLID compliant - uses direct ZeroMQ socket for simplicity
- *          Non-blocking send (~20ns enqueue) for real-time performance
+ *          Non-blocking send (enqueue only) for real-time performance
  */
 
 #include <zmq_config.hpp>
 #include <zmq.hpp>
 #include "DelayCalcTrackDataZeroMQOutgoingAdapter.hpp"
 #include "../../../utils/Logger.hpp"
+#include "../../../utils/StageTracer.hpp"
+#include "../../../utils/FlightRecorder.hpp"
 #include <sstream>
 #include <cstring>
 #include <stdexcept>
@@ -25,41 +27,49 @@ using domain::ports::DelayCalcTrackData;
 
 // ==================== Constructors ====================
 
-DelayCalcTrackDataZeroMQOutgoingAdapter::DelayCalcTrackDataZeroMQOutgoingAdapter()
+DelayCalcTrackDataZeroMQOutgoingAdapter::DelayCalcTrackDataZeroMQOutgoingAdapter(
+    std::shared_ptr<utils::WaitStrategy> waitStrategy)
     : endpoint_(std::string(ZMQ_PROTOCOL) + "://" + ZMQ_ADDRESS + ":" + std::to_string(ZMQ_PORT))
     , group_(ZMQ_GROUP)
     , adapterName_(std::string(ZMQ_GROUP) + "-OutAdapter")
     , socket_()  // Default constructed SimpleZMQSocket
     , running_{false}
-    , ready_{false} {
+    , ready_{false}
+    , waitStrategy_(waitStrategy ? std::move(waitStrategy) : std::make_shared<utils::BlockingWaitStrategy>())
+    , messageQueue_(MAX_QUEUE_SIZE, waitStrategy_) {
     
     if (!socket_.connect(endpoint_, group_)) {
         throw std::runtime_error("Failed to connect SimpleZMQSocket to: " + endpoint_);
     }
-    Logger::info("DelayCalcTrackDataZeroMQOutgoingAdapter created - endpoint: ", endpoint_, ", group: ", group_);
+    Logger::info("DelayCalcTrackDataZeroMQOutgoingAdapter created - endpoint: {}, group: {}, {} wait",
+                 endpoint_, group_, waitStrategy_->name());
 }
 
 DelayCalcTrackDataZeroMQOutgoingAdapter::DelayCalcTrackDataZeroMQOutgoingAdapter(
     const std::string& endpoint,
-    const std::string& group)
+    const std::string& group,
+    std::shared_ptr<utils::WaitStrategy> waitStrategy)
     : endpoint_(endpoint)
     , group_(group)
     , adapterName_(group + "-OutAdapter")
     , socket_()  // Default constructed SimpleZMQSocket
     , running_{false}
-    , ready_{false} {
+    , ready_{false}
+    , waitStrategy_(waitStrategy ? std::move(waitStrategy) : std::make_shared<utils::BlockingWaitStrategy>())
+    , messageQueue_(MAX_QUEUE_SIZE, waitStrategy_) {
     
     if (!socket_.connect(endpoint_, group_)) {
         throw std::runtime_error("Failed to connect SimpleZMQSocket to: " + endpoint_);
     }
-    Logger::info("DelayCalcTrackDataZeroMQOutgoingAdapter created (custom) - endpoint: ", endpoint_, ", group: ", group_);
+    Logger::info("DelayCalcTrackDataZeroMQOutgoingAdapter created (custom) - endpoint: {}, group: {}, {} wait",
+                 endpoint_, group_, waitStrategy_->name());
 }
 
 
 
 DelayCalcTrackDataZeroMQOutgoingAdapter::~DelayCalcTrackDataZeroMQOutgoingAdapter() noexcept {
     stop();
-    Logger::debug("DelayCalcTrackDataZeroMQOutgoingAdapter destroyed: ", adapterName_);
+    Logger::debug("DelayCalcTrackDataZeroMQOutgoingAdapter destroyed: {}", adapterName_);
 }
 
 
@@ -68,7 +78,7 @@ DelayCalcTrackDataZeroMQOutgoingAdapter::~DelayCalcTrackDataZeroMQOutgoingAdapte
 
 bool DelayCalcTrackDataZeroMQOutgoingAdapter::start() {
     if (running_.load()) {
-        Logger::warn("Adapter already running: ", adapterName_);
+        Logger::warn("Adapter already running: {}", adapterName_);
         return true;
     }
     
@@ -78,6 +88,10 @@ bool DelayCalcTrackDataZeroMQOutgoingAdapter::start() {
     }
     
     running_.store(true);
+    messageQueue_.resetWake();
+    if (broadcast_) {
+        broadcast_->setActive(broadcastConsumer_, true);
+    }
     ready_.store(true);
     
     // Start background publisher thread
@@ -85,7 +99,7 @@ bool DelayCalcTrackDataZeroMQOutgoingAdapter::start() {
         process();
     });
     
-    Logger::info("Adapter started with background worker: ", adapterName_);
+    Logger::info("Adapter started with background worker: {}", adapterName_);
     return true;
 }
 
@@ -94,20 +108,24 @@ void DelayCalcTrackDataZeroMQOutgoingAdapter::stop() {
         return;
     }
     
-    Logger::info("Stopping adapter: ", adapterName_);
+    Logger::info("Stopping adapter: {}", adapterName_);
     running_.store(false);
     ready_.store(false);
     
     // Wake up the worker thread
-    queueCV_.notify_all();
+    messageQueue_.wakeConsumer();
+    if (broadcast_) {
+        broadcast_->setActive(broadcastConsumer_, false);
+    }
     
     if (publisherThread_.joinable()) {
         publisherThread_.join();
     }
+    queueCounters_.publish(messageQueue_);  // Pushes after the last send
     
     socket_.close();
     
-    Logger::info("Adapter stopped: ", adapterName_);
+    Logger::info("Adapter stopped: {}", adapterName_);
 }
 
 bool DelayCalcTrackDataZeroMQOutgoingAdapter::isRunning() const {
@@ -122,103 +140,145 @@ std::string DelayCalcTrackDataZeroMQOutgoingAdapter::getName() const noexcept {
     return adapterName_;
 }
 
-// ==================== Non-blocking Send (~20ns enqueue) ====================
+// ==================== Broadcast Subscription ====================
+
+bool DelayCalcTrackDataZeroMQOutgoingAdapter::attachBroadcast(
+    std::shared_ptr<utils::BroadcastRing<DelayCalcTrackData>> ring,
+    utils::SlowConsumerPolicy policy) {
+    if (running_.load() || !ring) {
+        Logger::error("[{}] Broadcast ring can only be attached while stopped", adapterName_);
+        return false;
+    }
+    try {
+        broadcastConsumer_ = ring->addConsumer(policy, waitStrategy_);
+    } catch (const std::length_error& e) {
+        Logger::error("[{}] Cannot attach to broadcast ring: {}", adapterName_, e.what());
+        return false;
+    }
+    broadcast_ = std::move(ring);
+    Logger::info("[{}] Attached to broadcast ring (slow-consumer policy: {})",
+                 adapterName_, utils::slowConsumerPolicyName(policy));
+    return true;
+}
+
+// ==================== Non-blocking Send ====================
 // sendDelayCalcTrackData is the hot path called by domain thread
-// Performance goal: Return to caller ASAP (~20ns) to maintain real-time responsiveness
+// Performance goal: Return to caller ASAP to maintain real-time responsiveness
 // Actual ZeroMQ transmission happens in background thread
 
 void DelayCalcTrackDataZeroMQOutgoingAdapter::sendDelayCalcTrackData(const DelayCalcTrackData& data) {
     if (!isReady()) {
-        Logger::warn("Adapter not ready, dropping message for track: ", data.getTrackId());
+        LOG_WARN_EVERY_MS(1000, "Adapter not ready, dropping message for track: {}", data.getTrackId());
+        return;
+    }
+    
+    if (broadcast_) {
+        LOG_WARN_EVERY_MS(1000, "[{}] Fed by broadcast ring, ignoring direct send for track: {}",
+                          adapterName_, data.getTrackId());
         return;
     }
     
     // Validate input data
     if (!data.isValid()) {
-        Logger::error("Invalid DelayCalcTrackData for track ID: ", data.getTrackId());
+        LOG_ERROR_EVERY_MS(1000, "Invalid DelayCalcTrackData for track ID: {}", data.getTrackId());
         return;
     }
     
-    // Non-blocking enqueue (~20ns)
+    // Non-blocking enqueue
     enqueueMessage(data);
 }
 
-void DelayCalcTrackDataZeroMQOutgoingAdapter::enqueueMessage(const DelayCalcTrackData& data) {
-    {
-        std::lock_guard<std::mutex> lock(queueMutex_);
-        
-        // Prevent unbounded queue growth (protects against memory exhaustion)
-        // Strategy: Drop oldest message (FIFO eviction)
-        // Alternative strategies: Drop newest, drop by priority, backpressure
-        if (messageQueue_.size() >= MAX_QUEUE_SIZE) {
-            Logger::warn("Message queue full, dropping oldest message");
-            messageQueue_.pop();  // Remove oldest
+void DelayCalcTrackDataZeroMQOutgoingAdapter::sendDelayCalcTrackData(const std::vector<DelayCalcTrackData>& data) {
+    if (data.empty()) {
+        return;
+    }
+    if (!isReady()) {
+        LOG_WARN_EVERY_MS(1000, "Adapter not ready, dropping {} messages", data.size());
+        return;
+    }
+    
+    if (broadcast_) {
+        LOG_WARN_EVERY_MS(1000, "[{}] Fed by broadcast ring, ignoring direct send of {} messages",
+                          adapterName_, data.size());
+        return;
+    }
+    
+    std::size_t evicted = 0U;
+    for (const DelayCalcTrackData& item : data) {
+        if (!item.isValid()) {
+            LOG_ERROR_EVERY_MS(1000, "Invalid DelayCalcTrackData for track ID: {}", item.getTrackId());
+            continue;
+        }
+        if (messageQueue_.push(item) == utils::ConflateResult::EvictedOldest) {
+            ++evicted;
         }
-        
-        messageQueue_.push(data);
     }
     
-    queueCV_.notify_one();
+    if (evicted != 0U) {
+        LOG_WARN_EVERY_MS(1000, "Message queue full, dropped {} oldest tracks", evicted);
+    }
+}
+
+void DelayCalcTrackDataZeroMQOutgoingAdapter::enqueueMessage(const DelayCalcTrackData& data) {
+    // An unsent result of the same track is superseded in place;
+    // a new track evicts the oldest pending track when every slot is taken.
+    // The queue counts both; the worker publishes them as metrics.
+    if (messageQueue_.push(data) == utils::ConflateResult::EvictedOldest) {
+        LOG_WARN_EVERY_MS(1000, "Message queue full, dropping oldest track");
+    }
 }
 
 // ==================== Background Processing Loop ====================
 
 void DelayCalcTrackDataZeroMQOutgoingAdapter::process() {
-    Logger::debug("Outgoing adapter processing thread started: ", adapterName_);
+    Logger::debug("Outgoing adapter processing thread started: {}", adapterName_);
     
     while (running_.load()) {
         DelayCalcTrackData data;
         
         // Wait for message with timeout
-        // Condition variable pattern: wait_for(lock, timeout, predicate)
-        // - Returns true if predicate becomes true (message available or shutdown)
-        // - Returns false on timeout (allows periodic shutdown check)
-        // - Lock is automatically released during wait, reacquired on wake
-        {
-            std::unique_lock<std::mutex> lock(queueMutex_);
-            
-            if (queueCV_.wait_for(lock, std::chrono::milliseconds(QUEUE_WAIT_TIMEOUT_MS),
-                [this]() { return !messageQueue_.empty() || !running_.load(); })) {
-                
-                if (!running_.load()) {
-                    break;
-                }
-                
-                if (!messageQueue_.empty()) {
-                    data = std::move(messageQueue_.front());
-                    messageQueue_.pop();
-                } else {
-                    continue;
-                }
-            } else {
-                continue;  // Timeout, check running flag
-            }
+        // Timeout allows periodic check of running_ flag for graceful shutdown
+        const bool received = broadcast_
+            ? broadcast_->waitConsume(broadcastConsumer_, data, std::chrono::milliseconds(QUEUE_WAIT_TIMEOUT_MS))
+            : messageQueue_.waitPop(data, std::chrono::milliseconds(QUEUE_WAIT_TIMEOUT_MS));
+        if (!received) {
+            continue;
+        }
+        if (!broadcast_) {
+            queueCounters_.publish(messageQueue_);
         }
         
-        // Serialize and send (outside lock)
-        // Lock is released here to prevent blocking enqueue operations
+        // Serialize and send
         try {
-            // Serialize domain object to binary format (96 bytes)
-            // Format: Little-endian packed struct
-            std::vector<uint8_t> binaryData = data.serialize();
+            // Serialize domain object into a stack buffer (92 bytes, no allocation)
+            // Format: packed DelayCalcTrackData::Wire, native byte order
+            std::array<uint8_t, DelayCalcTrackData::kWireSize> binaryData{};
+            const std::size_t size = data.serializeInto(binaryData.data(), binaryData.size());
             
-            if (binaryData.empty()) {
-                Logger::error("Empty payload for track ID: ", data.getTrackId());
+            if (size == 0U) {
+                LOG_ERROR_EVERY_MS(1000, "Empty payload for track ID: {}", data.getTrackId());
                 continue;
             }
             
             // Send via SimpleZMQSocket (RADIO pattern with group tag)
-            if (socket_.send(binaryData)) {
-                Logger::debug("[", adapterName_, "] Sent TrackID: ", data.getTrackId(), 
-                             ", Size: ", binaryData.size(), " bytes");
+            if (socket_.send(binaryData.data(), size)) {
+                utils::StageTracer::instance().record(utils::TraceStage::Send, data.getTrackId(), data.getUpdateTime());
+                utils::FlightRecorder::instance().record(utils::FlightEventKind::Send, data.getTrackId(),
+                                                         data.getUpdateTime());
+                metricSent_.add();
+                metricBytes_.add(size);
+                LOG_DEBUG("[{}] Sent TrackID: {}, Size: {} bytes", adapterName_, data.getTrackId(), size);
             } else {
-                Logger::warn("Failed to send message for track: ", data.getTrackId());
+                metricSendFailures_.add();
+                utils::FlightRecorder::instance().record(utils::FlightEventKind::SendFailed, data.getTrackId(),
+                                                         data.getUpdateTime());
+                LOG_WARN_EVERY_MS(1000, "Failed to send message for track: {}", data.getTrackId());
             }
             
         } catch (const std::exception& e) {
-            Logger::error("[", adapterName_, "] Send error: ", e.what());
+            LOG_ERROR_EVERY_MS(1000, "[{}] Send error: {}", adapterName_, e.what());
         }
     }
     
-    Logger::debug("Outgoing adapter processing thread stopped: ", adapterName_);
+    Logger::debug("Outgoing adapter processing thread stopped: {}", adapterName_);
 }
\ No newline at end of file
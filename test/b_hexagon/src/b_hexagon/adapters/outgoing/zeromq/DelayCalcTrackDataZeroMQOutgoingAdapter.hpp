@@ -3,7 +3,7 @@
  * @brief ZeroMQ RADIO adapter for outbound data transmission using UDP multicast
  * @details Thread-per-Type architecture compliant - implements IAdapter interface
  *          SOLID compliant - uses direct ZeroMQ socket for simplicity
- *          Uses background worker thread for non-blocking sends (~20ns enqueue latency)
+ *          Uses background worker thread for non-blocking sends
  * 
  * Dependency Inversion:
  * - IDelayCalcTrackDataOutgoingPort: Domain port abstraction
@@ -15,7 +15,7 @@
  * │  sendDelayCalcTrackData() ──┐                                   │
  * │       │                     │                                   │
  * │       ▼                     ▼                                   │
- * │  [Enqueue ~20ns]     [Dequeue + ZMQ Send]                      │
+ * │  [Enqueue]           [Dequeue + ZMQ Send]                      │
  * │       │                     │                                   │
  * │  Return immediately    Background transmission                  │
  * └─────────────────────────────────────────────────────────────────┘
@@ -24,17 +24,21 @@
 #pragma once
 
 #include "adapters/common/IAdapter.hpp"                              // IAdapter interface
+#include "adapters/common/ZmqContextRegistry.hpp"                    // Shared ZeroMQ context
 #include "domain/ports/outgoing/IDelayCalcTrackDataOutgoingPort.hpp" // Outbound port interface
 #include "domain/ports/outgoing/DelayCalcTrackData.hpp"              // Domain data model
+#include "utils/ConflatingQueue.hpp"                                // Per-track stage queue
+#include "utils/BroadcastRing.hpp"                                  // Shared fan-out ring
+#include "utils/WaitStrategy.hpp"                                   // Worker wait policy
+#include "utils/Metrics.hpp"                                        // Runtime counters
 #include <zmq_config.hpp>
 #include <zmq.hpp>
 #include <string>
 #include <memory>
 #include <atomic>
-#include <mutex>
 #include <thread>
-#include <queue>
-#include <condition_variable>
+#include <array>
+#include <vector>
 
 // Using declarations for convenience
 using domain::ports::DelayCalcTrackData;
@@ -51,9 +55,9 @@ using domain::ports::DelayCalcTrackData;
  * - Dependency Inversion: Depends on domain port abstractions
  * 
  * Real-time Features:
- * - Non-blocking sendDelayCalcTrackData() (~20ns enqueue)
+ * - Non-blocking sendDelayCalcTrackData() (one short queue lock)
  * - Background worker thread for actual ZMQ transmission
- * - Bounded queue with overflow protection
+ * - Bounded per-track conflating queue: only the latest result of each track waits
  * - SCHED_FIFO priority for worker thread
  * 
  * Test Coverage:
@@ -73,7 +77,7 @@ public:
         
         bool connect(const std::string& endpoint, const std::string& group) {
             try {
-                context_ = std::make_shared<zmq::context_t>(1);
+                context_ = adapters::ZmqContextRegistry::instance().acquire();
                 socket_ = std::make_unique<zmq::socket_t>(*context_, zmq::socket_type::radio);
                 
                 // RADIO sockets connect (not bind) to endpoint
@@ -91,9 +95,14 @@ public:
         }
         
         bool send(const std::vector<uint8_t>& data) {
+            return send(data.data(), data.size());
+        }
+        
+        // Raw-buffer overload: lets callers encode into a stack buffer
+        bool send(const uint8_t* data, std::size_t size) {
             if (!socket_) return false;
             try {
-                zmq::message_t msg(data.data(), data.size());
+                zmq::message_t msg(data, size);
                 
                 // Set message group for DISH filtering
                 // Only DISH subscribers joined to this group will receive the message
@@ -115,22 +124,26 @@ public:
         bool isConnected() const { return socket_ != nullptr; }
         
     private:
-        std::shared_ptr<zmq::context_t> context_;
+        std::shared_ptr<zmq::context_t> context_;  // Process-wide shared context
         std::unique_ptr<zmq::socket_t> socket_;
         std::string group_;
     };
 
     /**
      * @brief Default constructor (production use)
+     * @param waitStrategy How the worker waits for data, on its own queue or
+     *                     the broadcast ring (blocking if null)
      */
-    explicit DelayCalcTrackDataZeroMQOutgoingAdapter();
+    explicit DelayCalcTrackDataZeroMQOutgoingAdapter(std::shared_ptr<utils::WaitStrategy> waitStrategy = nullptr);
     
     /**
      * @brief Construct with custom endpoint and group (production use)
+     * @param waitStrategy How the worker waits for data (blocking if null)
      */
     DelayCalcTrackDataZeroMQOutgoingAdapter(
         const std::string& endpoint,
-        const std::string& group);
+        const std::string& group,
+        std::shared_ptr<utils::WaitStrategy> waitStrategy = nullptr);
 
     // Destructor - RAII cleanup
     ~DelayCalcTrackDataZeroMQOutgoingAdapter() noexcept override;
@@ -155,18 +168,37 @@ public:
     /**
      * @brief Send data via RADIO socket (non-blocking)
      * @param data Data to send
-     * @details Enqueues message for background transmission (~20ns latency)
-     *          Domain thread returns immediately without blocking on ZMQ I/O
-     * @thread_safe Yes - uses mutex-protected queue
+     * @details Enqueues message for background transmission;
+     *          domain thread returns immediately without blocking on ZMQ I/O
+     * @thread_safe Yes - ConflatingQueue::push() serialises concurrent callers
      */
     void sendDelayCalcTrackData(const DelayCalcTrackData& data) override;
 
+    /**
+     * @brief Send a batch of results via RADIO socket (non-blocking)
+     * @param data Results to send, in order
+     * @details Enqueues the valid results one by one
+     * @thread_safe Yes - ConflatingQueue::push() serialises concurrent callers
+     */
+    void sendDelayCalcTrackData(const std::vector<DelayCalcTrackData>& data) override;
+
     /**
      * @brief Check if adapter is ready to accept messages
      * @return true if running and socket connected
      */
     [[nodiscard]] bool isReady() const noexcept;
 
+    /**
+     * @brief Read from a broadcast ring instead of the adapter's own queue
+     * @param ring Ring written by DelayCalcTrackDataBroadcastOutgoingPort
+     * @param policy What the ring does when this adapter falls a full ring behind
+     * @return false if the adapter is running or the ring has no free cursor
+     * @details Call before start(). While attached, the ring is the only input:
+     *          direct sendDelayCalcTrackData() calls are ignored.
+     */
+    [[nodiscard]] bool attachBroadcast(std::shared_ptr<utils::BroadcastRing<DelayCalcTrackData>> ring,
+                                       utils::SlowConsumerPolicy policy);
+
 private:
     // Network configuration constants
     static constexpr const char* ZMQ_ADDRESS = "127.0.0.1";
@@ -178,8 +210,8 @@ private:
     // MAX_QUEUE_SIZE controls memory vs latency trade-off:
     // - Larger queue: More buffering, handles bursts, higher memory usage
     // - Smaller queue: Lower memory, drops messages faster during overload
-    // 200 messages ≈ 15KB (200 * 76 bytes per message)
-    static constexpr std::size_t MAX_QUEUE_SIZE = 200;   ///< Prevent unbounded growth
+    // 200 tracks ≈ 15KB (200 * 76 bytes per message, one pending message per track)
+    static constexpr std::size_t MAX_QUEUE_SIZE = 200;   ///< Maximum pending tracks
     static constexpr int QUEUE_WAIT_TIMEOUT_MS = 100;    ///< Graceful shutdown timeout (allows loop to check running flag)
 
     /**
@@ -208,8 +240,19 @@ private:
     std::atomic<bool> running_{false}; ///< Running state
     std::atomic<bool> ready_{false};   ///< Socket ready state
 
-    // Thread-safe message queue
-    mutable std::mutex queueMutex_;              ///< Queue protection
-    std::condition_variable queueCV_;   ///< Queue notification
-    std::queue<DelayCalcTrackData> messageQueue_; ///< Pending messages
+    // Lock-free message queue
+    std::shared_ptr<utils::WaitStrategy> waitStrategy_;                    ///< Shared by queue and ring
+    utils::ConflatingQueue<DelayCalcTrackData> messageQueue_;              ///< Latest pending message per track
+
+    // Broadcast subscription (set before start)
+    std::shared_ptr<utils::BroadcastRing<DelayCalcTrackData>> broadcast_;  ///< Fan-out ring (optional)
+    std::size_t broadcastConsumer_{0U};                                     ///< Cursor in broadcast_
+
+    // Metrics (written by the worker; queue drops/conflations via queueCounters_)
+    utils::Metric& metricQueueDrops_{utils::MetricsRegistry::instance().counter("outgoing.queue_drops")};
+    utils::Metric& metricConflated_{utils::MetricsRegistry::instance().counter("outgoing.queue_conflated")};
+    utils::Metric& metricSent_{utils::MetricsRegistry::instance().counter("outgoing.sent")};
+    utils::Metric& metricBytes_{utils::MetricsRegistry::instance().counter("outgoing.bytes")};
+    utils::Metric& metricSendFailures_{utils::MetricsRegistry::instance().counter("outgoing.send_failures")};
+    utils::ConflatingQueueCounters queueCounters_{metricConflated_, metricQueueDrops_};
 };
\ No newline at end of file
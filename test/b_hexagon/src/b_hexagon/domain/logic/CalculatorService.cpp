@@ -11,7 +11,24 @@ namespace domain {
 namespace logic {
 
 ports::DelayCalcTrackData CalculatorService::calculateDelay(const ports::ExtrapTrackData& trackData) const {
-    Logger::debug("Processing track ", trackData.getTrackId(), " - calculating delay metrics");
+    return calculateDelayWith(trackData, clockEstimate());
+}
+
+void CalculatorService::calculateDelayBatch(const ports::ExtrapTrackData* trackData, std::size_t count,
+                                            ports::DelayCalcTrackData* results) const {
+    const utils::ClockOffsetEstimate clock = clockEstimate();
+    for (std::size_t i = 0U; i < count; ++i) {
+        results[i] = calculateDelayWith(trackData[i], clock);
+    }
+}
+
+utils::ClockOffsetEstimate CalculatorService::clockEstimate() const {
+    return (clockSource_ != nullptr) ? clockSource_->estimate() : utils::ClockOffsetEstimate{};
+}
+
+ports::DelayCalcTrackData CalculatorService::calculateDelayWith(const ports::ExtrapTrackData& trackData,
+                                                               const utils::ClockOffsetEstimate& clock) const {
+    LOG_DEBUG("Processing track {} - calculating delay metrics", trackData.getTrackId());
     
     // Get current processing time for second hop
     // This represents when we're processing the data (second hop timestamp)
@@ -19,38 +36,45 @@ ports::DelayCalcTrackData CalculatorService::calculateDelay(const ports::ExtrapT
     
     // Validate input timestamp to prevent negative delays or overflow
     if (trackData.getFirstHopSentTime() <= 0) {
-        Logger::warn("Invalid firstHopSentTime for track ", trackData.getTrackId(), ": ", trackData.getFirstHopSentTime());
+        LOG_WARN_EVERY_MS(1000, "Invalid firstHopSentTime for track {}: {}",
+                          trackData.getTrackId(), trackData.getFirstHopSentTime());
     }
     
-    // Create result with calculated values
-    ports::DelayCalcTrackData result;
-    
-    // Copy all original track data (position, velocity, timestamps)
-    // DelayCalcTrackData extends ExtrapTrackData with additional delay fields
-    result.setTrackId(trackData.getTrackId());
-    result.setXVelocityECEF(trackData.getXVelocityECEF());
-    result.setYVelocityECEF(trackData.getYVelocityECEF());
-    result.setZVelocityECEF(trackData.getZVelocityECEF());
-    result.setXPositionECEF(trackData.getXPositionECEF());
-    result.setYPositionECEF(trackData.getYPositionECEF());
-    result.setZPositionECEF(trackData.getZPositionECEF());
-    result.setUpdateTime(trackData.getUpdateTime());
-    result.setOriginalUpdateTime(trackData.getOriginalUpdateTime());
-    result.setFirstHopSentTime(trackData.getFirstHopSentTime());
-    
     // Calculate first hop delay (current time - first hop sent time)
     // This measures latency from data generation to our processing
     // Unit: microseconds (1 second = 1,000,000 microseconds)
-    result.setFirstHopDelayTime(calculateTimeDelta(trackData.getFirstHopSentTime(), currentTime));
+    // firstHopSentTime was stamped on a_hexagon's clock: compare it with our
+    // time converted to that clock (unchanged while no estimate is available)
+    const long firstHopDelay = calculateTimeDelta(trackData.getFirstHopSentTime(), clock.toPeerClock(currentTime));
     
-    // Set second hop sent time as current time
-    // This timestamp marks when we're forwarding the processed data
-    result.setSecondHopSentTime(currentTime);
+    // Copy all original track data (position, velocity, timestamps)
+    // DelayCalcTrackData extends ExtrapTrackData with additional delay fields.
+    // trackData passed isValid() at submitExtrapTrackData(), so the unchecked
+    // constructor is used; the outgoing adapters re-check the result.
+    // Second hop sent time is the current time: when we forward the data.
+    ports::DelayCalcTrackData result(
+        ports::DelayCalcTrackData::UNCHECKED,
+        trackData.getTrackId(),
+        trackData.getXVelocityECEF(),
+        trackData.getYVelocityECEF(),
+        trackData.getZVelocityECEF(),
+        trackData.getXPositionECEF(),
+        trackData.getYPositionECEF(),
+        trackData.getZPositionECEF(),
+        trackData.getOriginalUpdateTime(),
+        trackData.getUpdateTime(),
+        trackData.getFirstHopSentTime(),
+        firstHopDelay,
+        currentTime);
+    if (clock.valid) {
+        result.setFirstHopClockOffset(clock.offsetUs);
+        result.setFirstHopClockErrorBound(clock.errorBoundUs);
+    }
     
-    Logger::info("Track ", trackData.getTrackId(), " delay calculation complete - first hop delay: ", 
-                 result.getFirstHopDelayTime(), " μs, second hop time: ", result.getSecondHopSentTime());
-    Logger::info("CURRENT TIME <>>>>>>>  ",currentTime);
-    Logger::info("getFirstHopSentTime TIME <>>>>>>>  ",trackData.getFirstHopSentTime());
+    LOG_DEBUG("Track {} delay calculation complete - first hop delay: {} ± {} μs (clock offset {} μs), "
+              "first hop sent: {}, second hop sent: {}",
+              trackData.getTrackId(), result.getFirstHopDelayTime(), result.getFirstHopClockErrorBound(),
+              result.getFirstHopClockOffset(), trackData.getFirstHopSentTime(), result.getSecondHopSentTime());
     
     return result;
 }
@@ -77,6 +101,7 @@ long CalculatorService::calculateTimeDelta(long originalTime, long currentTime)
     
     // Check for time going backwards (clock skew or wraparound)
     if (currentTime <= originalTime) {
+        metricClampedDelays_->add();  // Residual clock skew larger than the delay
         return 0L;  // No delay if current time is not later (prevents negative values)
     }
     
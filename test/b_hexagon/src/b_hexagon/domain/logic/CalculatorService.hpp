@@ -9,6 +9,8 @@
 #include "ICalculatorService.hpp"
 #include "domain/ports/incoming/ExtrapTrackData.hpp"
 #include "domain/ports/outgoing/DelayCalcTrackData.hpp"
+#include "utils/ClockSync.hpp"
+#include "utils/Metrics.hpp"
 #include <chrono>
 
 namespace domain {
@@ -28,7 +30,9 @@ namespace logic {
  * 
  * Calculation Logic:
  * 1. Get current timestamp (microsecond precision)
- * 2. Calculate first hop delay: currentTime - firstHopSentTime
+ * 2. Calculate first hop delay: currentTime - firstHopSentTime, with
+ *    currentTime converted to a_hexagon's clock when a clock offset
+ *    estimate is available
  * 3. Set second hop sent time: currentTime
  * 4. Copy all original fields to output
  * 
@@ -46,6 +50,27 @@ public:
      */
     CalculatorService() = default;
 
+    /**
+     * @brief Constructor with cross-node clock correction
+     * @param clockSource Offset estimate of a_hexagon's clock (may be null;
+     *                    must outlive the service)
+     */
+    explicit CalculatorService(const utils::ClockSyncClient* clockSource) noexcept
+        : clockSource_(clockSource) {
+    }
+
+    /**
+     * @brief Constructor for a service owned by one of several domain threads
+     * @param clockSource Offset estimate of a_hexagon's clock (may be null;
+     *                    must outlive the service)
+     * @param clampedDelays Counter written only by this service's thread
+     *                      (Metric::add is not atomic, so services never share it)
+     */
+    CalculatorService(const utils::ClockSyncClient* clockSource, utils::Metric& clampedDelays) noexcept
+        : clockSource_(clockSource)
+        , metricClampedDelays_(&clampedDelays) {
+    }
+
     /**
      * @brief Destructor
      */
@@ -65,7 +90,9 @@ public:
      * @return DelayCalcTrackData with computed delay value
      * @details Transforms ExtrapTrackData to DelayCalcTrackData by:
      *          1. Copying all input fields (position, velocity, timestamps)
-     *          2. Calculating firstHopDelayTime (currentTime - firstHopSentTime)
+     *          2. Calculating firstHopDelayTime (currentTime - firstHopSentTime),
+     *             corrected by the a_hexagon clock offset; the offset and its
+     *             error bound are attached to the result
      *          3. Setting secondHopSentTime (current processing time)
      *          
      * Thread Safety: const method, can be called from multiple threads
@@ -74,7 +101,29 @@ public:
     [[nodiscard]] ports::DelayCalcTrackData calculateDelay(
         const ports::ExtrapTrackData& trackData) const override;
 
+    /**
+     * @brief Calculate delays for a batch of tracks
+     * @details Same result per track as calculateDelay(); the clock offset
+     *          estimate is read once for the whole batch, the current time
+     *          still per track.
+     */
+    void calculateDelayBatch(const ports::ExtrapTrackData* trackData, std::size_t count,
+                             ports::DelayCalcTrackData* results) const override;
+
 private:
+    /**
+     * @brief Build the result for one track
+     * @param trackData Input track data
+     * @param clock a_hexagon clock offset estimate to correct the first hop with
+     */
+    [[nodiscard]] ports::DelayCalcTrackData calculateDelayWith(
+        const ports::ExtrapTrackData& trackData, const utils::ClockOffsetEstimate& clock) const;
+
+    /**
+     * @brief Current a_hexagon clock offset estimate (invalid without a source)
+     */
+    [[nodiscard]] utils::ClockOffsetEstimate clockEstimate() const;
+
     /**
      * @brief Get current time in microseconds since epoch
      * @return Current timestamp in microseconds
@@ -94,12 +143,17 @@ private:
      * @return Calculated delay in microseconds (0 if invalid/negative)
      * @details Validates timestamps before subtraction:
      *          - Returns 0 if either timestamp is zero/negative
-     *          - Returns 0 if current <= original (prevents negative delay)
+     *          - Returns 0 if current <= original (prevents negative delay);
+     *            counted in calc.clamped_delays, or the counter given
+     *            to the constructor (residual clock skew)
      *          - Otherwise returns: currentTime - originalTime
      *          
      * noexcept: Never throws (returns safe default on error)
      */
     [[nodiscard]] long calculateTimeDelta(long originalTime, long currentTime) const noexcept;
+
+    const utils::ClockSyncClient* clockSource_{nullptr};   ///< a_hexagon clock offset (optional)
+    utils::Metric* metricClampedDelays_{&utils::MetricsRegistry::instance().counter("calc.clamped_delays")};  ///< Calling thread only
 };
 
 } // namespace logic
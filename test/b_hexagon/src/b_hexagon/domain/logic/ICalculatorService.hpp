@@ -40,6 +40,7 @@
 
 #include "domain/ports/incoming/ExtrapTrackData.hpp"
 #include "domain/ports/outgoing/DelayCalcTrackData.hpp"
+#include <cstddef>
 
 namespace domain {
 namespace logic {
@@ -78,6 +79,22 @@ public:
     [[nodiscard]] virtual ports::DelayCalcTrackData calculateDelay(
         const ports::ExtrapTrackData& trackData) const = 0;
 
+    /**
+     * @brief Calculate delays for a batch drained in one wake-up
+     * @param trackData First input track
+     * @param count Number of input tracks
+     * @param results Receives one result per input, in input order
+     * @throws std::invalid_argument if an input is invalid (results partially written)
+     * @details The default calls calculateDelay() per track; implementations
+     *          override it to share per-batch work.
+     */
+    virtual void calculateDelayBatch(const ports::ExtrapTrackData* trackData, std::size_t count,
+                                     ports::DelayCalcTrackData* results) const {
+        for (std::size_t i = 0U; i < count; ++i) {
+            results[i] = calculateDelay(trackData[i]);
+        }
+    }
+
 protected:
     ICalculatorService() = default;
     ICalculatorService(const ICalculatorService&) = default;
@@ -14,6 +14,8 @@
 
 #include "domain/logic/ProcessTrackUseCase.hpp"
 #include "utils/Logger.hpp"
+#include "utils/StageTracer.hpp"
+#include "utils/FlightRecorder.hpp"
 #include <stdexcept>
 
 // Linux real-time scheduling headers
@@ -48,9 +50,11 @@ ProcessTrackUseCase::ProcessTrackUseCase(
 // shared_ptr used for dataSender to allow multiple adapters to share same port
 ProcessTrackUseCase::ProcessTrackUseCase(
     std::unique_ptr<ICalculatorService> calculator,
-    std::shared_ptr<ports::outgoing::IDelayCalcTrackDataOutgoingPort> dataSender
+    std::shared_ptr<ports::outgoing::IDelayCalcTrackDataOutgoingPort> dataSender,
+    std::shared_ptr<utils::WaitStrategy> waitStrategy
     ): calculator_(std::move(calculator)),
     dataSender_(std::move(dataSender)),
+    eventQueue_(MAX_QUEUE_SIZE, std::move(waitStrategy)),
     running_{false} {
         if (!calculator_) {
             throw std::invalid_argument("ICalculatorService cannot be null");
@@ -58,7 +62,8 @@ ProcessTrackUseCase::ProcessTrackUseCase(
         if (!dataSender_) {
             throw std::invalid_argument("IDelayCalcTrackDataOutgoingPort cannot be null");
         }
-        Logger::info("ProcessTrackUseCase initialized (Event Queue with dedicated thread)");
+        Logger::info("ProcessTrackUseCase initialized (Event Queue with dedicated thread, {} wait)",
+                     eventQueue_.waitStrategy().name());
     }
 
 // ==================== Destructor ====================
@@ -76,6 +81,7 @@ bool ProcessTrackUseCase::start() {
     }
     
     running_.store(true);
+    eventQueue_.resetWake();
     
     // Start dedicated processing thread
     processingThread_ = std::thread([this]() {
@@ -95,11 +101,12 @@ void ProcessTrackUseCase::stop() {
     running_.store(false);
     
     // Wake up the processing thread
-    queueCV_.notify_all();
+    eventQueue_.wakeConsumer();
     
     if (processingThread_.joinable()) {
         processingThread_.join();
     }
+    queueCounters_.publish(eventQueue_);  // Pushes after the last drain
     
     Logger::info("ProcessTrackUseCase stopped");
 }
@@ -111,11 +118,12 @@ bool ProcessTrackUseCase::isRunning() const {
 // ==================== Event Queue Interface ====================
 // submitExtrapTrackData is the entry point from incoming adapters
 // Called by ExtrapTrackDataZeroMQIncomingAdapter when new data arrives
-// Non-blocking: Enqueues message and returns immediately (~20ns)
+// Non-blocking: Enqueues message and returns immediately
 
 void ProcessTrackUseCase::submitExtrapTrackData(const ports::ExtrapTrackData& data) {
     if (!running_.load()) {
-        Logger::warn("ProcessTrackUseCase not running, dropping track: ", data.getTrackId());
+        metricRejected_.add();
+        LOG_WARN_EVERY_MS(1000, "ProcessTrackUseCase not running, dropping track: {}", data.getTrackId());
         return;
     }
     
@@ -123,28 +131,35 @@ void ProcessTrackUseCase::submitExtrapTrackData(const ports::ExtrapTrackData& da
     // isValid() checks all fields are within acceptable ranges
     // Invalid data is rejected early to prevent processing errors
     if (!data.isValid()) {
-        Logger::warn("Invalid track data received: ID=", data.getTrackId());
+        metricRejected_.add();
+        LOG_WARN_EVERY_MS(1000, "Invalid track data received: ID={}", data.getTrackId());
         return;
     }
     
-    // Non-blocking enqueue (~20ns)
+    // Non-blocking enqueue
     enqueueMessage(data);
 }
 
 void ProcessTrackUseCase::enqueueMessage(const ports::ExtrapTrackData& data) {
-    {
-        std::lock_guard<std::mutex> lock(queueMutex_);
-        
-        // Prevent unbounded queue growth
-        if (eventQueue_.size() >= MAX_QUEUE_SIZE) {
-            Logger::warn("Event queue full, dropping oldest message for track: ", data.getTrackId());
-            eventQueue_.pop();
-        }
-        
-        eventQueue_.push(data);
-    }
+    // Stamp before the push: the domain thread may dequeue before we return
+    utils::StageTracer& tracer = utils::StageTracer::instance();
+    const int64_t enqueueNs = tracer.isEnabled() ? utils::StageTracer::nowNs() : 0;
+    
+    // One slot per track: a pending sample of this track is replaced in place,
+    // a new track evicts the oldest pending track when every slot is taken.
+    // The queue counts both; the domain thread publishes them as metrics.
+    const utils::ConflateResult result = eventQueue_.push(data);
+    tracer.record(utils::TraceStage::Enqueue, data.getTrackId(), data.getUpdateTime(), enqueueNs);
+    utils::FlightRecorder& recorder = utils::FlightRecorder::instance();
+    recorder.record(utils::FlightEventKind::Enqueue, data.getTrackId(), data.getUpdateTime());
     
-    queueCV_.notify_one();
+    if (result == utils::ConflateResult::Replaced) {
+        recorder.record(utils::FlightEventKind::Conflated, data.getTrackId(), data.getUpdateTime());
+    } else if (result == utils::ConflateResult::EvictedOldest) {
+        recorder.record(utils::FlightEventKind::QueueDrop, data.getTrackId(), data.getUpdateTime());
+        LOG_WARN_EVERY_MS(1000, "Event queue full ({} tracks pending), evicted the oldest track for track: {}",
+                          MAX_QUEUE_SIZE, data.getTrackId());
+    }
 }
 
 // ==================== Background Processing Loop ====================
@@ -153,71 +168,93 @@ void ProcessTrackUseCase::process() {
     Logger::debug("Domain processing thread started");
     
     while (running_.load()) {
-        ports::ExtrapTrackData data;
-        
-        // Wait for message with timeout
-        {
-            std::unique_lock<std::mutex> lock(queueMutex_);
-            
-            if (queueCV_.wait_for(lock, std::chrono::milliseconds(QUEUE_WAIT_TIMEOUT_MS),
-                [this]() { return !eventQueue_.empty() || !running_.load(); })) {
-                
-                if (!running_.load()) {
-                    break;
-                }
-                
-                if (!eventQueue_.empty()) {
-                    data = std::move(eventQueue_.front());
-                    eventQueue_.pop();
-                } else {
-                    continue;
-                }
-            } else {
-                continue;  // Timeout, check running flag
-            }
+        // Wait for messages with timeout (timeout lets us re-check running flag),
+        // then take everything pending up to one batch in a single queue lock
+        const std::size_t count = eventQueue_.waitPopBatch(inputBatch_.data(), inputBatch_.size(),
+                                                           std::chrono::milliseconds(QUEUE_WAIT_TIMEOUT_MS));
+        if (count == 0U) {
+            continue;
         }
         
-        // Process track data (outside lock)
-        processTrackData(data);
+        for (std::size_t i = 0U; i < count; ++i) {
+            const ports::ExtrapTrackData& data = inputBatch_[i];
+            utils::StageTracer::instance().record(utils::TraceStage::Dequeue, data.getTrackId(),
+                                                  data.getUpdateTime());
+            utils::FlightRecorder::instance().record(utils::FlightEventKind::Dequeue, data.getTrackId(),
+                                                     data.getUpdateTime());
+        }
+        metricQueueDepth_.set(static_cast<int64_t>(eventQueue_.size()));
+        queueCounters_.publish(eventQueue_);
+        processBatch(count);
     }
     
     Logger::debug("Domain processing thread stopped");
 }
 
+void ProcessTrackUseCase::processBatch(std::size_t count) {
+    // Shrinking within capacity never reallocates
+    outputBatch_.resize(count);
+    try {
+        calculator_->calculateDelayBatch(inputBatch_.data(), count, outputBatch_.data());
+    } catch (const std::exception& e) {
+        // Nothing was sent yet: re-run the tracks one by one to isolate the bad one
+        LOG_WARN_EVERY_MS(1000, "Batch of {} tracks failed ({}), processing them one by one", count, e.what());
+        for (std::size_t i = 0U; i < count; ++i) {
+            processTrackData(inputBatch_[i]);
+        }
+        return;
+    }
+    
+    for (const ports::DelayCalcTrackData& processedData : outputBatch_) {
+        LOG_DEBUG("Calculated delay for track {} -> Delay: {}μs",
+                  processedData.getTrackId(), processedData.getFirstHopDelayTime());
+        utils::StageTracer::instance().record(utils::TraceStage::ComputeEnd, processedData.getTrackId(),
+                                              processedData.getUpdateTime());
+    }
+    
+    try {
+        // One outgoing port call for the whole batch
+        dataSender_->sendDelayCalcTrackData(outputBatch_);
+        metricProcessed_.add(static_cast<uint64_t>(count));
+    } catch (const std::exception& e) {
+        metricErrors_.add();
+        Logger::error("Error sending batch of {} tracks: {}", count, e.what());
+    }
+}
+
 void ProcessTrackUseCase::processTrackData(const ports::ExtrapTrackData& data) {
     try {
-        // Log incoming track data for debugging and monitoring
-        Logger::info("=== PROCESSING TRACK DATA ===");
-        Logger::info("Track ID: ", data.getTrackId());
-        Logger::info("Position ECEF: (", data.getXPositionECEF(), ", ", 
-                     data.getYPositionECEF(), ", ", data.getZPositionECEF(), ")");
-        Logger::info("Velocity ECEF: (", data.getXVelocityECEF(), ", ", 
-                     data.getYVelocityECEF(), ", ", data.getZVelocityECEF(), ")");
-        Logger::info("Update Time: ", data.getUpdateTime());
-        Logger::info("==============================");
+        // Runs per track on the batch-failure fallback: debug level only
+        LOG_DEBUG("Processing track {} - position ECEF: ({}, {}, {}), velocity ECEF: ({}, {}, {}), update time: {}",
+                  data.getTrackId(), data.getXPositionECEF(), data.getYPositionECEF(), data.getZPositionECEF(),
+                  data.getXVelocityECEF(), data.getYVelocityECEF(), data.getZVelocityECEF(), data.getUpdateTime());
         
         // Process the track data through domain logic (via ICalculatorService abstraction)
         // calculateDelay() computes timing metrics and creates DelayCalcTrackData
         // This is the core domain operation: ExtrapTrackData → DelayCalcTrackData
         ports::DelayCalcTrackData processedData = calculator_->calculateDelay(data);
         
-        Logger::info("Calculated delay for track ", data.getTrackId(), 
-                    " -> Delay: ", processedData.getFirstHopDelayTime(), "μs");
+        LOG_DEBUG("Calculated delay for track {} -> Delay: {}μs",
+                  data.getTrackId(), processedData.getFirstHopDelayTime());
         
         // Send processed data to all outgoing adapters
         // dataSender_ is an abstraction (IDelayCalcTrackDataOutgoingPort)
         // Multiple adapters can implement this interface:
         // - DelayCalcTrackDataZeroMQOutgoingAdapter (primary transmission)
         // - DelayCalcTrackDataCustomOutgoingAdapter (analytics/logging)
+        utils::StageTracer::instance().record(utils::TraceStage::ComputeEnd, processedData.getTrackId(),
+                                              processedData.getUpdateTime());
         if (dataSender_) {
             dataSender_->sendDelayCalcTrackData(processedData);
-            Logger::debug("Successfully sent processed track data for ID=", data.getTrackId());
+            metricProcessed_.add();
+            LOG_DEBUG("Successfully sent processed track data for ID={}", data.getTrackId());
         } else {
             Logger::error("Error while sending data: dataSender is null");
         }
         
     } catch (const std::exception& e) {
-        Logger::error("Error processing track ", data.getTrackId(), ": ", e.what());
+        metricErrors_.add();
+        Logger::error("Error processing track {}: {}", data.getTrackId(), e.what());
     }
 }
 
@@ -17,12 +17,13 @@
 #include "domain/ports/outgoing/IDelayCalcTrackDataOutgoingPort.hpp"
 #include "domain/ports/incoming/ExtrapTrackData.hpp"
 #include "domain/ports/outgoing/DelayCalcTrackData.hpp"
+#include "utils/ConflatingQueue.hpp"
+#include "utils/WaitStrategy.hpp"
+#include "utils/Metrics.hpp"
 #include <memory>
-#include <queue>
-#include <mutex>
-#include <condition_variable>
 #include <thread>
 #include <atomic>
+#include <vector>
 
 namespace domain {
 namespace logic {
@@ -45,18 +46,22 @@ namespace logic {
  * │  Incoming Adapter Thread    Domain Thread                   │
  * │  ───────────────────────    ─────────────                   │
  * │  submitExtrapTrackData() ──→ [Event Queue] ──→ process()    │
- * │         (~20ns enqueue)        (FIFO)         (while loop)  │
+ * │      (non-blocking push)  (per-track FIFO)  (drains batches) │
  * │                                                    │         │
- * │                                       CalculatorService      │
+ * │                                  calculateDelayBatch()       │
  * │                                                    │         │
  * │                                       sendDelayCalcTrackData │
  * └──────────────────────────────────────────────────────────────┘
  * 
  * Performance Characteristics:
- * - Enqueue latency: ~20ns (non-blocking for incoming adapter)
+ * - Enqueue: non-blocking for the incoming adapter (one short queue lock)
  * - Processing latency: Variable (depends on calculator service)
- * - Queue size: 500 messages max (prevents memory exhaustion)
- * - Overflow strategy: Drop oldest message (FIFO eviction)
+ * - Queue size: 500 pending tracks max (prevents memory exhaustion)
+ * - Conflation: a newer sample of a queued track replaces the older one in place
+ * - Overflow strategy: a new track evicts the track that has waited longest
+ * - Queue: pre-allocated conflating queue, no allocation on push/pop
+ * - Draining: up to DRAIN_BATCH_SIZE tracks per wake-up, one queue lock,
+ *   one clock read and one outgoing port call per batch
  * 
  * Dependency Inversion:
  * - ICalculatorService: Abstraction for delay calculation (mockable)
@@ -79,12 +84,14 @@ public:
     * @brief Construct with shared_ptr ownership (Event Queue architecture)
     * @param calculator Calculator service (ownership transferred via unique_ptr)
     * @param dataSender Outgoing port (shared ownership via shared_ptr)
+    * @param waitStrategy How the domain thread waits for data (blocking if null)
     * @details Recommended constructor - allows multiple adapters to share port
     *          Example: ZeroMQ adapter + Custom analytics adapter
     */
    explicit ProcessTrackUseCase(
     std::unique_ptr<ICalculatorService> calculator,
-    std::shared_ptr<ports::outgoing::IDelayCalcTrackDataOutgoingPort> dataSender);
+    std::shared_ptr<ports::outgoing::IDelayCalcTrackDataOutgoingPort> dataSender,
+    std::shared_ptr<utils::WaitStrategy> waitStrategy = nullptr);
 
     /**
      * @brief Destructor - ensures graceful shutdown
@@ -99,9 +106,9 @@ public:
     /**
      * @brief Submit incoming track data to event queue (non-blocking)
      * @param data Received ExtrapTrackData to process
-     * @details Enqueues message for background processing (~20ns latency)
-     *          Incoming adapter thread returns immediately
-     * @thread_safe Yes - uses mutex-protected queue
+     * @details Enqueues message for background processing;
+     *          incoming adapter thread returns immediately
+     * @thread_safe Yes - ConflatingQueue::push() serialises concurrent callers
      */
     void submitExtrapTrackData(const ports::ExtrapTrackData& data) override;
 
@@ -124,24 +131,34 @@ public:
 
 private:
     // Queue configuration
-    // 500 messages chosen for balance between buffering and memory usage:
+    // At most one pending sample per track, so the bound is a track count:
     // - 500 * 76 bytes = 38 KB memory footprint
-    // - At 1000 Hz input rate, 500 messages = 0.5 seconds of buffering
-    static constexpr std::size_t MAX_QUEUE_SIZE = 500;    ///< Prevent unbounded growth
+    // - Bursts from one track are conflated instead of filling the queue
+    static constexpr std::size_t MAX_QUEUE_SIZE = 500;    ///< Maximum pending tracks
     static constexpr int QUEUE_WAIT_TIMEOUT_MS = 100;     ///< Graceful shutdown timeout (allows loop exit check)
+    static constexpr std::size_t DRAIN_BATCH_SIZE = 32;   ///< Tracks drained per wake-up
 
     /**
      * @brief Background processing loop (runs in dedicated thread)
-     * @details Continuously dequeues messages and processes them
-     *          Loop exits when running_ flag is set to false
+     * @details Drains up to DRAIN_BATCH_SIZE messages per wake-up and processes them
+     *          as one batch. Loop exits when running_ flag is set to false
      */
     void process();
 
+    /**
+     * @brief Process the drained batch in inputBatch_
+     * @param count Number of valid entries in inputBatch_
+     * @details calculateDelayBatch() → one sendDelayCalcTrackData() call.
+     *          If the batch throws, its tracks are re-run one by one so a single
+     *          bad track costs only its own result.
+     */
+    void processBatch(std::size_t count);
+
     /**
      * @brief Enqueue message for background processing
      * @param data Track data to queue
-     * @details Non-blocking operation (~20ns)
-     *          Uses mutex-protected queue with overflow prevention
+     * @details Non-blocking. Replaces a pending sample of the same track; when every slot holds
+     *          another track, the track that has waited longest is evicted
      */
     void enqueueMessage(const ports::ExtrapTrackData& data);
 
@@ -149,7 +166,8 @@ private:
      * @brief Process single track data item
      * @param data Track data to process
      * @details Orchestrates: calculateDelay() → sendDelayCalcTrackData()
-     *          Runs in background thread (processTrackData called from process())
+     *          Runs in the domain thread when processBatch() falls back to
+     *          one-by-one processing after a failed batch; logs at debug level
      */
     void processTrackData(const ports::ExtrapTrackData& data);
     
@@ -158,13 +176,24 @@ private:
     std::shared_ptr<ports::outgoing::IDelayCalcTrackDataOutgoingPort> dataSender_; ///< Outgoing port (abstract)
 
     // Event queue infrastructure
-    std::queue<ports::ExtrapTrackData> eventQueue_;  ///< FIFO event queue
-    std::mutex queueMutex_;                          ///< Queue protection
-    std::condition_variable queueCV_;                ///< Queue notification
+    utils::ConflatingQueue<ports::ExtrapTrackData> eventQueue_{MAX_QUEUE_SIZE};  ///< Per-track conflating event queue
+    
+    // Drain buffers, owned by the processing thread (sized once, never reallocated)
+    std::vector<ports::ExtrapTrackData> inputBatch_ = std::vector<ports::ExtrapTrackData>(DRAIN_BATCH_SIZE);
+    std::vector<ports::DelayCalcTrackData> outputBatch_ = std::vector<ports::DelayCalcTrackData>(DRAIN_BATCH_SIZE);
     
     // Thread management
     std::thread processingThread_;                   ///< Dedicated processing thread
     std::atomic<bool> running_{false};               ///< Thread-safe running flag
+    
+    // Metrics
+    utils::Metric& metricQueueDrops_{utils::MetricsRegistry::instance().counter("domain.queue_drops")};  ///< Via queueCounters_
+    utils::Metric& metricConflated_{utils::MetricsRegistry::instance().counter("domain.queue_conflated")};  ///< Via queueCounters_
+    utils::Metric& metricRejected_{utils::MetricsRegistry::instance().counter("domain.rejected")};       ///< Submitter thread
+    utils::Metric& metricProcessed_{utils::MetricsRegistry::instance().counter("domain.processed")};     ///< Domain thread
+    utils::Metric& metricErrors_{utils::MetricsRegistry::instance().counter("domain.errors")};           ///< Domain thread
+    utils::Metric& metricQueueDepth_{utils::MetricsRegistry::instance().gauge("domain.queue_depth")};    ///< Domain thread
+    utils::ConflatingQueueCounters queueCounters_{metricConflated_, metricQueueDrops_};                  ///< Domain thread
 };
 
 } // namespace logic
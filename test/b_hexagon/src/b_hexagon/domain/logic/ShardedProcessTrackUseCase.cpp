@@ -0,0 +1,295 @@
+/**
+ * @file ShardedProcessTrackUseCase.cpp
+ * @brief Implementation of the track-sharded parallel use case
+ * @details Routes each track to a fixed shard, runs the shard's calculator on
+ *          its own thread and merges the results into the outgoing port.
+ *
+ * @author b_hexagon Team
+ * @version 1.0
+ * @date 2025
+ *
+ * @see ShardedProcessTrackUseCase.hpp
+ */
+
+#include "domain/logic/ShardedProcessTrackUseCase.hpp"
+#include "utils/Logger.hpp"
+#include "utils/StageTracer.hpp"
+#include "utils/FlightRecorder.hpp"
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+// Linux CPU affinity headers
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace domain {
+namespace logic {
+
+namespace {
+
+utils::Metric& shardGauge(std::size_t index, const char* name) {
+    return utils::MetricsRegistry::instance().gauge("domain.shard" + std::to_string(index) + "." + name);
+}
+
+} // namespace
+
+// ==================== Shard ====================
+
+ShardedProcessTrackUseCase::Shard::Shard(std::size_t index, std::unique_ptr<ICalculatorService> shardCalculator,
+                                         std::size_t queueTracks)
+    : id(index)
+    , calculator(std::move(shardCalculator))
+    , queue(queueTracks)
+    , metricQueueDrops(shardCounter(index, "queue_drops"))
+    , metricConflated(shardCounter(index, "queue_conflated"))
+    , metricProcessed(shardCounter(index, "processed"))
+    , metricErrors(shardCounter(index, "errors"))
+    , metricMergeDrops(shardCounter(index, "merge_drops"))
+    , metricQueueDepth(shardGauge(index, "queue_depth"))
+    , queueCounters(metricConflated, metricQueueDrops) {
+}
+
+// ==================== Constructor / Destructor ====================
+
+ShardedProcessTrackUseCase::ShardedProcessTrackUseCase(
+    const CalculatorFactory& calculatorFactory,
+    std::shared_ptr<ports::outgoing::IDelayCalcTrackDataOutgoingPort> dataSender,
+    const ShardedProcessingConfig& config)
+    : dataSender_(std::move(dataSender))
+    , config_(config)
+    , results_(config.mergeQueueSize) {
+    if (!calculatorFactory) {
+        throw std::invalid_argument("CalculatorFactory cannot be null");
+    }
+    if (!dataSender_) {
+        throw std::invalid_argument("IDelayCalcTrackDataOutgoingPort cannot be null");
+    }
+    if (config_.shardCount == 0U) {
+        throw std::invalid_argument("Shard count must be greater than zero");
+    }
+
+    shards_.reserve(config_.shardCount);
+    for (std::size_t i = 0U; i < config_.shardCount; ++i) {
+        std::unique_ptr<ICalculatorService> calculator = calculatorFactory(i);
+        if (!calculator) {
+            throw std::invalid_argument("CalculatorFactory returned a null ICalculatorService");
+        }
+        shards_.push_back(std::make_unique<Shard>(i, std::move(calculator), config_.shardQueueTracks));
+    }
+    Logger::info("ShardedProcessTrackUseCase initialized ({} shards)", config_.shardCount);
+}
+
+ShardedProcessTrackUseCase::~ShardedProcessTrackUseCase() {
+    stop();
+    Logger::debug("ShardedProcessTrackUseCase destroyed");
+}
+
+// ==================== Lifecycle Management ====================
+
+bool ShardedProcessTrackUseCase::start() {
+    if (running_.load()) {
+        Logger::warn("ShardedProcessTrackUseCase already running");
+        return true;
+    }
+
+    running_.store(true);
+    merging_.store(true);
+    results_.resetWake();
+    mergeThread_ = std::thread([this]() {
+        pinCurrentThread(config_.mergeCpuCore, "Merge", 0U);
+        mergeResults();
+    });
+
+    for (const std::unique_ptr<Shard>& shard : shards_) {
+        shard->queue.resetWake();
+        Shard* const worker = shard.get();
+        const int32_t core = (worker->id < config_.cpuCores.size()) ? config_.cpuCores[worker->id] : -1;
+        worker->thread = std::thread([this, worker, core]() {
+            pinCurrentThread(core, "Shard", worker->id);
+            processShard(*worker);
+        });
+    }
+
+    Logger::info("ShardedProcessTrackUseCase started ({} shard threads + merge thread)", shards_.size());
+    return true;
+}
+
+void ShardedProcessTrackUseCase::stop() {
+    if (!running_.load()) {
+        return;
+    }
+
+    Logger::info("Stopping ShardedProcessTrackUseCase...");
+    running_.store(false);
+
+    // Shards first, so the merge thread can forward their last results
+    for (const std::unique_ptr<Shard>& shard : shards_) {
+        shard->queue.wakeConsumer();
+    }
+    for (const std::unique_ptr<Shard>& shard : shards_) {
+        if (shard->thread.joinable()) {
+            shard->thread.join();
+        }
+        shard->queueCounters.publish(shard->queue);  // Pushes after the last drain
+    }
+    merging_.store(false);
+    results_.wakeConsumer();
+    if (mergeThread_.joinable()) {
+        mergeThread_.join();
+    }
+
+    Logger::info("ShardedProcessTrackUseCase stopped");
+}
+
+bool ShardedProcessTrackUseCase::isRunning() const {
+    return running_.load();
+}
+
+std::size_t ShardedProcessTrackUseCase::shardCount() const noexcept {
+    return shards_.size();
+}
+
+std::size_t ShardedProcessTrackUseCase::shardFor(int32_t trackId) const noexcept {
+    // Fibonacci hashing spreads sequential track ids across shards
+    const uint32_t mixed = static_cast<uint32_t>(trackId) * 2654435761U;
+    return static_cast<std::size_t>(mixed >> 16U) % shards_.size();
+}
+
+std::size_t ShardedProcessTrackUseCase::shardQueueDepth(std::size_t shard) const noexcept {
+    return (shard < shards_.size()) ? shards_[shard]->queue.size() : 0U;
+}
+
+utils::Metric& ShardedProcessTrackUseCase::shardCounter(std::size_t shardIndex, const char* name) {
+    return utils::MetricsRegistry::instance().counter("domain.shard" + std::to_string(shardIndex) + "." + name);
+}
+
+std::vector<int32_t> ShardedProcessTrackUseCase::shardCores(std::size_t count, int32_t firstCore,
+                                                            const std::vector<int32_t>& reservedCores) {
+    std::vector<int32_t> cores;
+    cores.reserve(count);
+    for (int32_t core = firstCore; cores.size() < count; ++core) {
+        if (std::find(reservedCores.begin(), reservedCores.end(), core) == reservedCores.end()) {
+            cores.push_back(core);
+        }
+    }
+    return cores;
+}
+
+// ==================== Incoming Port ====================
+
+void ShardedProcessTrackUseCase::submitExtrapTrackData(const ports::ExtrapTrackData& data) {
+    if (!running_.load()) {
+        metricRejected_.add();
+        LOG_WARN_EVERY_MS(1000, "ShardedProcessTrackUseCase not running, dropping track: {}", data.getTrackId());
+        return;
+    }
+    if (!data.isValid()) {
+        metricRejected_.add();
+        LOG_WARN_EVERY_MS(1000, "Invalid track data received: ID={}", data.getTrackId());
+        return;
+    }
+
+    Shard& shard = *shards_[shardFor(data.getTrackId())];
+    utils::StageTracer& tracer = utils::StageTracer::instance();
+    const int64_t enqueueNs = tracer.isEnabled() ? utils::StageTracer::nowNs() : 0;
+
+    // The queue counts conflations and drops; the shard thread publishes them
+    const utils::ConflateResult result = shard.queue.push(data);
+    tracer.record(utils::TraceStage::Enqueue, data.getTrackId(), data.getUpdateTime(), enqueueNs);
+    utils::FlightRecorder& recorder = utils::FlightRecorder::instance();
+    recorder.record(utils::FlightEventKind::Enqueue, data.getTrackId(), data.getUpdateTime());
+
+    if (result == utils::ConflateResult::Replaced) {
+        recorder.record(utils::FlightEventKind::Conflated, data.getTrackId(), data.getUpdateTime());
+    } else if (result == utils::ConflateResult::EvictedOldest) {
+        recorder.record(utils::FlightEventKind::QueueDrop, data.getTrackId(), data.getUpdateTime());
+        LOG_WARN_EVERY_MS(1000, "Shard {} queue full ({} tracks pending), evicted the oldest track for track: {}",
+                          shard.id, config_.shardQueueTracks, data.getTrackId());
+    }
+}
+
+// ==================== Worker Loops ====================
+
+void ShardedProcessTrackUseCase::processShard(Shard& shard) {
+    Logger::debug("Shard {} processing thread started", shard.id);
+
+    while (running_.load()) {
+        ports::ExtrapTrackData data;
+        if (!shard.queue.waitPop(data, std::chrono::milliseconds(QUEUE_WAIT_TIMEOUT_MS))) {
+            continue;
+        }
+
+        utils::StageTracer::instance().record(utils::TraceStage::Dequeue, data.getTrackId(), data.getUpdateTime());
+        utils::FlightRecorder::instance().record(utils::FlightEventKind::Dequeue, data.getTrackId(),
+                                                 data.getUpdateTime());
+        shard.metricQueueDepth.set(static_cast<int64_t>(shard.queue.size()));
+        shard.queueCounters.publish(shard.queue);
+
+        try {
+            const ports::DelayCalcTrackData processedData = shard.calculator->calculateDelay(data);
+            utils::StageTracer::instance().record(utils::TraceStage::ComputeEnd, processedData.getTrackId(),
+                                                  processedData.getUpdateTime());
+            if (results_.push(processedData)) {
+                shard.metricProcessed.add();
+            } else {
+                shard.metricMergeDrops.add();
+                LOG_WARN_EVERY_MS(1000, "Merge queue full, dropping result of shard {} for track: {}",
+                                  shard.id, data.getTrackId());
+            }
+        } catch (const std::exception& e) {
+            shard.metricErrors.add();
+            Logger::error("Shard {} error processing track {}: {}", shard.id, data.getTrackId(), e.what());
+        }
+    }
+
+    Logger::debug("Shard {} processing thread stopped", shard.id);
+}
+
+void ShardedProcessTrackUseCase::mergeResults() {
+    Logger::debug("Merge thread started");
+
+    ports::DelayCalcTrackData result;
+    while (merging_.load()) {
+        if (!results_.waitPop(result, std::chrono::milliseconds(QUEUE_WAIT_TIMEOUT_MS))) {
+            continue;
+        }
+        dataSender_->sendDelayCalcTrackData(result);
+        metricProcessed_.add();
+    }
+
+    // merging_ is cleared after the shards joined: forward what they left
+    while (results_.tryPop(result)) {
+        dataSender_->sendDelayCalcTrackData(result);
+        metricProcessed_.add();
+    }
+
+    Logger::debug("Merge thread stopped");
+}
+
+void ShardedProcessTrackUseCase::pinCurrentThread(int32_t cpuCore, const char* role, std::size_t index) {
+    if (cpuCore < 0) {
+        return;
+    }
+#ifdef __linux__
+    cpu_set_t cpuset;
+    CPU_ZERO(&cpuset);
+    CPU_SET(cpuCore, &cpuset);
+    const int ret = pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuset);
+    if (ret != 0) {
+        Logger::debug("{} {} CPU affinity not set (core {}): {} - running on any available core",
+                      role, index, cpuCore, std::strerror(ret));
+    } else {
+        Logger::debug("{} {} thread pinned to CPU core {}", role, index, cpuCore);
+    }
+#else
+    static_cast<void>(role);
+    static_cast<void>(index);
+#endif
+}
+
+} // namespace logic
+} // namespace domain
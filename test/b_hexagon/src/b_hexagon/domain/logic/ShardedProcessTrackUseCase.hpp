@@ -0,0 +1,203 @@
+/**
+ * @file ShardedProcessTrackUseCase.hpp
+ * @brief Track-sharded parallel variant of ProcessTrackUseCase
+ * @details ProcessTrackUseCase runs every calculateDelay() on one domain
+ *          thread, which caps b_hexagon at one core. This use case hashes
+ *          trackId onto N shards, each with its own queue, pinned thread and
+ *          ICalculatorService instance, and merges the results into the
+ *          outgoing port through one MPSC ring.
+ *
+ * @author b_hexagon Team
+ * @version 1.0
+ * @date 2025
+ *
+ * @see ProcessTrackUseCase.hpp
+ */
+
+#pragma once
+
+#include "domain/logic/ICalculatorService.hpp"
+#include "domain/ports/incoming/IExtrapTrackDataIncomingPort.hpp"
+#include "domain/ports/outgoing/IDelayCalcTrackDataOutgoingPort.hpp"
+#include "domain/ports/incoming/ExtrapTrackData.hpp"
+#include "domain/ports/outgoing/DelayCalcTrackData.hpp"
+#include "utils/ConflatingQueue.hpp"
+#include "utils/MpscRingBuffer.hpp"
+#include "utils/Metrics.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace domain {
+namespace logic {
+
+/**
+ * @struct ShardedProcessingConfig
+ * @brief Sizing and placement of the shard threads
+ */
+struct ShardedProcessingConfig {
+    std::size_t shardCount{2U};          ///< Worker threads (>= 1)
+    std::vector<int32_t> cpuCores{};     ///< Shard i is pinned to cpuCores[i]; shards past the end run unpinned
+    int32_t mergeCpuCore{-1};            ///< Merge thread core; -1 leaves it unpinned
+    std::size_t shardQueueTracks{500U};  ///< Pending tracks per shard
+    std::size_t mergeQueueSize{1024U};   ///< Results waiting for the outgoing port
+};
+
+/**
+ * @class ShardedProcessTrackUseCase
+ * @brief Domain use case processing tracks on N shard threads
+ * @details
+ * Thread Architecture:
+ * ┌────────────────────────────────────────────────────────────────────┐
+ * │  Incoming Adapter Thread     Shard Threads        Merge Thread     │
+ * │  ───────────────────────     ─────────────        ────────────     │
+ * │  submitExtrapTrackData()                                           │
+ * │    hash(trackId) % N ──┬──→ [Queue 0] → calc 0 ─┐                  │
+ * │                        ├──→ [Queue 1] → calc 1 ─┼→ [MPSC] → send() │
+ * │                        └──→ [Queue N-1] → ...  ─┘                  │
+ * └────────────────────────────────────────────────────────────────────┘
+ *
+ * Ordering:
+ * - A track always hashes to the same shard, whose queue and thread are
+ *   FIFO, and the MPSC ring keeps each producer's order, so results of one
+ *   track reach the outgoing port in submission order.
+ * - Shard queues conflate per track like ProcessTrackUseCase's queue.
+ *
+ * Each shard exports domain.shard<i>.queue_depth, .queue_drops,
+ * .queue_conflated, .processed, .errors and .merge_drops; the merge thread
+ * exports domain.processed. Calculators built by the factory register their
+ * own per-shard counters through shardCounter().
+ */
+class ShardedProcessTrackUseCase final : public ports::incoming::IExtrapTrackDataIncomingPort {
+public:
+    /// @brief Creates the calculator of one shard (shards never share an instance)
+    using CalculatorFactory = std::function<std::unique_ptr<ICalculatorService>(std::size_t shardIndex)>;
+
+    /**
+     * @brief Constructor
+     * @param calculatorFactory Called once per shard with the shard index
+     * @param dataSender Outgoing port, called from the merge thread only
+     * @param config Shard count, CPU placement and queue sizes
+     * @throws std::invalid_argument if a dependency is null or shardCount is zero
+     */
+    ShardedProcessTrackUseCase(
+        const CalculatorFactory& calculatorFactory,
+        std::shared_ptr<ports::outgoing::IDelayCalcTrackDataOutgoingPort> dataSender,
+        const ShardedProcessingConfig& config);
+
+    /**
+     * @brief Destructor - ensures graceful shutdown
+     */
+    ~ShardedProcessTrackUseCase() override;
+
+    ShardedProcessTrackUseCase(const ShardedProcessTrackUseCase&) = delete;
+    ShardedProcessTrackUseCase& operator=(const ShardedProcessTrackUseCase&) = delete;
+    ShardedProcessTrackUseCase(ShardedProcessTrackUseCase&&) = delete;
+    ShardedProcessTrackUseCase& operator=(ShardedProcessTrackUseCase&&) = delete;
+
+    /**
+     * @brief Route incoming track data to its shard (non-blocking)
+     * @param data Received ExtrapTrackData to process
+     * @thread_safe Yes - concurrent callers are serialised per shard
+     */
+    void submitExtrapTrackData(const ports::ExtrapTrackData& data) override;
+
+    /**
+     * @brief Start the merge thread and the shard threads
+     * @return true if started successfully
+     */
+    [[nodiscard]] bool start();
+
+    /**
+     * @brief Stop all threads gracefully
+     */
+    void stop();
+
+    /**
+     * @brief Check if the use case is running
+     */
+    [[nodiscard]] bool isRunning() const;
+
+    /// @brief Number of shards
+    [[nodiscard]] std::size_t shardCount() const noexcept;
+
+    /// @brief Shard a track is routed to
+    [[nodiscard]] std::size_t shardFor(int32_t trackId) const noexcept;
+
+    /// @brief Tracks pending in one shard's queue (approximate)
+    [[nodiscard]] std::size_t shardQueueDepth(std::size_t shard) const noexcept;
+
+    /**
+     * @brief Pick shard cores from firstCore upwards, skipping cores other threads own
+     * @param count Number of shards
+     * @param firstCore Lowest candidate core
+     * @param reservedCores Cores pinned to other threads
+     * @return count cores in ascending order
+     */
+    [[nodiscard]] static std::vector<int32_t> shardCores(std::size_t count, int32_t firstCore,
+                                                         const std::vector<int32_t>& reservedCores);
+
+    /**
+     * @brief Counter owned by one shard thread
+     * @param shardIndex Shard index
+     * @param name Counter name within the shard
+     * @return The domain.shard<shardIndex>.<name> counter
+     */
+    [[nodiscard]] static utils::Metric& shardCounter(std::size_t shardIndex, const char* name);
+
+private:
+    static constexpr int QUEUE_WAIT_TIMEOUT_MS = 100;     ///< Graceful shutdown timeout (allows loop exit check)
+
+    /**
+     * @brief One worker: queue, calculator, thread and its metrics
+     */
+    struct Shard {
+        Shard(std::size_t index, std::unique_ptr<ICalculatorService> shardCalculator, std::size_t queueTracks);
+
+        std::size_t id;                                           ///< Shard index
+        std::unique_ptr<ICalculatorService> calculator;           ///< Shard-private calculator
+        utils::ConflatingQueue<ports::ExtrapTrackData> queue;     ///< Per-track conflating queue
+        std::thread thread;                                       ///< Shard worker thread
+        utils::Metric& metricQueueDrops;                          ///< Via queueCounters
+        utils::Metric& metricConflated;                           ///< Via queueCounters
+        utils::Metric& metricProcessed;                           ///< Shard thread
+        utils::Metric& metricErrors;                              ///< Shard thread
+        utils::Metric& metricMergeDrops;                          ///< Shard thread
+        utils::Metric& metricQueueDepth;                          ///< Shard thread
+        utils::ConflatingQueueCounters queueCounters;             ///< Shard thread
+    };
+
+    /**
+     * @brief Shard loop: dequeue, calculate, push the result to the merge ring
+     */
+    void processShard(Shard& shard);
+
+    /**
+     * @brief Merge loop: forward results to the outgoing port
+     */
+    void mergeResults();
+
+    /**
+     * @brief Pin the calling thread to a core (no-op for a negative core)
+     */
+    static void pinCurrentThread(int32_t cpuCore, const char* role, std::size_t index);
+
+    std::shared_ptr<ports::outgoing::IDelayCalcTrackDataOutgoingPort> dataSender_;  ///< Outgoing port (abstract)
+    ShardedProcessingConfig config_;                                                ///< Shard layout
+    std::vector<std::unique_ptr<Shard>> shards_;                                    ///< Fixed after construction
+    utils::MpscRingBuffer<ports::DelayCalcTrackData> results_;                      ///< Shard results to merge
+    std::thread mergeThread_;                                                       ///< Outgoing port caller
+    std::atomic<bool> running_{false};                                              ///< Thread-safe running flag
+    std::atomic<bool> merging_{false};                                              ///< Cleared after the shards joined
+
+    // Metrics
+    utils::Metric& metricRejected_{utils::MetricsRegistry::instance().counter("domain.rejected")};    ///< Submitter thread
+    utils::Metric& metricProcessed_{utils::MetricsRegistry::instance().counter("domain.processed")};  ///< Merge thread
+};
+
+} // namespace logic
+} // namespace domain
@@ -25,62 +25,139 @@ DelayCalcTrackData::DelayCalcTrackData() noexcept {
     secondHopSentTime_ = static_cast<int64_t>(0);
 }
 
+// Unchecked constructor: caller guarantees the values are in range
+DelayCalcTrackData::DelayCalcTrackData(UncheckedInit,
+                                        int32_t trackId,
+                                        double xVelocityECEF,
+                                        double yVelocityECEF,
+                                        double zVelocityECEF,
+                                        double xPositionECEF,
+                                        double yPositionECEF,
+                                        double zPositionECEF,
+                                        int64_t originalUpdateTime,
+                                        int64_t updateTime,
+                                        int64_t firstHopSentTime,
+                                        int64_t firstHopDelayTime,
+                                        int64_t secondHopSentTime) noexcept
+    : trackId_(trackId)
+    , xVelocityECEF_(xVelocityECEF)
+    , yVelocityECEF_(yVelocityECEF)
+    , zVelocityECEF_(zVelocityECEF)
+    , xPositionECEF_(xPositionECEF)
+    , yPositionECEF_(yPositionECEF)
+    , zPositionECEF_(zPositionECEF)
+    , originalUpdateTime_(originalUpdateTime)
+    , updateTime_(updateTime)
+    , firstHopSentTime_(firstHopSentTime)
+    , firstHopDelayTime_(firstHopDelayTime)
+    , secondHopSentTime_(secondHopSentTime) {
+}
+
+// Range checks - noexcept, shared by setters and validate()
+bool DelayCalcTrackData::isTrackIdInRange(int32_t value) noexcept {
+    return (value >= 1LL) && (value <= 9999LL);
+}
+
+bool DelayCalcTrackData::isXVelocityECEFInRange(double value) noexcept {
+    return !std::isnan(value) && (value >= -1.0E+6) && (value <= 1.0E+6);
+}
+
+bool DelayCalcTrackData::isYVelocityECEFInRange(double value) noexcept {
+    return !std::isnan(value) && (value >= -1.0E+6) && (value <= 1.0E+6);
+}
+
+bool DelayCalcTrackData::isZVelocityECEFInRange(double value) noexcept {
+    return !std::isnan(value) && (value >= -1.0E+6) && (value <= 1.0E+6);
+}
+
+bool DelayCalcTrackData::isXPositionECEFInRange(double value) noexcept {
+    return !std::isnan(value) && (value >= -9.9E+10) && (value <= 9.9E+10);
+}
+
+bool DelayCalcTrackData::isYPositionECEFInRange(double value) noexcept {
+    return !std::isnan(value) && (value >= -9.9E+10) && (value <= 9.9E+10);
+}
+
+bool DelayCalcTrackData::isZPositionECEFInRange(double value) noexcept {
+    return !std::isnan(value) && (value >= -9.9E+10) && (value <= 9.9E+10);
+}
+
+bool DelayCalcTrackData::isOriginalUpdateTimeInRange(int64_t value) noexcept {
+    return (value >= 0LL) && (value <= 9223372036854775LL);
+}
+
+bool DelayCalcTrackData::isUpdateTimeInRange(int64_t value) noexcept {
+    return (value >= 0LL) && (value <= 9223372036854775LL);
+}
+
+bool DelayCalcTrackData::isFirstHopSentTimeInRange(int64_t value) noexcept {
+    return (value >= 0LL) && (value <= 9223372036854775LL);
+}
+
+bool DelayCalcTrackData::isFirstHopDelayTimeInRange(int64_t value) noexcept {
+    return (value >= 0LL) && (value <= 9223372036854775LL);
+}
+
+bool DelayCalcTrackData::isSecondHopSentTimeInRange(int64_t value) noexcept {
+    return (value >= 0LL) && (value <= 9223372036854775LL);
+}
+
     void DelayCalcTrackData::validateTrackId(int32_t value) const {
-        if (value < 1LL || value > 9999LL) {
+        if (!isTrackIdInRange(value)) {
             throw std::out_of_range("TrackId value is out of valid range: " + std::to_string(value));
         }
     }
 
     void DelayCalcTrackData::validateXVelocityECEF(double value) const {
-        if (std::isnan(value) || value < -1.0E+6 || value > 1.0E+6) {
+        if (!isXVelocityECEFInRange(value)) {
             throw std::out_of_range("XVelocityECEF value is out of valid range: " + std::to_string(value));
         }
     }
 
     void DelayCalcTrackData::validateYVelocityECEF(double value) const {
-        if (std::isnan(value) || value < -1.0E+6 || value > 1.0E+6) {
+        if (!isYVelocityECEFInRange(value)) {
             throw std::out_of_range("YVelocityECEF value is out of valid range: " + std::to_string(value));
         }
     }
 
     void DelayCalcTrackData::validateZVelocityECEF(double value) const {
-        if (std::isnan(value) || value < -1.0E+6 || value > 1.0E+6) {
+        if (!isZVelocityECEFInRange(value)) {
             throw std::out_of_range("ZVelocityECEF value is out of valid range: " + std::to_string(value));
         }
     }
 
     void DelayCalcTrackData::validateXPositionECEF(double value) const {
-        if (std::isnan(value) || value < -9.9E+10 || value > 9.9E+10) {
+        if (!isXPositionECEFInRange(value)) {
             throw std::out_of_range("XPositionECEF value is out of valid range: " + std::to_string(value));
         }
     }
 
     void DelayCalcTrackData::validateYPositionECEF(double value) const {
-        if (std::isnan(value) || value < -9.9E+10 || value > 9.9E+10) {
+        if (!isYPositionECEFInRange(value)) {
             throw std::out_of_range("YPositionECEF value is out of valid range: " + std::to_string(value));
         }
     }
 
     void DelayCalcTrackData::validateZPositionECEF(double value) const {
-        if (std::isnan(value) || value < -9.9E+10 || value > 9.9E+10) {
+        if (!isZPositionECEFInRange(value)) {
             throw std::out_of_range("ZPositionECEF value is out of valid range: " + std::to_string(value));
         }
     }
 
     void DelayCalcTrackData::validateOriginalUpdateTime(int64_t value) const {
-        if (value < 0LL || value > 9223372036854775LL) {
+        if (!isOriginalUpdateTimeInRange(value)) {
             throw std::out_of_range("OriginalUpdateTime value is out of valid range: " + std::to_string(value));
         }
     }
 
     void DelayCalcTrackData::validateUpdateTime(int64_t value) const {
-        if (value < 0LL || value > 9223372036854775LL) {
+        if (!isUpdateTimeInRange(value)) {
             throw std::out_of_range("UpdateTime value is out of valid range: " + std::to_string(value));
         }
     }
 
     void DelayCalcTrackData::validateFirstHopSentTime(int64_t value) const {
-        if (value < 0LL || value > 9223372036854775LL) {
+        if (!isFirstHopSentTimeInRange(value)) {
             throw std::out_of_range("FirstHopSentTime value is out of valid range: " + std::to_string(value));
         }
     }
@@ -90,13 +167,13 @@ DelayCalcTrackData::DelayCalcTrackData() noexcept {
         // Range: 0 to ~2.5 million seconds (~29 days)
         // Delays beyond this indicate clock issues or stale data
         // Negative delays are invalid (indicate clock skew)
-        if (value < 0LL || value > 9223372036854775LL) {
+        if (!isFirstHopDelayTimeInRange(value)) {
             throw std::out_of_range("FirstHopDelayTime value is out of valid range: " + std::to_string(value));
         }
     }
 
     void DelayCalcTrackData::validateSecondHopSentTime(int64_t value) const {
-        if (value < 0LL || value > 9223372036854775LL) {
+        if (!isSecondHopSentTimeInRange(value)) {
             throw std::out_of_range("SecondHopSentTime value is out of valid range: " + std::to_string(value));
         }
     }
@@ -209,240 +286,122 @@ void DelayCalcTrackData::setSecondHopSentTime(const int64_t& value) {
     secondHopSentTime_ = value;
 }
 
-bool DelayCalcTrackData::isValid() const noexcept {
-    try {
-        // Validate all fields (12 total)
-        // Returns true only if ALL validations pass
-        // Catches exceptions from any validation failure
-        validateTrackId(trackId_);
-        validateXVelocityECEF(xVelocityECEF_);
-        validateYVelocityECEF(yVelocityECEF_);
-        validateZVelocityECEF(zVelocityECEF_);
-        validateXPositionECEF(xPositionECEF_);
-        validateYPositionECEF(yPositionECEF_);
-        validateZPositionECEF(zPositionECEF_);
-        validateOriginalUpdateTime(originalUpdateTime_);
-        validateUpdateTime(updateTime_);
-        validateFirstHopSentTime(firstHopSentTime_);
-        validateFirstHopDelayTime(firstHopDelayTime_);
-        validateSecondHopSentTime(secondHopSentTime_);
-        return true;  // All validations passed
-    } catch (const std::exception&) {
-        return false;  // At least one validation failed
-    }
+// Local fields: plain stores, outside validate() and the wire format
+int64_t DelayCalcTrackData::getFirstHopClockOffset() const noexcept {
+    return firstHopClockOffset_;
 }
 
-// MISRA C++ 2023 compliant Binary Serialization Implementation
-// Format: Little-endian packed binary (no padding, no alignment)
-// Total size: 96 bytes (extends ExtrapTrackData by 16 bytes)
-// Layout: [int32(4)] [double(8)]x6 [int64(8)]x5
-//   All ExtrapTrackData fields (76 bytes)
-//   + firstHopDelayTime_: 8 bytes
-//   + secondHopSentTime_: 8 bytes
-std::vector<uint8_t> DelayCalcTrackData::serialize() const {
-    std::vector<uint8_t> buffer;
-    buffer.reserve(getSerializedSize());  // 96 bytes pre-allocated
-    
-    // Serialize trackId_
-    {
-        const uint8_t* ptr = reinterpret_cast<const uint8_t*>(&trackId_);
-        buffer.insert(buffer.end(), ptr, ptr + sizeof(trackId_));
+void DelayCalcTrackData::setFirstHopClockOffset(const int64_t& value) noexcept {
+    firstHopClockOffset_ = value;
+}
+
+int64_t DelayCalcTrackData::getFirstHopClockErrorBound() const noexcept {
+    return firstHopClockErrorBound_;
+}
+
+void DelayCalcTrackData::setFirstHopClockErrorBound(const int64_t& value) noexcept {
+    firstHopClockErrorBound_ = value;
+}
+
+uint32_t DelayCalcTrackData::validate() const noexcept {
+    uint32_t errors = 0U;
+    if (!isTrackIdInRange(trackId_)) {
+        errors |= FIELD_TRACK_ID;
     }
-    
-    // Serialize xVelocityECEF_
-    {
-        const uint8_t* ptr = reinterpret_cast<const uint8_t*>(&xVelocityECEF_);
-        buffer.insert(buffer.end(), ptr, ptr + sizeof(xVelocityECEF_));
+    if (!isXVelocityECEFInRange(xVelocityECEF_)) {
+        errors |= FIELD_X_VELOCITY_ECEF;
     }
-    
-    // Serialize yVelocityECEF_
-    {
-        const uint8_t* ptr = reinterpret_cast<const uint8_t*>(&yVelocityECEF_);
-        buffer.insert(buffer.end(), ptr, ptr + sizeof(yVelocityECEF_));
+    if (!isYVelocityECEFInRange(yVelocityECEF_)) {
+        errors |= FIELD_Y_VELOCITY_ECEF;
     }
-    
-    // Serialize zVelocityECEF_
-    {
-        const uint8_t* ptr = reinterpret_cast<const uint8_t*>(&zVelocityECEF_);
-        buffer.insert(buffer.end(), ptr, ptr + sizeof(zVelocityECEF_));
+    if (!isZVelocityECEFInRange(zVelocityECEF_)) {
+        errors |= FIELD_Z_VELOCITY_ECEF;
     }
-    
-    // Serialize xPositionECEF_
-    {
-        const uint8_t* ptr = reinterpret_cast<const uint8_t*>(&xPositionECEF_);
-        buffer.insert(buffer.end(), ptr, ptr + sizeof(xPositionECEF_));
+    if (!isXPositionECEFInRange(xPositionECEF_)) {
+        errors |= FIELD_X_POSITION_ECEF;
     }
-    
-    // Serialize yPositionECEF_
-    {
-        const uint8_t* ptr = reinterpret_cast<const uint8_t*>(&yPositionECEF_);
-        buffer.insert(buffer.end(), ptr, ptr + sizeof(yPositionECEF_));
+    if (!isYPositionECEFInRange(yPositionECEF_)) {
+        errors |= FIELD_Y_POSITION_ECEF;
     }
-    
-    // Serialize zPositionECEF_
-    {
-        const uint8_t* ptr = reinterpret_cast<const uint8_t*>(&zPositionECEF_);
-        buffer.insert(buffer.end(), ptr, ptr + sizeof(zPositionECEF_));
+    if (!isZPositionECEFInRange(zPositionECEF_)) {
+        errors |= FIELD_Z_POSITION_ECEF;
     }
-    
-    // Serialize originalUpdateTime_
-    {
-        const uint8_t* ptr = reinterpret_cast<const uint8_t*>(&originalUpdateTime_);
-        buffer.insert(buffer.end(), ptr, ptr + sizeof(originalUpdateTime_));
+    if (!isOriginalUpdateTimeInRange(originalUpdateTime_)) {
+        errors |= FIELD_ORIGINAL_UPDATE_TIME;
     }
-    
-    // Serialize updateTime_
-    {
-        const uint8_t* ptr = reinterpret_cast<const uint8_t*>(&updateTime_);
-        buffer.insert(buffer.end(), ptr, ptr + sizeof(updateTime_));
+    if (!isUpdateTimeInRange(updateTime_)) {
+        errors |= FIELD_UPDATE_TIME;
     }
-    
-    // Serialize firstHopSentTime_
-    {
-        const uint8_t* ptr = reinterpret_cast<const uint8_t*>(&firstHopSentTime_);
-        buffer.insert(buffer.end(), ptr, ptr + sizeof(firstHopSentTime_));
+    if (!isFirstHopSentTimeInRange(firstHopSentTime_)) {
+        errors |= FIELD_FIRST_HOP_SENT_TIME;
     }
-    
-    // Serialize firstHopDelayTime_
-    {
-        const uint8_t* ptr = reinterpret_cast<const uint8_t*>(&firstHopDelayTime_);
-        buffer.insert(buffer.end(), ptr, ptr + sizeof(firstHopDelayTime_));
+    if (!isFirstHopDelayTimeInRange(firstHopDelayTime_)) {
+        errors |= FIELD_FIRST_HOP_DELAY_TIME;
     }
-    
-    // Serialize secondHopSentTime_
-    {
-        const uint8_t* ptr = reinterpret_cast<const uint8_t*>(&secondHopSentTime_);
-        buffer.insert(buffer.end(), ptr, ptr + sizeof(secondHopSentTime_));
+    if (!isSecondHopSentTimeInRange(secondHopSentTime_)) {
+        errors |= FIELD_SECOND_HOP_SENT_TIME;
     }
-    
+    return errors;
+}
+
+bool DelayCalcTrackData::isValid() const noexcept {
+    return validate() == 0U;
+}
+
+// MISRA C++ 2023 compliant Binary Serialization Implementation
+// Format: packed Wire struct, native (little-endian) byte order, no padding
+// Total size: 92 bytes (extends ExtrapTrackData by 16 bytes)
+// Layout: [int32(4)] [double(8)]x6 [int64(8)]x5
+//   All ExtrapTrackData fields (76 bytes)
+//   + firstHopDelayTime_: 8 bytes
+//   + secondHopSentTime_: 8 bytes
+std::vector<uint8_t> DelayCalcTrackData::serialize() const {
+    std::vector<uint8_t> buffer(kWireSize);
+    static_cast<void>(serializeInto(buffer.data(), buffer.size()));
     return buffer;
 }
 
-bool DelayCalcTrackData::deserialize(const std::vector<uint8_t>& data) noexcept {
-    if (data.size() < getSerializedSize()) {
-        return false;
-    }
-    
-    std::size_t offset = 0U;
-    
-    // Deserialize trackId_
-    if (offset + sizeof(trackId_) <= data.size()) {
-        std::memcpy(&trackId_, &data[offset], sizeof(trackId_));
-        offset += sizeof(trackId_);
-    } else {
-        return false;
-    }
-    
-    // Deserialize xVelocityECEF_
-    if (offset + sizeof(xVelocityECEF_) <= data.size()) {
-        std::memcpy(&xVelocityECEF_, &data[offset], sizeof(xVelocityECEF_));
-        offset += sizeof(xVelocityECEF_);
-    } else {
-        return false;
+std::size_t DelayCalcTrackData::serializeInto(uint8_t* dst, std::size_t cap) const noexcept {
+    if ((dst == nullptr) || (cap < kWireSize)) {
+        return 0U;
     }
-    
-    // Deserialize yVelocityECEF_
-    if (offset + sizeof(yVelocityECEF_) <= data.size()) {
-        std::memcpy(&yVelocityECEF_, &data[offset], sizeof(yVelocityECEF_));
-        offset += sizeof(yVelocityECEF_);
-    } else {
-        return false;
-    }
-    
-    // Deserialize zVelocityECEF_
-    if (offset + sizeof(zVelocityECEF_) <= data.size()) {
-        std::memcpy(&zVelocityECEF_, &data[offset], sizeof(zVelocityECEF_));
-        offset += sizeof(zVelocityECEF_);
-    } else {
-        return false;
-    }
-    
-    // Deserialize xPositionECEF_
-    if (offset + sizeof(xPositionECEF_) <= data.size()) {
-        std::memcpy(&xPositionECEF_, &data[offset], sizeof(xPositionECEF_));
-        offset += sizeof(xPositionECEF_);
-    } else {
-        return false;
-    }
-    
-    // Deserialize yPositionECEF_
-    if (offset + sizeof(yPositionECEF_) <= data.size()) {
-        std::memcpy(&yPositionECEF_, &data[offset], sizeof(yPositionECEF_));
-        offset += sizeof(yPositionECEF_);
-    } else {
-        return false;
-    }
-    
-    // Deserialize zPositionECEF_
-    if (offset + sizeof(zPositionECEF_) <= data.size()) {
-        std::memcpy(&zPositionECEF_, &data[offset], sizeof(zPositionECEF_));
-        offset += sizeof(zPositionECEF_);
-    } else {
-        return false;
-    }
-    
-    // Deserialize originalUpdateTime_
-    if (offset + sizeof(originalUpdateTime_) <= data.size()) {
-        std::memcpy(&originalUpdateTime_, &data[offset], sizeof(originalUpdateTime_));
-        offset += sizeof(originalUpdateTime_);
-    } else {
-        return false;
-    }
-    
-    // Deserialize updateTime_
-    if (offset + sizeof(updateTime_) <= data.size()) {
-        std::memcpy(&updateTime_, &data[offset], sizeof(updateTime_));
-        offset += sizeof(updateTime_);
-    } else {
-        return false;
-    }
-    
-    // Deserialize firstHopSentTime_
-    if (offset + sizeof(firstHopSentTime_) <= data.size()) {
-        std::memcpy(&firstHopSentTime_, &data[offset], sizeof(firstHopSentTime_));
-        offset += sizeof(firstHopSentTime_);
-    } else {
-        return false;
-    }
-    
-    // Deserialize firstHopDelayTime_
-    if (offset + sizeof(firstHopDelayTime_) <= data.size()) {
-        std::memcpy(&firstHopDelayTime_, &data[offset], sizeof(firstHopDelayTime_));
-        offset += sizeof(firstHopDelayTime_);
-    } else {
-        return false;
-    }
-    
-    // Deserialize secondHopSentTime_
-    if (offset + sizeof(secondHopSentTime_) <= data.size()) {
-        std::memcpy(&secondHopSentTime_, &data[offset], sizeof(secondHopSentTime_));
-        offset += sizeof(secondHopSentTime_);
-    } else {
+
+    const Wire wire{trackId_, xVelocityECEF_, yVelocityECEF_, zVelocityECEF_, xPositionECEF_, yPositionECEF_, zPositionECEF_, originalUpdateTime_, updateTime_, firstHopSentTime_, firstHopDelayTime_, secondHopSentTime_};
+    std::memcpy(dst, &wire, kWireSize);
+    return kWireSize;
+}
+
+bool DelayCalcTrackData::deserialize(const std::vector<uint8_t>& data) noexcept {
+    return deserialize(data.data(), data.size());
+}
+
+bool DelayCalcTrackData::deserialize(const uint8_t* data, std::size_t size) noexcept {
+    if ((data == nullptr) || (size < kWireSize)) {
         return false;
     }
-    
+
+    Wire wire;
+    std::memcpy(&wire, data, kWireSize);
+    trackId_ = wire.trackId;
+    xVelocityECEF_ = wire.xVelocityECEF;
+    yVelocityECEF_ = wire.yVelocityECEF;
+    zVelocityECEF_ = wire.zVelocityECEF;
+    xPositionECEF_ = wire.xPositionECEF;
+    yPositionECEF_ = wire.yPositionECEF;
+    zPositionECEF_ = wire.zPositionECEF;
+    originalUpdateTime_ = wire.originalUpdateTime;
+    updateTime_ = wire.updateTime;
+    firstHopSentTime_ = wire.firstHopSentTime;
+    firstHopDelayTime_ = wire.firstHopDelayTime;
+    secondHopSentTime_ = wire.secondHopSentTime;
+    // Local fields are never on the wire
+    firstHopClockOffset_ = {};
+    firstHopClockErrorBound_ = {};
     return true;
 }
 
 std::size_t DelayCalcTrackData::getSerializedSize() const noexcept {
-    std::size_t size = 0U;
-    
-    // Calculate total size: sum of all field sizes
-    // Total: 96 bytes = 4 + (6*8) + (5*8) = 4 + 48 + 40 + 16
-    size += sizeof(trackId_);  // int32_t = 4 bytes
-    size += sizeof(xVelocityECEF_);  // double = 8 bytes
-    size += sizeof(yVelocityECEF_);  // double = 8 bytes
-    size += sizeof(zVelocityECEF_);  // double = 8 bytes
-    size += sizeof(xPositionECEF_);  // double = 8 bytes
-    size += sizeof(yPositionECEF_);  // double = 8 bytes
-    size += sizeof(zPositionECEF_);  // double = 8 bytes
-    size += sizeof(originalUpdateTime_);  // int64_t = 8 bytes
-    size += sizeof(updateTime_);  // int64_t = 8 bytes
-    size += sizeof(firstHopSentTime_);  // int64_t = 8 bytes
-    size += sizeof(firstHopDelayTime_);  // int64_t = 8 bytes (new field)
-    size += sizeof(secondHopSentTime_);  // int64_t = 8 bytes (new field)
-    
-    return size;
+    return kWireSize;
 }
 
 } // namespace model
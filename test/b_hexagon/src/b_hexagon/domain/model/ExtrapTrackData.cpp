@@ -19,11 +19,76 @@ ExtrapTrackData::ExtrapTrackData() noexcept {
     firstHopSentTime_ = static_cast<int64_t>(0);
 }
 
+// Unchecked constructor: caller guarantees the values are in range
+ExtrapTrackData::ExtrapTrackData(UncheckedInit,
+                                  int32_t trackId,
+                                  double xVelocityECEF,
+                                  double yVelocityECEF,
+                                  double zVelocityECEF,
+                                  double xPositionECEF,
+                                  double yPositionECEF,
+                                  double zPositionECEF,
+                                  int64_t originalUpdateTime,
+                                  int64_t updateTime,
+                                  int64_t firstHopSentTime) noexcept
+    : trackId_(trackId)
+    , xVelocityECEF_(xVelocityECEF)
+    , yVelocityECEF_(yVelocityECEF)
+    , zVelocityECEF_(zVelocityECEF)
+    , xPositionECEF_(xPositionECEF)
+    , yPositionECEF_(yPositionECEF)
+    , zPositionECEF_(zPositionECEF)
+    , originalUpdateTime_(originalUpdateTime)
+    , updateTime_(updateTime)
+    , firstHopSentTime_(firstHopSentTime) {
+}
+
+// Range checks - noexcept, shared by setters and validate()
+bool ExtrapTrackData::isTrackIdInRange(int32_t value) noexcept {
+    return (value >= 1LL) && (value <= 4294967295LL);
+}
+
+bool ExtrapTrackData::isXVelocityECEFInRange(double value) noexcept {
+    return !std::isnan(value) && (value >= -1.0E+6) && (value <= 1.0E+6);
+}
+
+bool ExtrapTrackData::isYVelocityECEFInRange(double value) noexcept {
+    return !std::isnan(value) && (value >= -1.0E+6) && (value <= 1.0E+6);
+}
+
+bool ExtrapTrackData::isZVelocityECEFInRange(double value) noexcept {
+    return !std::isnan(value) && (value >= -1.0E+6) && (value <= 1.0E+6);
+}
+
+bool ExtrapTrackData::isXPositionECEFInRange(double value) noexcept {
+    return !std::isnan(value) && (value >= -9.9E+10) && (value <= 9.9E+10);
+}
+
+bool ExtrapTrackData::isYPositionECEFInRange(double value) noexcept {
+    return !std::isnan(value) && (value >= -9.9E+10) && (value <= 9.9E+10);
+}
+
+bool ExtrapTrackData::isZPositionECEFInRange(double value) noexcept {
+    return !std::isnan(value) && (value >= -9.9E+10) && (value <= 9.9E+10);
+}
+
+bool ExtrapTrackData::isOriginalUpdateTimeInRange(int64_t value) noexcept {
+    return (value >= 0LL) && (value <= 9223372036854775807LL);
+}
+
+bool ExtrapTrackData::isUpdateTimeInRange(int64_t value) noexcept {
+    return (value >= 0LL) && (value <= 9223372036854775807LL);
+}
+
+bool ExtrapTrackData::isFirstHopSentTimeInRange(int64_t value) noexcept {
+    return (value >= 0LL) && (value <= 9223372036854775LL);
+}
+
     void ExtrapTrackData::validateTrackId(int32_t value) const {
         // Track ID range: 1-4294967295 (positive int32 values)
         // Range allows for large number of concurrent tracks
         // Zero reserved as invalid/uninitialized marker
-        if (value < 1LL || value > 4294967295LL) {
+        if (!isTrackIdInRange(value)) {
             throw std::out_of_range("TrackId value is out of valid range: " + std::to_string(value));
         }
     }
@@ -33,19 +98,19 @@ ExtrapTrackData::ExtrapTrackData() noexcept {
         // ECEF = Earth-Centered, Earth-Fixed coordinate system
         // Range covers hypersonic velocities (Mach 2900+)
         // NaN check prevents undefined behavior in calculations
-        if (std::isnan(value) || value < -1.0E+6 || value > 1.0E+6) {
+        if (!isXVelocityECEFInRange(value)) {
             throw std::out_of_range("XVelocityECEF value is out of valid range: " + std::to_string(value));
         }
     }
 
     void ExtrapTrackData::validateYVelocityECEF(double value) const {
-        if (std::isnan(value) || value < -1.0E+6 || value > 1.0E+6) {
+        if (!isYVelocityECEFInRange(value)) {
             throw std::out_of_range("YVelocityECEF value is out of valid range: " + std::to_string(value));
         }
     }
 
     void ExtrapTrackData::validateZVelocityECEF(double value) const {
-        if (std::isnan(value) || value < -1.0E+6 || value > 1.0E+6) {
+        if (!isZVelocityECEFInRange(value)) {
             throw std::out_of_range("ZVelocityECEF value is out of valid range: " + std::to_string(value));
         }
     }
@@ -57,19 +122,19 @@ ExtrapTrackData::ExtrapTrackData() noexcept {
         // - LEO: 200-2000 km altitude
         // - GEO: ~35,786 km altitude
         // Range: ~15x Earth-Moon distance (sufficient for all practical cases)
-        if (std::isnan(value) || value < -9.9E+10 || value > 9.9E+10) {
+        if (!isXPositionECEFInRange(value)) {
             throw std::out_of_range("XPositionECEF value is out of valid range: " + std::to_string(value));
         }
     }
 
     void ExtrapTrackData::validateYPositionECEF(double value) const {
-        if (std::isnan(value) || value < -9.9E+10 || value > 9.9E+10) {
+        if (!isYPositionECEFInRange(value)) {
             throw std::out_of_range("YPositionECEF value is out of valid range: " + std::to_string(value));
         }
     }
 
     void ExtrapTrackData::validateZPositionECEF(double value) const {
-        if (std::isnan(value) || value < -9.9E+10 || value > 9.9E+10) {
+        if (!isZPositionECEFInRange(value)) {
             throw std::out_of_range("ZPositionECEF value is out of valid range: " + std::to_string(value));
         }
     }
@@ -79,19 +144,19 @@ ExtrapTrackData::ExtrapTrackData() noexcept {
         // Range: 1970-01-01 to ~290,000 years in the future
         // Max value: 9,223,372,036,854,775,807 microseconds (~292,471 years)
         // Sufficient for all practical applications
-        if (value < 0LL || value > 9223372036854775807LL) {  // Max int64_t value
+        if (!isOriginalUpdateTimeInRange(value)) {  // Max int64_t value
             throw std::out_of_range("OriginalUpdateTime value is out of valid range: " + std::to_string(value));
         }
     }
 
     void ExtrapTrackData::validateUpdateTime(int64_t value) const {
-        if (value < 0LL || value > 9223372036854775807LL) {  // Maksimum int64_t değeri - microsecond epoch time için yeterli
+        if (!isUpdateTimeInRange(value)) {  // Maksimum int64_t değeri - microsecond epoch time için yeterli
             throw std::out_of_range("UpdateTime value is out of valid range: " + std::to_string(value));
         }
     }
 
     void ExtrapTrackData::validateFirstHopSentTime(int64_t value) const {
-        if (value < 0LL || value > 9223372036854775LL) {  // Microsecond epoch time için yeterli
+        if (!isFirstHopSentTimeInRange(value)) {  // Microsecond epoch time için yeterli
             throw std::out_of_range("FirstHopSentTime value is out of valid range: " + std::to_string(value));
         }
     }
@@ -186,26 +251,47 @@ void ExtrapTrackData::setFirstHopSentTime(const int64_t& value) {
     firstHopSentTime_ = value;
 }
 
-bool ExtrapTrackData::isValid() const noexcept {
-    try {
-        validateTrackId(trackId_);
-        validateXVelocityECEF(xVelocityECEF_);
-        validateYVelocityECEF(yVelocityECEF_);
-        validateZVelocityECEF(zVelocityECEF_);
-        validateXPositionECEF(xPositionECEF_);
-        validateYPositionECEF(yPositionECEF_);
-        validateZPositionECEF(zPositionECEF_);
-        validateOriginalUpdateTime(originalUpdateTime_);
-        validateUpdateTime(updateTime_);
-        validateFirstHopSentTime(firstHopSentTime_);
-        return true;
-    } catch (const std::exception&) {
-        return false;
+uint32_t ExtrapTrackData::validate() const noexcept {
+    uint32_t errors = 0U;
+    if (!isTrackIdInRange(trackId_)) {
+        errors |= FIELD_TRACK_ID;
+    }
+    if (!isXVelocityECEFInRange(xVelocityECEF_)) {
+        errors |= FIELD_X_VELOCITY_ECEF;
+    }
+    if (!isYVelocityECEFInRange(yVelocityECEF_)) {
+        errors |= FIELD_Y_VELOCITY_ECEF;
+    }
+    if (!isZVelocityECEFInRange(zVelocityECEF_)) {
+        errors |= FIELD_Z_VELOCITY_ECEF;
     }
+    if (!isXPositionECEFInRange(xPositionECEF_)) {
+        errors |= FIELD_X_POSITION_ECEF;
+    }
+    if (!isYPositionECEFInRange(yPositionECEF_)) {
+        errors |= FIELD_Y_POSITION_ECEF;
+    }
+    if (!isZPositionECEFInRange(zPositionECEF_)) {
+        errors |= FIELD_Z_POSITION_ECEF;
+    }
+    if (!isOriginalUpdateTimeInRange(originalUpdateTime_)) {
+        errors |= FIELD_ORIGINAL_UPDATE_TIME;
+    }
+    if (!isUpdateTimeInRange(updateTime_)) {
+        errors |= FIELD_UPDATE_TIME;
+    }
+    if (!isFirstHopSentTimeInRange(firstHopSentTime_)) {
+        errors |= FIELD_FIRST_HOP_SENT_TIME;
+    }
+    return errors;
+}
+
+bool ExtrapTrackData::isValid() const noexcept {
+    return validate() == 0U;
 }
 
 // MISRA C++ 2023 compliant Binary Serialization Implementation
-// Format: Little-endian packed binary (no padding, no alignment)
+// Format: packed Wire struct, native (little-endian) byte order, no padding
 // Total size: 76 bytes
 // Layout: [int32(4)] [double(8)]x6 [int64(8)]x3
 //   trackId_: 4 bytes
@@ -213,182 +299,47 @@ bool ExtrapTrackData::isValid() const noexcept {
 //   xPositionECEF_, yPositionECEF_, zPositionECEF_: 24 bytes (3x8)
 //   originalUpdateTime_, updateTime_, firstHopSentTime_: 24 bytes (3x8)
 std::vector<uint8_t> ExtrapTrackData::serialize() const {
-    std::vector<uint8_t> buffer;
-    buffer.reserve(getSerializedSize());  // Pre-allocate to avoid reallocations
-    
-    // Serialize trackId_
-    // reinterpret_cast used for type-punning (MISRA compliant for POD types)
-    // Copies 4 bytes representing int32_t to buffer
-    {
-        const uint8_t* ptr = reinterpret_cast<const uint8_t*>(&trackId_);
-        buffer.insert(buffer.end(), ptr, ptr + sizeof(trackId_));
-    }
-    
-    // Serialize xVelocityECEF_
-    {
-        const uint8_t* ptr = reinterpret_cast<const uint8_t*>(&xVelocityECEF_);
-        buffer.insert(buffer.end(), ptr, ptr + sizeof(xVelocityECEF_));
-    }
-    
-    // Serialize yVelocityECEF_
-    {
-        const uint8_t* ptr = reinterpret_cast<const uint8_t*>(&yVelocityECEF_);
-        buffer.insert(buffer.end(), ptr, ptr + sizeof(yVelocityECEF_));
-    }
-    
-    // Serialize zVelocityECEF_
-    {
-        const uint8_t* ptr = reinterpret_cast<const uint8_t*>(&zVelocityECEF_);
-        buffer.insert(buffer.end(), ptr, ptr + sizeof(zVelocityECEF_));
-    }
-    
-    // Serialize xPositionECEF_
-    {
-        const uint8_t* ptr = reinterpret_cast<const uint8_t*>(&xPositionECEF_);
-        buffer.insert(buffer.end(), ptr, ptr + sizeof(xPositionECEF_));
-    }
-    
-    // Serialize yPositionECEF_
-    {
-        const uint8_t* ptr = reinterpret_cast<const uint8_t*>(&yPositionECEF_);
-        buffer.insert(buffer.end(), ptr, ptr + sizeof(yPositionECEF_));
-    }
-    
-    // Serialize zPositionECEF_
-    {
-        const uint8_t* ptr = reinterpret_cast<const uint8_t*>(&zPositionECEF_);
-        buffer.insert(buffer.end(), ptr, ptr + sizeof(zPositionECEF_));
-    }
-    
-    // Serialize originalUpdateTime_
-    {
-        const uint8_t* ptr = reinterpret_cast<const uint8_t*>(&originalUpdateTime_);
-        buffer.insert(buffer.end(), ptr, ptr + sizeof(originalUpdateTime_));
-    }
-    
-    // Serialize updateTime_
-    {
-        const uint8_t* ptr = reinterpret_cast<const uint8_t*>(&updateTime_);
-        buffer.insert(buffer.end(), ptr, ptr + sizeof(updateTime_));
-    }
-    
-    // Serialize firstHopSentTime_
-    {
-        const uint8_t* ptr = reinterpret_cast<const uint8_t*>(&firstHopSentTime_);
-        buffer.insert(buffer.end(), ptr, ptr + sizeof(firstHopSentTime_));
-    }
-    
+    std::vector<uint8_t> buffer(kWireSize);
+    static_cast<void>(serializeInto(buffer.data(), buffer.size()));
     return buffer;
 }
 
-bool ExtrapTrackData::deserialize(const std::vector<uint8_t>& data) noexcept {
-    // Validate buffer size before deserialization (prevents buffer overflow)
-    if (data.size() < getSerializedSize()) {
-        return false;  // Insufficient data
-    }
-    
-    std::size_t offset = 0U;  // Track current position in buffer
-    
-    // Deserialize trackId_
-    // Double-check bounds before memcpy (defense in depth)
-    // memcpy used for type-safe byte copying (MISRA compliant)
-    if (offset + sizeof(trackId_) <= data.size()) {
-        std::memcpy(&trackId_, &data[offset], sizeof(trackId_));
-        offset += sizeof(trackId_);
-    } else {
-        return false;  // Buffer overflow protection
-    }
-    
-    // Deserialize xVelocityECEF_
-    if (offset + sizeof(xVelocityECEF_) <= data.size()) {
-        std::memcpy(&xVelocityECEF_, &data[offset], sizeof(xVelocityECEF_));
-        offset += sizeof(xVelocityECEF_);
-    } else {
-        return false;
-    }
-    
-    // Deserialize yVelocityECEF_
-    if (offset + sizeof(yVelocityECEF_) <= data.size()) {
-        std::memcpy(&yVelocityECEF_, &data[offset], sizeof(yVelocityECEF_));
-        offset += sizeof(yVelocityECEF_);
-    } else {
-        return false;
-    }
-    
-    // Deserialize zVelocityECEF_
-    if (offset + sizeof(zVelocityECEF_) <= data.size()) {
-        std::memcpy(&zVelocityECEF_, &data[offset], sizeof(zVelocityECEF_));
-        offset += sizeof(zVelocityECEF_);
-    } else {
-        return false;
+std::size_t ExtrapTrackData::serializeInto(uint8_t* dst, std::size_t cap) const noexcept {
+    if ((dst == nullptr) || (cap < kWireSize)) {
+        return 0U;
     }
-    
-    // Deserialize xPositionECEF_
-    if (offset + sizeof(xPositionECEF_) <= data.size()) {
-        std::memcpy(&xPositionECEF_, &data[offset], sizeof(xPositionECEF_));
-        offset += sizeof(xPositionECEF_);
-    } else {
-        return false;
-    }
-    
-    // Deserialize yPositionECEF_
-    if (offset + sizeof(yPositionECEF_) <= data.size()) {
-        std::memcpy(&yPositionECEF_, &data[offset], sizeof(yPositionECEF_));
-        offset += sizeof(yPositionECEF_);
-    } else {
-        return false;
-    }
-    
-    // Deserialize zPositionECEF_
-    if (offset + sizeof(zPositionECEF_) <= data.size()) {
-        std::memcpy(&zPositionECEF_, &data[offset], sizeof(zPositionECEF_));
-        offset += sizeof(zPositionECEF_);
-    } else {
-        return false;
-    }
-    
-    // Deserialize originalUpdateTime_
-    if (offset + sizeof(originalUpdateTime_) <= data.size()) {
-        std::memcpy(&originalUpdateTime_, &data[offset], sizeof(originalUpdateTime_));
-        offset += sizeof(originalUpdateTime_);
-    } else {
-        return false;
-    }
-    
-    // Deserialize updateTime_
-    if (offset + sizeof(updateTime_) <= data.size()) {
-        std::memcpy(&updateTime_, &data[offset], sizeof(updateTime_));
-        offset += sizeof(updateTime_);
-    } else {
-        return false;
-    }
-    
-    // Deserialize firstHopSentTime_
-    if (offset + sizeof(firstHopSentTime_) <= data.size()) {
-        std::memcpy(&firstHopSentTime_, &data[offset], sizeof(firstHopSentTime_));
-        offset += sizeof(firstHopSentTime_);
-    } else {
+
+    const Wire wire{trackId_, xVelocityECEF_, yVelocityECEF_, zVelocityECEF_, xPositionECEF_, yPositionECEF_, zPositionECEF_, originalUpdateTime_, updateTime_, firstHopSentTime_};
+    std::memcpy(dst, &wire, kWireSize);
+    return kWireSize;
+}
+
+bool ExtrapTrackData::deserialize(const std::vector<uint8_t>& data) noexcept {
+    return deserialize(data.data(), data.size());
+}
+
+bool ExtrapTrackData::deserialize(const uint8_t* data, std::size_t size) noexcept {
+    if ((data == nullptr) || (size < kWireSize)) {
         return false;
     }
-    
+
+    Wire wire;
+    std::memcpy(&wire, data, kWireSize);
+    trackId_ = wire.trackId;
+    xVelocityECEF_ = wire.xVelocityECEF;
+    yVelocityECEF_ = wire.yVelocityECEF;
+    zVelocityECEF_ = wire.zVelocityECEF;
+    xPositionECEF_ = wire.xPositionECEF;
+    yPositionECEF_ = wire.yPositionECEF;
+    zPositionECEF_ = wire.zPositionECEF;
+    originalUpdateTime_ = wire.originalUpdateTime;
+    updateTime_ = wire.updateTime;
+    firstHopSentTime_ = wire.firstHopSentTime;
     return true;
 }
 
 std::size_t ExtrapTrackData::getSerializedSize() const noexcept {
-    std::size_t size = 0U;
-    
-    size += sizeof(trackId_);  // int32_t
-    size += sizeof(xVelocityECEF_);  // double
-    size += sizeof(yVelocityECEF_);  // double
-    size += sizeof(zVelocityECEF_);  // double
-    size += sizeof(xPositionECEF_);  // double
-    size += sizeof(yPositionECEF_);  // double
-    size += sizeof(zPositionECEF_);  // double
-    size += sizeof(originalUpdateTime_);  // int64_t
-    size += sizeof(updateTime_);  // int64_t
-    size += sizeof(firstHopSentTime_);  // int64_t
-    
-    return size;
+    return kWireSize;
 }
 
 } // namespace model
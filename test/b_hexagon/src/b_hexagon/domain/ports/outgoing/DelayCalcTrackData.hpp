@@ -7,6 +7,8 @@
 #include <cmath>
 #include <vector>
 #include <cstring>
+#include <cstddef>
+#include <type_traits>
 
 namespace domain {
 namespace ports {
@@ -41,6 +43,29 @@ class DelayCalcTrackData final {
 public:
     // MISRA C++ 2023 compliant constructors
     explicit DelayCalcTrackData() noexcept;
+
+    /// @brief Tag selecting the unchecked constructor
+    struct UncheckedInit final {};
+    static constexpr UncheckedInit UNCHECKED{};
+
+    /**
+     * @brief Construct from values that already passed validate() upstream
+     * @details No range checks: stage-to-stage copies cost one store per field.
+     *          Only use for data validated at the ingress boundary.
+     */
+    DelayCalcTrackData(UncheckedInit,
+                       int32_t trackId,
+                       double xVelocityECEF,
+                       double yVelocityECEF,
+                       double zVelocityECEF,
+                       double xPositionECEF,
+                       double yPositionECEF,
+                       double zPositionECEF,
+                       int64_t originalUpdateTime,
+                       int64_t updateTime,
+                       int64_t firstHopSentTime,
+                       int64_t firstHopDelayTime,
+                       int64_t secondHopSentTime) noexcept;
     
     // Copy constructor
     DelayCalcTrackData(const DelayCalcTrackData& other) = default;
@@ -94,12 +119,84 @@ public:
     int64_t getSecondHopSentTime() const noexcept;
     void setSecondHopSentTime(const int64_t& value);
 
-    // Validation - MISRA compliant
+    // Local fields - set in-process, not serialized or validated
+    /// @brief Clock offset applied to firstHopDelayTime: a_hexagon clock - local clock (microseconds)
+    int64_t getFirstHopClockOffset() const noexcept;
+    void setFirstHopClockOffset(const int64_t& value) noexcept;
+
+    /// @brief Error bound of firstHopDelayTime after the offset (microseconds, 0 = uncorrected)
+    int64_t getFirstHopClockErrorBound() const noexcept;
+    void setFirstHopClockErrorBound(const int64_t& value) noexcept;
+
+    // Validation - MISRA compliant, exception free
+    /// @brief Field bits reported by validate()
+    static constexpr uint32_t FIELD_TRACK_ID{1U << 0U};
+    static constexpr uint32_t FIELD_X_VELOCITY_ECEF{1U << 1U};
+    static constexpr uint32_t FIELD_Y_VELOCITY_ECEF{1U << 2U};
+    static constexpr uint32_t FIELD_Z_VELOCITY_ECEF{1U << 3U};
+    static constexpr uint32_t FIELD_X_POSITION_ECEF{1U << 4U};
+    static constexpr uint32_t FIELD_Y_POSITION_ECEF{1U << 5U};
+    static constexpr uint32_t FIELD_Z_POSITION_ECEF{1U << 6U};
+    static constexpr uint32_t FIELD_ORIGINAL_UPDATE_TIME{1U << 7U};
+    static constexpr uint32_t FIELD_UPDATE_TIME{1U << 8U};
+    static constexpr uint32_t FIELD_FIRST_HOP_SENT_TIME{1U << 9U};
+    static constexpr uint32_t FIELD_FIRST_HOP_DELAY_TIME{1U << 10U};
+    static constexpr uint32_t FIELD_SECOND_HOP_SENT_TIME{1U << 11U};
+
+    /**
+     * @brief Range-check every field without throwing
+     * @return 0 if valid, otherwise the FIELD_* bits of out-of-range fields
+     */
+    [[nodiscard]] uint32_t validate() const noexcept;
     [[nodiscard]] bool isValid() const noexcept;
 
+    // Per-field range checks (setters throw std::out_of_range when these fail)
+    [[nodiscard]] static bool isTrackIdInRange(int32_t value) noexcept;
+    [[nodiscard]] static bool isXVelocityECEFInRange(double value) noexcept;
+    [[nodiscard]] static bool isYVelocityECEFInRange(double value) noexcept;
+    [[nodiscard]] static bool isZVelocityECEFInRange(double value) noexcept;
+    [[nodiscard]] static bool isXPositionECEFInRange(double value) noexcept;
+    [[nodiscard]] static bool isYPositionECEFInRange(double value) noexcept;
+    [[nodiscard]] static bool isZPositionECEFInRange(double value) noexcept;
+    [[nodiscard]] static bool isOriginalUpdateTimeInRange(int64_t value) noexcept;
+    [[nodiscard]] static bool isUpdateTimeInRange(int64_t value) noexcept;
+    [[nodiscard]] static bool isFirstHopSentTimeInRange(int64_t value) noexcept;
+    [[nodiscard]] static bool isFirstHopDelayTimeInRange(int64_t value) noexcept;
+    [[nodiscard]] static bool isSecondHopSentTimeInRange(int64_t value) noexcept;
+
     // Binary Serialization - MISRA compliant
+    /// @brief Fixed wire size in bytes (packed fields, native byte order)
+    static constexpr std::size_t kWireSize{92U};
+
+    /**
+     * @brief Packed wire image of the serialized fields
+     * @details Trivially copyable: encode and decode are one memcpy of kWireSize bytes
+     */
+#pragma pack(push, 1)
+    struct Wire final {
+        int32_t trackId;
+        double xVelocityECEF;
+        double yVelocityECEF;
+        double zVelocityECEF;
+        double xPositionECEF;
+        double yPositionECEF;
+        double zPositionECEF;
+        int64_t originalUpdateTime;
+        int64_t updateTime;
+        int64_t firstHopSentTime;
+        int64_t firstHopDelayTime;
+        int64_t secondHopSentTime;
+    };
+#pragma pack(pop)
+
     [[nodiscard]] std::vector<uint8_t> serialize() const;
+    /**
+     * @brief Encode into a caller-provided (pooled or stack) buffer
+     * @return Bytes written (kWireSize), or 0 if dst is null or cap < kWireSize
+     */
+    [[nodiscard]] std::size_t serializeInto(uint8_t* dst, std::size_t cap) const noexcept;
     bool deserialize(const std::vector<uint8_t>& data) noexcept;
+    bool deserialize(const uint8_t* data, std::size_t size) noexcept;
     [[nodiscard]] std::size_t getSerializedSize() const noexcept;
 
 private:
@@ -128,6 +225,11 @@ private:
     int64_t firstHopDelayTime_;
     /// İkinci atlamanın gönderildiği zaman (mikrosaniye)
     int64_t secondHopSentTime_;
+    // Local fields (not serialized)
+    /// Clock offset applied to firstHopDelayTime: a_hexagon clock - local clock (microseconds)
+    int64_t firstHopClockOffset_{};
+    /// Error bound of firstHopDelayTime after the offset (microseconds, 0 = uncorrected)
+    int64_t firstHopClockErrorBound_{};
 
     // Validation functions - MISRA compliant
     void validateTrackId(int32_t value) const;
@@ -144,5 +246,8 @@ private:
     void validateSecondHopSentTime(int64_t value) const;
 };
 
+static_assert(sizeof(DelayCalcTrackData::Wire) == DelayCalcTrackData::kWireSize, "DelayCalcTrackData::Wire must have no padding");
+static_assert(std::is_trivially_copyable<DelayCalcTrackData::Wire>::value, "DelayCalcTrackData::Wire must be trivially copyable");
+
 } // namespace ports
 } // namespace domain
@@ -14,6 +14,7 @@
 #pragma once
 
 #include "domain/ports/outgoing/DelayCalcTrackData.hpp"
+#include <vector>
 
 namespace domain {
 namespace ports {
@@ -60,6 +61,15 @@ public:
      * @throws std::runtime_error if send operation fails
      */
     virtual void sendDelayCalcTrackData(const DelayCalcTrackData& data) = 0;
+
+    /**
+     * @brief Send a batch of processed track data
+     * @param data Results of one domain wake-up, in processing order
+     * @details Lets adapters take their producer lock and wake their worker
+     *          once per batch instead of once per record.
+     * @throws std::runtime_error if send operation fails
+     */
+    virtual void sendDelayCalcTrackData(const std::vector<DelayCalcTrackData>& data) = 0;
     
 protected:
     /// @brief Protected default constructor
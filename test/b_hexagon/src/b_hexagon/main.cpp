@@ -9,12 +9,20 @@
 #include "domain/logic/ICalculatorService.hpp"
 #include "domain/logic/CalculatorService.hpp"
 #include "domain/logic/ProcessTrackUseCase.hpp"
+#include "domain/logic/ShardedProcessTrackUseCase.hpp"
 #include "domain/ports/incoming/IExtrapTrackDataIncomingPort.hpp"
 #include "domain/ports/outgoing/IDelayCalcTrackDataOutgoingPort.hpp"
 #include "adapters/incoming/zeromq/ExtrapTrackDataZeroMQIncomingAdapter.hpp"
 #include "adapters/outgoing/zeromq/DelayCalcTrackDataZeroMQOutgoingAdapter.hpp"
 #include "adapters/outgoing/custom/DelayCalcTrackDataCustomOutgoingAdapter.hpp"
+#include "adapters/outgoing/broadcast/DelayCalcTrackDataBroadcastOutgoingPort.hpp"
+#include "adapters/common/ZmqContextRegistry.hpp"
 #include "utils/Logger.hpp"
+#include "utils/StageTraceAggregator.hpp"
+#include "utils/MetricsPublisher.hpp"
+#include "utils/ClockSync.hpp"
+#include "utils/FlightRecorder.hpp"
+#include "utils/InstrumentedWaitStrategy.hpp"
 #include <memory>
 #include <iostream>
 #include <thread>
@@ -22,6 +30,7 @@
 #include <csignal>
 #include <atomic>
 #include <vector>
+#include <string>
 
 // Using declarations for convenience
 using domain::ports::ExtrapTrackData;
@@ -29,22 +38,82 @@ using domain::ports::DelayCalcTrackData;
 using domain::logic::ICalculatorService;
 using domain::logic::CalculatorService;
 using domain::logic::ProcessTrackUseCase;
+using domain::logic::ShardedProcessTrackUseCase;
 
 // Global resources for signal handler access
 // NOTE: Signal handlers cannot access member variables, so we use static globals
 // All pointers are set to nullptr after use to prevent dangling references
 static std::atomic<bool> g_running{true};  // Thread-safe shutdown flag
 static ProcessTrackUseCase* g_domainProcessor{nullptr};
+static ShardedProcessTrackUseCase* g_shardedProcessor{nullptr};
 static ExtrapTrackDataZeroMQIncomingAdapter* g_incomingAdapter{nullptr};
 static DelayCalcTrackDataZeroMQOutgoingAdapter* g_outgoingZeroMQAdapter{nullptr};
 static DelayCalcTrackDataCustomOutgoingAdapter* g_outgoingCustomAdapter{nullptr};
 
+// Shared ZeroMQ context settings
+static constexpr int32_t MESSAGING_IO_THREADS{1};
+static constexpr int32_t MESSAGING_IO_THREAD_CPU{0};
+
+// Intra-process stage tracing (receive/enqueue/dequeue/compute/send). Off by
+// default; when on, the main thread drains the trace rings every loop tick
+static constexpr bool STAGE_TRACING_ENABLED{false};
+static constexpr int64_t STAGE_TRACE_REPORT_INTERVAL_MS{5000};
+
+// Runtime counters (receive/drop/send) snapshot to the hexagon_metrics CLI
+static constexpr const char* METRICS_SOURCE_NAME{"b_hexagon"};
+static constexpr int64_t METRICS_PUBLISH_INTERVAL_MS{1000};
+
+// Flight recorder: last pipeline events per thread, dumped on SIGUSR1, fatal
+// signals and domain-thread stalls (kill -USR1 <pid> for a manual dump)
+static constexpr bool FLIGHT_RECORDER_ENABLED{true};
+static constexpr const char* FLIGHT_RECORDER_DIRECTORY{"/tmp"};
+static constexpr int64_t FLIGHT_RECORDER_STALL_TIMEOUT_MS{2000};
+
+// Cross-node clock offsets: ping a_hexagon's responder to correct the first
+// hop delay, answer c_hexagon's pings for the second hop. The a_hexagon
+// responder defaults to this host; set HEXAGON_CLOCK_SYNC_A_ENDPOINT when it
+// runs elsewhere
+static constexpr bool CLOCK_SYNC_ENABLED{true};
+static constexpr const char* CLOCK_SYNC_UPSTREAM_ENV{"HEXAGON_CLOCK_SYNC_A_ENDPOINT"};
+static constexpr const char* CLOCK_SYNC_UPSTREAM_ENDPOINT{"udp://127.0.0.1:15100"};  // a_hexagon responder
+static constexpr const char* CLOCK_SYNC_RESPONDER_ENDPOINT{"udp://0.0.0.0:15101"};   // c_hexagon pings here
+static constexpr int64_t CLOCK_SYNC_INTERVAL_MS{1000};
+
+// Thread placement (see the architecture diagram below)
+static constexpr int32_t INCOMING_THREAD_CPU{1};
+static constexpr int32_t ZEROMQ_OUTGOING_THREAD_CPU{2};
+static constexpr int32_t DOMAIN_THREAD_CPU{3};
+static constexpr int32_t CUSTOM_OUTGOING_THREAD_CPU{4};
+
+// Domain sharding: 1 keeps the single domain thread; N > 1 hashes trackId onto
+// N shard threads (each with its own CalculatorService) pinned from the domain
+// core up, skipping the cores above, merged into the outgoing adapter by one
+// extra thread
+static constexpr std::size_t DOMAIN_SHARD_COUNT{1U};
+
+// Outgoing fan-out: the domain writes each result once into a broadcast ring
+// that both outgoing adapters read with their own cursor. When off, only the
+// ZeroMQ adapter is fed (through its own queue)
+static constexpr bool OUTGOING_BROADCAST_ENABLED{true};
+static constexpr std::size_t OUTGOING_BROADCAST_RING_SIZE{1024U};
+static constexpr utils::SlowConsumerPolicy ZEROMQ_SLOW_CONSUMER_POLICY{utils::SlowConsumerPolicy::Drop};
+static constexpr utils::SlowConsumerPolicy CUSTOM_SLOW_CONSUMER_POLICY{utils::SlowConsumerPolicy::Skip};
+
+// Worker wait strategies: Blocking frees the core at idle but pays a futex
+// wake-up per burst; SpinThenPark spins WAIT_SPIN_BUDGET_US first; BusySpin
+// only on an isolated core. Wake-up latency is logged at shutdown
+static constexpr utils::WaitStrategyKind DOMAIN_WAIT_STRATEGY{utils::WaitStrategyKind::Blocking};
+static constexpr utils::WaitStrategyKind CUSTOM_OUTGOING_WAIT_STRATEGY{utils::WaitStrategyKind::Blocking};
+static constexpr utils::WaitStrategyKind ZEROMQ_OUTGOING_WAIT_STRATEGY{utils::WaitStrategyKind::Blocking};
+static constexpr int64_t WAIT_SPIN_BUDGET_US{50};
+static constexpr bool WAKE_LATENCY_HISTOGRAMS_ENABLED{true};
+
 /**
  * @brief Signal handler for graceful shutdown
  * @param signum Signal number received
  */
 void signalHandler(int signum) {
-    Logger::info("Received signal ", signum, ", initiating graceful shutdown...");
+    Logger::info("Received signal {}, initiating graceful shutdown...", signum);
     g_running.store(false);
     
     // Stop all components in reverse order (incoming first to stop new data flow)
@@ -54,6 +123,9 @@ void signalHandler(int signum) {
     if (g_domainProcessor != nullptr) {
         g_domainProcessor->stop();
     }
+    if (g_shardedProcessor != nullptr) {
+        g_shardedProcessor->stop();
+    }
     if (g_outgoingZeroMQAdapter != nullptr) {
         g_outgoingZeroMQAdapter->stop();
     }
@@ -62,6 +134,54 @@ void signalHandler(int signum) {
     }
 }
 
+/**
+ * @brief Log the per-segment latency breakdown of one report interval
+ * @param aggregator Segment histograms (reset afterwards)
+ */
+static void reportStageTrace(utils::StageTraceAggregator& aggregator) {
+    if (aggregator.completedCount() == 0U) {
+        return;
+    }
+    for (std::size_t i = 0U; i < utils::TRACE_SEGMENT_COUNT; ++i) {
+        const auto segment = static_cast<utils::TraceSegment>(i);
+        const utils::HdrHistogram& histogram = aggregator.segment(segment);
+        Logger::info("Stage {} | n={} | p50: {} ns | p99: {} ns | max: {} ns",
+                     utils::StageTraceAggregator::segmentName(segment), histogram.count(),
+                     histogram.valueAtPercentile(50.0), histogram.valueAtPercentile(99.0), histogram.max());
+    }
+    Logger::info("Stage trace: {} incomplete messages, {} events dropped",
+                 aggregator.abandonedCount(), utils::StageTracer::instance().droppedCount());
+    aggregator.reset();
+}
+
+/**
+ * @brief Create a worker thread's wait strategy
+ * @param kind Strategy selected in the configuration above
+ * @param probe Receives the wake-up latency wrapper (null when histograms are off)
+ */
+static std::shared_ptr<utils::WaitStrategy> createWaitStrategy(
+    utils::WaitStrategyKind kind, std::shared_ptr<utils::InstrumentedWaitStrategy>& probe) {
+    std::shared_ptr<utils::WaitStrategy> strategy =
+        utils::makeWaitStrategy(kind, std::chrono::microseconds(WAIT_SPIN_BUDGET_US));
+    if (WAKE_LATENCY_HISTOGRAMS_ENABLED) {
+        probe = std::make_shared<utils::InstrumentedWaitStrategy>(strategy);
+        strategy = probe;
+    }
+    return strategy;
+}
+
+/**
+ * @brief Log the signal-to-wake latency of one worker thread
+ * @param thread Thread label
+ * @param probe Wake-up latency wrapper of its wait strategy
+ */
+static void reportWakeLatency(const char* thread, const utils::InstrumentedWaitStrategy& probe) {
+    const utils::HdrHistogram& histogram = probe.wakeLatency();
+    Logger::info("Wake-up latency {} ({}) | n={} | p50: {} ns | p99: {} ns | max: {} ns",
+                 thread, probe.name(), histogram.count(), histogram.valueAtPercentile(50.0),
+                 histogram.valueAtPercentile(99.0), histogram.max());
+}
+
 /**
  * @brief Application entry point
  * 
@@ -94,6 +214,9 @@ void signalHandler(int signum) {
  * - IDelayCalcTrackDataOutgoingPort: Abstract outgoing port
  */
 int main() {
+    // Async logger first: the log calls no longer initialize it lazily
+    Logger::init("b_hexagon");
+    
     Logger::info("=== B_Hexagon Track Processing System Starting ===");
     Logger::info("Architecture: Event Queue Based (5 isolated threads)");
     Logger::info("SOLID: Dependency Inversion enabled for high test coverage");
@@ -105,38 +228,118 @@ int main() {
         
         Logger::info("Initializing application components...");
         
-        // ==================== Create Domain Services ====================
-        Logger::debug("Creating CalculatorService (implements ICalculatorService)...");
-        std::unique_ptr<ICalculatorService> calculatorService = std::make_unique<CalculatorService>();
+        utils::StageTracer::instance().setEnabled(STAGE_TRACING_ENABLED);
+        
+        if (FLIGHT_RECORDER_ENABLED) {
+            if (utils::FlightRecorder::instance().enable(FLIGHT_RECORDER_DIRECTORY, METRICS_SOURCE_NAME) &&
+                utils::FlightRecorder::installSignalHandlers()) {
+                Logger::info("Flight recorder enabled (dump: kill -USR1 {})", ::getpid());
+            } else {
+                Logger::warn("Flight recorder could not be fully enabled");
+            }
+        }
+        
+        // ==================== Shared ZeroMQ Context ====================
+        // One context for all sockets; its I/O thread stays off the pipeline cores (1-4)
+        adapters::ZmqContextConfig zmqConfig;
+        zmqConfig.ioThreads = MESSAGING_IO_THREADS;
+        zmqConfig.ioThreadCpus = {MESSAGING_IO_THREAD_CPU};
+        static_cast<void>(adapters::ZmqContextRegistry::instance().configure(zmqConfig));
+        
+        // ==================== Clock Synchronization ====================
+        // Best effort: without an estimate hop delays stay uncorrected
+        const utils::ClockSyncPeerEndpoint clockPeer =
+            utils::resolveClockSyncPeer(CLOCK_SYNC_UPSTREAM_ENV, CLOCK_SYNC_UPSTREAM_ENDPOINT);
+        utils::ClockSyncClient clockClient("a_hexagon", clockPeer.endpoint,
+                                           std::chrono::milliseconds(CLOCK_SYNC_INTERVAL_MS));
+        utils::ClockSyncResponder clockResponder(CLOCK_SYNC_RESPONDER_ENDPOINT);
+        if (CLOCK_SYNC_ENABLED) {
+            if (clockPeer.invalidOverride) {
+                Logger::warn("Ignoring {}: not a udp://a.b.c.d:port endpoint", CLOCK_SYNC_UPSTREAM_ENV);
+            }
+            Logger::info("Clock sync peer a_hexagon: {} ({})", clockPeer.endpoint,
+                         clockPeer.fromEnvironment ? CLOCK_SYNC_UPSTREAM_ENV : "default");
+            if (!clockClient.start()) {
+                Logger::warn("Clock sync client unavailable, first hop delay uncorrected");
+            }
+            if (!clockResponder.start()) {
+                Logger::warn("Clock sync responder could not bind {}", CLOCK_SYNC_RESPONDER_ENDPOINT);
+            }
+        }
         
         // ==================== Create Outgoing Adapters ====================
         Logger::info("Creating Outgoing Adapters...");
         
         // ZeroMQ Outgoing Adapter (RADIO socket)
         Logger::debug("Creating DelayCalcTrackDataZeroMQOutgoingAdapter (RADIO socket)...");
-        auto zmqOutgoingAdapter = std::make_shared<DelayCalcTrackDataZeroMQOutgoingAdapter>();
+        std::shared_ptr<utils::InstrumentedWaitStrategy> zmqWaitProbe;
+        auto zmqOutgoingAdapter = std::make_shared<DelayCalcTrackDataZeroMQOutgoingAdapter>(
+            createWaitStrategy(ZEROMQ_OUTGOING_WAIT_STRATEGY, zmqWaitProbe));
         g_outgoingZeroMQAdapter = zmqOutgoingAdapter.get();
         
         // Custom Adapter (Moving Average Calculation)
         Logger::debug("Creating DelayCalcTrackDataCustomOutgoingAdapter (Custom Processing)...");
-        auto customOutgoingAdapter = std::make_shared<DelayCalcTrackDataCustomOutgoingAdapter>();
+        std::shared_ptr<utils::InstrumentedWaitStrategy> customWaitProbe;
+        auto customOutgoingAdapter = std::make_shared<DelayCalcTrackDataCustomOutgoingAdapter>(
+            createWaitStrategy(CUSTOM_OUTGOING_WAIT_STRATEGY, customWaitProbe));
         g_outgoingCustomAdapter = customOutgoingAdapter.get();
         
         // NOTE: Custom adapter calculates moving average of FirstHopDelayTime
         // Primary output: ZeroMQ adapter
         // Analytics output: Custom adapter (100-sample moving average)
         
+        // ==================== Outgoing Fan-out ====================
+        // One ring write per result; each adapter reads it on its own worker thread
+        std::shared_ptr<domain::ports::outgoing::IDelayCalcTrackDataOutgoingPort> outgoingPort = zmqOutgoingAdapter;
+        std::shared_ptr<DelayCalcTrackDataBroadcastOutgoingPort> broadcastPort;
+        if (OUTGOING_BROADCAST_ENABLED) {
+            broadcastPort = std::make_shared<DelayCalcTrackDataBroadcastOutgoingPort>(OUTGOING_BROADCAST_RING_SIZE);
+            if (!zmqOutgoingAdapter->attachBroadcast(broadcastPort->ring(), ZEROMQ_SLOW_CONSUMER_POLICY) ||
+                !customOutgoingAdapter->attachBroadcast(broadcastPort->ring(), CUSTOM_SLOW_CONSUMER_POLICY)) {
+                Logger::error("Failed to attach outgoing adapters to the broadcast ring");
+                return 1;
+            }
+            outgoingPort = broadcastPort;
+        }
+        
         // ==================== Create Domain Use Case ====================
-        Logger::debug("Creating ProcessTrackUseCase with dependencies...");
-        auto domainProcessor = std::make_shared<ProcessTrackUseCase>(
-            std::move(calculatorService),
-            zmqOutgoingAdapter  // Primary outgoing adapter
-        );
-        g_domainProcessor = domainProcessor.get();
+        // One CalculatorService per domain thread (ICalculatorService abstraction)
+        const utils::ClockSyncClient* clockSource = CLOCK_SYNC_ENABLED ? &clockClient : nullptr;
+        std::shared_ptr<ProcessTrackUseCase> domainProcessor;
+        std::shared_ptr<ShardedProcessTrackUseCase> shardedProcessor;
+        std::shared_ptr<domain::ports::incoming::IExtrapTrackDataIncomingPort> domainPort;
+        std::shared_ptr<utils::InstrumentedWaitStrategy> domainWaitProbe;
+        domain::logic::ShardedProcessingConfig shardConfig;
+        if (DOMAIN_SHARD_COUNT > 1U) {
+            Logger::debug("Creating ShardedProcessTrackUseCase ({} shards)...", DOMAIN_SHARD_COUNT);
+            shardConfig.shardCount = DOMAIN_SHARD_COUNT;
+            shardConfig.cpuCores = ShardedProcessTrackUseCase::shardCores(
+                DOMAIN_SHARD_COUNT, DOMAIN_THREAD_CPU,
+                {MESSAGING_IO_THREAD_CPU, INCOMING_THREAD_CPU, ZEROMQ_OUTGOING_THREAD_CPU, CUSTOM_OUTGOING_THREAD_CPU});
+            shardedProcessor = std::make_shared<ShardedProcessTrackUseCase>(
+                [clockSource](std::size_t shard) -> std::unique_ptr<ICalculatorService> {
+                    return std::make_unique<CalculatorService>(
+                        clockSource, ShardedProcessTrackUseCase::shardCounter(shard, "clamped_delays"));
+                },
+                outgoingPort,
+                shardConfig
+            );
+            g_shardedProcessor = shardedProcessor.get();
+            domainPort = shardedProcessor;
+        } else {
+            Logger::debug("Creating ProcessTrackUseCase with dependencies...");
+            domainProcessor = std::make_shared<ProcessTrackUseCase>(
+                std::make_unique<CalculatorService>(clockSource),
+                outgoingPort,  // Broadcast ring, or the ZeroMQ adapter alone
+                createWaitStrategy(DOMAIN_WAIT_STRATEGY, domainWaitProbe)
+            );
+            g_domainProcessor = domainProcessor.get();
+            domainPort = domainProcessor;
+        }
         
         // ==================== Create Incoming Adapter ====================
         Logger::debug("Creating ExtrapTrackDataZeroMQIncomingAdapter (DISH socket)...");
-        auto incomingAdapter = std::make_shared<ExtrapTrackDataZeroMQIncomingAdapter>(domainProcessor);
+        auto incomingAdapter = std::make_shared<ExtrapTrackDataZeroMQIncomingAdapter>(domainPort);
         g_incomingAdapter = incomingAdapter.get();
         
         // ==================== System Information ====================
@@ -146,11 +349,21 @@ int main() {
         Logger::info("Messaging Output: ZeroMQ RADIO (TCP) + Custom Processing");
         Logger::info("Input Group: ExtrapTrackData");
         Logger::info("Output Groups: DelayCalcTrackData (ZeroMQ + Analytics)");
-        Logger::info("Thread 1: Incoming Adapter (CPU 1)");
-        Logger::info("Thread 2: Domain Processing (CPU 3)");
-        Logger::info("Thread 3: Outgoing ZeroMQ (CPU 2)");
-        Logger::info("Thread 4: Outgoing Custom (CPU 4 - Moving Average)");
+        Logger::info("Thread 1: Incoming Adapter (CPU {})", INCOMING_THREAD_CPU);
+        if (shardedProcessor) {
+            std::string shardCpus;
+            for (const int32_t core : shardConfig.cpuCores) {
+                shardCpus += (shardCpus.empty() ? "" : ",") + std::to_string(core);
+            }
+            Logger::info("Thread 2: Domain Processing ({} shards, CPU {}) + merge thread",
+                         DOMAIN_SHARD_COUNT, shardCpus);
+        } else {
+            Logger::info("Thread 2: Domain Processing (CPU {})", DOMAIN_THREAD_CPU);
+        }
+        Logger::info("Thread 3: Outgoing ZeroMQ (CPU {})", ZEROMQ_OUTGOING_THREAD_CPU);
+        Logger::info("Thread 4: Outgoing Custom (CPU {} - Moving Average)", CUSTOM_OUTGOING_THREAD_CPU);
         Logger::info("Thread 5: Main (lifecycle management)");
+        Logger::info("ZeroMQ I/O: {} shared thread(s) (CPU {})", MESSAGING_IO_THREADS, MESSAGING_IO_THREAD_CPU);
         Logger::info("Press Ctrl+C to shutdown gracefully");
         Logger::info("===============================");
         
@@ -176,7 +389,8 @@ int main() {
         
         // Step 2: Start domain processor
         Logger::info("Step 2: Starting domain processor...");
-        if (!domainProcessor->start()) {
+        const bool domainStarted = shardedProcessor ? shardedProcessor->start() : domainProcessor->start();
+        if (!domainStarted) {
             Logger::error("Failed to start domain processor");
             return 1;
         }
@@ -189,10 +403,33 @@ int main() {
             return 1;
         }
         
+        // Metrics snapshots are best effort: the pipeline runs without them
+        utils::MetricsPublisher metricsPublisher(METRICS_SOURCE_NAME, utils::DEFAULT_METRICS_SOCKET_PATH,
+                                                 std::chrono::milliseconds(METRICS_PUBLISH_INTERVAL_MS));
+        if (!metricsPublisher.start()) {
+            Logger::warn("Metrics publisher unavailable, runtime counters not exported");
+        }
+        
+        utils::FlightRecorderWatchdog flightWatchdog{std::chrono::milliseconds(FLIGHT_RECORDER_STALL_TIMEOUT_MS)};
+        if (FLIGHT_RECORDER_ENABLED) {
+            static_cast<void>(flightWatchdog.start());
+        }
+        
         // ==================== Main Loop ====================
         Logger::info("All components running. Entering main loop...");
+        utils::StageTraceAggregator stageTrace;
+        auto nextStageReport = std::chrono::steady_clock::now() +
+                               std::chrono::milliseconds(STAGE_TRACE_REPORT_INTERVAL_MS);
         while (g_running.load()) {
             std::this_thread::sleep_for(std::chrono::milliseconds(100));
+            
+            if (STAGE_TRACING_ENABLED) {
+                static_cast<void>(stageTrace.collect(utils::StageTracer::instance()));
+                if (std::chrono::steady_clock::now() >= nextStageReport) {
+                    reportStageTrace(stageTrace);
+                    nextStageReport += std::chrono::milliseconds(STAGE_TRACE_REPORT_INTERVAL_MS);
+                }
+            }
         }
         
         // ==================== Graceful Shutdown ====================
@@ -204,18 +441,50 @@ int main() {
         // 3. Outgoing adapters stop last - ensures all processed data is sent
         // This ordering prevents data loss during shutdown
         incomingAdapter->stop();
-        domainProcessor->stop();
+        if (shardedProcessor) {
+            shardedProcessor->stop();
+        } else {
+            domainProcessor->stop();
+        }
         zmqOutgoingAdapter->stop();
         customOutgoingAdapter->stop();
+        if (broadcastPort) {
+            const auto ring = broadcastPort->ring();
+            Logger::info("Broadcast ring: {} published; ZeroMQ lost {}, Custom lost {}",
+                         ring->publishedCount(), ring->lostCount(0U), ring->lostCount(1U));
+        }
+        metricsPublisher.stop();
+        flightWatchdog.stop();
+        if (flightWatchdog.stallCount() > 0U) {
+            Logger::warn("Flight recorder watchdog detected {} domain stall(s)", flightWatchdog.stallCount());
+        }
+        if (domainWaitProbe) {
+            reportWakeLatency("domain", *domainWaitProbe);
+        }
+        if (customWaitProbe) {
+            reportWakeLatency("custom outgoing", *customWaitProbe);
+        }
+        if (zmqWaitProbe) {
+            reportWakeLatency("zeromq outgoing", *zmqWaitProbe);
+        }
+        const utils::ClockOffsetEstimate clock = clockClient.estimate();
+        clockClient.stop();
+        clockResponder.stop();
+        if (clock.valid) {
+            Logger::info("Clock offset to a_hexagon: {} ± {} μs (rtt {} μs, {} samples); answered {} c_hexagon pings",
+                         clock.offsetUs, clock.errorBoundUs, clock.rttUs, clock.samples,
+                         clockResponder.answeredCount());
+        }
         
         // Clear global pointers
         g_incomingAdapter = nullptr;
         g_domainProcessor = nullptr;
+        g_shardedProcessor = nullptr;
         g_outgoingZeroMQAdapter = nullptr;
         g_outgoingCustomAdapter = nullptr;
         
     } catch (const std::exception& ex) {
-        Logger::error("Application error: ", ex.what());
+        Logger::error("Application error: {}", ex.what());
         return 1;
     }
     
@@ -0,0 +1,363 @@
+/**
+ * @file BroadcastRing.hpp
+ * @brief Single-producer, multi-consumer broadcast ring (Disruptor style)
+ * @details Fanning one stream out to K consumers through K private queues
+ *          costs K copies per message. This ring is written once per message;
+ *          every consumer reads the same slots through its own sequence
+ *          cursor.
+ *
+ * Design:
+ * - Slots are pre-allocated once (power of two). A reader copies its slot
+ *   under its cursor's read lock; the producer moves a lapped cursor under the
+ *   same lock before reusing the slot, so a slot is never rewritten while it
+ *   is being copied. The producer takes no lock while no cursor is lapped.
+ * - Consumers are registered up front (at most MAX_CONSUMERS); each has its own
+ *   cache-line padded cursor and wait strategy.
+ * - What happens when a consumer falls a full ring behind is chosen per
+ *   consumer (SlowConsumerPolicy):
+ *   - Block: the producer waits for the consumer (no loss, back-pressure)
+ *   - Skip : the consumer jumps to the newest entry, skipping its backlog
+ *   - Drop : the producer evicts the consumer's oldest unread entry (same
+ *            drop-oldest rule as the SPSC stage rings)
+ * - Inactive consumers (adapter stopped) never hold the producer back.
+ *
+ * @author b_hexagon Team
+ * @version 1.0
+ * @date 2025
+ *
+ * @note MISRA C++ 2023 compliant implementation
+ * @note Exactly one producer thread; one thread per consumer cursor
+ * @see SpscRingBuffer.hpp
+ */
+
+#ifndef B_HEXAGON_UTILS_BROADCAST_RING_HPP
+#define B_HEXAGON_UTILS_BROADCAST_RING_HPP
+
+#include "utils/SpinLock.hpp"
+#include "utils/SpscRingBuffer.hpp"
+#include "utils/WaitStrategy.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace utils {
+
+/**
+ * @brief What the ring does when a consumer is a full ring behind
+ */
+enum class SlowConsumerPolicy : uint8_t {
+    Block = 0U,  ///< Producer waits until the consumer frees the slot
+    Skip = 1U,   ///< Consumer jumps to the newest entry
+    Drop = 2U    ///< Producer evicts the consumer's oldest unread entry
+};
+
+/**
+ * @brief Policy name for logging
+ */
+inline const char* slowConsumerPolicyName(SlowConsumerPolicy policy) noexcept {
+    switch (policy) {
+        case SlowConsumerPolicy::Block: return "block";
+        case SlowConsumerPolicy::Skip:  return "skip";
+        default:                        return "drop";
+    }
+}
+
+/**
+ * @class BroadcastRing
+ * @brief Bounded broadcast ring: one write per message, one cursor per consumer
+ * @tparam T Trivially copyable element type
+ */
+template <typename T>
+class BroadcastRing {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "BroadcastRing elements must be trivially copyable");
+
+public:
+    static constexpr std::size_t MAX_CONSUMERS = 8U;
+    static constexpr uint32_t BLOCK_SPINS_BEFORE_SLEEP = 64U;
+    static constexpr std::chrono::microseconds BLOCK_MAX_BACKOFF{128};
+
+    /// @brief Consumer handle returned by addConsumer()
+    using ConsumerId = std::size_t;
+
+    /**
+     * @brief Constructor
+     * @param capacity Minimum number of buffered messages (> 0, rounded up to a power of two)
+     * @throws std::invalid_argument if capacity is zero
+     */
+    explicit BroadcastRing(std::size_t capacity)
+        : mask_(slotCountFor(capacity) - 1U)
+        , slots_(slotCountFor(capacity)) {
+        if (capacity == 0U) {
+            throw std::invalid_argument("BroadcastRing capacity must be greater than zero");
+        }
+    }
+
+    // Non-copyable, non-movable (shared between threads)
+    BroadcastRing(const BroadcastRing&) = delete;
+    BroadcastRing& operator=(const BroadcastRing&) = delete;
+    BroadcastRing(BroadcastRing&&) = delete;
+    BroadcastRing& operator=(BroadcastRing&&) = delete;
+    ~BroadcastRing() = default;
+
+    // ==================== Registration ====================
+
+    /**
+     * @brief Register a consumer cursor (inactive until setActive(true))
+     * @param policy Slow-consumer policy for this cursor
+     * @param waitStrategy Consumer wait policy (blocking if null)
+     * @return Consumer id
+     * @throws std::length_error if MAX_CONSUMERS are already registered
+     */
+    ConsumerId addConsumer(SlowConsumerPolicy policy, std::shared_ptr<WaitStrategy> waitStrategy = nullptr) {
+        std::lock_guard<std::mutex> guard(registrationMutex_);
+        const std::size_t id = consumerCount_.load(std::memory_order_relaxed);
+        if (id >= MAX_CONSUMERS) {
+            throw std::length_error("BroadcastRing consumer limit reached");
+        }
+        Consumer& consumer = consumers_[id];
+        consumer.policy = policy;
+        consumer.waitStrategy = waitStrategy ? std::move(waitStrategy) : std::make_shared<BlockingWaitStrategy>();
+        consumer.next.value.store(published_.value.load(std::memory_order_acquire), std::memory_order_relaxed);
+        consumerCount_.store(id + 1U, std::memory_order_release);
+        return id;
+    }
+
+    /**
+     * @brief Start or stop reading with a cursor
+     * @details Activation moves the cursor to the newest position, so a
+     *          restarted consumer does not replay stale messages. Inactive
+     *          cursors are ignored by the producer.
+     */
+    void setActive(ConsumerId id, bool active) noexcept {
+        Consumer& consumer = consumers_[id];
+        if (active) {
+            consumer.next.value.store(published_.value.load(std::memory_order_acquire), std::memory_order_release);
+            consumer.woken.store(false, std::memory_order_release);
+        }
+        consumer.active.store(active, std::memory_order_release);
+        if (!active) {
+            consumer.woken.store(true, std::memory_order_release);
+            consumer.waitStrategy->signalAll();
+        }
+    }
+
+    // ==================== Producer Side ====================
+
+    /**
+     * @brief Write one message for every consumer
+     * @param item Message to copy into the ring (once)
+     */
+    void publish(const T& item) noexcept {
+        const uint64_t sequence = published_.value.load(std::memory_order_relaxed);
+        const std::size_t count = consumerCount_.load(std::memory_order_acquire);
+        const uint64_t slotCount = mask_ + 1U;
+
+        if (sequence >= slotCount) {
+            for (std::size_t i = 0U; i < count; ++i) {
+                makeRoom(consumers_[i], sequence, slotCount);
+            }
+        }
+
+        slots_[static_cast<std::size_t>(sequence & mask_)] = item;
+        published_.value.store(sequence + 1U, std::memory_order_release);
+
+        for (std::size_t i = 0U; i < count; ++i) {
+            if (consumers_[i].active.load(std::memory_order_relaxed)) {
+                consumers_[i].waitStrategy->signal();
+            }
+        }
+    }
+
+    // ==================== Consumer Side (one thread per cursor) ====================
+
+    /**
+     * @brief Read the cursor's next message without waiting
+     * @param id Consumer cursor
+     * @param out Destination for the message
+     * @return true if a message was read
+     */
+    bool tryConsume(ConsumerId id, T& out) noexcept {
+        Consumer& consumer = consumers_[id];
+        const uint64_t slotCount = mask_ + 1U;
+        std::lock_guard<SpinLock> guard(consumer.readLock);
+        uint64_t next = consumer.next.value.load(std::memory_order_relaxed);
+        const uint64_t published = published_.value.load(std::memory_order_acquire);
+        if (next >= published) {
+            return false;
+        }
+        if ((consumer.policy == SlowConsumerPolicy::Skip) &&
+            (((published - next) >= slotCount) || (consumer.lappedSkips != 0U))) {
+            // Lapped (or about to be): jump to the newest entry, counting what the producer moved past
+            const uint64_t newest = published - 1U;
+            consumer.lost.fetch_add(consumer.lappedSkips + (newest - next), std::memory_order_relaxed);
+            consumer.lappedSkips = 0U;
+            next = newest;
+        }
+        out = slots_[static_cast<std::size_t>(next & mask_)];
+        consumer.next.value.store(next + 1U, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Read the cursor's next message, waiting up to timeout
+     * @param id Consumer cursor
+     * @param out Destination for the message
+     * @param timeout Maximum wait
+     * @return true if a message was read
+     */
+    bool waitConsume(ConsumerId id, T& out, std::chrono::microseconds timeout) {
+        if (tryConsume(id, out)) {
+            return true;
+        }
+        Consumer& consumer = consumers_[id];
+        if (!consumer.waitStrategy->waitFor(
+                [this, &consumer]() {
+                    return (consumer.next.value.load(std::memory_order_acquire) <
+                            published_.value.load(std::memory_order_acquire)) ||
+                           consumer.woken.load(std::memory_order_acquire);
+                },
+                timeout)) {
+            return false;
+        }
+        return tryConsume(id, out);
+    }
+
+    // ==================== Observers (any thread, approximate) ====================
+
+    /// @brief Messages published so far
+    [[nodiscard]] uint64_t publishedCount() const noexcept {
+        return published_.value.load(std::memory_order_acquire);
+    }
+
+    /// @brief Messages the cursor has not read yet
+    [[nodiscard]] std::size_t lag(ConsumerId id) const noexcept {
+        const uint64_t published = published_.value.load(std::memory_order_acquire);
+        const uint64_t next = consumers_[id].next.value.load(std::memory_order_acquire);
+        return (published > next) ? static_cast<std::size_t>(published - next) : 0U;
+    }
+
+    /// @brief Messages the cursor lost to Skip or Drop
+    [[nodiscard]] uint64_t lostCount(ConsumerId id) const noexcept {
+        return consumers_[id].lost.load(std::memory_order_relaxed);
+    }
+
+    /// @brief Times the producer had to wait for a Block cursor
+    [[nodiscard]] uint64_t blockedCount(ConsumerId id) const noexcept {
+        return consumers_[id].blocked.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] SlowConsumerPolicy policy(ConsumerId id) const noexcept {
+        return consumers_[id].policy;
+    }
+
+    [[nodiscard]] std::size_t consumerCount() const noexcept {
+        return consumerCount_.load(std::memory_order_acquire);
+    }
+
+    [[nodiscard]] std::size_t capacity() const noexcept {
+        return slots_.size();
+    }
+
+private:
+    /**
+     * @brief Index padded to its own cache line
+     */
+    template <typename V>
+    struct alignas(CACHE_LINE_SIZE) PaddedAtomic {
+        std::atomic<V> value{0U};
+    };
+
+    /**
+     * @brief One consumer cursor and its settings
+     */
+    struct alignas(CACHE_LINE_SIZE) Consumer {
+        PaddedAtomic<uint64_t> next;                 ///< Next sequence to read
+        std::atomic<bool> active{false};             ///< Gates the producer only when true
+        std::atomic<bool> woken{false};              ///< Wakes a waiting reader on deactivation
+        SlowConsumerPolicy policy{SlowConsumerPolicy::Drop};
+        std::shared_ptr<WaitStrategy> waitStrategy;
+        std::atomic<uint64_t> lost{0U};              ///< Skipped or evicted messages
+        std::atomic<uint64_t> blocked{0U};           ///< Producer waits (Block)
+        SpinLock readLock;                           ///< Held while reading; producer moves lapped cursors under it
+        uint64_t lappedSkips{0U};                    ///< Skip: entries the producer moved past (readLock)
+    };
+
+    /**
+     * @brief Make sure writing sequence does not overrun the consumer
+     */
+    void makeRoom(Consumer& consumer, uint64_t sequence, uint64_t slotCount) noexcept {
+        const bool active = consumer.active.load(std::memory_order_acquire);
+        if (active && (consumer.policy == SlowConsumerPolicy::Block)) {
+            uint32_t spins = 0U;
+            std::chrono::microseconds backoff{1};
+            bool counted = false;
+            while (((sequence - consumer.next.value.load(std::memory_order_acquire)) >= slotCount) &&
+                   consumer.active.load(std::memory_order_acquire)) {
+                if (!counted) {
+                    consumer.blocked.fetch_add(1U, std::memory_order_relaxed);
+                    counted = true;
+                }
+                if (spins < BLOCK_SPINS_BEFORE_SLEEP) {
+                    ++spins;
+                    cpuRelax();
+                } else {
+                    // Sleep rather than yield: a SCHED_FIFO producer must let the reader run
+                    std::this_thread::sleep_for(backoff);
+                    backoff = std::min(backoff * 2, BLOCK_MAX_BACKOFF);
+                }
+            }
+            if (consumer.active.load(std::memory_order_acquire)) {
+                return;
+            }
+        }
+
+        if ((sequence - consumer.next.value.load(std::memory_order_acquire)) < slotCount) {
+            return;
+        }
+        // Lapped: move the cursor off the slot about to be reused, waiting out a copy in flight
+        std::lock_guard<SpinLock> guard(consumer.readLock);
+        const uint64_t next = consumer.next.value.load(std::memory_order_relaxed);
+        if ((sequence - next) < slotCount) {
+            return;
+        }
+        const uint64_t oldestKept = (sequence - slotCount) + 1U;
+        if (active && (consumer.policy == SlowConsumerPolicy::Drop)) {
+            consumer.lost.fetch_add(oldestKept - next, std::memory_order_relaxed);
+        } else if (active && (consumer.policy == SlowConsumerPolicy::Skip)) {
+            consumer.lappedSkips += oldestKept - next;  // Counted when the reader jumps
+        } else {
+            // Inactive: nothing is owed; activation moves the cursor anyway
+        }
+        consumer.next.value.store(oldestKept, std::memory_order_release);
+    }
+
+    /// @brief Smallest power of two >= capacity (at least 2)
+    static std::size_t slotCountFor(std::size_t capacity) noexcept {
+        std::size_t slots = 2U;
+        while (slots < capacity) {
+            slots <<= 1U;
+        }
+        return slots;
+    }
+
+    const uint64_t mask_;
+    std::vector<T> slots_;
+    PaddedAtomic<uint64_t> published_;                    ///< Next sequence to write
+    std::array<Consumer, MAX_CONSUMERS> consumers_{};
+    std::atomic<std::size_t> consumerCount_{0U};
+    std::mutex registrationMutex_;                        ///< Serialises addConsumer()
+};
+
+} // namespace utils
+
+#endif // B_HEXAGON_UTILS_BROADCAST_RING_HPP
@@ -10,10 +10,10 @@
  * - Console output with colors
  * - Configurable log levels
  * - Non-blocking overflow policy for real-time systems
- * - Variadic template support for easy usage
+ * - fmt format strings checked at compile time, formatted only when enabled
  * 
  * @author b_hexagon Team
- * @version 3.0 - Async logging for real-time performance
+ * @version 3.1 - fmt format strings instead of iostream concatenation
  * @date 2025
  * 
  * @note MISRA C++ 2023 compliant implementation
@@ -21,13 +21,29 @@
 
 #pragma once
 
+// Compile-time minimum level (spdlog convention): LOG_* call sites below it
+// expand to ((void)0) and their arguments are never evaluated. Build with
+// -DSPDLOG_ACTIVE_LEVEL=SPDLOG_LEVEL_WARN to keep warnings and above only.
+// The legacy ENABLE_TRACE_LOG / ENABLE_DEBUG_LOG flags lower it; default: info.
+#ifndef SPDLOG_ACTIVE_LEVEL
+    #if defined(ENABLE_TRACE_LOG)
+        #define SPDLOG_ACTIVE_LEVEL 0
+    #elif defined(ENABLE_DEBUG_LOG)
+        #define SPDLOG_ACTIVE_LEVEL 1
+    #endif
+#endif
+
 #include <spdlog/spdlog.h>
 #include <spdlog/async.h>
 #include <spdlog/sinks/stdout_color_sinks.h>
 #include <spdlog/sinks/rotating_file_sink.h>
+#include <spdlog/sinks/null_sink.h>
 #include <memory>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <limits>
 #include <string>
-#include <sstream>
 #include <iostream>
 
 namespace utils {
@@ -139,66 +155,71 @@ public:
     }
 
     /**
-     * @brief Log a debug message
-     * @tparam Args Variadic template arguments (any types with operator<<)
-     * @param args Arguments to concatenate and log
+     * @brief Check whether a level would be logged
+     * @details One relaxed atomic load; use it to guard argument computation
+     *          that is expensive on its own (formatting is already skipped)
+     */
+    [[nodiscard]] static bool shouldLog(spdlog::level::level_enum level) noexcept {
+        return spdlog::default_logger_raw()->should_log(level);
+    }
+
+    /**
+     * @brief Log a trace message
+     * @tparam Args Format arguments (any type with an fmt formatter)
+     * @param fmt Format string, checked against the arguments at compile time
+     * @param args Arguments, formatted only if the level is enabled
      * 
      * Usage:
      * @code
-     * Logger::debug("Processing track ", trackId, " with delay ", delay, " us");
+     * Logger::debug("Processing track {} with delay {} us", trackId, delay);
      * @endcode
      * 
-     * Performance: ~20ns hot path (async enqueue)
+     * Performance: level check first, then fmt into a stack buffer and an
+     * async enqueue - no iostreams, no heap for typical messages
      */
     template<typename... Args>
-    static void debug(Args&&... args) {
-        ensureInitialized();
-        spdlog::debug(concatenate(std::forward<Args>(args)...));
+    static void trace(spdlog::format_string_t<Args...> fmt, Args&&... args) {
+        spdlog::default_logger_raw()->trace(fmt, std::forward<Args>(args)...);
     }
 
     /**
-     * @brief Log an info message
+     * @brief Log a debug message
      */
     template<typename... Args>
-    static void info(Args&&... args) {
-        ensureInitialized();
-        spdlog::info(concatenate(std::forward<Args>(args)...));
+    static void debug(spdlog::format_string_t<Args...> fmt, Args&&... args) {
+        spdlog::default_logger_raw()->debug(fmt, std::forward<Args>(args)...);
     }
 
     /**
-     * @brief Log a warning message
+     * @brief Log an info message
      */
     template<typename... Args>
-    static void warn(Args&&... args) {
-        ensureInitialized();
-        spdlog::warn(concatenate(std::forward<Args>(args)...));
+    static void info(spdlog::format_string_t<Args...> fmt, Args&&... args) {
+        spdlog::default_logger_raw()->info(fmt, std::forward<Args>(args)...);
     }
 
     /**
-     * @brief Log an error message
+     * @brief Log a warning message
      */
     template<typename... Args>
-    static void error(Args&&... args) {
-        ensureInitialized();
-        spdlog::error(concatenate(std::forward<Args>(args)...));
+    static void warn(spdlog::format_string_t<Args...> fmt, Args&&... args) {
+        spdlog::default_logger_raw()->warn(fmt, std::forward<Args>(args)...);
     }
 
     /**
-     * @brief Log a critical message
+     * @brief Log an error message
      */
     template<typename... Args>
-    static void critical(Args&&... args) {
-        ensureInitialized();
-        spdlog::critical(concatenate(std::forward<Args>(args)...));
+    static void error(spdlog::format_string_t<Args...> fmt, Args&&... args) {
+        spdlog::default_logger_raw()->error(fmt, std::forward<Args>(args)...);
     }
 
     /**
-     * @brief Log a trace message
+     * @brief Log a critical message
      */
     template<typename... Args>
-    static void trace(Args&&... args) {
-        ensureInitialized();
-        spdlog::trace(concatenate(std::forward<Args>(args)...));
+    static void critical(spdlog::format_string_t<Args...> fmt, Args&&... args) {
+        spdlog::default_logger_raw()->critical(fmt, std::forward<Args>(args)...);
     }
 
     /**
@@ -210,10 +231,15 @@ public:
 
     /**
      * @brief Shutdown the logger gracefully
+     * @details spdlog::shutdown() drops the default logger, which every log
+     *          call reaches through default_logger_raw(); a discarding one is
+     *          installed in its place so late calls are no-ops, not crashes.
      * @note Call at application shutdown
      */
     static void shutdown() {
         spdlog::shutdown();
+        spdlog::set_default_logger(
+            std::make_shared<spdlog::logger>("", std::make_shared<spdlog::sinks::null_sink_mt>()));
         initialized_ = false;
     }
 
@@ -230,8 +256,7 @@ public:
     static void logLatency(const std::string& component,
                            const std::string& operation,
                            int64_t latency_us) {
-        ensureInitialized();
-        spdlog::info("[{}] {} latency: {} μs", component, operation, latency_us);
+        info("[{}] {} latency: {} μs", component, operation, latency_us);
     }
 
     /**
@@ -243,9 +268,8 @@ public:
     static void logTrackReceived(int32_t track_id,
                                   int64_t hop1_latency,
                                   int64_t hop2_latency) {
-        ensureInitialized();
-        spdlog::debug("Track {} received - Hop1: {} μs, Hop2: {} μs, Total: {} μs",
-                     track_id, hop1_latency, hop2_latency, hop1_latency + hop2_latency);
+        debug("Track {} received - Hop1: {} μs, Hop2: {} μs, Total: {} μs",
+              track_id, hop1_latency, hop2_latency, hop1_latency + hop2_latency);
     }
 
     /**
@@ -264,33 +288,49 @@ private:
     static inline bool initialized_ = false;
 
     /**
-     * @brief Ensure logger is initialized before use
+     * @brief Ensure logger is initialized before use (configuration calls only;
+     *        the log calls use whatever default logger is installed)
      */
     static void ensureInitialized() {
         if (!initialized_) {
             init();
         }
     }
+};
 
+/**
+ * @brief Per-call-site state behind the LOG_*_EVERY_N / LOG_*_EVERY_MS macros
+ * @details Every macro expansion owns one function-local static instance, so
+ *          each call site is sampled on its own. Lock-free and callable from
+ *          any thread; under contention exactly one caller wins each window.
+ */
+class LogRateLimiter final {
+public:
     /**
-     * @brief Concatenate variadic arguments into a single string
-     * @details Maintains backward compatibility with existing Logger::info(a, b, c) calls
-     *          Uses fold expression to concatenate all arguments via ostringstream
-     *          
-     * Implementation:
-     * - ostringstream for efficient string building
-     * - Fold expression: ((oss << arg), ...) processes all args left-to-right
-     * - Forward preserves value category (lvalue/rvalue)
-     * 
-     * Example:
-     * concatenate("Track ", 42, " delay: ", 123.5) → "Track 42 delay: 123.5"
+     * @brief Pass the 1st, (n+1)th, (2n+1)th ... call
      */
-    template<typename... Args>
-    static std::string concatenate(Args&&... args) {
-        std::ostringstream oss;
-        ((oss << std::forward<Args>(args)), ...);
-        return oss.str();
+    [[nodiscard]] bool everyN(uint64_t n) noexcept {
+        const uint64_t call = calls_.fetch_add(1U, std::memory_order_relaxed);
+        return (n <= 1U) || ((call % n) == 0U);
     }
+
+    /**
+     * @brief Pass the first call, then at most one call per interval
+     */
+    [[nodiscard]] bool everyMs(int64_t intervalMs) noexcept {
+        const int64_t now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+        int64_t next = nextNs_.load(std::memory_order_relaxed);
+        if (now < next) {
+            return false;
+        }
+        return nextNs_.compare_exchange_strong(next, now + (intervalMs * 1000000),
+                                               std::memory_order_relaxed);
+    }
+
+private:
+    std::atomic<uint64_t> calls_{0U};                                    ///< Calls seen (EVERY_N)
+    std::atomic<int64_t> nextNs_{std::numeric_limits<int64_t>::min()};   ///< Next allowed time (EVERY_MS)
 };
 
 } // namespace utils
@@ -298,21 +338,82 @@ private:
 // Backward compatibility - expose Logger in global namespace
 using Logger = utils::Logger;
 
-// Convenience macros for conditional compilation (zero overhead in release)
-#ifdef ENABLE_TRACE_LOG
+// Per-call-site sampling for per-message logs, e.g.
+//   LOG_INFO_EVERY_N(1000, "Track {} received", id);      // 1 in 1000 calls
+//   LOG_WARN_EVERY_MS(1000, "Queue full, dropping {}", id); // at most 1/s
+#define LOG_EVERY_N_IMPL(logMacro, n, ...) \
+    do { \
+        static utils::LogRateLimiter logRateLimiter_; \
+        if (logRateLimiter_.everyN(static_cast<uint64_t>(n))) { \
+            logMacro(__VA_ARGS__); \
+        } \
+    } while (false)
+
+#define LOG_EVERY_MS_IMPL(logMacro, ms, ...) \
+    do { \
+        static utils::LogRateLimiter logRateLimiter_; \
+        if (logRateLimiter_.everyMs(static_cast<int64_t>(ms))) { \
+            logMacro(__VA_ARGS__); \
+        } \
+    } while (false)
+
+// Level macros (compiled out below SPDLOG_ACTIVE_LEVEL)
+#if SPDLOG_ACTIVE_LEVEL <= SPDLOG_LEVEL_TRACE
     #define LOG_TRACE(...) utils::Logger::trace(__VA_ARGS__)
+    #define LOG_TRACE_EVERY_N(n, ...) LOG_EVERY_N_IMPL(LOG_TRACE, n, __VA_ARGS__)
+    #define LOG_TRACE_EVERY_MS(ms, ...) LOG_EVERY_MS_IMPL(LOG_TRACE, ms, __VA_ARGS__)
 #else
     #define LOG_TRACE(...) ((void)0)
+    #define LOG_TRACE_EVERY_N(n, ...) ((void)0)
+    #define LOG_TRACE_EVERY_MS(ms, ...) ((void)0)
 #endif
 
-#ifdef ENABLE_DEBUG_LOG
+#if SPDLOG_ACTIVE_LEVEL <= SPDLOG_LEVEL_DEBUG
     #define LOG_DEBUG(...) utils::Logger::debug(__VA_ARGS__)
+    #define LOG_DEBUG_EVERY_N(n, ...) LOG_EVERY_N_IMPL(LOG_DEBUG, n, __VA_ARGS__)
+    #define LOG_DEBUG_EVERY_MS(ms, ...) LOG_EVERY_MS_IMPL(LOG_DEBUG, ms, __VA_ARGS__)
 #else
     #define LOG_DEBUG(...) ((void)0)
+    #define LOG_DEBUG_EVERY_N(n, ...) ((void)0)
+    #define LOG_DEBUG_EVERY_MS(ms, ...) ((void)0)
 #endif
 
-// Always enabled logs
-#define LOG_INFO(...) utils::Logger::info(__VA_ARGS__)
-#define LOG_WARN(...) utils::Logger::warn(__VA_ARGS__)
-#define LOG_ERROR(...) utils::Logger::error(__VA_ARGS__)
-#define LOG_CRITICAL(...) utils::Logger::critical(__VA_ARGS__)
+#if SPDLOG_ACTIVE_LEVEL <= SPDLOG_LEVEL_INFO
+    #define LOG_INFO(...) utils::Logger::info(__VA_ARGS__)
+    #define LOG_INFO_EVERY_N(n, ...) LOG_EVERY_N_IMPL(LOG_INFO, n, __VA_ARGS__)
+    #define LOG_INFO_EVERY_MS(ms, ...) LOG_EVERY_MS_IMPL(LOG_INFO, ms, __VA_ARGS__)
+#else
+    #define LOG_INFO(...) ((void)0)
+    #define LOG_INFO_EVERY_N(n, ...) ((void)0)
+    #define LOG_INFO_EVERY_MS(ms, ...) ((void)0)
+#endif
+
+#if SPDLOG_ACTIVE_LEVEL <= SPDLOG_LEVEL_WARN
+    #define LOG_WARN(...) utils::Logger::warn(__VA_ARGS__)
+    #define LOG_WARN_EVERY_N(n, ...) LOG_EVERY_N_IMPL(LOG_WARN, n, __VA_ARGS__)
+    #define LOG_WARN_EVERY_MS(ms, ...) LOG_EVERY_MS_IMPL(LOG_WARN, ms, __VA_ARGS__)
+#else
+    #define LOG_WARN(...) ((void)0)
+    #define LOG_WARN_EVERY_N(n, ...) ((void)0)
+    #define LOG_WARN_EVERY_MS(ms, ...) ((void)0)
+#endif
+
+#if SPDLOG_ACTIVE_LEVEL <= SPDLOG_LEVEL_ERROR
+    #define LOG_ERROR(...) utils::Logger::error(__VA_ARGS__)
+    #define LOG_ERROR_EVERY_N(n, ...) LOG_EVERY_N_IMPL(LOG_ERROR, n, __VA_ARGS__)
+    #define LOG_ERROR_EVERY_MS(ms, ...) LOG_EVERY_MS_IMPL(LOG_ERROR, ms, __VA_ARGS__)
+#else
+    #define LOG_ERROR(...) ((void)0)
+    #define LOG_ERROR_EVERY_N(n, ...) ((void)0)
+    #define LOG_ERROR_EVERY_MS(ms, ...) ((void)0)
+#endif
+
+#if SPDLOG_ACTIVE_LEVEL <= SPDLOG_LEVEL_CRITICAL
+    #define LOG_CRITICAL(...) utils::Logger::critical(__VA_ARGS__)
+    #define LOG_CRITICAL_EVERY_N(n, ...) LOG_EVERY_N_IMPL(LOG_CRITICAL, n, __VA_ARGS__)
+    #define LOG_CRITICAL_EVERY_MS(ms, ...) LOG_EVERY_MS_IMPL(LOG_CRITICAL, ms, __VA_ARGS__)
+#else
+    #define LOG_CRITICAL(...) ((void)0)
+    #define LOG_CRITICAL_EVERY_N(n, ...) ((void)0)
+    #define LOG_CRITICAL_EVERY_MS(ms, ...) ((void)0)
+#endif
@@ -0,0 +1,203 @@
+/**
+ * @file MetricsPublisher.hpp
+ * @brief Periodic metrics snapshot publication over a Unix datagram socket
+ * @details A background thread snapshots MetricsRegistry once per interval,
+ *          adds per-second rates for counters and sends one frame (see
+ *          Metrics.hpp) to a well-known Unix-domain datagram path. The
+ *          hexagon_metrics CLI binds that path and displays every publisher.
+ *
+ * Design:
+ * - The hot path is untouched: the thread only reads relaxed atomics.
+ * - Sends are non-blocking; without a reader (no socket file, or the
+ *   reader's buffer is full) the snapshot is silently discarded.
+ *
+ * @author b_hexagon Team
+ * @version 1.0
+ * @date 2025
+ *
+ * @note MISRA C++ 2023 compliant implementation
+ * @note Linux/POSIX only (AF_UNIX)
+ * @see Metrics.hpp
+ */
+
+#ifndef B_HEXAGON_UTILS_METRICS_PUBLISHER_HPP
+#define B_HEXAGON_UTILS_METRICS_PUBLISHER_HPP
+
+#include "utils/Metrics.hpp"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace utils {
+
+/// @brief Path the metrics CLI listens on
+static constexpr const char* DEFAULT_METRICS_SOCKET_PATH{"/tmp/hexagon_metrics.sock"};
+
+/**
+ * @class MetricsPublisher
+ * @brief Snapshot thread for the process-wide MetricsRegistry
+ */
+class MetricsPublisher final {
+public:
+    /**
+     * @brief Constructor
+     * @param source Process name in every frame (truncated to 15 characters)
+     * @param socketPath Unix datagram path of the reader
+     * @param interval Snapshot period (> 0)
+     */
+    explicit MetricsPublisher(std::string source,
+                              std::string socketPath = DEFAULT_METRICS_SOCKET_PATH,
+                              std::chrono::milliseconds interval = std::chrono::milliseconds(1000))
+        : source_(std::move(source))
+        , socketPath_(std::move(socketPath))
+        , interval_((interval.count() > 0) ? interval : std::chrono::milliseconds(1000)) {
+    }
+
+    // Non-copyable, non-movable (owns a thread)
+    MetricsPublisher(const MetricsPublisher&) = delete;
+    MetricsPublisher& operator=(const MetricsPublisher&) = delete;
+    MetricsPublisher(MetricsPublisher&&) = delete;
+    MetricsPublisher& operator=(MetricsPublisher&&) = delete;
+
+    ~MetricsPublisher() {
+        stop();
+    }
+
+    /**
+     * @brief Open the socket and start the snapshot thread
+     * @return false if already running or the socket cannot be created
+     */
+    [[nodiscard]] bool start() {
+        if (running_.load()) {
+            return false;
+        }
+        if ((socketPath_.size() + 1U) > sizeof(sockaddr_un::sun_path)) {
+            return false;
+        }
+        fd_ = ::socket(AF_UNIX, SOCK_DGRAM | SOCK_CLOEXEC, 0);
+        if (fd_ < 0) {
+            return false;
+        }
+
+        running_.store(true);
+        thread_ = std::thread([this]() { run(); });
+        return true;
+    }
+
+    /**
+     * @brief Publish a final snapshot and stop the thread
+     */
+    void stop() {
+        if (!running_.exchange(false)) {
+            return;
+        }
+        wakeCv_.notify_all();
+        if (thread_.joinable()) {
+            thread_.join();
+        }
+        ::close(fd_);
+        fd_ = -1;
+    }
+
+    [[nodiscard]] bool isRunning() const noexcept {
+        return running_.load();
+    }
+
+    /// @brief Frames handed to the kernel
+    [[nodiscard]] uint64_t publishedCount() const noexcept {
+        return published_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Encode the current registry into one frame (also used by tests)
+     * @param elapsedSec Seconds since the previous snapshot (rate divisor)
+     * @param frame Receives the encoded frame
+     */
+    void encodeSnapshot(double elapsedSec, std::vector<uint8_t>& frame) {
+        MetricsRegistry::instance().snapshot(samples_);
+        const std::size_t count = (samples_.size() < METRICS_MAX_RECORDS) ? samples_.size() : METRICS_MAX_RECORDS;
+        if (previous_.size() < count) {
+            previous_.resize(count, 0);
+        }
+
+        MetricsFrameHeader header;
+        header.magic = METRICS_FRAME_MAGIC;
+        header.version = METRICS_FRAME_VERSION;
+        header.recordCount = static_cast<uint16_t>(count);
+        header.timestampUs = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+        copyMetricsField(header.source, sizeof(header.source), source_);
+
+        frame.resize(sizeof(MetricsFrameHeader) + (count * sizeof(MetricRecord)));
+        std::memcpy(frame.data(), &header, sizeof(header));
+
+        for (std::size_t i = 0U; i < count; ++i) {
+            const MetricSample& sample = samples_[i];
+            MetricRecord record;
+            copyMetricsField(record.name, sizeof(record.name), sample.metric->name());
+            record.kind = static_cast<uint8_t>(sample.metric->kind());
+            record.value = sample.value;
+            if ((sample.metric->kind() == MetricKind::Counter) && (elapsedSec > 0.0)) {
+                // Registry is append-only, so index i is the same metric as last time
+                record.ratePerSec = static_cast<double>(sample.value - previous_[i]) / elapsedSec;
+            }
+            previous_[i] = sample.value;
+            std::memcpy(frame.data() + sizeof(MetricsFrameHeader) + (i * sizeof(MetricRecord)),
+                        &record, sizeof(record));
+        }
+    }
+
+private:
+    void run() {
+        sockaddr_un address{};
+        address.sun_family = AF_UNIX;
+        std::memcpy(address.sun_path, socketPath_.c_str(), socketPath_.size() + 1U);
+
+        std::vector<uint8_t> frame;
+        auto last = std::chrono::steady_clock::now();
+        bool keepRunning = true;
+        while (keepRunning) {
+            {
+                std::unique_lock<std::mutex> lock(wakeMutex_);
+                static_cast<void>(wakeCv_.wait_for(lock, interval_, [this]() { return !running_.load(); }));
+            }
+            keepRunning = running_.load();  // One last snapshot after stop()
+
+            const auto now = std::chrono::steady_clock::now();
+            encodeSnapshot(std::chrono::duration<double>(now - last).count(), frame);
+            last = now;
+
+            const ssize_t sent = ::sendto(fd_, frame.data(), frame.size(), MSG_DONTWAIT,
+                                          reinterpret_cast<const sockaddr*>(&address), sizeof(address));
+            if (sent == static_cast<ssize_t>(frame.size())) {
+                published_.fetch_add(1U, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    std::string source_;                         ///< Frame source name
+    std::string socketPath_;                     ///< Reader path
+    std::chrono::milliseconds interval_;         ///< Snapshot period
+    int fd_{-1};                                 ///< Datagram socket
+    std::thread thread_;                         ///< Snapshot thread
+    std::atomic<bool> running_{false};           ///< Lifecycle flag
+    std::mutex wakeMutex_;                       ///< Paired with wakeCv_
+    std::condition_variable wakeCv_;             ///< Early wake on stop()
+    std::atomic<uint64_t> published_{0U};        ///< Frames sent
+    std::vector<MetricSample> samples_;          ///< Reused snapshot buffer
+    std::vector<int64_t> previous_;              ///< Counter values of the last snapshot
+};
+
+} // namespace utils
+
+#endif // B_HEXAGON_UTILS_METRICS_PUBLISHER_HPP
@@ -0,0 +1,227 @@
+/**
+ * @file MpscRingBuffer.hpp
+ * @brief Bounded lock-free multi-producer/single-consumer ring buffer
+ * @details Merges the results of several worker threads into one consumer.
+ *          Each slot carries a sequence number (Vyukov bounded queue): a
+ *          producer claims a position with one CAS on the shared tail, writes
+ *          the slot and publishes it through the slot's sequence, so producers
+ *          never wait for each other's copies.
+ *
+ * Design:
+ * - Storage is pre-allocated once (power-of-two slots >= capacity), so
+ *   push/pop never allocate.
+ * - Items of one producer are delivered in the order that producer pushed
+ *   them.
+ * - A full ring rejects the new item (producers cannot evict a slot another
+ *   producer may still be writing); rejections are counted.
+ * - Waiting is delegated to a utils::WaitStrategy.
+ *
+ * @author b_hexagon Team
+ * @version 1.0
+ * @date 2025
+ *
+ * @note MISRA C++ 2023 compliant implementation
+ * @note Any number of producer threads, exactly one consumer thread
+ * @see SpscRingBuffer.hpp
+ */
+
+#ifndef B_HEXAGON_UTILS_MPSC_RING_BUFFER_HPP
+#define B_HEXAGON_UTILS_MPSC_RING_BUFFER_HPP
+
+#include "utils/SpscRingBuffer.hpp"
+#include "utils/WaitStrategy.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace utils {
+
+/**
+ * @class MpscRingBuffer
+ * @brief Bounded MPSC queue with reject-newest overflow policy
+ * @tparam T Trivially copyable element type
+ */
+template <typename T>
+class MpscRingBuffer {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "MpscRingBuffer elements must be trivially copyable");
+
+public:
+    /**
+     * @brief Constructor
+     * @param capacity Minimum number of queued items (> 0, rounded up to a power of two)
+     * @param waitStrategy Consumer wait policy (blocking if null)
+     * @throws std::invalid_argument if capacity is zero
+     */
+    explicit MpscRingBuffer(std::size_t capacity,
+                            std::shared_ptr<WaitStrategy> waitStrategy = nullptr)
+        : mask_(slotCountFor(capacity) - 1U)
+        , cells_(slotCountFor(capacity))
+        , waitStrategy_(waitStrategy ? std::move(waitStrategy)
+                                     : std::make_shared<BlockingWaitStrategy>()) {
+        if (capacity == 0U) {
+            throw std::invalid_argument("MpscRingBuffer capacity must be greater than zero");
+        }
+        for (std::size_t i = 0U; i < cells_.size(); ++i) {
+            cells_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    // Non-copyable, non-movable (shared between threads)
+    MpscRingBuffer(const MpscRingBuffer&) = delete;
+    MpscRingBuffer& operator=(const MpscRingBuffer&) = delete;
+    MpscRingBuffer(MpscRingBuffer&&) = delete;
+    MpscRingBuffer& operator=(MpscRingBuffer&&) = delete;
+    ~MpscRingBuffer() = default;
+
+    // ==================== Producer Side (any thread) ====================
+
+    /**
+     * @brief Publish an item
+     * @param item Item to copy into the ring
+     * @return false if the ring was full and the item was rejected
+     */
+    bool push(const T& item) noexcept {
+        uint64_t position = tail_.value.load(std::memory_order_relaxed);
+        Cell* cell = nullptr;
+        for (;;) {
+            cell = &cells_[static_cast<std::size_t>(position & mask_)];
+            const uint64_t sequence = cell->sequence.load(std::memory_order_acquire);
+            const int64_t lag = static_cast<int64_t>(sequence - position);
+            if (lag == 0) {
+                if (tail_.value.compare_exchange_weak(position, position + 1U, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (lag < 0) {
+                // Slot still holds an item one lap behind: full
+                rejectCount_.value.fetch_add(1U, std::memory_order_relaxed);
+                return false;
+            } else {
+                position = tail_.value.load(std::memory_order_relaxed);
+            }
+        }
+
+        cell->item = item;
+        cell->sequence.store(position + 1U, std::memory_order_release);
+        waitStrategy_->signal();
+        return true;
+    }
+
+    // ==================== Consumer Side ====================
+
+    /**
+     * @brief Pop the next published item without waiting
+     * @param out Destination for the popped item
+     * @return true if an item was popped
+     */
+    bool tryPop(T& out) noexcept {
+        const uint64_t position = head_.value.load(std::memory_order_relaxed);
+        Cell& cell = cells_[static_cast<std::size_t>(position & mask_)];
+        if (cell.sequence.load(std::memory_order_acquire) != (position + 1U)) {
+            return false;
+        }
+        out = cell.item;
+        cell.sequence.store(position + mask_ + 1U, std::memory_order_release);
+        head_.value.store(position + 1U, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Pop the next item, waiting up to timeout via the wait strategy
+     * @param out Destination for the popped item
+     * @param timeout Maximum wait
+     * @return true if an item was popped
+     */
+    bool waitPop(T& out, std::chrono::microseconds timeout) {
+        if (tryPop(out)) {
+            return true;
+        }
+        if (!waitStrategy_->waitFor([this]() { return !empty() || woken_.load(std::memory_order_acquire); },
+                                    timeout)) {
+            return false;
+        }
+        return tryPop(out);
+    }
+
+    /**
+     * @brief Wake a waiting consumer (e.g. on shutdown)
+     * @details The next waitFor() returns immediately until resetWake() is called.
+     */
+    void wakeConsumer() noexcept {
+        woken_.store(true, std::memory_order_release);
+        waitStrategy_->signalAll();
+    }
+
+    /**
+     * @brief Re-arm waiting after wakeConsumer() (e.g. on restart)
+     */
+    void resetWake() noexcept {
+        woken_.store(false, std::memory_order_release);
+    }
+
+    // ==================== Observers (any thread, approximate) ====================
+
+    /// @brief Claimed items not yet consumed (includes items still being written)
+    [[nodiscard]] std::size_t size() const noexcept {
+        const uint64_t head = head_.value.load(std::memory_order_acquire);
+        const uint64_t tail = tail_.value.load(std::memory_order_acquire);
+        return (tail > head) ? static_cast<std::size_t>(tail - head) : 0U;
+    }
+
+    [[nodiscard]] bool empty() const noexcept {
+        return size() == 0U;
+    }
+
+    [[nodiscard]] std::size_t capacity() const noexcept {
+        return cells_.size();
+    }
+
+    /// @brief Total number of items rejected because the ring was full
+    [[nodiscard]] uint64_t rejectedCount() const noexcept {
+        return rejectCount_.value.load(std::memory_order_relaxed);
+    }
+
+private:
+    /**
+     * @brief Slot with its publication sequence
+     */
+    struct Cell {
+        std::atomic<uint64_t> sequence{0U};
+        T item{};
+    };
+
+    /**
+     * @brief Index padded to its own cache line
+     */
+    template <typename V>
+    struct alignas(CACHE_LINE_SIZE) PaddedAtomic {
+        std::atomic<V> value{0U};
+    };
+
+    /// @brief Smallest power of two >= capacity (at least 2)
+    static std::size_t slotCountFor(std::size_t capacity) noexcept {
+        std::size_t slots = 2U;
+        while (slots < capacity) {
+            slots <<= 1U;
+        }
+        return slots;
+    }
+
+    const uint64_t mask_;
+    std::vector<Cell> cells_;
+    std::shared_ptr<WaitStrategy> waitStrategy_;
+
+    PaddedAtomic<uint64_t> tail_;          ///< Next position to claim (producers)
+    PaddedAtomic<uint64_t> head_;          ///< Next position to consume
+    PaddedAtomic<uint64_t> rejectCount_;
+    std::atomic<bool> woken_{false};
+};
+
+} // namespace utils
+
+#endif // B_HEXAGON_UTILS_MPSC_RING_BUFFER_HPP
@@ -0,0 +1,205 @@
+/**
+ * @file StageTraceAggregator.hpp
+ * @brief Per-stage latency breakdown built from StageTracer events
+ * @details Correlates the stage events of each message and records the time
+ *          spent between consecutive stages into one HdrHistogram per segment:
+ *
+ * @code
+ * Receive --Ingress--> Enqueue --QueueWait--> Dequeue --Compute--> ComputeEnd --Egress--> Send
+ * @endcode
+ *
+ *          Egress covers the outgoing adapter queue and the socket write.
+ *          A message is complete once all five stages were seen. Messages that
+ *          never complete (dropped by a queue) are abandoned when the pending
+ *          table reaches its bound.
+ *
+ * @author b_hexagon Team
+ * @version 1.0
+ * @date 2025
+ *
+ * @note MISRA C++ 2023 compliant implementation
+ * @note Not thread-safe: owned by the single collector thread
+ * @see StageTracer.hpp
+ */
+
+#ifndef B_HEXAGON_UTILS_STAGE_TRACE_AGGREGATOR_HPP
+#define B_HEXAGON_UTILS_STAGE_TRACE_AGGREGATOR_HPP
+
+#include "utils/HdrHistogram.hpp"
+#include "utils/StageTracer.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace utils {
+
+/**
+ * @brief Time between two stages (histograms hold nanoseconds)
+ */
+enum class TraceSegment : uint8_t {
+    Ingress = 0U,    ///< Receive -> Enqueue (decode, validation)
+    QueueWait = 1U,  ///< Enqueue -> Dequeue (domain event queue)
+    Compute = 2U,    ///< Dequeue -> ComputeEnd (domain logic)
+    Egress = 3U,     ///< ComputeEnd -> Send (outgoing queue and socket)
+    Total = 4U       ///< Receive -> Send
+};
+
+inline constexpr std::size_t TRACE_SEGMENT_COUNT{5U};
+
+/**
+ * @class StageTraceAggregator
+ * @brief Matches stage events per message and histograms the segments
+ */
+class StageTraceAggregator final {
+public:
+    /// @brief Default bound on messages awaiting their remaining stages
+    static constexpr std::size_t DEFAULT_MAX_PENDING{4096U};
+
+    explicit StageTraceAggregator(std::size_t maxPending = DEFAULT_MAX_PENDING)
+        : maxPending_(maxPending) {
+        pending_.reserve(maxPending_);
+    }
+
+    // Non-copyable, non-movable (histograms are read in place)
+    StageTraceAggregator(const StageTraceAggregator&) = delete;
+    StageTraceAggregator& operator=(const StageTraceAggregator&) = delete;
+    StageTraceAggregator(StageTraceAggregator&&) = delete;
+    StageTraceAggregator& operator=(StageTraceAggregator&&) = delete;
+    ~StageTraceAggregator() = default;
+
+    /**
+     * @brief Drain @p tracer and add its events
+     * @return Events consumed
+     */
+    std::size_t collect(StageTracer& tracer) {
+        events_.clear();
+        const std::size_t drained = tracer.drain(events_);
+        for (const TraceEvent& event : events_) {
+            add(event);
+        }
+        return drained;
+    }
+
+    /**
+     * @brief Add one stage event
+     * @details Ring drain order is arbitrary, so stages are matched by set
+     *          membership rather than arrival order.
+     */
+    void add(const TraceEvent& event) {
+        if (event.stage >= TRACE_STAGE_COUNT) {
+            return;
+        }
+
+        const Key key{event.trackId, event.messageKey};
+        auto found = pending_.find(key);
+        if (found == pending_.end()) {
+            if (pending_.size() >= maxPending_) {
+                abandoned_ += pending_.size();
+                pending_.clear();
+            }
+            found = pending_.emplace(key, Pending{}).first;
+        }
+
+        Pending& pending = found->second;
+        pending.timestampsNs[event.stage] = event.timestampNs;
+        pending.seen = static_cast<uint8_t>(pending.seen | (1U << event.stage));
+        if (pending.seen == ALL_STAGES) {
+            complete(pending);
+            pending_.erase(found);
+        }
+    }
+
+    [[nodiscard]] const HdrHistogram& segment(TraceSegment segment) const noexcept {
+        return segments_[static_cast<std::size_t>(segment)];
+    }
+
+    [[nodiscard]] static const char* segmentName(TraceSegment segment) noexcept {
+        switch (segment) {
+            case TraceSegment::Ingress:   return "ingress";
+            case TraceSegment::QueueWait: return "queue-wait";
+            case TraceSegment::Compute:   return "compute";
+            case TraceSegment::Egress:    return "egress";
+            case TraceSegment::Total:     return "total";
+            default:                      return "unknown";
+        }
+    }
+
+    /// @brief Messages with all stages seen since the last reset()
+    [[nodiscard]] uint64_t completedCount() const noexcept {
+        return completed_;
+    }
+
+    /// @brief Messages given up on (pending table full)
+    [[nodiscard]] uint64_t abandonedCount() const noexcept {
+        return abandoned_;
+    }
+
+    [[nodiscard]] std::size_t pendingCount() const noexcept {
+        return pending_.size();
+    }
+
+    /**
+     * @brief Start a new reporting interval (pending messages are kept)
+     */
+    void reset() noexcept {
+        for (HdrHistogram& histogram : segments_) {
+            histogram.reset();
+        }
+        completed_ = 0U;
+        abandoned_ = 0U;
+    }
+
+private:
+    static constexpr uint8_t ALL_STAGES{static_cast<uint8_t>((1U << TRACE_STAGE_COUNT) - 1U)};
+
+    struct Key {
+        int32_t trackId;
+        int64_t messageKey;
+
+        bool operator==(const Key& other) const noexcept {
+            return (trackId == other.trackId) && (messageKey == other.messageKey);
+        }
+    };
+
+    struct KeyHash {
+        std::size_t operator()(const Key& key) const noexcept {
+            const uint64_t mixed = static_cast<uint64_t>(key.messageKey) ^
+                                   (static_cast<uint64_t>(static_cast<uint32_t>(key.trackId)) * 0x9E3779B97F4A7C15ULL);
+            return static_cast<std::size_t>(mixed ^ (mixed >> 29U));
+        }
+    };
+
+    struct Pending {
+        std::array<int64_t, TRACE_STAGE_COUNT> timestampsNs{};
+        uint8_t seen{0U};
+    };
+
+    void complete(const Pending& pending) noexcept {
+        const auto at = [&pending](TraceStage stage) {
+            return pending.timestampsNs[static_cast<std::size_t>(stage)];
+        };
+        record(TraceSegment::Ingress, at(TraceStage::Enqueue) - at(TraceStage::Receive));
+        record(TraceSegment::QueueWait, at(TraceStage::Dequeue) - at(TraceStage::Enqueue));
+        record(TraceSegment::Compute, at(TraceStage::ComputeEnd) - at(TraceStage::Dequeue));
+        record(TraceSegment::Egress, at(TraceStage::Send) - at(TraceStage::ComputeEnd));
+        record(TraceSegment::Total, at(TraceStage::Send) - at(TraceStage::Receive));
+        ++completed_;
+    }
+
+    void record(TraceSegment segment, int64_t durationNs) noexcept {
+        segments_[static_cast<std::size_t>(segment)].record(durationNs);
+    }
+
+    std::size_t maxPending_;                                  ///< Pending table bound
+    std::unordered_map<Key, Pending, KeyHash> pending_;       ///< Messages missing stages
+    std::array<HdrHistogram, TRACE_SEGMENT_COUNT> segments_;  ///< Segment durations (ns)
+    std::vector<TraceEvent> events_;                          ///< Reused drain buffer
+    uint64_t completed_{0U};                                  ///< Completed messages
+    uint64_t abandoned_{0U};                                  ///< Dropped pending messages
+};
+
+} // namespace utils
+
+#endif // B_HEXAGON_UTILS_STAGE_TRACE_AGGREGATOR_HPP
@@ -0,0 +1,249 @@
+/**
+ * @file StageTracer.hpp
+ * @brief Intra-process stage timestamps for per-message latency breakdowns
+ * @details The hop timestamps in the models only measure wire-to-wire time.
+ *          StageTracer records monotonic timestamps at each stage inside the
+ *          process (receive, enqueue, dequeue, compute end, socket send) so
+ *          queueing can be told apart from computation and the send path.
+ *
+ * Design:
+ * - Every recording thread owns one TraceRing (single writer); the ring is
+ *   created and registered on the thread's first record(), the only step
+ *   that allocates or locks.
+ * - One collector thread drains all rings (single reader per ring).
+ * - A full ring drops the new event and counts it; the pipeline never waits.
+ * - Disabled (default): record() is one relaxed atomic load.
+ *
+ * @author b_hexagon Team
+ * @version 1.0
+ * @date 2025
+ *
+ * @note MISRA C++ 2023 compliant implementation
+ * @see StageTraceAggregator.hpp
+ */
+
+#ifndef B_HEXAGON_UTILS_STAGE_TRACER_HPP
+#define B_HEXAGON_UTILS_STAGE_TRACER_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace utils {
+
+/**
+ * @brief Pipeline stages traced inside one hexagon, in pipeline order
+ */
+enum class TraceStage : uint8_t {
+    Receive = 0U,     ///< Message taken off the incoming socket
+    Enqueue = 1U,     ///< Pushed into the domain event queue
+    Dequeue = 2U,     ///< Popped by the domain thread
+    ComputeEnd = 3U,  ///< Domain result ready for the outgoing port
+    Send = 4U         ///< Written to the outgoing socket
+};
+
+inline constexpr std::size_t TRACE_STAGE_COUNT{5U};
+
+/**
+ * @struct TraceEvent
+ * @brief One stage timestamp of one message
+ * @details Stages of a message are correlated by (trackId, messageKey); the
+ *          model's updateTime is carried unchanged through every stage.
+ */
+struct TraceEvent {
+    int64_t messageKey{0};   ///< Correlation key (model updateTime)
+    int64_t timestampNs{0};  ///< steady_clock nanoseconds
+    int32_t trackId{0};      ///< Track of the message
+    uint8_t stage{0U};       ///< TraceStage
+};
+
+/**
+ * @class TraceRing
+ * @brief Fixed-capacity single-writer/single-reader event ring
+ */
+class TraceRing final {
+public:
+    /**
+     * @brief Constructor
+     * @param capacity Rounded up to a power of two
+     */
+    explicit TraceRing(std::size_t capacity)
+        : slots_(slotCountFor(capacity))
+        , mask_(slots_.size() - 1U) {
+    }
+
+    // Non-copyable, non-movable (shared between writer and collector)
+    TraceRing(const TraceRing&) = delete;
+    TraceRing& operator=(const TraceRing&) = delete;
+    TraceRing(TraceRing&&) = delete;
+    TraceRing& operator=(TraceRing&&) = delete;
+    ~TraceRing() = default;
+
+    /**
+     * @brief Append one event (owning thread only)
+     * @return false if the ring is full and the event was dropped
+     */
+    bool push(const TraceEvent& event) noexcept {
+        const uint64_t tail = tail_.load(std::memory_order_relaxed);
+        if ((tail - head_.load(std::memory_order_acquire)) > mask_) {
+            dropped_.store(dropped_.load(std::memory_order_relaxed) + 1U, std::memory_order_relaxed);
+            return false;
+        }
+        slots_[static_cast<std::size_t>(tail) & mask_] = event;
+        tail_.store(tail + 1U, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Move all published events to @p out (collector thread only)
+     * @return Events appended
+     */
+    std::size_t drain(std::vector<TraceEvent>& out) {
+        const uint64_t head = head_.load(std::memory_order_relaxed);
+        const uint64_t tail = tail_.load(std::memory_order_acquire);
+        for (uint64_t index = head; index != tail; ++index) {
+            out.push_back(slots_[static_cast<std::size_t>(index) & mask_]);
+        }
+        head_.store(tail, std::memory_order_release);
+        return static_cast<std::size_t>(tail - head);
+    }
+
+    [[nodiscard]] uint64_t droppedCount() const noexcept {
+        return dropped_.load(std::memory_order_relaxed);
+    }
+
+private:
+    static std::size_t slotCountFor(std::size_t capacity) noexcept {
+        std::size_t slots = 1U;
+        while (slots < capacity) {
+            slots <<= 1U;
+        }
+        return slots;
+    }
+
+    std::vector<TraceEvent> slots_;                ///< Event storage
+    std::size_t mask_;                             ///< slots_.size() - 1
+    alignas(64) std::atomic<uint64_t> head_{0U};   ///< Next event to drain
+    alignas(64) std::atomic<uint64_t> tail_{0U};   ///< Next free slot
+    std::atomic<uint64_t> dropped_{0U};            ///< Events lost to a full ring
+};
+
+/**
+ * @class StageTracer
+ * @brief Process-wide registry of per-thread trace rings
+ */
+class StageTracer final {
+public:
+    /// @brief Events buffered per thread between two drains
+    static constexpr std::size_t RING_CAPACITY{8192U};
+
+    /**
+     * @brief Process-wide tracer
+     */
+    static StageTracer& instance() {
+        static StageTracer tracer;
+        return tracer;
+    }
+
+    // Non-copyable, non-movable (singleton)
+    StageTracer(const StageTracer&) = delete;
+    StageTracer& operator=(const StageTracer&) = delete;
+    StageTracer(StageTracer&&) = delete;
+    StageTracer& operator=(StageTracer&&) = delete;
+
+    void setEnabled(bool enabled) noexcept {
+        enabled_.store(enabled, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] bool isEnabled() const noexcept {
+        return enabled_.load(std::memory_order_relaxed);
+    }
+
+    /// @brief Monotonic timestamp used for all stages
+    [[nodiscard]] static int64_t nowNs() noexcept {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    /**
+     * @brief Record a stage of one message at the current time
+     */
+    void record(TraceStage stage, int32_t trackId, int64_t messageKey) noexcept {
+        if (isEnabled()) {
+            push(stage, trackId, messageKey, nowNs());
+        }
+    }
+
+    /**
+     * @brief Record a stage with a timestamp taken earlier (e.g. before decoding)
+     */
+    void record(TraceStage stage, int32_t trackId, int64_t messageKey, int64_t timestampNs) noexcept {
+        if (isEnabled()) {
+            push(stage, trackId, messageKey, timestampNs);
+        }
+    }
+
+    /**
+     * @brief Move the events of every thread to @p out (one collector thread)
+     * @return Events appended
+     */
+    std::size_t drain(std::vector<TraceEvent>& out) {
+        std::lock_guard<std::mutex> lock(registryMutex_);
+        std::size_t drained = 0U;
+        for (const auto& ring : rings_) {
+            drained += ring->drain(out);
+        }
+        return drained;
+    }
+
+    /// @brief Events lost to full rings or failed ring registration
+    [[nodiscard]] uint64_t droppedCount() const {
+        std::lock_guard<std::mutex> lock(registryMutex_);
+        uint64_t dropped = unregistered_;
+        for (const auto& ring : rings_) {
+            dropped += ring->droppedCount();
+        }
+        return dropped;
+    }
+
+private:
+    StageTracer() = default;
+    ~StageTracer() = default;
+
+    void push(TraceStage stage, int32_t trackId, int64_t messageKey, int64_t timestampNs) noexcept {
+        TraceRing* ring = localRing();
+        if (ring != nullptr) {
+            static_cast<void>(ring->push(TraceEvent{messageKey, timestampNs, trackId,
+                                                    static_cast<uint8_t>(stage)}));
+        }
+    }
+
+    /// @brief Ring of the calling thread, registered on first use
+    TraceRing* localRing() noexcept {
+        thread_local TraceRing* ring = nullptr;
+        if (ring == nullptr) {
+            std::lock_guard<std::mutex> lock(registryMutex_);
+            try {
+                // Rings stay registered after their thread exits so late events are drained
+                rings_.push_back(std::make_unique<TraceRing>(RING_CAPACITY));
+                ring = rings_.back().get();
+            } catch (...) {
+                ++unregistered_;
+            }
+        }
+        return ring;
+    }
+
+    std::atomic<bool> enabled_{false};                 ///< Tracing switch
+    mutable std::mutex registryMutex_;                 ///< Guards rings_ (registration and drain)
+    std::vector<std::unique_ptr<TraceRing>> rings_;    ///< One ring per recording thread
+    uint64_t unregistered_{0U};                        ///< Events lost to allocation failure
+};
+
+} // namespace utils
+
+#endif // B_HEXAGON_UTILS_STAGE_TRACER_HPP
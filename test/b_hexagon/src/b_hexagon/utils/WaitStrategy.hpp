@@ -0,0 +1,297 @@
+/**
+ * @file WaitStrategy.hpp
+ * @brief Consumer wait strategies for lock-free stage queues
+ * @details Decouples how a consumer thread waits for data from the queue
+ *          itself. Producers call signal() after publishing; the blocking
+ *          strategy only pays for a notify when a consumer is actually parked.
+ *
+ * Available strategies:
+ * - BlockingWaitStrategy : condition variable park (lowest CPU, futex wake-up)
+ * - YieldingWaitStrategy : spin briefly, then std::this_thread::yield()
+ * - SpinThenParkWaitStrategy : spin for a time budget, then park like blocking
+ * - BusySpinWaitStrategy : pure spin with CPU pause (isolated cores only)
+ *
+ * makeWaitStrategy() builds one from a WaitStrategyKind so each worker thread
+ * can be configured at startup.
+ *
+ * @author b_hexagon Team
+ * @version 1.0
+ * @date 2025
+ *
+ * @note MISRA C++ 2023 compliant implementation
+ * @see SpscRingBuffer.hpp
+ */
+
+#ifndef B_HEXAGON_UTILS_WAIT_STRATEGY_HPP
+#define B_HEXAGON_UTILS_WAIT_STRATEGY_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace utils {
+
+/**
+ * @brief Emit a CPU relax hint inside spin loops
+ */
+inline void cpuRelax() noexcept {
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__)
+    asm volatile("yield" ::: "memory");
+#endif
+}
+
+/**
+ * @class WaitStrategy
+ * @brief Abstract consumer wait policy
+ */
+class WaitStrategy {
+public:
+    virtual ~WaitStrategy() = default;
+
+    /**
+     * @brief Wait until ready() is true or the timeout expires
+     * @param ready Condition evaluated by the consumer (must be cheap, non-blocking)
+     * @param timeout Maximum time to wait
+     * @return Value of ready() when the wait ended
+     */
+    virtual bool waitFor(const std::function<bool()>& ready, std::chrono::microseconds timeout) = 0;
+
+    /**
+     * @brief Notify a waiting consumer that data was published
+     * @note Called by the producer on every publish - must be cheap
+     */
+    virtual void signal() noexcept = 0;
+
+    /**
+     * @brief Wake every waiter unconditionally (used on shutdown)
+     */
+    virtual void signalAll() noexcept = 0;
+
+    /**
+     * @brief Strategy name for logging
+     */
+    [[nodiscard]] virtual const char* name() const noexcept = 0;
+
+protected:
+    WaitStrategy() = default;
+    WaitStrategy(const WaitStrategy&) = default;
+    WaitStrategy(WaitStrategy&&) = default;
+    WaitStrategy& operator=(const WaitStrategy&) = default;
+    WaitStrategy& operator=(WaitStrategy&&) = default;
+};
+
+/**
+ * @class BlockingWaitStrategy
+ * @brief Parks the consumer on a condition variable
+ * @details The producer only takes the mutex when a consumer is parked, so an
+ *          uncontended publish costs a fence and one relaxed load.
+ */
+class BlockingWaitStrategy final : public WaitStrategy {
+public:
+    bool waitFor(const std::function<bool()>& ready, std::chrono::microseconds timeout) override {
+        if (ready()) {
+            return true;
+        }
+        std::unique_lock<std::mutex> lock(mutex_);
+        waiters_.fetch_add(1U, std::memory_order_seq_cst);
+        const bool result = cv_.wait_for(lock, timeout, ready);
+        waiters_.fetch_sub(1U, std::memory_order_relaxed);
+        return result;
+    }
+
+    void signal() noexcept override {
+        // Pairs with the seq_cst increment in waitFor(): either the consumer sees
+        // the published data, or we see the waiter and wake it.
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (waiters_.load(std::memory_order_relaxed) != 0U) {
+            { std::lock_guard<std::mutex> lock(mutex_); }
+            cv_.notify_one();
+        }
+    }
+
+    void signalAll() noexcept override {
+        { std::lock_guard<std::mutex> lock(mutex_); }
+        cv_.notify_all();
+    }
+
+    [[nodiscard]] const char* name() const noexcept override {
+        return "blocking";
+    }
+
+private:
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::atomic<uint32_t> waiters_{0U};
+};
+
+/**
+ * @class YieldingWaitStrategy
+ * @brief Spins for a short burst, then yields the CPU between checks
+ */
+class YieldingWaitStrategy final : public WaitStrategy {
+public:
+    static constexpr uint32_t SPIN_TRIES = 100U;
+
+    bool waitFor(const std::function<bool()>& ready, std::chrono::microseconds timeout) override {
+        const auto deadline = std::chrono::steady_clock::now() + timeout;
+        uint32_t tries = 0U;
+        while (!ready()) {
+            if (tries < SPIN_TRIES) {
+                ++tries;
+                cpuRelax();
+                continue;
+            }
+            if (std::chrono::steady_clock::now() >= deadline) {
+                return ready();
+            }
+            std::this_thread::yield();
+        }
+        return true;
+    }
+
+    void signal() noexcept override {}
+    void signalAll() noexcept override {}
+
+    [[nodiscard]] const char* name() const noexcept override {
+        return "yielding";
+    }
+};
+
+/**
+ * @class SpinThenParkWaitStrategy
+ * @brief Spins for up to a time budget, then parks on a condition variable
+ * @details Data arriving within the budget is picked up without a futex
+ *          wake-up; an idle consumer still releases its core. The producer
+ *          only pays for a notify once the consumer has parked.
+ */
+class SpinThenParkWaitStrategy final : public WaitStrategy {
+public:
+    static constexpr std::chrono::microseconds DEFAULT_SPIN_BUDGET{50};
+    static constexpr uint32_t CLOCK_CHECK_INTERVAL = 64U;
+
+    /**
+     * @param spinBudget Time spent spinning before parking (0 parks at once)
+     */
+    explicit SpinThenParkWaitStrategy(std::chrono::microseconds spinBudget = DEFAULT_SPIN_BUDGET) noexcept
+        : spinBudget_((spinBudget.count() > 0) ? spinBudget : std::chrono::microseconds(0)) {
+    }
+
+    bool waitFor(const std::function<bool()>& ready, std::chrono::microseconds timeout) override {
+        if (spinBudget_.count() == 0) {
+            return park_.waitFor(ready, timeout);
+        }
+        const auto start = std::chrono::steady_clock::now();
+        const auto deadline = start + timeout;
+        const auto spinEnd = start + std::min(spinBudget_, timeout);
+        uint32_t spins = 0U;
+        while (!ready()) {
+            cpuRelax();
+            if ((++spins % CLOCK_CHECK_INTERVAL) != 0U) {
+                continue;
+            }
+            const auto now = std::chrono::steady_clock::now();
+            if (now >= spinEnd) {
+                if (now >= deadline) {
+                    return ready();
+                }
+                return park_.waitFor(ready, std::chrono::duration_cast<std::chrono::microseconds>(deadline - now));
+            }
+        }
+        return true;
+    }
+
+    void signal() noexcept override {
+        park_.signal();
+    }
+
+    void signalAll() noexcept override {
+        park_.signalAll();
+    }
+
+    [[nodiscard]] const char* name() const noexcept override {
+        return "spin-then-park";
+    }
+
+    [[nodiscard]] std::chrono::microseconds spinBudget() const noexcept {
+        return spinBudget_;
+    }
+
+private:
+    std::chrono::microseconds spinBudget_;
+    BlockingWaitStrategy park_;
+};
+
+/**
+ * @class BusySpinWaitStrategy
+ * @brief Never leaves the CPU; lowest wake-up latency
+ * @warning Only for threads pinned to an isolated core
+ */
+class BusySpinWaitStrategy final : public WaitStrategy {
+public:
+    static constexpr uint32_t CLOCK_CHECK_INTERVAL = 1024U;
+
+    bool waitFor(const std::function<bool()>& ready, std::chrono::microseconds timeout) override {
+        const auto deadline = std::chrono::steady_clock::now() + timeout;
+        uint32_t spins = 0U;
+        while (!ready()) {
+            cpuRelax();
+            if ((++spins % CLOCK_CHECK_INTERVAL) == 0U) {
+                if (std::chrono::steady_clock::now() >= deadline) {
+                    return ready();
+                }
+            }
+        }
+        return true;
+    }
+
+    void signal() noexcept override {}
+    void signalAll() noexcept override {}
+
+    [[nodiscard]] const char* name() const noexcept override {
+        return "busy-spin";
+    }
+};
+
+/**
+ * @brief Selectable wait strategies (startup configuration)
+ */
+enum class WaitStrategyKind : uint8_t {
+    Blocking = 0,
+    Yielding = 1,
+    SpinThenPark = 2,
+    BusySpin = 3
+};
+
+/**
+ * @brief Create a wait strategy
+ * @param kind Strategy to create
+ * @param spinBudget Spin time before parking (SpinThenPark only)
+ * @return New strategy, never null
+ */
+inline std::shared_ptr<WaitStrategy> makeWaitStrategy(
+    WaitStrategyKind kind,
+    std::chrono::microseconds spinBudget = SpinThenParkWaitStrategy::DEFAULT_SPIN_BUDGET) {
+    switch (kind) {
+        case WaitStrategyKind::Yielding:
+            return std::make_shared<YieldingWaitStrategy>();
+        case WaitStrategyKind::SpinThenPark:
+            return std::make_shared<SpinThenParkWaitStrategy>(spinBudget);
+        case WaitStrategyKind::BusySpin:
+            return std::make_shared<BusySpinWaitStrategy>();
+        case WaitStrategyKind::Blocking:
+        default:
+            return std::make_shared<BlockingWaitStrategy>();
+    }
+}
+
+} // namespace utils
+
+#endif // B_HEXAGON_UTILS_WAIT_STRATEGY_HPP
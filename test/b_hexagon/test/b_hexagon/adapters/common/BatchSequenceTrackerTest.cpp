@@ -0,0 +1,71 @@
+/**
+ * @file BatchSequenceTrackerTest.cpp
+ * @brief Unit tests for batch frame gap, reorder and restart detection
+ */
+
+#include <gtest/gtest.h>
+#include "adapters/common/BatchFrame.hpp"
+#include <cstdint>
+
+using namespace adapters;
+
+TEST(BatchSequenceTrackerTest, Observe_InOrderFramesLoseNothing) {
+    BatchSequenceTracker tracker;
+    EXPECT_EQ(tracker.observe(10U), BatchSequenceResult::First);
+    EXPECT_EQ(tracker.observe(11U), BatchSequenceResult::InOrder);
+    EXPECT_EQ(tracker.observe(12U), BatchSequenceResult::InOrder);
+    EXPECT_EQ(tracker.expected(), 13U);
+    EXPECT_EQ(tracker.lostCount(), 0U);
+}
+
+TEST(BatchSequenceTrackerTest, Observe_ForwardGapCountsMissingFrames) {
+    BatchSequenceTracker tracker;
+    static_cast<void>(tracker.observe(1U));
+    EXPECT_EQ(tracker.observe(5U), BatchSequenceResult::Gap);
+    EXPECT_EQ(tracker.lastGap(), 3U);
+    EXPECT_EQ(tracker.observe(6U), BatchSequenceResult::InOrder);
+    EXPECT_EQ(tracker.lostCount(), 3U);
+}
+
+TEST(BatchSequenceTrackerTest, Observe_WrapAroundIsAnOrdinaryStep) {
+    BatchSequenceTracker tracker;
+    static_cast<void>(tracker.observe(0xFFFFFFFEU));
+    EXPECT_EQ(tracker.observe(0xFFFFFFFFU), BatchSequenceResult::InOrder);
+    EXPECT_EQ(tracker.observe(0U), BatchSequenceResult::InOrder);
+    EXPECT_EQ(tracker.observe(2U), BatchSequenceResult::Gap);
+    EXPECT_EQ(tracker.lostCount(), 1U);
+}
+
+TEST(BatchSequenceTrackerTest, Observe_PublisherRestartResynchronisesWithoutLoss) {
+    BatchSequenceTracker tracker;
+    for (uint32_t sequence = 0U; sequence <= 100000U; ++sequence) {
+        static_cast<void>(tracker.observe(sequence));
+    }
+
+    // Restart: the publisher counts from 0 again
+    EXPECT_EQ(tracker.observe(0U), BatchSequenceResult::Reset);
+    EXPECT_EQ(tracker.observe(1U), BatchSequenceResult::InOrder);
+    EXPECT_EQ(tracker.observe(2U), BatchSequenceResult::InOrder);
+    EXPECT_EQ(tracker.lostCount(), 0U);
+    EXPECT_EQ(tracker.resetCount(), 1U);
+    EXPECT_EQ(tracker.reorderedCount(), 0U);
+}
+
+TEST(BatchSequenceTrackerTest, Observe_ImplausibleForwardJumpResynchronises) {
+    BatchSequenceTracker tracker;
+    static_cast<void>(tracker.observe(5U));
+    EXPECT_EQ(tracker.observe(5U + 1U + static_cast<uint32_t>(BatchSequenceTracker::MAX_GAP) + 1U),
+              BatchSequenceResult::Reset);
+    EXPECT_EQ(tracker.lostCount(), 0U);
+    EXPECT_EQ(tracker.resetCount(), 1U);
+}
+
+TEST(BatchSequenceTrackerTest, Observe_LateFrameKeepsExpectation) {
+    BatchSequenceTracker tracker;
+    static_cast<void>(tracker.observe(1U));
+    EXPECT_EQ(tracker.observe(3U), BatchSequenceResult::Gap);
+    EXPECT_EQ(tracker.observe(2U), BatchSequenceResult::Reordered);
+    EXPECT_EQ(tracker.observe(4U), BatchSequenceResult::InOrder);
+    EXPECT_EQ(tracker.reorderedCount(), 1U);
+    EXPECT_EQ(tracker.resetCount(), 0U);
+}
@@ -0,0 +1,161 @@
+/**
+ * @file ShardedProcessTrackUseCaseTest.cpp
+ * @brief Unit tests for the track-sharded domain use case
+ */
+
+#include <gtest/gtest.h>
+#include "domain/logic/ShardedProcessTrackUseCase.hpp"
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+using namespace domain::logic;
+using domain::ports::DelayCalcTrackData;
+using domain::ports::ExtrapTrackData;
+
+namespace {
+    /// Tags every result with the index of the calculator (hence shard) that produced it
+    class TaggingCalculator final : public ICalculatorService {
+    public:
+        explicit TaggingCalculator(int64_t tag) : tag_(tag) {}
+
+        DelayCalcTrackData calculateDelay(const ExtrapTrackData& trackData) const override {
+            DelayCalcTrackData result;
+            result.setTrackId(trackData.getTrackId());
+            result.setUpdateTime(trackData.getUpdateTime());
+            result.setFirstHopClockOffset(tag_);
+            return result;
+        }
+
+    private:
+        int64_t tag_;
+    };
+
+    class RecordingPort final : public domain::ports::outgoing::IDelayCalcTrackDataOutgoingPort {
+    public:
+        void sendDelayCalcTrackData(const DelayCalcTrackData& data) override {
+            std::lock_guard<std::mutex> lock(mutex_);
+            received_.push_back(data);
+        }
+
+        void sendDelayCalcTrackData(const std::vector<DelayCalcTrackData>& data) override {
+            for (const DelayCalcTrackData& item : data) {
+                sendDelayCalcTrackData(item);
+            }
+        }
+
+        std::vector<DelayCalcTrackData> received() const {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return received_;
+        }
+
+    private:
+        mutable std::mutex mutex_;
+        std::vector<DelayCalcTrackData> received_;
+    };
+
+    ShardedProcessTrackUseCase::CalculatorFactory taggingFactory() {
+        return [](std::size_t shard) -> std::unique_ptr<ICalculatorService> {
+            return std::make_unique<TaggingCalculator>(static_cast<int64_t>(shard));
+        };
+    }
+
+    ExtrapTrackData makeTrack(int32_t trackId, int64_t updateTime) {
+        ExtrapTrackData data;
+        data.setTrackId(trackId);
+        data.setUpdateTime(updateTime);
+        return data;
+    }
+
+    ShardedProcessingConfig configWithShards(std::size_t shards) {
+        ShardedProcessingConfig config;
+        config.shardCount = shards;
+        return config;
+    }
+}
+
+TEST(ShardedProcessTrackUseCaseTest, Constructor_RejectsNullDependenciesAndZeroShards) {
+    auto port = std::make_shared<RecordingPort>();
+    EXPECT_THROW(ShardedProcessTrackUseCase(nullptr, port, configWithShards(2U)), std::invalid_argument);
+    EXPECT_THROW(ShardedProcessTrackUseCase(taggingFactory(), nullptr, configWithShards(2U)), std::invalid_argument);
+    EXPECT_THROW(ShardedProcessTrackUseCase(taggingFactory(), port, configWithShards(0U)), std::invalid_argument);
+}
+
+TEST(ShardedProcessTrackUseCaseTest, ShardFor_IsStableAndUsesEveryShard) {
+    ShardedProcessTrackUseCase useCase(taggingFactory(), std::make_shared<RecordingPort>(), configWithShards(4U));
+    ASSERT_EQ(useCase.shardCount(), 4U);
+
+    std::set<std::size_t> used;
+    for (int32_t trackId = 1; trackId <= 1000; ++trackId) {
+        const std::size_t shard = useCase.shardFor(trackId);
+        ASSERT_LT(shard, 4U);
+        ASSERT_EQ(useCase.shardFor(trackId), shard);
+        used.insert(shard);
+    }
+    EXPECT_EQ(used.size(), 4U);
+}
+
+TEST(ShardedProcessTrackUseCaseTest, Submit_SameTrackRunsOnItsShardInOrder) {
+    constexpr int32_t tracks = 16;
+    constexpr int64_t updates = 200;
+    auto port = std::make_shared<RecordingPort>();
+    ShardedProcessTrackUseCase useCase(taggingFactory(), port, configWithShards(4U));
+    ASSERT_TRUE(useCase.start());
+
+    for (int64_t update = 1; update <= updates; ++update) {
+        for (int32_t trackId = 1; trackId <= tracks; ++trackId) {
+            useCase.submitExtrapTrackData(makeTrack(trackId, update));
+        }
+    }
+
+    // Conflation may skip intermediate updates, never the latest one
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    std::map<int32_t, int64_t> latest;
+    while ((static_cast<int32_t>(latest.size()) < tracks) && (std::chrono::steady_clock::now() < deadline)) {
+        latest.clear();
+        for (const DelayCalcTrackData& result : port->received()) {
+            if (result.getUpdateTime() == updates) {
+                latest[result.getTrackId()] = updates;
+            }
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    useCase.stop();
+    ASSERT_EQ(static_cast<int32_t>(latest.size()), tracks);
+
+    std::map<int32_t, int64_t> lastSeen;
+    for (const DelayCalcTrackData& result : port->received()) {
+        const int32_t trackId = result.getTrackId();
+        EXPECT_EQ(static_cast<std::size_t>(result.getFirstHopClockOffset()), useCase.shardFor(trackId))
+            << "track " << trackId;
+        EXPECT_GT(result.getUpdateTime(), lastSeen[trackId]) << "track " << trackId;
+        lastSeen[trackId] = result.getUpdateTime();
+    }
+}
+
+TEST(ShardedProcessTrackUseCaseTest, Submit_WhileStoppedIsDropped) {
+    auto port = std::make_shared<RecordingPort>();
+    ShardedProcessTrackUseCase useCase(taggingFactory(), port, configWithShards(2U));
+    useCase.submitExtrapTrackData(makeTrack(1, 1));
+    EXPECT_EQ(useCase.shardQueueDepth(useCase.shardFor(1)), 0U);
+    EXPECT_TRUE(port->received().empty());
+}
+
+TEST(ShardedProcessTrackUseCaseTest, ShardCores_SkipReservedCores) {
+    EXPECT_EQ(ShardedProcessTrackUseCase::shardCores(1U, 3, {0, 1, 2, 4}), (std::vector<int32_t>{3}));
+    EXPECT_EQ(ShardedProcessTrackUseCase::shardCores(3U, 3, {0, 1, 2, 4}), (std::vector<int32_t>{3, 5, 6}));
+    EXPECT_EQ(ShardedProcessTrackUseCase::shardCores(2U, 0, {}), (std::vector<int32_t>{0, 1}));
+    EXPECT_TRUE(ShardedProcessTrackUseCase::shardCores(0U, 3, {}).empty());
+}
+
+TEST(ShardedProcessTrackUseCaseTest, ShardCounter_IsNamedAfterItsShard) {
+    utils::MetricsRegistry& registry = utils::MetricsRegistry::instance();
+    EXPECT_EQ(&ShardedProcessTrackUseCase::shardCounter(1U, "clamped_delays"),
+              &registry.counter("domain.shard1.clamped_delays"));
+    EXPECT_NE(&ShardedProcessTrackUseCase::shardCounter(0U, "clamped_delays"),
+              &ShardedProcessTrackUseCase::shardCounter(1U, "clamped_delays"));
+}
@@ -0,0 +1,17 @@
+/**
+ * @file main_test.cpp
+ * @brief Test runner main entry point
+ */
+
+#include <gtest/gtest.h>
+#include "utils/Logger.hpp"
+
+int main(int argc, char** argv) {
+    // Initialize Google Test
+    ::testing::InitGoogleTest(&argc, argv);
+    
+    // Run all tests
+    int result = RUN_ALL_TESTS();
+    
+    return result;
+}
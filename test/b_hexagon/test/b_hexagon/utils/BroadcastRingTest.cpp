@@ -0,0 +1,196 @@
+/**
+ * @file BroadcastRingTest.cpp
+ * @brief Unit tests for the single-write fan-out ring and its slow-consumer policies
+ */
+
+#include <gtest/gtest.h>
+#include "utils/BroadcastRing.hpp"
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+
+using namespace utils;
+
+namespace {
+    struct Sample {
+        uint64_t sequence{0U};
+    };
+
+    using Ring = BroadcastRing<Sample>;
+
+    /// @brief Wide enough that a read can overlap the producer lapping the reader
+    struct WideSample {
+        std::array<uint64_t, 32> words{};
+    };
+
+    Ring::ConsumerId addActiveConsumer(Ring& ring, SlowConsumerPolicy policy) {
+        const Ring::ConsumerId id = ring.addConsumer(policy);
+        ring.setActive(id, true);
+        return id;
+    }
+
+    void publishRange(Ring& ring, uint64_t first, uint64_t last) {
+        for (uint64_t sequence = first; sequence < last; ++sequence) {
+            ring.publish(Sample{sequence});
+        }
+    }
+}
+
+TEST(BroadcastRingTest, Constructor_ZeroCapacityThrowsAndCapacityRoundsUp) {
+    EXPECT_THROW(Ring{0U}, std::invalid_argument);
+    EXPECT_EQ(Ring{5U}.capacity(), 8U);
+}
+
+TEST(BroadcastRingTest, AddConsumer_RejectsMoreThanMaxConsumers) {
+    Ring ring{4U};
+    for (std::size_t i = 0U; i < Ring::MAX_CONSUMERS; ++i) {
+        EXPECT_EQ(ring.addConsumer(SlowConsumerPolicy::Drop), i);
+    }
+    EXPECT_THROW(static_cast<void>(ring.addConsumer(SlowConsumerPolicy::Drop)), std::length_error);
+    EXPECT_EQ(ring.consumerCount(), Ring::MAX_CONSUMERS);
+}
+
+TEST(BroadcastRingTest, Publish_EveryActiveConsumerReadsEveryMessageOnce) {
+    Ring ring{8U};
+    const Ring::ConsumerId first = addActiveConsumer(ring, SlowConsumerPolicy::Drop);
+    const Ring::ConsumerId second = addActiveConsumer(ring, SlowConsumerPolicy::Skip);
+    publishRange(ring, 0U, 5U);
+    EXPECT_EQ(ring.publishedCount(), 5U);
+
+    Sample out;
+    for (const Ring::ConsumerId id : {first, second}) {
+        EXPECT_EQ(ring.lag(id), 5U);
+        for (uint64_t sequence = 0U; sequence < 5U; ++sequence) {
+            ASSERT_TRUE(ring.tryConsume(id, out));
+            EXPECT_EQ(out.sequence, sequence);
+        }
+        EXPECT_FALSE(ring.tryConsume(id, out));
+        EXPECT_EQ(ring.lostCount(id), 0U);
+    }
+}
+
+TEST(BroadcastRingTest, SetActive_InactiveConsumerNeverHoldsProducerBack) {
+    Ring ring{4U};
+    const Ring::ConsumerId id = ring.addConsumer(SlowConsumerPolicy::Block);
+    publishRange(ring, 0U, 10U);
+    EXPECT_EQ(ring.blockedCount(id), 0U);
+
+    // Activation starts at the newest position instead of replaying stale entries
+    ring.setActive(id, true);
+    Sample out;
+    EXPECT_FALSE(ring.tryConsume(id, out));
+    ring.publish(Sample{10U});
+    ASSERT_TRUE(ring.tryConsume(id, out));
+    EXPECT_EQ(out.sequence, 10U);
+}
+
+TEST(BroadcastRingTest, DropPolicy_ProducerEvictsOldestUnread) {
+    Ring ring{4U};
+    const Ring::ConsumerId id = addActiveConsumer(ring, SlowConsumerPolicy::Drop);
+    publishRange(ring, 0U, 6U);
+    EXPECT_EQ(ring.lostCount(id), 2U);
+    EXPECT_EQ(ring.lag(id), 4U);
+
+    Sample out;
+    for (uint64_t sequence = 2U; sequence < 6U; ++sequence) {
+        ASSERT_TRUE(ring.tryConsume(id, out));
+        EXPECT_EQ(out.sequence, sequence);
+    }
+    EXPECT_FALSE(ring.tryConsume(id, out));
+}
+
+TEST(BroadcastRingTest, SkipPolicy_LappedConsumerJumpsToNewest) {
+    Ring ring{4U};
+    const Ring::ConsumerId id = addActiveConsumer(ring, SlowConsumerPolicy::Skip);
+    publishRange(ring, 0U, 6U);
+    EXPECT_EQ(ring.lostCount(id), 0U);
+
+    Sample out;
+    ASSERT_TRUE(ring.tryConsume(id, out));
+    EXPECT_EQ(out.sequence, 5U);
+    EXPECT_EQ(ring.lostCount(id), 5U);
+    EXPECT_FALSE(ring.tryConsume(id, out));
+}
+
+TEST(BroadcastRingTest, BlockPolicy_ProducerWaitsAndNothingIsLost) {
+    Ring ring{4U};
+    const Ring::ConsumerId id = addActiveConsumer(ring, SlowConsumerPolicy::Block);
+    std::thread producer([&ring]() { publishRange(ring, 0U, 8U); });
+
+    // The producer stalls on the fifth message until the consumer frees a slot
+    while (ring.publishedCount() < 4U) {
+        std::this_thread::yield();
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_EQ(ring.publishedCount(), 4U);
+
+    Sample out;
+    for (uint64_t sequence = 0U; sequence < 8U; ++sequence) {
+        ASSERT_TRUE(ring.waitConsume(id, out, std::chrono::seconds(5)));
+        EXPECT_EQ(out.sequence, sequence);
+    }
+    producer.join();
+    EXPECT_GE(ring.blockedCount(id), 1U);
+    EXPECT_EQ(ring.lostCount(id), 0U);
+}
+
+TEST(BroadcastRingTest, WaitConsume_WakesForPublishAndOnDeactivation) {
+    Ring ring{4U};
+    const Ring::ConsumerId id = addActiveConsumer(ring, SlowConsumerPolicy::Drop);
+    Sample out;
+    EXPECT_FALSE(ring.waitConsume(id, out, std::chrono::milliseconds(5)));
+
+    std::thread producer([&ring]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        ring.publish(Sample{3U});
+    });
+    EXPECT_TRUE(ring.waitConsume(id, out, std::chrono::seconds(5)));
+    producer.join();
+    EXPECT_EQ(out.sequence, 3U);
+
+    const auto before = std::chrono::steady_clock::now();
+    ring.setActive(id, false);
+    EXPECT_FALSE(ring.waitConsume(id, out, std::chrono::seconds(5)));
+    EXPECT_LT(std::chrono::steady_clock::now() - before, std::chrono::seconds(1));
+}
+
+TEST(BroadcastRingTest, LappedReaders_NeverSeeTornMessages) {
+    BroadcastRing<WideSample> ring{2U};
+    const auto dropId = ring.addConsumer(SlowConsumerPolicy::Drop);
+    const auto skipId = ring.addConsumer(SlowConsumerPolicy::Skip);
+    ring.setActive(dropId, true);
+    ring.setActive(skipId, true);
+    constexpr uint64_t MESSAGE_COUNT = 100000U;
+
+    std::thread producer([&ring]() {
+        WideSample sample;
+        for (uint64_t sequence = 0U; sequence < MESSAGE_COUNT; ++sequence) {
+            sample.words.fill(sequence);
+            ring.publish(sample);
+        }
+    });
+
+    auto reader = [&ring](BroadcastRing<WideSample>::ConsumerId id) {
+        WideSample out;
+        uint64_t last = 0U;
+        bool first = true;
+        while (first || (last < (MESSAGE_COUNT - 1U))) {
+            if (!ring.waitConsume(id, out, std::chrono::seconds(5))) {
+                break;
+            }
+            for (const uint64_t word : out.words) {
+                ASSERT_EQ(word, out.words[0U]);
+            }
+            ASSERT_TRUE(first || (out.words[0U] > last));
+            last = out.words[0U];
+            first = false;
+        }
+        EXPECT_EQ(last, MESSAGE_COUNT - 1U);
+    };
+    std::thread dropReader(reader, dropId);
+    std::thread skipReader(reader, skipId);
+    producer.join();
+    dropReader.join();
+    skipReader.join();
+}
@@ -0,0 +1,120 @@
+/**
+ * @file MpscRingBufferTest.cpp
+ * @brief Unit tests for the multi-producer/single-consumer merge ring
+ */
+
+#include <gtest/gtest.h>
+#include "utils/MpscRingBuffer.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+using namespace utils;
+
+namespace {
+    struct Sample {
+        uint32_t producer{0U};
+        uint32_t sequence{0U};
+    };
+}
+
+TEST(MpscRingBufferTest, Constructor_ZeroCapacityThrows) {
+    EXPECT_THROW(MpscRingBuffer<Sample>{0U}, std::invalid_argument);
+}
+
+TEST(MpscRingBufferTest, Constructor_RoundsCapacityUpToPowerOfTwo) {
+    EXPECT_EQ(MpscRingBuffer<Sample>{1U}.capacity(), 2U);
+    EXPECT_EQ(MpscRingBuffer<Sample>{5U}.capacity(), 8U);
+    EXPECT_EQ(MpscRingBuffer<Sample>{8U}.capacity(), 8U);
+}
+
+TEST(MpscRingBufferTest, EmptyRing_TryPopAndWaitPopReturnFalse) {
+    MpscRingBuffer<Sample> ring{4U};
+    Sample out;
+    EXPECT_TRUE(ring.empty());
+    EXPECT_FALSE(ring.tryPop(out));
+    EXPECT_FALSE(ring.waitPop(out, std::chrono::milliseconds(5)));
+}
+
+TEST(MpscRingBufferTest, FullRing_RejectsNewestAndKeepsQueuedItems) {
+    MpscRingBuffer<Sample> ring{4U};
+    for (uint32_t i = 0U; i < 4U; ++i) {
+        ASSERT_TRUE(ring.push(Sample{0U, i}));
+    }
+    EXPECT_EQ(ring.size(), 4U);
+    EXPECT_FALSE(ring.push(Sample{0U, 4U}));
+    EXPECT_FALSE(ring.push(Sample{0U, 5U}));
+    EXPECT_EQ(ring.rejectedCount(), 2U);
+
+    Sample out;
+    for (uint32_t i = 0U; i < 4U; ++i) {
+        ASSERT_TRUE(ring.tryPop(out));
+        EXPECT_EQ(out.sequence, i);
+    }
+    EXPECT_FALSE(ring.tryPop(out));
+
+    // Popped slots are reusable on the next lap
+    EXPECT_TRUE(ring.push(Sample{0U, 6U}));
+    ASSERT_TRUE(ring.tryPop(out));
+    EXPECT_EQ(out.sequence, 6U);
+}
+
+TEST(MpscRingBufferTest, MultipleProducers_KeepPerProducerOrder) {
+    constexpr uint32_t producers = 4U;
+    constexpr uint32_t perProducer = 20000U;
+    MpscRingBuffer<Sample> ring{64U};
+    std::atomic<bool> go{false};
+
+    std::vector<std::thread> threads;
+    for (uint32_t p = 0U; p < producers; ++p) {
+        threads.emplace_back([&ring, &go, p]() {
+            while (!go.load(std::memory_order_acquire)) {
+                std::this_thread::yield();
+            }
+            for (uint32_t i = 0U; i < perProducer; ++i) {
+                // Retry on full: this test checks ordering, not overflow
+                while (!ring.push(Sample{p, i})) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    go.store(true, std::memory_order_release);
+
+    std::vector<uint32_t> next(producers, 0U);
+    uint32_t received = 0U;
+    Sample out;
+    while (received < (producers * perProducer)) {
+        if (!ring.waitPop(out, std::chrono::seconds(5))) {
+            break;
+        }
+        ASSERT_LT(out.producer, producers);
+        ASSERT_EQ(out.sequence, next[out.producer]) << "producer " << out.producer;
+        ++next[out.producer];
+        ++received;
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(received, producers * perProducer);
+    EXPECT_TRUE(ring.empty());
+}
+
+TEST(MpscRingBufferTest, WaitPop_WakesForProducerAndOnWakeConsumer) {
+    MpscRingBuffer<Sample> ring{4U};
+    Sample out;
+    std::thread producer([&ring]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        static_cast<void>(ring.push(Sample{1U, 7U}));
+    });
+    EXPECT_TRUE(ring.waitPop(out, std::chrono::seconds(5)));
+    producer.join();
+    EXPECT_EQ(out.sequence, 7U);
+
+    ring.wakeConsumer();
+    EXPECT_FALSE(ring.waitPop(out, std::chrono::seconds(5)));
+    ring.resetWake();
+    EXPECT_FALSE(ring.waitPop(out, std::chrono::milliseconds(5)));
+}
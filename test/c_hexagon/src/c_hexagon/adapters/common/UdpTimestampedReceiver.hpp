@@ -0,0 +1,310 @@
+/**
+ * @file UdpTimestampedReceiver.hpp
+ * @brief Plain UDP ingress for ZeroMQ RADIO traffic with kernel receive timestamps
+ * @details A ZeroMQ DISH socket hides its file descriptor, so the only receive
+ *          time available is taken after the ZeroMQ I/O thread has queued and
+ *          delivered the message. RADIO over udp:// sends one datagram per
+ *          message:
+ *
+ * @code
+ * [group length: 1 byte][group: n bytes][body]
+ * @endcode
+ *
+ *          so a plain UDP socket bound to the same endpoint receives the same
+ *          messages. This receiver enables SO_TIMESTAMPING (software RX) and
+ *          returns the kernel arrival time with each body, which separates
+ *          network latency from in-process latency.
+ *
+ * Design:
+ * - Multicast endpoints bind INADDR_ANY:port and join the group; unicast
+ *   endpoints bind the address itself.
+ * - Falls back to SO_TIMESTAMPNS, then to no timestamp (0), if the kernel
+ *   refuses SO_TIMESTAMPING.
+ * - Returned bodies point into the receiver's buffer and stay valid until the
+ *   next receive.
+ *
+ * @author c_hexagon Team
+ * @version 1.0
+ * @date 2025
+ *
+ * @note MISRA C++ 2023 compliant implementation
+ * @note Linux only (SO_TIMESTAMPING)
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <ctime>
+#include <string>
+#include <vector>
+#include <arpa/inet.h>
+#include <linux/net_tstamp.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace adapters {
+
+/**
+ * @struct TimestampedDatagram
+ * @brief One received message body and its kernel arrival time
+ */
+struct TimestampedDatagram {
+    const uint8_t* body{nullptr};        ///< Message body (after the RADIO group header)
+    std::size_t size{0U};                ///< Body length
+    int64_t kernelReceiveTimeUs{0};      ///< CLOCK_REALTIME arrival time, 0 if unavailable
+};
+
+/**
+ * @class UdpTimestampedReceiver
+ * @brief Receives RADIO datagrams of one group with kernel timestamps
+ */
+class UdpTimestampedReceiver final {
+public:
+    /// @brief Largest UDP payload
+    static constexpr std::size_t MAX_DATAGRAM_SIZE{65536U};
+
+    UdpTimestampedReceiver()
+        : buffer_(MAX_DATAGRAM_SIZE) {
+    }
+
+    // Non-copyable, non-movable (owns a socket)
+    UdpTimestampedReceiver(const UdpTimestampedReceiver&) = delete;
+    UdpTimestampedReceiver& operator=(const UdpTimestampedReceiver&) = delete;
+    UdpTimestampedReceiver(UdpTimestampedReceiver&&) = delete;
+    UdpTimestampedReceiver& operator=(UdpTimestampedReceiver&&) = delete;
+
+    ~UdpTimestampedReceiver() {
+        close();
+    }
+
+    /**
+     * @brief Bind the endpoint and enable kernel RX timestamps
+     * @param endpoint "udp://<IPv4 address>:<port>" (same string the DISH binds)
+     * @param group RADIO group to accept; datagrams of other groups are skipped
+     * @return false if the endpoint is invalid or the socket cannot be bound
+     */
+    [[nodiscard]] bool open(const std::string& endpoint, const std::string& group) {
+        close();
+        sockaddr_in address{};
+        if (!parseEndpoint(endpoint, address) || (group.size() > 255U)) {
+            return false;
+        }
+        fd_ = ::socket(AF_INET, SOCK_DGRAM | SOCK_CLOEXEC, 0);
+        if (fd_ < 0) {
+            return false;
+        }
+        const int enable = 1;
+        static_cast<void>(::setsockopt(fd_, SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(enable)));
+
+        const bool multicast = IN_MULTICAST(ntohl(address.sin_addr.s_addr));
+        sockaddr_in bindAddress = address;
+        if (multicast) {
+            bindAddress.sin_addr.s_addr = htonl(INADDR_ANY);
+        }
+        if (::bind(fd_, reinterpret_cast<const sockaddr*>(&bindAddress), sizeof(bindAddress)) != 0) {
+            close();
+            return false;
+        }
+        if (multicast) {
+            ip_mreq membership{};
+            membership.imr_multiaddr = address.sin_addr;
+            membership.imr_interface.s_addr = htonl(INADDR_ANY);
+            if (::setsockopt(fd_, IPPROTO_IP, IP_ADD_MEMBERSHIP, &membership, sizeof(membership)) != 0) {
+                close();
+                return false;
+            }
+        }
+
+        const int flags = SOF_TIMESTAMPING_RX_SOFTWARE | SOF_TIMESTAMPING_SOFTWARE;
+        timestampMode_ = TimestampMode::None;
+        if (::setsockopt(fd_, SOL_SOCKET, SO_TIMESTAMPING, &flags, sizeof(flags)) == 0) {
+            timestampMode_ = TimestampMode::Timestamping;
+        } else if (::setsockopt(fd_, SOL_SOCKET, SO_TIMESTAMPNS, &enable, sizeof(enable)) == 0) {
+            timestampMode_ = TimestampMode::TimestampNs;
+        }
+        group_ = group;
+        return true;
+    }
+
+    void close() noexcept {
+        if (fd_ >= 0) {
+            static_cast<void>(::close(fd_));
+            fd_ = -1;
+        }
+    }
+
+    [[nodiscard]] bool isOpen() const noexcept {
+        return fd_ >= 0;
+    }
+
+    /// @brief true if the kernel accepted SO_TIMESTAMPING or SO_TIMESTAMPNS
+    [[nodiscard]] bool hasKernelTimestamps() const noexcept {
+        return timestampMode_ != TimestampMode::None;
+    }
+
+    /// @brief "SO_TIMESTAMPING", "SO_TIMESTAMPNS" or "none"
+    [[nodiscard]] const char* timestampModeName() const noexcept {
+        switch (timestampMode_) {
+            case TimestampMode::Timestamping: return "SO_TIMESTAMPING";
+            case TimestampMode::TimestampNs:  return "SO_TIMESTAMPNS";
+            default:                          return "none";
+        }
+    }
+
+    /**
+     * @brief Non-blocking receive of the next datagram of our group
+     * @return true if @p out holds a message
+     */
+    bool tryReceive(TimestampedDatagram& out) {
+        // Datagrams of other groups or without a valid header are skipped
+        while (receiveOne(out)) {
+            if (out.body != nullptr) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Wait up to @p timeoutMs for the next datagram of our group
+     * @return true if @p out holds a message
+     */
+    bool receive(int timeoutMs, TimestampedDatagram& out) {
+        if (tryReceive(out)) {
+            return true;
+        }
+        return waitReadable(timeoutMs) && tryReceive(out);
+    }
+
+    /**
+     * @brief Sleep in poll() until a datagram is pending or @p timeoutMs elapses
+     * @return true if the socket became readable
+     */
+    bool waitReadable(int timeoutMs) {
+        pollfd item{fd_, POLLIN, 0};
+        return ::poll(&item, 1U, timeoutMs) > 0;
+    }
+
+    /// @brief Datagrams skipped (other group or malformed header)
+    [[nodiscard]] uint64_t skippedCount() const noexcept {
+        return skipped_;
+    }
+
+    /**
+     * @brief Split a RADIO datagram into group and body
+     * @return false if the header is malformed
+     */
+    static bool parseRadioDatagram(const uint8_t* data, std::size_t size, const char*& group,
+                                   std::size_t& groupSize, const uint8_t*& body, std::size_t& bodySize) noexcept {
+        if ((data == nullptr) || (size < 1U) || ((1U + static_cast<std::size_t>(data[0])) > size)) {
+            return false;
+        }
+        groupSize = data[0];
+        group = reinterpret_cast<const char*>(data + 1);
+        body = data + 1U + groupSize;
+        bodySize = size - 1U - groupSize;
+        return true;
+    }
+
+    /**
+     * @brief Parse "udp://a.b.c.d:port"
+     */
+    static bool parseEndpoint(const std::string& endpoint, sockaddr_in& address) {
+        static const std::string scheme{"udp://"};
+        if (endpoint.compare(0U, scheme.size(), scheme) != 0) {
+            return false;
+        }
+        const std::size_t colon = endpoint.rfind(':');
+        if ((colon == std::string::npos) || (colon <= scheme.size())) {
+            return false;
+        }
+        const std::string host = endpoint.substr(scheme.size(), colon - scheme.size());
+        const std::string portText = endpoint.substr(colon + 1U);
+        if (portText.empty() || (portText.find_first_not_of("0123456789") != std::string::npos) ||
+            (portText.size() > 5U)) {
+            return false;
+        }
+        const unsigned long port = std::stoul(portText);
+        if ((port == 0UL) || (port > 65535UL)) {
+            return false;
+        }
+        address = sockaddr_in{};
+        address.sin_family = AF_INET;
+        address.sin_port = htons(static_cast<uint16_t>(port));
+        return ::inet_pton(AF_INET, host.c_str(), &address.sin_addr) == 1;
+    }
+
+private:
+    enum class TimestampMode : uint8_t {
+        None,
+        Timestamping,
+        TimestampNs
+    };
+
+    /**
+     * @brief Receive one datagram without blocking
+     * @return false if nothing was pending; true with out.body == nullptr if skipped
+     */
+    bool receiveOne(TimestampedDatagram& out) {
+        out = TimestampedDatagram{};
+        iovec vector{buffer_.data(), buffer_.size()};
+        alignas(cmsghdr) char control[256];
+        msghdr message{};
+        message.msg_iov = &vector;
+        message.msg_iovlen = 1U;
+        message.msg_control = control;
+        message.msg_controllen = sizeof(control);
+
+        const ssize_t received = ::recvmsg(fd_, &message, MSG_DONTWAIT);
+        if (received < 0) {
+            return false;
+        }
+
+        const char* group = nullptr;
+        std::size_t groupSize = 0U;
+        const uint8_t* body = nullptr;
+        std::size_t bodySize = 0U;
+        if (!parseRadioDatagram(buffer_.data(), static_cast<std::size_t>(received), group, groupSize, body, bodySize) ||
+            (groupSize != group_.size()) || (std::memcmp(group, group_.data(), groupSize) != 0)) {
+            ++skipped_;
+            return true;
+        }
+        out.body = body;
+        out.size = bodySize;
+        out.kernelReceiveTimeUs = kernelTimeUs(message);
+        return true;
+    }
+
+    static int64_t kernelTimeUs(msghdr& message) noexcept {
+        for (cmsghdr* header = CMSG_FIRSTHDR(&message); header != nullptr; header = CMSG_NXTHDR(&message, header)) {
+            if (header->cmsg_level != SOL_SOCKET) {
+                continue;
+            }
+            timespec stamp{};
+            if (header->cmsg_type == SCM_TIMESTAMPING) {
+                // ts[0] is the software timestamp
+                std::memcpy(&stamp, CMSG_DATA(header), sizeof(stamp));
+            } else if (header->cmsg_type == SCM_TIMESTAMPNS) {
+                std::memcpy(&stamp, CMSG_DATA(header), sizeof(stamp));
+            } else {
+                continue;
+            }
+            if ((stamp.tv_sec != 0) || (stamp.tv_nsec != 0)) {
+                return (static_cast<int64_t>(stamp.tv_sec) * 1000000LL) + (static_cast<int64_t>(stamp.tv_nsec) / 1000LL);
+            }
+        }
+        return 0;
+    }
+
+    int fd_{-1};                                     ///< UDP socket
+    std::string group_;                              ///< Accepted RADIO group
+    std::vector<uint8_t> buffer_;                    ///< Datagram buffer (bodies point into it)
+    TimestampMode timestampMode_{TimestampMode::None};  ///< Enabled kernel timestamping
+    uint64_t skipped_{0U};                           ///< Skipped datagrams
+};
+
+} // namespace adapters
@@ -6,8 +6,12 @@
 
 #include "TrackDataZeroMQIncomingAdapter.hpp"
 #include "utils/Logger.hpp"
+#include "utils/StageTracer.hpp"
+#include "utils/FlightRecorder.hpp"
+#include "utils/WaitStrategy.hpp"
 #include <zmq_config.hpp>  // Must be included before zmq.hpp for Draft API
 #include <zmq.hpp>
+#include <algorithm>
 #include <sstream>
 #ifdef __linux__
 #include <cerrno>
@@ -30,6 +34,12 @@ namespace {
         oss << "udp://" << address << ":" << port;
         return oss.str();
     }
+
+    /// Wall-clock microseconds, same epoch as the kernel SO_TIMESTAMP and the sender stamps
+    int64_t wallClockUs() noexcept {
+        return std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+    }
 }
 
 /**
@@ -42,7 +52,7 @@ TrackDataZeroMQIncomingAdapter::TrackDataZeroMQIncomingAdapter(
     , endpoint_(buildEndpoint(DEFAULT_MULTICAST_ADDRESS, DEFAULT_PORT))
     , group_(DEFAULT_GROUP)
     , adapter_name_("DelayCalcTrackData-InAdapter")
-    , zmq_context_(1)
+    , zmq_context_(ZmqContextRegistry::instance().acquire())
     , dish_socket_(nullptr)
     , running_(false) {
     
@@ -63,7 +73,7 @@ TrackDataZeroMQIncomingAdapter::TrackDataZeroMQIncomingAdapter(
     , endpoint_(multicast_endpoint)
     , group_(group_name)
     , adapter_name_(group_name + "-InAdapter")
-    , zmq_context_(1)
+    , zmq_context_(ZmqContextRegistry::instance().acquire())
     , dish_socket_(nullptr)
     , running_(false) {
     
@@ -88,7 +98,7 @@ void TrackDataZeroMQIncomingAdapter::initializeDishSocket() {
         LOG_INFO("Socket Configuration - Endpoint: {}, Group: {}", endpoint_, group_);
         
         // RADIO/DISH pattern
-        dish_socket_ = std::make_unique<zmq::socket_t>(zmq_context_, zmq::socket_type::dish);
+        dish_socket_ = std::make_unique<zmq::socket_t>(*zmq_context_, zmq::socket_type::dish);
         
         // Configure socket options for optimal performance
         dish_socket_->set(zmq::sockopt::rcvhwm, HIGH_WATER_MARK);
@@ -125,6 +135,16 @@ bool TrackDataZeroMQIncomingAdapter::start() {
         return false;
     }
 
+    if (ingress_mode_ == IngressMode::KernelTimestampedUdp) {
+        if (!udp_receiver_.open(endpoint_, group_)) {
+            LOG_ERROR("{} cannot bind timestamped UDP ingress on {}: {}",
+                      adapter_name_, endpoint_, std::strerror(errno));
+            return false;
+        }
+        LOG_INFO("{} timestamped UDP ingress on {} - kernel timestamps: {}",
+                 adapter_name_, endpoint_, udp_receiver_.timestampModeName());
+    }
+
     running_.store(true);
 
     // Start the subscriber worker thread
@@ -167,6 +187,14 @@ void TrackDataZeroMQIncomingAdapter::stop() {
 
     if (subscriber_thread_.joinable()) {
         subscriber_thread_.join();
+        udp_receiver_.close();
+        
+        const ReceiveStats stats = getReceiveStats();
+        static_cast<void>(stats);  // Only used by LOG_INFO, which may be compiled out
+        LOG_INFO("Receive loop stats - mode: {}, messages: {}, ready: {}, spin hits: {}, wakeups: {}, "
+                 "spin time: {} us, wake latency avg/max: {}/{} ns",
+                 receiveModeName(stats.mode), stats.messages, stats.ready_hits, stats.spin_hits, stats.wakeups,
+                 stats.spin_time_us, stats.wake_latency_avg_ns, stats.wake_latency_max_ns);
     }
 }
 
@@ -186,56 +214,136 @@ std::string TrackDataZeroMQIncomingAdapter::getName() const {
     return adapter_name_;
 }
 
+/**
+ * @brief Selects the receive mode; only allowed while stopped
+ */
+bool TrackDataZeroMQIncomingAdapter::setReceiveMode(ReceiveMode mode,
+                                                    std::chrono::microseconds spin_window) {
+    if (running_.load()) {
+        LOG_WARN("Receive mode cannot change while {} is running", adapter_name_);
+        return false;
+    }
+    receive_mode_ = mode;
+    spin_window_ = (spin_window.count() > 0) ? spin_window : std::chrono::microseconds(0);
+    LOG_INFO("{} receive mode: {} (spin window {} us)",
+             adapter_name_, receiveModeName(receive_mode_), spin_window_.count());
+    return true;
+}
+
+/**
+ * @brief Selects the ingress socket; only allowed while stopped
+ * @details The DISH socket is closed for KernelTimestampedUdp so the plain
+ *          UDP socket can bind the endpoint, and re-created when switching back
+ */
+bool TrackDataZeroMQIncomingAdapter::setIngressMode(IngressMode mode) {
+    if (running_.load()) {
+        LOG_WARN("Ingress mode cannot change while {} is running", adapter_name_);
+        return false;
+    }
+    if (mode == IngressMode::KernelTimestampedUdp) {
+        dish_socket_.reset();
+    } else if (!dish_socket_) {
+        initializeDishSocket();
+    }
+    ingress_mode_ = mode;
+    LOG_INFO("{} ingress: {}", adapter_name_,
+             (mode == IngressMode::KernelTimestampedUdp) ? "kernel-timestamped UDP" : "ZeroMQ DISH");
+    return true;
+}
+
+IngressMode TrackDataZeroMQIncomingAdapter::getIngressMode() const noexcept {
+    return ingress_mode_;
+}
+
+/**
+ * @brief Returns a snapshot of the receive loop counters
+ */
+ReceiveStats TrackDataZeroMQIncomingAdapter::getReceiveStats() const noexcept {
+    ReceiveStats stats;
+    stats.mode = receive_mode_;
+    stats.messages = stat_messages_.load(std::memory_order_relaxed);
+    stats.ready_hits = stat_ready_hits_.load(std::memory_order_relaxed);
+    stats.spin_hits = stat_spin_hits_.load(std::memory_order_relaxed);
+    stats.wakeups = stat_wakeups_.load(std::memory_order_relaxed);
+    stats.spin_time_us = stat_spin_time_us_.load(std::memory_order_relaxed);
+    stats.wake_latency_max_ns = stat_wake_latency_max_ns_.load(std::memory_order_relaxed);
+    if (stats.wakeups > 0U) {
+        stats.wake_latency_avg_ns = stat_wake_latency_sum_ns_.load(std::memory_order_relaxed) /
+                                    static_cast<int64_t>(stats.wakeups);
+    }
+    return stats;
+}
+
+const char* TrackDataZeroMQIncomingAdapter::receiveModeName(ReceiveMode mode) noexcept {
+    switch (mode) {
+        case ReceiveMode::BusyPoll:     return "BusyPoll";
+        case ReceiveMode::Blocking:     return "Blocking";
+        case ReceiveMode::AdaptiveSpin: return "AdaptiveSpin";
+        default:                        return "Unknown";
+    }
+}
+
 /**
  * @brief Main worker loop for receiving and processing messages
- * @details Continuously polls the DISH socket for incoming messages,
- *          deserializes them, and forwards valid data to the domain layer
+ * @details Waits according to receive_mode_:
+ *          - BusyPoll:     dontwait receive, 10 us sleep when empty
+ *          - Blocking:     zmq_poll until the DISH socket is readable
+ *          - AdaptiveSpin: after a message, spin for spin_window_ expecting a
+ *                          burst; once the window expires, block in zmq_poll
  */
 void TrackDataZeroMQIncomingAdapter::subscriberWorker() {
+    if (ingress_mode_ == IngressMode::KernelTimestampedUdp) {
+        timestampedUdpWorker();
+        return;
+    }
+
+    // Reused across receives; recv() releases the previous frame
+    zmq::message_t received_msg;
+    bool recently_active = false;   // AdaptiveSpin: spin only right after traffic
+
     while (running_.load()) {
         try {
-            zmq::message_t received_msg;
+            bool received = false;
+            ReceivePath path = ReceivePath::Ready;
+            int64_t woke_us = 0;
             
-            // Non-blocking receive with timeout for graceful shutdown
-            auto result = dish_socket_->recv(received_msg, zmq::recv_flags::dontwait);
-            
-            if (!result.has_value() || received_msg.size() == 0U) {
-                // No message available, brief sleep before retry
-                std::this_thread::sleep_for(std::chrono::microseconds(10));
-                continue;
-            }
-
-            // Record receive timestamp for latency calculation
-            auto receive_time = std::chrono::duration_cast<std::chrono::microseconds>(
-                std::chrono::high_resolution_clock::now().time_since_epoch()).count();
-
-            // Convert binary message to vector
-            const uint8_t* msg_data = static_cast<const uint8_t*>(received_msg.data());
-            std::vector<uint8_t> binary_data(msg_data, msg_data + received_msg.size());
-
-            // Deserialize the binary data into DelayCalcTrackData
-            domain::ports::DelayCalcTrackData track_data;
-            if (track_data.deserialize(binary_data)) {
-                if (track_data.isValid() && track_data_submission_) {
-                    // Calculate second hop latency
-                    auto second_hop_latency_us = static_cast<int64_t>(receive_time - track_data.getSecondHopSentTime());
+            switch (receive_mode_) {
+                case ReceiveMode::BusyPoll:
+                    received = tryReceive(received_msg);
+                    if (!received) {
+                        std::this_thread::sleep_for(std::chrono::microseconds(10));
+                    }
+                    break;
                     
-                    LOG_INFO("[c_hexagon] DelayCalcTrackData received - TrackID: {}, Size: {} bytes",
-                             track_data.getTrackId(), binary_data.size());
+                case ReceiveMode::AdaptiveSpin:
+                    if (recently_active) {
+                        received = spinReceive(received_msg);
+                        path = ReceivePath::Spin;
+                    }
+                    if (!received) {
+                        path = ReceivePath::Ready;
+                        received = tryReceive(received_msg);
+                    }
+                    if (!received) {
+                        path = ReceivePath::Wake;
+                        received = blockingReceive(received_msg, woke_us);
+                    }
+                    recently_active = received;
+                    break;
                     
-                    // Log latency metrics (async, ~20ns overhead)
-                    utils::Logger::logTrackReceived(
-                        track_data.getTrackId(),
-                        track_data.getFirstHopDelayTime(),
-                        second_hop_latency_us);
-                    
-                    // Forward to domain layer via hexagonal architecture port
-                    track_data_submission_->submitDelayCalcTrackData(track_data);
-                } else {
-                    LOG_WARN("Invalid DelayCalcTrackData received");
-                }
-            } else {
-                LOG_ERROR("Failed to deserialize DelayCalcTrackData - Message size: {} bytes", received_msg.size());
+                case ReceiveMode::Blocking:
+                default:
+                    received = tryReceive(received_msg);
+                    if (!received) {
+                        path = ReceivePath::Wake;
+                        received = blockingReceive(received_msg, woke_us);
+                    }
+                    break;
+            }
+            
+            if (received) {
+                handleMessage(static_cast<const uint8_t*>(received_msg.data()), received_msg.size(),
+                              path, woke_us, 0);
             }
 
         } catch (const zmq::error_t& e) {
@@ -251,6 +359,137 @@ void TrackDataZeroMQIncomingAdapter::subscriberWorker() {
     }
 }
 
+bool TrackDataZeroMQIncomingAdapter::tryReceive(zmq::message_t& message) {
+    const auto result = dish_socket_->recv(message, zmq::recv_flags::dontwait);
+    return result.has_value() && (message.size() > 0U);
+}
+
+bool TrackDataZeroMQIncomingAdapter::spinReceive(zmq::message_t& message) {
+    const auto spin_start = std::chrono::steady_clock::now();
+    const auto deadline = spin_start + spin_window_;
+    bool received = false;
+    
+    while (!received && running_.load(std::memory_order_relaxed)) {
+        received = tryReceive(message);
+        if (!received) {
+            if (std::chrono::steady_clock::now() >= deadline) {
+                break;
+            }
+            utils::cpuRelax();
+        }
+    }
+    
+    const auto spun = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - spin_start).count();
+    stat_spin_time_us_.fetch_add(static_cast<uint64_t>(spun), std::memory_order_relaxed);
+    return received;
+}
+
+bool TrackDataZeroMQIncomingAdapter::blockingReceive(zmq::message_t& message, int64_t& woke_us) {
+    // DISH is a thread-safe socket: ZMQ_FD is not available, zmq_poll routes
+    // through the zmq_poller (epoll based) and sleeps until readable
+    zmq::pollitem_t items[] = {{dish_socket_->handle(), 0, ZMQ_POLLIN, 0}};
+    const int ready = zmq::poll(items, 1, std::chrono::milliseconds(RECEIVE_TIMEOUT_MS));
+    
+    if ((ready <= 0) || ((items[0].revents & ZMQ_POLLIN) == 0)) {
+        return false;  // Timeout - re-check running_
+    }
+    woke_us = wallClockUs();
+    return tryReceive(message);
+}
+
+/**
+ * @brief Receive loop over the kernel-timestamped UDP socket
+ * @details Drains pending datagrams without blocking, then sleeps in poll()
+ *          for up to RECEIVE_TIMEOUT_MS (bounds stop() latency)
+ */
+void TrackDataZeroMQIncomingAdapter::timestampedUdpWorker() {
+    adapters::TimestampedDatagram datagram;
+
+    while (running_.load()) {
+        try {
+            ReceivePath path = ReceivePath::Ready;
+            int64_t woke_us = 0;
+            bool received = udp_receiver_.tryReceive(datagram);
+            if (!received && udp_receiver_.waitReadable(RECEIVE_TIMEOUT_MS)) {
+                path = ReceivePath::Wake;
+                woke_us = wallClockUs();
+                received = udp_receiver_.tryReceive(datagram);
+            }
+            if (received) {
+                handleMessage(datagram.body, datagram.size, path, woke_us, datagram.kernelReceiveTimeUs);
+            }
+        } catch (const std::exception& e) {
+            LOG_ERROR("Worker thread error: {}", e.what());
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+    }
+}
+
+void TrackDataZeroMQIncomingAdapter::handleMessage(const uint8_t* data, std::size_t size, ReceivePath path,
+                                                   int64_t woke_us, int64_t kernel_receive_us) {
+    // Record receive timestamp for latency calculation (wall clock, same epoch
+    // as the kernel SO_TIMESTAMP and b_hexagon's secondHopSentTime)
+    const int64_t receive_time = wallClockUs();
+    utils::StageTracer& tracer = utils::StageTracer::instance();
+    const int64_t receive_ns = tracer.isEnabled() ? utils::StageTracer::nowNs() : 0;
+
+    metric_received_.add();
+    metric_bytes_.add(size);
+    
+    // Deserialize straight from the received frame (no intermediate copy)
+    domain::ports::DelayCalcTrackData track_data;
+    if (!track_data.deserialize(data, size)) {
+        metric_decode_failures_.add();
+        LOG_ERROR("Failed to deserialize DelayCalcTrackData - Message size: {} bytes", size);
+        return;
+    }
+    // ZeroMQ ingress has no kernel timestamp: fall back to our own receive time,
+    // which also counts the ZeroMQ I/O thread handoff as network time
+    track_data.setSecondHopReceiveTime((kernel_receive_us > 0) ? kernel_receive_us : receive_time);
+    
+    if (!track_data.isValid() || !track_data_submission_) {
+        metric_invalid_.add();
+        LOG_WARN("Invalid DelayCalcTrackData received");
+        return;
+    }
+    
+    // Calculate second hop latency
+    auto second_hop_latency_us = static_cast<int64_t>(receive_time - track_data.getSecondHopSentTime());
+    
+    stat_messages_.fetch_add(1U, std::memory_order_relaxed);
+    if (path == ReceivePath::Wake) {
+        // Arrival to wait return: kernel RX stamp when available, else the sender's
+        // stamp (then includes the network hop). Clock skew can make it negative.
+        const int64_t arrival_us = (kernel_receive_us > 0) ? kernel_receive_us : track_data.getSecondHopSentTime();
+        const int64_t wake_latency_ns = std::max<int64_t>(0, woke_us - arrival_us) * 1000;
+        stat_wakeups_.fetch_add(1U, std::memory_order_relaxed);
+        stat_wake_latency_sum_ns_.fetch_add(wake_latency_ns, std::memory_order_relaxed);
+        if (wake_latency_ns > stat_wake_latency_max_ns_.load(std::memory_order_relaxed)) {
+            stat_wake_latency_max_ns_.store(wake_latency_ns, std::memory_order_relaxed);
+        }
+    } else if (path == ReceivePath::Spin) {
+        stat_spin_hits_.fetch_add(1U, std::memory_order_relaxed);
+    } else {
+        stat_ready_hits_.fetch_add(1U, std::memory_order_relaxed);
+    }
+    
+    LOG_INFO_EVERY_MS(RECEIVE_LOG_INTERVAL_MS, "[c_hexagon] DelayCalcTrackData received - TrackID: {}, Size: {} bytes",
+                      track_data.getTrackId(), size);
+    
+    // Log latency metrics (async, ~20ns overhead)
+    utils::Logger::logTrackReceived(
+        track_data.getTrackId(),
+        track_data.getFirstHopDelayTime(),
+        second_hop_latency_us);
+    
+    // Forward to domain layer via hexagonal architecture port
+    tracer.record(utils::TraceStage::Receive, track_data.getTrackId(), track_data.getUpdateTime(), receive_ns);
+    utils::FlightRecorder::instance().record(utils::FlightEventKind::Receive, track_data.getTrackId(),
+                                             track_data.getUpdateTime());
+    track_data_submission_->submitDelayCalcTrackData(track_data);
+}
+
 /**
  * @brief Deserializes binary data into DelayCalcTrackData object
  * @param binary_data Raw binary data received from ZeroMQ
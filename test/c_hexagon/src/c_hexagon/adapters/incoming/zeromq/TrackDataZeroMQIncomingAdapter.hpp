@@ -16,8 +16,11 @@
 #pragma once
 
 #include "adapters/common/IAdapter.hpp"
+#include "adapters/common/UdpTimestampedReceiver.hpp"
+#include "adapters/common/ZmqContextRegistry.hpp"
 #include "domain/ports/incoming/IDelayCalcTrackDataIncomingPort.hpp"
 #include "domain/ports/incoming/DelayCalcTrackData.hpp"
+#include "utils/Metrics.hpp"
 #include <zmq_config.hpp>  // Must be included before zmq.hpp for Draft API
 #include <zmq.hpp>
 #include <zmq_addon.hpp>
@@ -28,6 +31,7 @@
 #include <sstream>
 #include <optional>
 #include <cstring>
+#include <cstdint>
 #include <chrono>
 
 // Using declarations for convenience
@@ -37,6 +41,42 @@ namespace adapters {
 namespace incoming {
 namespace zeromq {
 
+/**
+ * @brief How the subscriber thread waits for the next message
+ */
+enum class ReceiveMode : uint8_t {
+    BusyPoll,      ///< recv(dontwait) + 10 us sleep (legacy, burns the core at idle)
+    Blocking,      ///< zmq_poll until readable, thread sleeps in the kernel
+    AdaptiveSpin   ///< spin for a window after each message, then zmq_poll
+};
+
+/**
+ * @brief Which socket receives the RADIO traffic
+ */
+enum class IngressMode : uint8_t {
+    ZeroMqDish,            ///< ZeroMQ DISH socket (default); receive time taken in user space
+    KernelTimestampedUdp   ///< Plain UDP socket parsing RADIO datagrams, kernel RX timestamps
+};
+
+/**
+ * @brief Receive loop counters (snapshot)
+ * @details Every message is classified by how the loop got it: already
+ *          queued (no wait), caught while spinning, or delivered by a blocking
+ *          wait. Wake latency is measured only for the latter, from arrival
+ *          (kernel RX timestamp, else the sender's secondHopSentTime) to the
+ *          wait returning, so it excludes receive and decode cost.
+ */
+struct ReceiveStats {
+    ReceiveMode mode{ReceiveMode::Blocking};
+    uint64_t messages{0U};            ///< Messages received
+    uint64_t ready_hits{0U};          ///< Messages already queued when polled
+    uint64_t spin_hits{0U};           ///< Messages that arrived inside a spin window
+    uint64_t wakeups{0U};             ///< Messages that followed a blocking wait
+    uint64_t spin_time_us{0U};        ///< Total time spent spinning
+    int64_t wake_latency_avg_ns{0};   ///< Mean arrival to wait-return time
+    int64_t wake_latency_max_ns{0};   ///< Worst arrival to wait-return time
+};
+
 /**
  * @brief ZeroMQ DISH Adapter for receiving DelayCalcTrackData via UDP multicast
  * @details Thread-per-Type architecture compliant - runs in dedicated thread.
@@ -56,7 +96,9 @@ private:
     // Real-time thread configuration
     static constexpr int REALTIME_THREAD_PRIORITY = 95;
     static constexpr int DEDICATED_CPU_CORE = 2;  // Different from b_hexagon
-    static constexpr int RECEIVE_TIMEOUT_MS = 100;
+    static constexpr int RECEIVE_TIMEOUT_MS = 100;       // Poll timeout (bounds stop() latency)
+    static constexpr int64_t DEFAULT_SPIN_WINDOW_US = 50;  // AdaptiveSpin window after a message
+    static constexpr int64_t RECEIVE_LOG_INTERVAL_MS = 1000;  // Per-message log sampling period
     
     // Network configuration constants (UDP RADIO/DISH pattern)
     static constexpr const char* DEFAULT_MULTICAST_ADDRESS = "127.0.0.1";
@@ -68,6 +110,13 @@ private:
     static constexpr int LINGER_MS = 0;
     static constexpr int HIGH_WATER_MARK = 0;  // Unlimited
     
+    /// How the worker obtained a message (ReceiveStats classification)
+    enum class ReceivePath : uint8_t {
+        Ready,   ///< Already queued, no wait
+        Spin,    ///< Arrived inside the spin window
+        Wake     ///< Arrived during a blocking wait
+    };
+    
     // ==================== Member Variables ====================
     std::shared_ptr<domain::ports::incoming::IDelayCalcTrackDataIncomingPort> track_data_submission_;
     
@@ -77,12 +126,35 @@ private:
     std::string adapter_name_;        // Adapter identifier for logging
     
     // ZeroMQ C++ context and socket
-    zmq::context_t zmq_context_;
+    std::shared_ptr<zmq::context_t> zmq_context_;  // Process-wide shared context
     std::unique_ptr<zmq::socket_t> dish_socket_;
     
+    // Kernel-timestamped UDP ingress (IngressMode::KernelTimestampedUdp)
+    IngressMode ingress_mode_{IngressMode::ZeroMqDish};
+    adapters::UdpTimestampedReceiver udp_receiver_;
+    
     // Thread management
     std::thread subscriber_thread_;
     std::atomic<bool> running_;
+    
+    // Receive mode (fixed while running)
+    ReceiveMode receive_mode_{ReceiveMode::Blocking};
+    std::chrono::microseconds spin_window_{DEFAULT_SPIN_WINDOW_US};
+    
+    // Receive loop counters (written by the subscriber thread only)
+    std::atomic<uint64_t> stat_messages_{0U};
+    std::atomic<uint64_t> stat_ready_hits_{0U};
+    std::atomic<uint64_t> stat_spin_hits_{0U};
+    std::atomic<uint64_t> stat_wakeups_{0U};
+    std::atomic<uint64_t> stat_spin_time_us_{0U};
+    std::atomic<int64_t> stat_wake_latency_sum_ns_{0};
+    std::atomic<int64_t> stat_wake_latency_max_ns_{0};
+    
+    // Process-wide metrics (subscriber thread is the only writer)
+    utils::Metric& metric_received_{utils::MetricsRegistry::instance().counter("incoming.received")};
+    utils::Metric& metric_bytes_{utils::MetricsRegistry::instance().counter("incoming.bytes")};
+    utils::Metric& metric_decode_failures_{utils::MetricsRegistry::instance().counter("incoming.decode_failures")};
+    utils::Metric& metric_invalid_{utils::MetricsRegistry::instance().counter("incoming.invalid")};
 
 public:
     /**
@@ -129,6 +201,44 @@ public:
      */
     [[nodiscard]] std::string getName() const override;
 
+    /**
+     * @brief Select how the subscriber thread waits for messages
+     * @param mode Receive mode
+     * @param spin_window Spin time after each message (AdaptiveSpin only)
+     * @return false if the adapter is running (mode unchanged)
+     */
+    bool setReceiveMode(ReceiveMode mode,
+                        std::chrono::microseconds spin_window = std::chrono::microseconds(DEFAULT_SPIN_WINDOW_US));
+
+    /**
+     * @brief Select the ingress socket
+     * @details KernelTimestampedUdp closes the DISH socket and binds a plain
+     *          UDP socket to the same endpoint on start(); each message then
+     *          carries its kernel arrival time instead of the adapter's receive
+     *          time (DelayCalcTrackData::getSecondHopReceiveTime), so the
+     *          network / in-process split of the second hop no longer counts
+     *          the ZeroMQ I/O thread as network. The receive mode does not
+     *          apply: the thread blocks in poll() between messages.
+     * @param mode Ingress mode
+     * @return false if the adapter is running (mode unchanged)
+     */
+    bool setIngressMode(IngressMode mode);
+
+    /**
+     * @brief Active ingress mode
+     */
+    [[nodiscard]] IngressMode getIngressMode() const noexcept;
+
+    /**
+     * @brief Snapshot of receive loop counters (any thread)
+     */
+    [[nodiscard]] ReceiveStats getReceiveStats() const noexcept;
+
+    /**
+     * @brief Printable receive mode name
+     */
+    [[nodiscard]] static const char* receiveModeName(ReceiveMode mode) noexcept;
+
 private:
     /**
      * @brief Initializes the ZeroMQ DISH socket
@@ -140,6 +250,43 @@ private:
      */
     void subscriberWorker();
 
+    /**
+     * @brief Non-blocking receive
+     * @return true if a non-empty message was received
+     */
+    bool tryReceive(zmq::message_t& message);
+
+    /**
+     * @brief Spin on tryReceive() for up to spin_window_
+     * @return true if a message arrived inside the window
+     */
+    bool spinReceive(zmq::message_t& message);
+
+    /**
+     * @brief Block in zmq_poll (up to RECEIVE_TIMEOUT_MS) then receive
+     * @param woke_us Set to the wall-clock time (us) the poll returned
+     * @return true if a message was received
+     */
+    bool blockingReceive(zmq::message_t& message, int64_t& woke_us);
+
+    /**
+     * @brief Receive loop for IngressMode::KernelTimestampedUdp
+     */
+    void timestampedUdpWorker();
+
+    /**
+     * @brief Deserialize, record latency and forward one message
+     * @param data Message body
+     * @param size Body length
+     * @param path How the worker obtained the message
+     * @param woke_us Wall-clock time (us) the blocking wait returned
+     *                (ReceivePath::Wake only)
+     * @param kernel_receive_us Kernel arrival time, 0 if unknown (the
+     *                          userspace receive time is recorded instead)
+     */
+    void handleMessage(const uint8_t* data, std::size_t size, ReceivePath path, int64_t woke_us,
+                       int64_t kernel_receive_us);
+
     /**
      * @brief Deserializes binary data to DelayCalcTrackData
      * @param binary_data Raw binary data from ZeroMQ message
@@ -0,0 +1,141 @@
+/**
+ * @file LatencySnapshotFileOutgoingAdapter.cpp
+ * @brief Implementation of the latency snapshot dump writer
+ *
+ * @author c_hexagon Team
+ * @version 1.0
+ * @date 2025
+ *
+ * @note MISRA C++ 2023 compliant implementation
+ * @see LatencySnapshotFileOutgoingAdapter.hpp
+ */
+
+#include "LatencySnapshotFileOutgoingAdapter.hpp"
+#include "utils/Logger.hpp"
+#include <cerrno>
+#include <cstring>
+#include <utility>
+
+namespace adapters {
+namespace outgoing {
+namespace file {
+
+using domain::ports::LatencySnapshot;
+
+LatencySnapshotFileOutgoingAdapter::LatencySnapshotFileOutgoingAdapter(std::string path)
+    : path_(std::move(path)) {
+}
+
+LatencySnapshotFileOutgoingAdapter::~LatencySnapshotFileOutgoingAdapter() noexcept {
+    stop();
+}
+
+bool LatencySnapshotFileOutgoingAdapter::start() {
+    std::lock_guard<std::mutex> lock(fileMutex_);
+    if (file_ != nullptr) {
+        return true;
+    }
+
+    file_ = std::fopen(path_.c_str(), "ab");
+    if (file_ == nullptr) {
+        LOG_ERROR("Cannot open latency dump {}: {}", path_, std::strerror(errno));
+        return false;
+    }
+
+    // New (empty) file: write the header once
+    if ((std::fseek(file_, 0, SEEK_END) == 0) && (std::ftell(file_) == 0)) {
+        LatencyDumpHeader header;
+        header.magic = LATENCY_DUMP_MAGIC;
+        header.version = LATENCY_DUMP_VERSION;
+        header.recordSize = static_cast<uint16_t>(sizeof(LatencySnapshot));
+        if (std::fwrite(&header, sizeof(header), 1U, file_) != 1U) {
+            LOG_ERROR("Cannot write latency dump header: {}", path_);
+            std::fclose(file_);
+            file_ = nullptr;
+            return false;
+        }
+        static_cast<void>(std::fflush(file_));
+    }
+
+    written_.store(0U);
+    running_.store(true);
+    LOG_INFO("Latency snapshot dump: {}", path_);
+    return true;
+}
+
+void LatencySnapshotFileOutgoingAdapter::stop() {
+    std::lock_guard<std::mutex> lock(fileMutex_);
+    running_.store(false);
+    if (file_ != nullptr) {
+        std::fclose(file_);
+        file_ = nullptr;
+    }
+}
+
+bool LatencySnapshotFileOutgoingAdapter::isRunning() const {
+    return running_.load();
+}
+
+std::string LatencySnapshotFileOutgoingAdapter::getName() const {
+    return "LatencySnapshotFileOutgoingAdapter";
+}
+
+bool LatencySnapshotFileOutgoingAdapter::isReady() const {
+    return running_.load();
+}
+
+void LatencySnapshotFileOutgoingAdapter::publishLatencySnapshots(
+    const std::vector<LatencySnapshot>& snapshots) {
+    if (snapshots.empty()) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(fileMutex_);
+    if (file_ == nullptr) {
+        return;
+    }
+
+    const std::size_t written = std::fwrite(snapshots.data(), sizeof(LatencySnapshot),
+                                            snapshots.size(), file_);
+    static_cast<void>(std::fflush(file_));
+    written_.fetch_add(written);
+    if (written != snapshots.size()) {
+        LOG_WARN("Latency dump short write: {} of {} snapshots", written, snapshots.size());
+    }
+}
+
+bool LatencySnapshotFileOutgoingAdapter::readDump(const std::string& path,
+                                                  std::vector<LatencySnapshot>& out) {
+    std::FILE* in = std::fopen(path.c_str(), "rb");
+    if (in == nullptr) {
+        return false;
+    }
+
+    LatencyDumpHeader header;
+    bool ok = (std::fread(&header, sizeof(header), 1U, in) == 1U) &&
+              (header.magic == LATENCY_DUMP_MAGIC) &&
+              (header.version == LATENCY_DUMP_VERSION) &&
+              (header.recordSize == sizeof(LatencySnapshot));
+
+    LatencySnapshot record;
+    while (ok) {
+        const std::size_t got = std::fread(&record, 1U, sizeof(record), in);
+        if (got == sizeof(record)) {
+            out.push_back(record);
+        } else {
+            ok = (got == 0U);  // Partial record: torn write
+            break;
+        }
+    }
+
+    std::fclose(in);
+    return ok;
+}
+
+uint64_t LatencySnapshotFileOutgoingAdapter::writtenCount() const noexcept {
+    return written_.load();
+}
+
+} // namespace file
+} // namespace outgoing
+} // namespace adapters
@@ -0,0 +1,112 @@
+/**
+ * @file LatencySnapshotFileOutgoingAdapter.hpp
+ * @brief Appends latency percentile snapshots to a compact binary dump file
+ * @details Layout (native byte order):
+ *
+ * @code
+ * offset  size  field
+ *      0     4  magic        (0x4C415443, "LATC")
+ *      4     2  version      (1)
+ *      6     2  recordSize   (sizeof(LatencySnapshot), 80)
+ *      8     8  reserved     (0)
+ *     16     -  LatencySnapshot records, appended once per rotation interval
+ * @endcode
+ *
+ * Size grows with (tracks + 1) x hops per interval, independent of the message
+ * rate: 100 tracks at 1 s intervals write ~24 KB/s.
+ *
+ * @author c_hexagon Team
+ * @version 1.0
+ * @date 2025
+ *
+ * @note MISRA C++ 2023 compliant implementation
+ */
+
+#pragma once
+
+#include "adapters/common/IAdapter.hpp"
+#include "domain/ports/outgoing/ILatencyStatisticsOutgoingPort.hpp"
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace adapters {
+namespace outgoing {
+namespace file {
+
+/**
+ * @struct LatencyDumpHeader
+ * @brief Fixed 16-byte file header
+ */
+struct LatencyDumpHeader {
+    uint32_t magic{0U};
+    uint16_t version{0U};
+    uint16_t recordSize{0U};
+    uint64_t reserved{0U};
+};
+
+static_assert(sizeof(LatencyDumpHeader) == 16U, "LatencyDumpHeader must be 16 bytes on disk");
+
+/// @brief Dump identification constants
+static constexpr uint32_t LATENCY_DUMP_MAGIC{0x4C415443U};
+static constexpr uint16_t LATENCY_DUMP_VERSION{1U};
+
+/**
+ * @class LatencySnapshotFileOutgoingAdapter
+ * @brief File-backed ILatencyStatisticsOutgoingPort
+ * @details publishLatencySnapshots() runs on the domain thread once per
+ *          interval: one buffered fwrite of the whole interval plus fflush.
+ */
+class LatencySnapshotFileOutgoingAdapter final
+    : public adapters::IAdapter
+    , public domain::ports::outgoing::ILatencyStatisticsOutgoingPort {
+public:
+    /**
+     * @brief Constructor
+     * @param path Dump file, created or appended to on start()
+     */
+    explicit LatencySnapshotFileOutgoingAdapter(std::string path);
+
+    ~LatencySnapshotFileOutgoingAdapter() noexcept override;
+
+    LatencySnapshotFileOutgoingAdapter(const LatencySnapshotFileOutgoingAdapter&) = delete;
+    LatencySnapshotFileOutgoingAdapter& operator=(const LatencySnapshotFileOutgoingAdapter&) = delete;
+    LatencySnapshotFileOutgoingAdapter(LatencySnapshotFileOutgoingAdapter&&) = delete;
+    LatencySnapshotFileOutgoingAdapter& operator=(LatencySnapshotFileOutgoingAdapter&&) = delete;
+
+    // ==================== IAdapter Interface ====================
+    [[nodiscard]] bool start() override;
+    void stop() override;
+    [[nodiscard]] bool isRunning() const override;
+    [[nodiscard]] std::string getName() const override;
+
+    // ==================== ILatencyStatisticsOutgoingPort Interface ====================
+    void publishLatencySnapshots(const std::vector<domain::ports::LatencySnapshot>& snapshots) override;
+    [[nodiscard]] bool isReady() const override;
+
+    /**
+     * @brief Read every snapshot of a dump file (offline analysis, tests)
+     * @param path Dump file
+     * @param out Receives the records in file order
+     * @return false if the file is missing, has a bad header or a torn record
+     */
+    [[nodiscard]] static bool readDump(const std::string& path,
+                                       std::vector<domain::ports::LatencySnapshot>& out);
+
+    /// @brief Records written since start()
+    [[nodiscard]] uint64_t writtenCount() const noexcept;
+
+private:
+    std::string path_;                      ///< Dump file path
+    mutable std::mutex fileMutex_;          ///< Guards file_ (publish vs stop)
+    std::FILE* file_{nullptr};              ///< Open dump file
+    std::atomic<bool> running_{false};      ///< Running state flag
+    std::atomic<uint64_t> written_{0U};     ///< Records written
+};
+
+} // namespace file
+} // namespace outgoing
+} // namespace adapters
@@ -13,6 +13,9 @@
 
 #include "FinalCalcTrackDataZeroMQOutgoingAdapter.hpp"
 #include "utils/Logger.hpp"
+#include "utils/StageTracer.hpp"
+#include "utils/FlightRecorder.hpp"
+#include <array>
 #include <chrono>
 #include <sstream>
 #ifdef __linux__
@@ -42,15 +45,18 @@ namespace {
 
 /**
  * @brief Default constructor with UDP multicast configuration
+ * @param waitStrategy Publisher thread wait policy (blocking if null)
  */
-FinalCalcTrackDataZeroMQOutgoingAdapter::FinalCalcTrackDataZeroMQOutgoingAdapter()
+FinalCalcTrackDataZeroMQOutgoingAdapter::FinalCalcTrackDataZeroMQOutgoingAdapter(
+    std::shared_ptr<utils::WaitStrategy> waitStrategy)
     : endpoint_(buildEndpoint(DEFAULT_MULTICAST_ADDRESS, DEFAULT_PORT))
     , group_(DEFAULT_GROUP)
     , adapter_name_("FinalCalcTrackData-OutAdapter")
-    , zmq_context_(1)
+    , zmq_context_(ZmqContextRegistry::instance().acquire())
     , radio_socket_(nullptr)
     , running_(false)
-    , ready_(false) {
+    , ready_(false)
+    , message_queue_(MAX_QUEUE_SIZE, std::move(waitStrategy)) {
     
     initializeRadioSocket();
 }
@@ -59,17 +65,20 @@ FinalCalcTrackDataZeroMQOutgoingAdapter::FinalCalcTrackDataZeroMQOutgoingAdapter
  * @brief Custom configuration constructor
  * @param endpoint ZeroMQ endpoint for RADIO socket
  * @param group_name Group name for message routing
+ * @param waitStrategy Publisher thread wait policy (blocking if null)
  */
 FinalCalcTrackDataZeroMQOutgoingAdapter::FinalCalcTrackDataZeroMQOutgoingAdapter(
     const std::string& endpoint,
-    const std::string& group_name)
+    const std::string& group_name,
+    std::shared_ptr<utils::WaitStrategy> waitStrategy)
     : endpoint_(endpoint)
     , group_(group_name)
     , adapter_name_(group_name + "-OutAdapter")
-    , zmq_context_(1)
+    , zmq_context_(ZmqContextRegistry::instance().acquire())
     , radio_socket_(nullptr)
     , running_(false)
-    , ready_(false) {
+    , ready_(false)
+    , message_queue_(MAX_QUEUE_SIZE, std::move(waitStrategy)) {
     
     initializeRadioSocket();
 }
@@ -91,7 +100,7 @@ void FinalCalcTrackDataZeroMQOutgoingAdapter::initializeRadioSocket() {
                  endpoint_, group_);
 
         // Create RADIO socket (publisher for RADIO/DISH pattern)
-        radio_socket_ = std::make_unique<zmq::socket_t>(zmq_context_, zmq::socket_type::radio);
+        radio_socket_ = std::make_unique<zmq::socket_t>(*zmq_context_, zmq::socket_type::radio);
 
         // Configure socket options for optimal performance
         radio_socket_->set(zmq::sockopt::sndhwm, HIGH_WATER_MARK);
@@ -128,6 +137,7 @@ bool FinalCalcTrackDataZeroMQOutgoingAdapter::start() {
     }
 
     running_ = true;
+    message_queue_.resetWake();
 
     // Start background publisher thread
     publisher_thread_ = std::thread([this]() {
@@ -157,7 +167,7 @@ bool FinalCalcTrackDataZeroMQOutgoingAdapter::start() {
         publisherWorker();
     });
 
-    LOG_INFO("RADIO adapter started: {}", adapter_name_);
+    LOG_INFO("RADIO adapter started: {} ({} wait)", adapter_name_, message_queue_.waitStrategy().name());
     return true;
 }
 
@@ -174,7 +184,7 @@ void FinalCalcTrackDataZeroMQOutgoingAdapter::stop() {
     ready_ = false;
 
     // Wake up the worker thread
-    queue_cv_.notify_all();
+    message_queue_.wakeConsumer();
 
     if (publisher_thread_.joinable()) {
         publisher_thread_.join();
@@ -223,6 +233,39 @@ void FinalCalcTrackDataZeroMQOutgoingAdapter::sendFinalTrackData(
     enqueueMessage(data);
 }
 
+/**
+ * @brief Send a batch of FinalCalcTrackData (non-blocking)
+ * @param data Final calculated track data to queue, in order
+ */
+void FinalCalcTrackDataZeroMQOutgoingAdapter::sendFinalTrackData(
+    const std::vector<domain::ports::FinalCalcTrackData>& data) {
+    
+    if (data.empty()) {
+        return;
+    }
+    if (!isReady()) {
+        LOG_WARN("Adapter not ready, dropping {} messages", data.size());
+        return;
+    }
+
+    std::size_t dropped = 0U;
+    {
+        std::lock_guard<utils::SpinLock> guard(producer_lock_);
+        
+        for (const domain::ports::FinalCalcTrackData& item : data) {
+            // Bounded ring: evicts the oldest message when full
+            if (!message_queue_.push(item)) {
+                metric_queue_drops_.add();
+                ++dropped;
+            }
+        }
+    }
+    
+    if (dropped != 0U) {
+        LOG_WARN_EVERY_MS(DROP_LOG_INTERVAL_MS, "Message queue full, dropped {} oldest messages", dropped);
+    }
+}
+
 /**
  * @brief Enqueue message for transmission
  * @param data Track data to queue
@@ -230,19 +273,20 @@ void FinalCalcTrackDataZeroMQOutgoingAdapter::sendFinalTrackData(
 void FinalCalcTrackDataZeroMQOutgoingAdapter::enqueueMessage(
     const domain::ports::FinalCalcTrackData& data) {
     
+    bool accepted = false;
     {
-        std::lock_guard<std::mutex> lock(queue_mutex_);
+        std::lock_guard<utils::SpinLock> guard(producer_lock_);
         
-        // Prevent unbounded queue growth
-        if (message_queue_.size() >= MAX_QUEUE_SIZE) {
-            LOG_WARN("Message queue full, dropping oldest message");
-            message_queue_.pop();
+        // Bounded ring: evicts the oldest message when full
+        accepted = message_queue_.push(data);
+        if (!accepted) {
+            metric_queue_drops_.add();
         }
-        
-        message_queue_.push(data);
     }
     
-    queue_cv_.notify_one();
+    if (!accepted) {
+        LOG_WARN_EVERY_MS(DROP_LOG_INTERVAL_MS, "Message queue full, dropping oldest message");
+    }
 }
 
 /**
@@ -253,55 +297,54 @@ void FinalCalcTrackDataZeroMQOutgoingAdapter::publisherWorker() {
     LOG_DEBUG("Publisher worker started");
 
     while (running_.load()) {
-        domain::ports::FinalCalcTrackData data;
-        
-        // Wait for message with timeout
-        {
-            std::unique_lock<std::mutex> lock(queue_mutex_);
-            
-            if (queue_cv_.wait_for(lock, std::chrono::milliseconds(100),
-                [this]() { return !message_queue_.empty() || !running_.load(); })) {
-                
-                if (!running_.load()) {
-                    break;
-                }
-                
-                if (!message_queue_.empty()) {
-                    data = std::move(message_queue_.front());
-                    message_queue_.pop();
-                } else {
-                    continue;
-                }
-            } else {
-                continue;  // Timeout, check running flag
-            }
+        // Wait through the configured strategy (timeout lets us re-check running flag),
+        // then take everything pending up to one drain buffer with a single claim
+        const std::size_t count = message_queue_.waitPopBatch(drain_buffer_.data(), drain_buffer_.size(),
+                                                              std::chrono::milliseconds(QUEUE_WAIT_TIMEOUT_MS));
+        for (std::size_t i = 0U; i < count; ++i) {
+            publishRecord(drain_buffer_[i]);
         }
+    }
 
-        // Serialize and send
-        try {
-            std::vector<uint8_t> serialized = data.serialize();
-            
-            // Create ZMQ message with group
-            zmq::message_t msg(serialized.data(), serialized.size());
-            msg.set_group(group_.c_str());
-            
-            auto result = radio_socket_->send(msg, zmq::send_flags::dontwait);
-            
-            if (result.has_value()) {
-                LOG_DEBUG("[c_hexagon] FinalCalcTrackData sent - TrackID: {}, Size: {} bytes",
-                         data.getTrackId(), serialized.size());
-            } else {
-                LOG_WARN("Failed to send FinalCalcTrackData - TrackID: {}", data.getTrackId());
-            }
+    LOG_DEBUG("Publisher worker stopped");
+}
 
-        } catch (const zmq::error_t& e) {
-            LOG_ERROR("ZMQ send error: {}", e.what());
-        } catch (const std::exception& e) {
-            LOG_ERROR("Send error: {}", e.what());
+/**
+ * @brief Serialize and send one record
+ * @param data Track data to send
+ */
+void FinalCalcTrackDataZeroMQOutgoingAdapter::publishRecord(const domain::ports::FinalCalcTrackData& data) {
+    try {
+        // Encode into a stack buffer (no allocation per record)
+        std::array<uint8_t, domain::ports::FinalCalcTrackData::kWireSize> serialized{};
+        const std::size_t size = data.serializeInto(serialized.data(), serialized.size());
+        
+        // Create ZMQ message with group
+        zmq::message_t msg(serialized.data(), size);
+        msg.set_group(group_.c_str());
+        
+        auto result = radio_socket_->send(msg, zmq::send_flags::dontwait);
+        
+        if (result.has_value()) {
+            utils::StageTracer::instance().record(utils::TraceStage::Send, data.getTrackId(), data.getUpdateTime());
+            utils::FlightRecorder::instance().record(utils::FlightEventKind::Send, data.getTrackId(),
+                                                     data.getUpdateTime());
+            metric_sent_.add();
+            metric_bytes_.add(size);
+            LOG_DEBUG("[c_hexagon] FinalCalcTrackData sent - TrackID: {}, Size: {} bytes",
+                     data.getTrackId(), size);
+        } else {
+            metric_send_failures_.add();
+            utils::FlightRecorder::instance().record(utils::FlightEventKind::SendFailed, data.getTrackId(),
+                                                     data.getUpdateTime());
+            LOG_WARN("Failed to send FinalCalcTrackData - TrackID: {}", data.getTrackId());
         }
-    }
 
-    LOG_DEBUG("Publisher worker stopped");
+    } catch (const zmq::error_t& e) {
+        LOG_ERROR("ZMQ send error: {}", e.what());
+    } catch (const std::exception& e) {
+        LOG_ERROR("Send error: {}", e.what());
+    }
 }
 
 } // namespace zeromq
@@ -14,8 +14,13 @@
 #pragma once
 
 #include "adapters/common/IAdapter.hpp"
+#include "adapters/common/ZmqContextRegistry.hpp"
 #include "domain/ports/outgoing/ITrackDataStatisticOutgoingPort.hpp"
 #include "domain/ports/outgoing/FinalCalcTrackData.hpp"
+#include "utils/Metrics.hpp"
+#include "utils/SpscRingBuffer.hpp"
+#include "utils/SpinLock.hpp"
+#include "utils/WaitStrategy.hpp"
 #include <zmq_config.hpp>  // Must be included before zmq.hpp for Draft API
 #include <zmq.hpp>
 #include <zmq_addon.hpp>
@@ -23,9 +28,7 @@
 #include <atomic>
 #include <memory>
 #include <string>
-#include <mutex>
-#include <queue>
-#include <condition_variable>
+#include <vector>
 
 namespace adapters {
 namespace outgoing {
@@ -47,7 +50,8 @@ namespace zeromq {
  *          (for hexagonal architecture integration).
  * 
  * Thread Safety:
- * - Uses mutex-protected queue for thread-safe message passing
+ * - Lock-free drop-oldest ring between senders (serialised by a spin lock)
+ *   and the worker; the worker waits through a selectable WaitStrategy
  * - Background worker thread handles actual ZMQ transmission
  * - Non-blocking sendFinalTrackData() for real-time performance
  */
@@ -58,18 +62,21 @@ class FinalCalcTrackDataZeroMQOutgoingAdapter
 public:
     /**
      * @brief Constructor with default configuration
+     * @param waitStrategy How the publisher thread waits for data (blocking if null)
      * @details Uses TCP localhost for development/container environment
      */
-    FinalCalcTrackDataZeroMQOutgoingAdapter();
+    explicit FinalCalcTrackDataZeroMQOutgoingAdapter(std::shared_ptr<utils::WaitStrategy> waitStrategy = nullptr);
 
     /**
      * @brief Constructor with custom configuration
      * @param endpoint ZeroMQ endpoint (e.g., "tcp://127.0.0.1:15003")
      * @param group_name Multicast group name for RADIO socket
+     * @param waitStrategy How the publisher thread waits for data (blocking if null)
      */
     FinalCalcTrackDataZeroMQOutgoingAdapter(
         const std::string& endpoint,
-        const std::string& group_name);
+        const std::string& group_name,
+        std::shared_ptr<utils::WaitStrategy> waitStrategy = nullptr);
 
     /**
      * @brief Destructor - ensures graceful shutdown
@@ -118,6 +125,13 @@ public:
      */
     void sendFinalTrackData(const domain::ports::FinalCalcTrackData& data) override;
 
+    /**
+     * @brief Send a batch of FinalCalcTrackData to external system
+     * @param data Final calculated track data to transmit, in order
+     * @details Non-blocking - queues the batch under one lock and wakes the worker once
+     */
+    void sendFinalTrackData(const std::vector<domain::ports::FinalCalcTrackData>& data) override;
+
     /**
      * @brief Check if the outgoing connection is ready
      * @return true if socket is bound and ready to send
@@ -136,6 +150,12 @@ private:
      */
     void publisherWorker();
 
+    /**
+     * @brief Serialize and send one record (publisher thread)
+     * @param data Track data to send
+     */
+    void publishRecord(const domain::ports::FinalCalcTrackData& data);
+
     /**
      * @brief Enqueue message for transmission
      * @param data Track data to send
@@ -159,6 +179,9 @@ private:
     static constexpr int LINGER_MS = 0;
     static constexpr int HIGH_WATER_MARK = 0;  // Unlimited
     static constexpr std::size_t MAX_QUEUE_SIZE = 1000;  ///< Prevent unbounded growth
+    static constexpr int64_t DROP_LOG_INTERVAL_MS = 1000;  ///< Queue-full warning sampling period
+    static constexpr int QUEUE_WAIT_TIMEOUT_MS = 100;      ///< Worker wake-up period for shutdown checks
+    static constexpr std::size_t DRAIN_BATCH_SIZE = 32;    ///< Records taken from the ring per dequeue
     
     // ==================== Member Variables ====================
     // Configuration
@@ -167,7 +190,7 @@ private:
     std::string adapter_name_;      ///< Adapter identifier
 
     // ZeroMQ components
-    zmq::context_t zmq_context_;
+    std::shared_ptr<zmq::context_t> zmq_context_;  // Process-wide shared context
     std::unique_ptr<zmq::socket_t> radio_socket_;
 
     // Thread management
@@ -175,10 +198,17 @@ private:
     std::atomic<bool> running_;
     std::atomic<bool> ready_;
 
-    // Thread-safe message queue
-    mutable std::mutex queue_mutex_;
-    std::condition_variable queue_cv_;
-    std::queue<domain::ports::FinalCalcTrackData> message_queue_;
+    // Sender → publisher hand-off
+    utils::SpscRingBuffer<domain::ports::FinalCalcTrackData> message_queue_;  ///< Drop-oldest message ring
+    utils::SpinLock producer_lock_;                                           ///< Serialises concurrent senders
+    std::vector<domain::ports::FinalCalcTrackData> drain_buffer_ =
+        std::vector<domain::ports::FinalCalcTrackData>(DRAIN_BATCH_SIZE);     ///< Publisher-owned dequeue buffer
+
+    // Process-wide metrics (drops under producer_lock_, the rest by the worker)
+    utils::Metric& metric_queue_drops_{utils::MetricsRegistry::instance().counter("outgoing.queue_drops")};
+    utils::Metric& metric_sent_{utils::MetricsRegistry::instance().counter("outgoing.sent")};
+    utils::Metric& metric_bytes_{utils::MetricsRegistry::instance().counter("outgoing.bytes")};
+    utils::Metric& metric_send_failures_{utils::MetricsRegistry::instance().counter("outgoing.send_failures")};
 };
 
 } // namespace zeromq
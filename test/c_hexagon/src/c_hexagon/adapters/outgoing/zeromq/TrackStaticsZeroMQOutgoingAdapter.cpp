@@ -0,0 +1,309 @@
+/**
+ * @file TrackStaticsZeroMQOutgoingAdapter.cpp
+ * @brief Implementation of ZeroMQ RADIO socket adapter for TrackStatics
+ * @details Implements the outgoing adapter for publishing per-track delay
+ *          statistics using ZeroMQ RADIO/DISH pattern for group-based messaging.
+ * 
+ * @author c_hexagon Team
+ * @version 1.0
+ * @date 2025
+ * 
+ * @note MISRA C++ 2023 compliant implementation
+ */
+
+#include "TrackStaticsZeroMQOutgoingAdapter.hpp"
+#include "utils/Logger.hpp"
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <sstream>
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#include <cerrno>
+#include <cstring>
+#endif
+
+namespace adapters {
+namespace outgoing {
+namespace zeromq {
+
+namespace {
+    /**
+     * @brief Constructs UDP multicast endpoint string
+     * @param address Multicast address (e.g., "239.1.1.5")
+     * @param port Port number
+     * @return Formatted endpoint string (e.g., "udp://239.1.1.5:9599")
+     */
+    std::string buildEndpoint(const char* address, int port) {
+        std::ostringstream oss;
+        oss << "udp://" << address << ":" << port;
+        return oss.str();
+    }
+}
+
+/**
+ * @brief Default constructor with UDP multicast configuration
+ */
+TrackStaticsZeroMQOutgoingAdapter::TrackStaticsZeroMQOutgoingAdapter()
+    : endpoint_(buildEndpoint(DEFAULT_MULTICAST_ADDRESS, DEFAULT_PORT))
+    , group_(DEFAULT_GROUP)
+    , adapter_name_("TrackStatics-OutAdapter")
+    , zmq_context_(ZmqContextRegistry::instance().acquire())
+    , radio_socket_(nullptr)
+    , running_(false)
+    , ready_(false) {
+    
+    initializeRadioSocket();
+}
+
+/**
+ * @brief Custom configuration constructor
+ * @param endpoint ZeroMQ endpoint for RADIO socket
+ * @param group_name Group name for message routing
+ */
+TrackStaticsZeroMQOutgoingAdapter::TrackStaticsZeroMQOutgoingAdapter(
+    const std::string& endpoint,
+    const std::string& group_name)
+    : endpoint_(endpoint)
+    , group_(group_name)
+    , adapter_name_(group_name + "-OutAdapter")
+    , zmq_context_(ZmqContextRegistry::instance().acquire())
+    , radio_socket_(nullptr)
+    , running_(false)
+    , ready_(false) {
+    
+    initializeRadioSocket();
+}
+
+/**
+ * @brief Destructor - ensures graceful shutdown
+ */
+TrackStaticsZeroMQOutgoingAdapter::~TrackStaticsZeroMQOutgoingAdapter() {
+    stop();
+}
+
+/**
+ * @brief Initialize the ZeroMQ RADIO socket
+ * @throws zmq::error_t if initialization fails
+ */
+void TrackStaticsZeroMQOutgoingAdapter::initializeRadioSocket() {
+    try {
+        LOG_INFO("Initializing RADIO socket - Endpoint: {}, Group: {}", 
+                 endpoint_, group_);
+
+        // Create RADIO socket (publisher for RADIO/DISH pattern)
+        radio_socket_ = std::make_unique<zmq::socket_t>(*zmq_context_, zmq::socket_type::radio);
+
+        // Configure socket options for optimal performance
+        radio_socket_->set(zmq::sockopt::sndhwm, HIGH_WATER_MARK);
+        radio_socket_->set(zmq::sockopt::sndtimeo, SEND_TIMEOUT_MS);
+        radio_socket_->set(zmq::sockopt::linger, LINGER_MS);
+        radio_socket_->set(zmq::sockopt::immediate, 1);        // Process immediately
+
+        // RADIO connects to endpoints (opposite of DISH which binds)
+        LOG_DEBUG("Connecting RADIO socket to endpoint");
+        radio_socket_->connect(endpoint_);
+
+        ready_ = true;
+        LOG_INFO("RADIO socket initialized successfully");
+
+    } catch (const zmq::error_t& e) {
+        LOG_ERROR("ZMQ RADIO socket initialization error: {}", e.what());
+        ready_ = false;
+        throw;
+    } catch (const std::exception& e) {
+        LOG_ERROR("RADIO socket initialization error: {}", e.what());
+        ready_ = false;
+        throw;
+    }
+}
+
+/**
+ * @brief Start the publisher thread
+ * @return true if started successfully
+ */
+bool TrackStaticsZeroMQOutgoingAdapter::start() {
+    if (running_.load()) {
+        LOG_WARN("Adapter already running: {}", adapter_name_);
+        return false;
+    }
+
+    running_ = true;
+
+    // Start background publisher thread
+    publisher_thread_ = std::thread([this]() {
+        #ifdef __linux__
+        // Set real-time scheduling priority
+        struct sched_param param;
+        param.sched_priority = REALTIME_THREAD_PRIORITY;
+        int ret = pthread_setschedparam(pthread_self(), SCHED_FIFO, &param);
+        if (ret != 0) {
+            LOG_DEBUG("RT scheduling not available (priority {}): {} - running with default scheduling", REALTIME_THREAD_PRIORITY, std::strerror(ret));
+        } else {
+            LOG_DEBUG("Outgoing adapter thread RT priority set to {}", REALTIME_THREAD_PRIORITY);
+        }
+
+        // Set CPU affinity
+        cpu_set_t cpuset;
+        CPU_ZERO(&cpuset);
+        CPU_SET(DEDICATED_CPU_CORE, &cpuset);
+        ret = pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuset);
+        if (ret != 0) {
+            LOG_DEBUG("CPU affinity not set (core {}): {} - running on any available core", DEDICATED_CPU_CORE, std::strerror(ret));
+        } else {
+            LOG_DEBUG("Outgoing adapter thread pinned to CPU core {}", DEDICATED_CPU_CORE);
+        }
+        #endif
+
+        publisherWorker();
+    });
+
+    LOG_INFO("RADIO adapter started: {}", adapter_name_);
+    return true;
+}
+
+/**
+ * @brief Stop the publisher thread gracefully
+ */
+void TrackStaticsZeroMQOutgoingAdapter::stop() {
+    if (!running_.load()) {
+        return;
+    }
+
+    LOG_INFO("Stopping RADIO adapter: {}", adapter_name_);
+    running_ = false;
+    ready_ = false;
+
+    // Wake up the worker thread
+    queue_cv_.notify_all();
+
+    if (publisher_thread_.joinable()) {
+        publisher_thread_.join();
+    }
+
+    LOG_INFO("RADIO adapter stopped: {}", adapter_name_);
+}
+
+/**
+ * @brief Check if adapter is running
+ * @return true if running
+ */
+bool TrackStaticsZeroMQOutgoingAdapter::isRunning() const {
+    return running_.load();
+}
+
+/**
+ * @brief Get adapter name
+ * @return Adapter identifier string
+ */
+std::string TrackStaticsZeroMQOutgoingAdapter::getName() const {
+    return adapter_name_;
+}
+
+/**
+ * @brief Check if ready to send
+ * @return true if socket is ready
+ */
+bool TrackStaticsZeroMQOutgoingAdapter::isReady() const {
+    return ready_.load() && running_.load();
+}
+
+/**
+ * @brief Publish one cadence of TrackStatics (non-blocking)
+ * @param statics Records to transmit
+ * @details Appends to the hand-over buffer for background transmission
+ */
+void TrackStaticsZeroMQOutgoingAdapter::sendTrackStatics(
+    const std::vector<domain::ports::TrackStatics>& statics) {
+    
+    if (!isReady()) {
+        LOG_WARN("Adapter not ready, dropping {} TrackStatics records", statics.size());
+        return;
+    }
+
+    std::size_t dropped = 0U;
+    {
+        std::lock_guard<std::mutex> lock(queue_mutex_);
+        
+        // Prevent unbounded growth if the worker falls a whole cadence behind
+        const std::size_t room = MAX_QUEUE_SIZE - std::min(pending_.size(), MAX_QUEUE_SIZE);
+        const std::size_t accepted = std::min(room, statics.size());
+        pending_.insert(pending_.end(), statics.begin(), statics.begin() + static_cast<std::ptrdiff_t>(accepted));
+        dropped = statics.size() - accepted;
+    }
+    
+    if (dropped != 0U) {
+        LOG_WARN("TrackStatics queue full, dropped {} records", dropped);
+    }
+    queue_cv_.notify_one();
+}
+
+/**
+ * @brief Background worker for message transmission
+ * @details Takes the whole pending batch per wake-up and sends it outside the lock
+ */
+void TrackStaticsZeroMQOutgoingAdapter::publisherWorker() {
+    LOG_DEBUG("Publisher worker started");
+
+    std::vector<domain::ports::TrackStatics> batch;
+    batch.reserve(MAX_QUEUE_SIZE);
+
+    while (running_.load()) {
+        // Wait for a batch with timeout
+        {
+            std::unique_lock<std::mutex> lock(queue_mutex_);
+            
+            if (!queue_cv_.wait_for(lock, std::chrono::milliseconds(100),
+                [this]() { return !pending_.empty() || !running_.load(); })) {
+                continue;  // Timeout, check running flag
+            }
+            if (!running_.load()) {
+                break;
+            }
+            batch.swap(pending_);
+        }
+
+        for (const domain::ports::TrackStatics& statics : batch) {
+            sendRecord(statics);
+        }
+        batch.clear();
+    }
+
+    LOG_DEBUG("Publisher worker stopped");
+}
+
+/**
+ * @brief Serialize and send one record
+ * @param statics Record to transmit
+ */
+void TrackStaticsZeroMQOutgoingAdapter::sendRecord(const domain::ports::TrackStatics& statics) {
+    try {
+        // Encode into a stack buffer (no allocation per record)
+        std::array<uint8_t, domain::ports::TrackStatics::kWireSize> serialized{};
+        const std::size_t size = statics.serializeInto(serialized.data(), serialized.size());
+        
+        // Create ZMQ message with group
+        zmq::message_t msg(serialized.data(), size);
+        msg.set_group(group_.c_str());
+        
+        auto result = radio_socket_->send(msg, zmq::send_flags::dontwait);
+        
+        if (result.has_value()) {
+            LOG_DEBUG("[c_hexagon] TrackStatics sent - TrackID: {}, Size: {} bytes",
+                     statics.getTrackId(), size);
+        } else {
+            LOG_WARN("Failed to send TrackStatics - TrackID: {}", statics.getTrackId());
+        }
+
+    } catch (const zmq::error_t& e) {
+        LOG_ERROR("ZMQ send error: {}", e.what());
+    } catch (const std::exception& e) {
+        LOG_ERROR("Send error: {}", e.what());
+    }
+}
+
+} // namespace zeromq
+} // namespace outgoing
+} // namespace adapters
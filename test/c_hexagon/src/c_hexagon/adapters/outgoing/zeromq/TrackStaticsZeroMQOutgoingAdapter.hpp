@@ -0,0 +1,183 @@
+/**
+ * @file TrackStaticsZeroMQOutgoingAdapter.hpp
+ * @brief ZeroMQ RADIO socket adapter for publishing TrackStatics
+ * @details Implements the outgoing adapter in hexagonal architecture for
+ *          transmitting per-track delay statistics to downstream consumers.
+ * 
+ * @author c_hexagon Team
+ * @version 1.0
+ * @date 2025
+ * 
+ * @note MISRA C++ 2023 compliant implementation
+ */
+
+#pragma once
+
+#include "adapters/common/IAdapter.hpp"
+#include "adapters/common/ZmqContextRegistry.hpp"
+#include "domain/ports/outgoing/ITrackStaticsOutgoingPort.hpp"
+#include "domain/ports/outgoing/TrackStatics.hpp"
+#include <zmq_config.hpp>  // Must be included before zmq.hpp for Draft API
+#include <zmq.hpp>
+#include <zmq_addon.hpp>
+#include <thread>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <mutex>
+#include <vector>
+#include <condition_variable>
+
+namespace adapters {
+namespace outgoing {
+namespace zeromq {
+
+/**
+ * @brief ZeroMQ RADIO Adapter for TrackStatics transmission via UDP multicast
+ * @details Thread-per-Type architecture compliant - runs in dedicated thread.
+ *          Uses RADIO/DISH pattern for group-based UDP multicast messaging,
+ *          one TrackStatics record (kWireSize bytes) per message.
+ * 
+ * Network Flow:
+ * - C_hexagon (RADIO) --[UDP Multicast]--> TrackStatics consumers (DISH)
+ * 
+ * Thread Safety:
+ * - The domain thread hands over a whole cadence batch under one lock
+ * - Background worker thread drains the batch and performs the ZMQ sends
+ * - Non-blocking sendTrackStatics() for real-time performance
+ * 
+ * @note MISRA C++ 2023 compliant implementation
+ */
+class TrackStaticsZeroMQOutgoingAdapter 
+    : public adapters::IAdapter
+    , public domain::ports::outgoing::ITrackStaticsOutgoingPort {
+    
+public:
+    /**
+     * @brief Constructor with default configuration
+     * @details Uses TCP localhost for development/container environment
+     */
+    TrackStaticsZeroMQOutgoingAdapter();
+
+    /**
+     * @brief Constructor with custom configuration
+     * @param endpoint ZeroMQ endpoint (e.g., "tcp://127.0.0.1:15003")
+     * @param group_name Multicast group name for RADIO socket
+     */
+    TrackStaticsZeroMQOutgoingAdapter(
+        const std::string& endpoint,
+        const std::string& group_name);
+
+    /**
+     * @brief Destructor - ensures graceful shutdown
+     */
+    ~TrackStaticsZeroMQOutgoingAdapter() override;
+
+    // Delete copy operations
+    TrackStaticsZeroMQOutgoingAdapter(const TrackStaticsZeroMQOutgoingAdapter&) = delete;
+    TrackStaticsZeroMQOutgoingAdapter& operator=(const TrackStaticsZeroMQOutgoingAdapter&) = delete;
+
+    // ═══════════════════════════════════════════════════════════════════
+    // IAdapter Interface Implementation
+    // ═══════════════════════════════════════════════════════════════════
+
+    /**
+     * @brief Start the RADIO publisher
+     * @return true if started successfully
+     */
+    [[nodiscard]] bool start() override;
+
+    /**
+     * @brief Stop the RADIO publisher
+     */
+    void stop() override;
+
+    /**
+     * @brief Check if adapter is running
+     * @return true if running
+     */
+    [[nodiscard]] bool isRunning() const override;
+
+    /**
+     * @brief Get adapter name for logging
+     * @return Adapter identifier
+     */
+    [[nodiscard]] std::string getName() const override;
+
+    // ═══════════════════════════════════════════════════════════════════
+    // ITrackStaticsOutgoingPort Interface Implementation
+    // ═══════════════════════════════════════════════════════════════════
+
+    /**
+     * @brief Publish one cadence of TrackStatics
+     * @param statics Records to transmit (copied)
+     * @details Non-blocking - queues the records for background transmission
+     */
+    void sendTrackStatics(const std::vector<domain::ports::TrackStatics>& statics) override;
+
+    /**
+     * @brief Check if the outgoing connection is ready
+     * @return true if socket is bound and ready to send
+     */
+    [[nodiscard]] bool isReady() const override;
+
+private:
+    /**
+     * @brief Initialize the ZeroMQ RADIO socket
+     * @throws zmq::error_t if socket initialization fails
+     */
+    void initializeRadioSocket();
+
+    /**
+     * @brief Background worker thread for message transmission
+     */
+    void publisherWorker();
+
+    /**
+     * @brief Send one record to the RADIO group (worker thread)
+     * @param statics Record to transmit
+     */
+    void sendRecord(const domain::ports::TrackStatics& statics);
+
+private:
+    // ==================== Configuration Constants ====================
+    // Real-time thread configuration
+    static constexpr int REALTIME_THREAD_PRIORITY = 95;
+    static constexpr int DEDICATED_CPU_CORE = 4;  // Shares the outgoing core (low rate)
+    static constexpr int SEND_TIMEOUT_MS = 100;
+    
+    // Network configuration constants (UDP RADIO/DISH pattern)
+    static constexpr const char* DEFAULT_MULTICAST_ADDRESS = "239.1.1.5";
+    static constexpr int DEFAULT_PORT = 9599;  // Output port for TrackStatics
+    static constexpr const char* DEFAULT_PROTOCOL = "udp";
+    static constexpr const char* DEFAULT_GROUP = "TrackStatics";
+    
+    // Socket configuration
+    static constexpr int LINGER_MS = 0;
+    static constexpr int HIGH_WATER_MARK = 0;  // Unlimited
+    static constexpr std::size_t MAX_QUEUE_SIZE = 4096;  ///< Records pending; a full cadence of tracks fits
+    
+    // ==================== Member Variables ====================
+    // Configuration
+    std::string endpoint_;          ///< ZeroMQ endpoint
+    std::string group_;             ///< Multicast group name
+    std::string adapter_name_;      ///< Adapter identifier
+
+    // ZeroMQ components
+    std::shared_ptr<zmq::context_t> zmq_context_;  // Process-wide shared context
+    std::unique_ptr<zmq::socket_t> radio_socket_;
+
+    // Thread management
+    std::thread publisher_thread_;
+    std::atomic<bool> running_;
+    std::atomic<bool> ready_;
+
+    // Thread-safe hand-over buffer (swapped with the worker's local buffer)
+    mutable std::mutex queue_mutex_;
+    std::condition_variable queue_cv_;
+    std::vector<domain::ports::TrackStatics> pending_;
+};
+
+} // namespace zeromq
+} // namespace outgoing
+} // namespace adapters
@@ -0,0 +1,168 @@
+/**
+ * @file LatencyStatistics.cpp
+ * @brief Implementation of the per-hop latency histograms
+ *
+ * @author c_hexagon Team
+ * @version 1.0
+ * @date 2025
+ *
+ * @note MISRA C++ 2023 compliant implementation
+ * @see LatencyStatistics.hpp
+ */
+
+#include "LatencyStatistics.hpp"
+#include <utility>
+
+namespace domain {
+namespace logic {
+
+namespace {
+    /// @brief Exported percentiles, ascending (p50, p90, p99, p99.9)
+    constexpr std::array<double, 4U> EXPORTED_PERCENTILES{50.0, 90.0, 99.0, 99.9};
+}
+
+LatencyStatistics::LatencyStatistics(std::size_t maxTrackedTracks, int64_t intervalStartUs)
+    : maxTrackedTracks_(maxTrackedTracks)
+    , intervalStartUs_(intervalStartUs) {
+    tracks_.reserve(maxTrackedTracks_);
+    spareSets_.reserve(maxTrackedTracks_);
+}
+
+void LatencyStatistics::record(const ports::FinalCalcTrackData& data) {
+    recordInto(global_, data);
+    recordSecondHopSplit(data);
+
+    const auto found = tracks_.find(data.getTrackId());
+    if (found != tracks_.end()) {
+        recordInto(*found->second, data);
+    } else if (tracks_.size() < maxTrackedTracks_) {
+        auto inserted = tracks_.emplace(data.getTrackId(), takeSpareSet());
+        recordInto(*inserted.first->second, data);
+    } else {
+        ++untrackedSamples_;
+    }
+}
+
+template <typename Histogram>
+void LatencyStatistics::recordInto(HopHistograms<Histogram>& set, const ports::FinalCalcTrackData& data) noexcept {
+    set.hops[static_cast<std::size_t>(ports::LatencyHop::FirstHop)].record(data.getFirstHopDelayTime());
+    set.hops[static_cast<std::size_t>(ports::LatencyHop::SecondHop)].record(data.getSecondHopDelayTime());
+    set.hops[static_cast<std::size_t>(ports::LatencyHop::Total)].record(data.getTotalDelayTime());
+}
+
+template <typename Histogram>
+void LatencyStatistics::resetUsed(Histogram& histogram) noexcept {
+    // Clearing touches every bucket; an empty histogram is already clear
+    if (histogram.count() != 0U) {
+        histogram.reset();
+    }
+}
+
+std::unique_ptr<LatencyStatistics::TrackHopHistograms> LatencyStatistics::takeSpareSet() {
+    if (spareSets_.empty()) {
+        return std::make_unique<TrackHopHistograms>();
+    }
+    std::unique_ptr<TrackHopHistograms> set = std::move(spareSets_.back());
+    spareSets_.pop_back();
+    set->idleIntervals = 0U;
+    return set;
+}
+
+void LatencyStatistics::recordSecondHopSplit(const ports::FinalCalcTrackData& data) noexcept {
+    const int64_t receiveTime = data.getSecondHopReceiveTime();
+    if (receiveTime <= 0) {
+        return;  // No receive timestamp: the split is unknown
+    }
+    // Sent time is on b_hexagon's clock; receive and third-hop times are local
+    secondHopSplit_[0U].record((receiveTime + data.getSecondHopClockOffset()) - data.getSecondHopSentTime());
+    secondHopSplit_[1U].record(data.getThirdHopSentTime() - receiveTime);
+}
+
+void LatencyStatistics::rotate(int64_t intervalEndUs, std::vector<ports::LatencySnapshot>& out) {
+    appendSnapshots(global_, ports::LATENCY_GLOBAL_TRACK_ID, intervalEndUs, out);
+    for (uint8_t hop = ports::LATENCY_HOP_COUNT; hop < ports::LATENCY_GLOBAL_HOP_COUNT; ++hop) {
+        appendSnapshot(secondHopSplit_[hop - ports::LATENCY_HOP_COUNT], ports::LATENCY_GLOBAL_TRACK_ID, hop,
+                       intervalEndUs, out);
+    }
+    for (auto& entry : tracks_) {
+        appendSnapshots(*entry.second, entry.first, intervalEndUs, out);
+    }
+
+    // Reset in place, skipping histograms that saw no samples this interval
+    for (auto& histogram : global_.hops) {
+        resetUsed(histogram);
+    }
+    for (auto& histogram : secondHopSplit_) {
+        resetUsed(histogram);
+    }
+    for (auto entry = tracks_.begin(); entry != tracks_.end();) {
+        TrackHopHistograms& set = *entry->second;
+        // Every record() feeds all hops, so the total hop tells whether the track was active
+        if (set.hops[static_cast<std::size_t>(ports::LatencyHop::Total)].count() != 0U) {
+            set.idleIntervals = 0U;
+            for (auto& histogram : set.hops) {
+                resetUsed(histogram);
+            }
+            ++entry;
+        } else if (++set.idleIntervals >= TRACK_IDLE_INTERVALS_BEFORE_EVICTION) {
+            spareSets_.push_back(std::move(entry->second));
+            entry = tracks_.erase(entry);
+        } else {
+            ++entry;
+        }
+    }
+    untrackedSamples_ = 0U;
+    intervalStartUs_ = intervalEndUs;
+}
+
+template <typename Histogram>
+void LatencyStatistics::appendSnapshots(const HopHistograms<Histogram>& set, int32_t trackId, int64_t intervalEndUs,
+                                        std::vector<ports::LatencySnapshot>& out) const {
+    for (uint8_t hop = 0U; hop < ports::LATENCY_HOP_COUNT; ++hop) {
+        appendSnapshot(set.hops[hop], trackId, hop, intervalEndUs, out);
+    }
+}
+
+template <typename Histogram>
+void LatencyStatistics::appendSnapshot(const Histogram& histogram, int32_t trackId, uint8_t hop,
+                                       int64_t intervalEndUs, std::vector<ports::LatencySnapshot>& out) const {
+    if (histogram.count() == 0U) {
+        return;
+    }
+
+    std::array<int64_t, EXPORTED_PERCENTILES.size()> values{};
+    histogram.valuesAtPercentiles(EXPORTED_PERCENTILES.data(), EXPORTED_PERCENTILES.size(), values.data());
+
+    ports::LatencySnapshot snapshot;
+    snapshot.intervalStartUs = intervalStartUs_;
+    snapshot.intervalEndUs = intervalEndUs;
+    snapshot.trackId = trackId;
+    snapshot.hop = hop;
+    snapshot.count = histogram.count();
+    snapshot.minUs = histogram.min();
+    snapshot.p50Us = values[0U];
+    snapshot.p90Us = values[1U];
+    snapshot.p99Us = values[2U];
+    snapshot.p999Us = values[3U];
+    snapshot.maxUs = histogram.max();
+    out.push_back(snapshot);
+}
+
+const utils::HdrHistogram& LatencyStatistics::global(ports::LatencyHop hop) const noexcept {
+    const auto index = static_cast<std::size_t>(hop);
+    if (index >= ports::LATENCY_HOP_COUNT) {
+        return secondHopSplit_[index - ports::LATENCY_HOP_COUNT];
+    }
+    return global_.hops[index];
+}
+
+std::size_t LatencyStatistics::trackedTrackCount() const noexcept {
+    return tracks_.size();
+}
+
+uint64_t LatencyStatistics::untrackedSampleCount() const noexcept {
+    return untrackedSamples_;
+}
+
+} // namespace logic
+} // namespace domain
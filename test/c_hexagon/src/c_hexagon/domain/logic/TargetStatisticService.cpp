@@ -14,6 +14,8 @@
 
 #include "TargetStatisticService.hpp"
 #include "utils/Logger.hpp"
+#include "utils/StageTracer.hpp"
+#include "utils/FlightRecorder.hpp"
 #include <chrono>
 #ifdef __linux__
 #include <pthread.h>
@@ -51,15 +53,19 @@ TargetStatisticService::TargetStatisticService(
 /**
  * @brief Constructor with outgoing port injection (shared_ptr)
  * @param outgoing_port Shared pointer to the outgoing port adapter
+ * @param waitStrategy Domain thread wait policy (blocking if null)
  */
 TargetStatisticService::TargetStatisticService(
-    std::shared_ptr<ports::outgoing::ITrackDataStatisticOutgoingPort> outgoing_port)
+    std::shared_ptr<ports::outgoing::ITrackDataStatisticOutgoingPort> outgoing_port,
+    std::shared_ptr<utils::WaitStrategy> waitStrategy)
     : outgoing_port_(std::move(outgoing_port))
+    , eventQueue_(MAX_QUEUE_SIZE, std::move(waitStrategy))
     , running_{false} {
     if (!outgoing_port_) {
         throw std::invalid_argument("ITrackDataStatisticOutgoingPort cannot be null");
     }
-    LOG_DEBUG("TargetStatisticService initialized with outgoing adapter (shared_ptr)");
+    LOG_DEBUG("TargetStatisticService initialized with outgoing adapter (shared_ptr, {} wait)",
+              eventQueue_.waitStrategy().name());
 }
 
 /**
@@ -79,6 +85,14 @@ bool TargetStatisticService::start() {
     }
 
     running_.store(true);
+    eventQueue_.resetWake();
+    outputBatch_.reserve(DRAIN_BATCH_SIZE);
+    if (latencyStatistics_) {
+        nextLatencyRotation_ = std::chrono::steady_clock::now() + latencyRotationInterval_;
+    }
+    if (trackStatics_) {
+        nextTrackStaticsPublish_ = std::chrono::steady_clock::now() + trackStaticsCadence_;
+    }
 
     // Start dedicated processing thread
     processingThread_ = std::thread([this]() {
@@ -122,11 +136,12 @@ void TargetStatisticService::stop() {
     running_.store(false);
 
     // Wake up the processing thread
-    queueCV_.notify_all();
+    eventQueue_.wakeConsumer();
 
     if (processingThread_.joinable()) {
         processingThread_.join();
     }
+    queueCounters_.publish(eventQueue_);  // Pushes after the last drain
 
     LOG_INFO("TargetStatisticService stopped");
 }
@@ -135,6 +150,146 @@ bool TargetStatisticService::isRunning() const {
     return running_.load();
 }
 
+// ==================== Latency Histograms ====================
+
+bool TargetStatisticService::enableLatencyStatistics(
+    std::shared_ptr<ports::outgoing::ILatencyStatisticsOutgoingPort> port,
+    std::chrono::milliseconds rotationInterval,
+    std::size_t maxTrackedTracks) {
+    if (running_.load()) {
+        LOG_WARN("Latency statistics must be configured before start()");
+        return false;
+    }
+    if (!port || (rotationInterval.count() <= 0)) {
+        LOG_ERROR("Latency statistics need an export port and a positive rotation interval");
+        return false;
+    }
+
+    const int64_t nowUs = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+    latencyStatistics_ = std::make_unique<LatencyStatistics>(maxTrackedTracks, nowUs);
+    latencyPort_ = std::move(port);
+    latencyRotationInterval_ = rotationInterval;
+    latencySnapshots_.clear();
+    latencySnapshots_.reserve(((maxTrackedTracks + 1U) * ports::LATENCY_HOP_COUNT) +
+                              (ports::LATENCY_GLOBAL_HOP_COUNT - ports::LATENCY_HOP_COUNT));
+
+    LOG_INFO("Latency statistics enabled - rotation: {} ms, tracked tracks: {}",
+             rotationInterval.count(), maxTrackedTracks);
+    return true;
+}
+
+const LatencyStatistics* TargetStatisticService::latencyStatistics() const noexcept {
+    return latencyStatistics_.get();
+}
+
+void TargetStatisticService::rotateLatencyStatistics(bool force) {
+    if (!latencyStatistics_) {
+        return;
+    }
+
+    const auto now = std::chrono::steady_clock::now();
+    if (!force && (now < nextLatencyRotation_)) {
+        return;
+    }
+    nextLatencyRotation_ = now + latencyRotationInterval_;
+
+    const int64_t nowUs = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+    latencySnapshots_.clear();
+    latencyStatistics_->rotate(nowUs, latencySnapshots_);
+    if (latencySnapshots_.empty()) {
+        return;
+    }
+
+    // Global snapshots come first, one per hop
+    for (const ports::LatencySnapshot& snapshot : latencySnapshots_) {
+        if (snapshot.trackId != ports::LATENCY_GLOBAL_TRACK_ID) {
+            break;
+        }
+        LOG_INFO("Latency hop {} | n={} | p50: {} μs | p90: {} μs | p99: {} μs | p99.9: {} μs | max: {} μs",
+                 static_cast<uint32_t>(snapshot.hop), snapshot.count, snapshot.p50Us, snapshot.p90Us,
+                 snapshot.p99Us, snapshot.p999Us, snapshot.maxUs);
+    }
+
+    if (latencyPort_->isReady()) {
+        latencyPort_->publishLatencySnapshots(latencySnapshots_);
+    } else {
+        LOG_WARN("Latency snapshot port not ready - dropped {} snapshots", latencySnapshots_.size());
+    }
+}
+
+// ==================== TrackStatics ====================
+
+bool TargetStatisticService::enableTrackStatics(
+    std::shared_ptr<ports::outgoing::ITrackStaticsOutgoingPort> port,
+    std::chrono::milliseconds cadence,
+    std::size_t maxTracks) {
+    if (running_.load()) {
+        LOG_WARN("TrackStatics must be configured before start()");
+        return false;
+    }
+    if (!port || (cadence.count() <= 0)) {
+        LOG_ERROR("TrackStatics need an outgoing port and a positive cadence");
+        return false;
+    }
+
+    trackStatics_ = std::make_unique<TrackStaticsAggregator>(maxTracks);
+    trackStaticsPort_ = std::move(port);
+    trackStaticsCadence_ = cadence;
+    trackStaticsBuffer_.clear();
+    trackStaticsBuffer_.reserve(maxTracks);
+
+    LOG_INFO("TrackStatics enabled - cadence: {} ms, max tracks: {}", cadence.count(), maxTracks);
+    return true;
+}
+
+const TrackStaticsAggregator* TargetStatisticService::trackStaticsAggregator() const noexcept {
+    return trackStatics_.get();
+}
+
+// ==================== Clock Correction ====================
+
+bool TargetStatisticService::setClockOffsetSource(const utils::ClockSyncClient* source) {
+    if (running_.load()) {
+        LOG_WARN("Clock offset source must be configured before start()");
+        return false;
+    }
+    clockSource_ = source;
+    return true;
+}
+
+void TargetStatisticService::publishTrackStatics(bool force) {
+    if (!trackStatics_) {
+        return;
+    }
+
+    const auto now = std::chrono::steady_clock::now();
+    if (!force && (now < nextTrackStaticsPublish_)) {
+        return;
+    }
+    nextTrackStaticsPublish_ = now + trackStaticsCadence_;
+
+    const int64_t nowUs = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+    trackStaticsBuffer_.clear();
+    if (trackStatics_->collect(nowUs, trackStaticsBuffer_) == 0U) {
+        return;
+    }
+
+    if (trackStaticsPort_->isReady()) {
+        trackStaticsPort_->sendTrackStatics(trackStaticsBuffer_);
+        LOG_DEBUG("Published {} TrackStatics records", trackStaticsBuffer_.size());
+    } else {
+        LOG_WARN("TrackStatics port not ready - dropped {} records", trackStaticsBuffer_.size());
+    }
+}
+
+void TargetStatisticService::runPeriodicExports(bool force) {
+    rotateLatencyStatistics(force);
+    publishTrackStatics(force);
+}
+
 // ==================== Event Queue Interface ====================
 
 /**
@@ -143,35 +298,42 @@ bool TargetStatisticService::isRunning() const {
  */
 void TargetStatisticService::submitDelayCalcTrackData(const DelayCalcTrackData& delayCalcData) {
     if (!running_.load()) {
+        metricInvalid_.add();
         LOG_WARN("TargetStatisticService not running, dropping track: {}", delayCalcData.getTrackId());
         return;
     }
 
     // Validate input data before queueing
     if (!delayCalcData.isValid()) {
+        metricInvalid_.add();
         LOG_WARN("Invalid DelayCalcTrackData received: ID={}", delayCalcData.getTrackId());
         return;
     }
 
-    // Non-blocking enqueue (~20ns)
+    // Non-blocking enqueue
     enqueueMessage(delayCalcData);
 }
 
 void TargetStatisticService::enqueueMessage(const DelayCalcTrackData& data) {
-    {
-        std::lock_guard<std::mutex> lock(queueMutex_);
-
-        // Prevent unbounded queue growth
-        if (eventQueue_.size() >= MAX_QUEUE_SIZE) {
-            LOG_WARN("Event queue full (size: {}), dropping oldest message for track: {}",
-                     MAX_QUEUE_SIZE, data.getTrackId());
-            eventQueue_.pop();
-        }
-
-        eventQueue_.push(data);
+    // Stamp before the push: the domain thread may dequeue before we return
+    utils::StageTracer& tracer = utils::StageTracer::instance();
+    const int64_t enqueueNs = tracer.isEnabled() ? utils::StageTracer::nowNs() : 0;
+
+    // One slot per track: a pending message of this track is replaced in place,
+    // a new track evicts the oldest pending track when every slot is taken.
+    // The queue counts both; the domain thread publishes them as metrics.
+    const utils::ConflateResult result = eventQueue_.push(data);
+    tracer.record(utils::TraceStage::Enqueue, data.getTrackId(), data.getUpdateTime(), enqueueNs);
+    utils::FlightRecorder& recorder = utils::FlightRecorder::instance();
+    recorder.record(utils::FlightEventKind::Enqueue, data.getTrackId(), data.getUpdateTime());
+
+    if (result == utils::ConflateResult::Replaced) {
+        recorder.record(utils::FlightEventKind::Conflated, data.getTrackId(), data.getUpdateTime());
+    } else if (result == utils::ConflateResult::EvictedOldest) {
+        recorder.record(utils::FlightEventKind::QueueDrop, data.getTrackId(), data.getUpdateTime());
+        LOG_WARN_EVERY_MS(DROP_LOG_INTERVAL_MS, "Event queue full ({} tracks pending), evicted the oldest track for track: {}",
+                          MAX_QUEUE_SIZE, data.getTrackId());
     }
-
-    queueCV_.notify_one();
 }
 
 // ==================== Background Processing Loop ====================
@@ -180,34 +342,31 @@ void TargetStatisticService::process() {
     LOG_DEBUG("Domain processing thread started");
 
     while (running_.load()) {
-        DelayCalcTrackData data;
-
-        // Wait for message with timeout
-        {
-            std::unique_lock<std::mutex> lock(queueMutex_);
-
-            if (queueCV_.wait_for(lock, std::chrono::milliseconds(QUEUE_WAIT_TIMEOUT_MS),
-                [this]() { return !eventQueue_.empty() || !running_.load(); })) {
-
-                if (!running_.load()) {
-                    break;
-                }
-
-                if (!eventQueue_.empty()) {
-                    data = std::move(eventQueue_.front());
-                    eventQueue_.pop();
-                } else {
-                    continue;
-                }
-            } else {
-                continue;  // Timeout, check running flag
-            }
+        // Wait for messages with timeout (timeout lets us re-check running flag),
+        // then take everything pending up to one batch in a single queue lock
+        const std::size_t count = eventQueue_.waitPopBatch(inputBatch_.data(), inputBatch_.size(),
+                                                           std::chrono::milliseconds(QUEUE_WAIT_TIMEOUT_MS));
+        if (count == 0U) {
+            runPeriodicExports(false);
+            continue;
         }
 
-        // Process track data (outside lock)
-        processDelayCalcData(data);
+        for (std::size_t i = 0U; i < count; ++i) {
+            const DelayCalcTrackData& data = inputBatch_[i];
+            utils::StageTracer::instance().record(utils::TraceStage::Dequeue, data.getTrackId(), data.getUpdateTime());
+            utils::FlightRecorder::instance().record(utils::FlightEventKind::Dequeue, data.getTrackId(),
+                                                     data.getUpdateTime());
+        }
+        metricQueueDepth_.set(static_cast<int64_t>(eventQueue_.size()));
+        queueCounters_.publish(eventQueue_);
+        processBatch(count);
+        metricProcessed_.add(static_cast<uint64_t>(count));
+        runPeriodicExports(false);
     }
 
+    // Export the last partial interval and pending TrackStatics
+    runPeriodicExports(true);
+
     LOG_DEBUG("Domain processing thread stopped");
 }
 
@@ -218,10 +377,7 @@ void TargetStatisticService::process() {
  */
 void TargetStatisticService::processDelayCalcData(const DelayCalcTrackData& delayCalcData) {
     // Business Logic: Create FinalCalcTrackData
-    FinalCalcTrackData finalData = createFinalCalcTrackData(delayCalcData);
-
-    // Log processing results
-    logProcessingResults(finalData);
+    const FinalCalcTrackData finalData = finalizeTrack(delayCalcData, clockEstimate());
 
     // Send via outgoing port (Hexagonal Architecture)
     if (outgoing_port_ && outgoing_port_->isReady()) {
@@ -232,6 +388,52 @@ void TargetStatisticService::processDelayCalcData(const DelayCalcTrackData& dela
     }
 }
 
+/**
+ * @brief Process a drained batch and forward it to the outgoing port
+ * @param count Number of valid entries in inputBatch_
+ * @details One clock offset read, one readiness check and one send per batch
+ */
+void TargetStatisticService::processBatch(std::size_t count) {
+    const utils::ClockOffsetEstimate clock = clockEstimate();
+
+    // Capacity reserved in start(): no allocation while draining
+    outputBatch_.clear();
+    for (std::size_t i = 0U; i < count; ++i) {
+        outputBatch_.push_back(finalizeTrack(inputBatch_[i], clock));
+    }
+
+    // Send via outgoing port (Hexagonal Architecture)
+    if (outgoing_port_ && outgoing_port_->isReady()) {
+        outgoing_port_->sendFinalTrackData(outputBatch_);
+        LOG_DEBUG("Sent {} FinalCalcTrackData records via outgoing adapter", outputBatch_.size());
+    } else {
+        LOG_WARN("Custom outgoing adapter not ready");
+    }
+}
+
+/**
+ * @brief Create one result and record its hop delays
+ * @param delayCalcData Input data to be processed
+ * @param clock Offset estimate of b_hexagon's clock
+ * @return FinalCalcTrackData ready to send
+ */
+FinalCalcTrackData TargetStatisticService::finalizeTrack(const DelayCalcTrackData& delayCalcData,
+                                                         const utils::ClockOffsetEstimate& clock) {
+    FinalCalcTrackData finalData = createFinalCalcTrackData(delayCalcData, clock);
+
+    // Record hop delays, log per-message details at DEBUG
+    if (latencyStatistics_) {
+        latencyStatistics_->record(finalData);
+    }
+    if (trackStatics_) {
+        trackStatics_->record(finalData);
+    }
+    logProcessingResults(finalData);
+    utils::StageTracer::instance().record(utils::TraceStage::ComputeEnd, finalData.getTrackId(), finalData.getUpdateTime());
+
+    return finalData;
+}
+
 /**
  * @brief Create FinalCalcTrackData from DelayCalcTrackData
  * @param delayCalcData Source data with delay calculations
@@ -240,40 +442,80 @@ void TargetStatisticService::processDelayCalcData(const DelayCalcTrackData& dela
  *          and computes total delay as sum of first and second hop delays
  */
 FinalCalcTrackData TargetStatisticService::createFinalCalcTrackData(const DelayCalcTrackData& delayCalcData) {
-    FinalCalcTrackData finalData;
-
-    // Copy basic track data
-    finalData.setTrackId(delayCalcData.getTrackId());
-    finalData.setXPositionECEF(delayCalcData.getXPositionECEF());
-    finalData.setYPositionECEF(delayCalcData.getYPositionECEF());
-    finalData.setZPositionECEF(delayCalcData.getZPositionECEF());
-    finalData.setXVelocityECEF(delayCalcData.getXVelocityECEF());
-    finalData.setYVelocityECEF(delayCalcData.getYVelocityECEF());
-    finalData.setZVelocityECEF(delayCalcData.getZVelocityECEF());
+    return createFinalCalcTrackData(delayCalcData, clockEstimate());
+}
 
+/**
+ * @brief Create FinalCalcTrackData with a clock offset estimate read by the caller
+ * @param delayCalcData Source data with delay calculations
+ * @param clock Offset estimate of b_hexagon's clock
+ * @return FinalCalcTrackData with computed hop delays and total delay
+ */
+FinalCalcTrackData TargetStatisticService::createFinalCalcTrackData(const DelayCalcTrackData& delayCalcData,
+                                                                    const utils::ClockOffsetEstimate& clock) {
     // Set timing information
     auto currentTime = std::chrono::duration_cast<std::chrono::microseconds>(
         std::chrono::high_resolution_clock::now().time_since_epoch()).count();
 
-    finalData.setThirdHopSentTime(currentTime);
-    finalData.setSecondHopSentTime(delayCalcData.getSecondHopSentTime());
-    finalData.setFirstHopDelayTime(delayCalcData.getFirstHopDelayTime());
-    finalData.setSecondHopDelayTime(currentTime - delayCalcData.getSecondHopSentTime());
-    finalData.setTotalDelayTime(finalData.getSecondHopDelayTime() + delayCalcData.getFirstHopDelayTime());
+    // secondHopSentTime was stamped on b_hexagon's clock: compare it with our
+    // time converted to that clock (unchanged while no estimate is available)
+    const int64_t secondHopDelay = clampDelay(clock.toPeerClock(currentTime) - delayCalcData.getSecondHopSentTime());
+    const int64_t totalDelay = clampDelay(secondHopDelay + delayCalcData.getFirstHopDelayTime());
+
+    // Input passed isValid() in submitDelayCalcTrackData() and the derived
+    // delays are clamped into range above: copy without per-field range checks
+    FinalCalcTrackData finalData(
+        FinalCalcTrackData::UNCHECKED,
+        delayCalcData.getTrackId(),
+        delayCalcData.getXVelocityECEF(),
+        delayCalcData.getYVelocityECEF(),
+        delayCalcData.getZVelocityECEF(),
+        delayCalcData.getXPositionECEF(),
+        delayCalcData.getYPositionECEF(),
+        delayCalcData.getZPositionECEF(),
+        delayCalcData.getOriginalUpdateTime(),
+        delayCalcData.getUpdateTime(),
+        delayCalcData.getFirstHopSentTime(),
+        delayCalcData.getFirstHopDelayTime(),
+        delayCalcData.getSecondHopSentTime(),
+        secondHopDelay,
+        totalDelay,
+        currentTime);
+    finalData.setSecondHopReceiveTime(delayCalcData.getSecondHopReceiveTime());
+    if (clock.valid) {
+        finalData.setSecondHopClockOffset(clock.offsetUs);
+        finalData.setSecondHopClockErrorBound(clock.errorBoundUs);
+    }
 
     return finalData;
 }
 
+int64_t TargetStatisticService::clampDelay(int64_t delayUs) noexcept {
+    if (FinalCalcTrackData::isSecondHopDelayTimeInRange(delayUs)) {
+        return delayUs;
+    }
+    // Residual clock skew larger than the delay, or a corrupt timestamp
+    metricClampedDelays_.add();
+    return (delayUs < 0) ? 0 : MAX_DELAY_US;
+}
+
+utils::ClockOffsetEstimate TargetStatisticService::clockEstimate() const noexcept {
+    return (clockSource_ != nullptr) ? clockSource_->estimate() : utils::ClockOffsetEstimate{};
+}
+
 /**
  * @brief Log processing results for monitoring and debugging
  * @param finalData Processed track data with delay information
  */
 void TargetStatisticService::logProcessingResults(const FinalCalcTrackData& finalData) {
-    LOG_INFO("Track ID: {} | Hop1: {} μs | Hop2: {} μs | Total: {} μs",
-             finalData.getTrackId(),
-             finalData.getFirstHopDelayTime(),
-             finalData.getSecondHopDelayTime(),
-             finalData.getFirstHopDelayTime() + finalData.getSecondHopDelayTime());
+    static_cast<void>(finalData);  // Unused when DEBUG logging is compiled out
+    LOG_DEBUG("Track ID: {} | Hop1: {} μs | Hop2: {} ± {} μs (clock offset {} μs) | Total: {} μs",
+              finalData.getTrackId(),
+              finalData.getFirstHopDelayTime(),
+              finalData.getSecondHopDelayTime(),
+              finalData.getSecondHopClockErrorBound(),
+              finalData.getSecondHopClockOffset(),
+              finalData.getFirstHopDelayTime() + finalData.getSecondHopDelayTime());
 }
 
 } // namespace logic
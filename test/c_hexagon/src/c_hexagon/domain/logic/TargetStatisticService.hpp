@@ -19,12 +19,19 @@
 #include "domain/ports/outgoing/FinalCalcTrackData.hpp"
 #include "domain/ports/outgoing/ITrackDataStatisticOutgoingPort.hpp"
 #include "domain/ports/incoming/IDelayCalcTrackDataIncomingPort.hpp"
+#include "domain/ports/outgoing/ILatencyStatisticsOutgoingPort.hpp"
+#include "domain/ports/outgoing/ITrackStaticsOutgoingPort.hpp"
+#include "domain/logic/LatencyStatistics.hpp"
+#include "domain/logic/TrackStaticsAggregator.hpp"
+#include "utils/ConflatingQueue.hpp"
+#include "utils/WaitStrategy.hpp"
+#include "utils/Metrics.hpp"
+#include "utils/ClockSync.hpp"
 #include <memory>
-#include <queue>
-#include <mutex>
-#include <condition_variable>
 #include <thread>
 #include <atomic>
+#include <chrono>
+#include <vector>
 
 namespace domain {
 namespace logic {
@@ -40,15 +47,24 @@ using domain::ports::FinalCalcTrackData;
  *          Event queue based architecture with isolated processing thread.
  *
  * @par Thread Architecture
- * - Incoming adapter thread: submitDelayCalcTrackData() (~20ns non-blocking enqueue)
- * - Domain processing thread: Dedicated background thread for processDelayCalcData()
+ * - Incoming adapter thread: submitDelayCalcTrackData() (non-blocking enqueue)
+ * - Event queue: one pending message per track; a newer message of a queued
+ *   track replaces the older one in place
+ * - Domain processing thread: Dedicated background thread draining up to
+ *   DRAIN_BATCH_SIZE messages per wake-up into processBatch()
  * - CPU affinity: Core 3, RT Priority: 90 (SCHED_FIFO)
  *
  * @par Data Flow
  * 1. submitDelayCalcTrackData() → non-blocking enqueue to event queue
- * 2. Background thread: dequeue → processDelayCalcData()
+ * 2. Background thread: dequeue a batch → processBatch()
  * 3. Creates FinalCalcTrackData with complete timing information
  * 4. Sends result via outgoing port to external systems
+ * 5. Optional: records hop delays into LatencyStatistics and exports
+ *    percentile snapshots via ILatencyStatisticsOutgoingPort per interval
+ * 6. Optional: accumulates per-track Welford statistics and publishes
+ *    TrackStatics via ITrackStaticsOutgoingPort on a fixed cadence
+ * 7. Optional: corrects the second hop delay with b_hexagon's clock offset
+ *    (ClockSyncClient) and attaches the offset and error bound to the result
  *
  * @invariant outgoing_port_ may be null (standalone mode)
  * @see IDelayCalcTrackDataIncomingPort
@@ -57,20 +73,49 @@ using domain::ports::FinalCalcTrackData;
 class TargetStatisticService : public ports::incoming::IDelayCalcTrackDataIncomingPort {
 private:
     // ==================== Configuration Constants ====================
-    static constexpr std::size_t MAX_QUEUE_SIZE = 500;
+    static constexpr std::size_t MAX_QUEUE_SIZE = 500;     ///< Maximum pending tracks
     static constexpr int QUEUE_WAIT_TIMEOUT_MS = 100;
+    static constexpr std::size_t DRAIN_BATCH_SIZE = 32;    ///< Messages drained per wake-up
+    static constexpr int64_t DROP_LOG_INTERVAL_MS = 1000;  ///< Queue-full warning sampling period
     static constexpr int DOMAIN_THREAD_PRIORITY = 90;
     static constexpr int DOMAIN_CPU_CORE = 3;
+    static constexpr int64_t MAX_DELAY_US = 9223372036854775LL;  ///< Upper bound of FinalCalcTrackData delay fields
 
     // ==================== Dependencies ====================
     std::shared_ptr<ports::outgoing::ITrackDataStatisticOutgoingPort> outgoing_port_;  ///< Outgoing port for sending results
 
     // ==================== Event Queue Infrastructure ====================
-    std::queue<ports::DelayCalcTrackData> eventQueue_;  ///< FIFO event queue
-    std::mutex queueMutex_;                              ///< Queue protection
-    std::condition_variable queueCV_;                    ///< Queue notification
+    utils::ConflatingQueue<ports::DelayCalcTrackData> eventQueue_{MAX_QUEUE_SIZE};  ///< Per-track conflating event queue
     std::thread processingThread_;                       ///< Dedicated processing thread
     std::atomic<bool> running_{false};                   ///< Thread-safe running flag
+    std::vector<DelayCalcTrackData> inputBatch_ = std::vector<DelayCalcTrackData>(DRAIN_BATCH_SIZE);  ///< Domain thread drain buffer
+    std::vector<FinalCalcTrackData> outputBatch_;        ///< Domain thread results (reserved in start())
+
+    // ==================== Metrics ====================
+    utils::Metric& metricQueueDrops_{utils::MetricsRegistry::instance().counter("domain.queue_drops")};  ///< Via queueCounters_
+    utils::Metric& metricConflated_{utils::MetricsRegistry::instance().counter("domain.queue_conflated")};  ///< Via queueCounters_
+    utils::Metric& metricInvalid_{utils::MetricsRegistry::instance().counter("domain.rejected")};        ///< Submitter thread
+    utils::Metric& metricProcessed_{utils::MetricsRegistry::instance().counter("domain.processed")};     ///< Domain thread
+    utils::Metric& metricQueueDepth_{utils::MetricsRegistry::instance().gauge("domain.queue_depth")};    ///< Domain thread
+    utils::Metric& metricClampedDelays_{utils::MetricsRegistry::instance().counter("domain.clamped_delays")};  ///< Domain thread
+    utils::ConflatingQueueCounters queueCounters_{metricConflated_, metricQueueDrops_};  ///< Domain thread
+
+    // ==================== Latency Histograms (configured while stopped) ====================
+    std::unique_ptr<LatencyStatistics> latencyStatistics_;                                ///< Per-hop histograms
+    std::shared_ptr<ports::outgoing::ILatencyStatisticsOutgoingPort> latencyPort_;        ///< Snapshot export
+    std::chrono::milliseconds latencyRotationInterval_{0};                               ///< Interval length
+    std::chrono::steady_clock::time_point nextLatencyRotation_{};                        ///< Next rotation due
+    std::vector<ports::LatencySnapshot> latencySnapshots_;                               ///< Reused export buffer
+
+    // ==================== TrackStatics (configured while stopped) ====================
+    std::unique_ptr<TrackStaticsAggregator> trackStatics_;                                ///< Per-track accumulators
+    std::shared_ptr<ports::outgoing::ITrackStaticsOutgoingPort> trackStaticsPort_;        ///< RADIO publisher
+    std::chrono::milliseconds trackStaticsCadence_{0};                                   ///< Publish period
+    std::chrono::steady_clock::time_point nextTrackStaticsPublish_{};                    ///< Next publish due
+    std::vector<ports::TrackStatics> trackStaticsBuffer_;                                ///< Reused publish buffer
+
+    // ==================== Clock Correction (configured while stopped) ====================
+    const utils::ClockSyncClient* clockSource_{nullptr};                                 ///< b_hexagon clock offset
 
 public:
     /**
@@ -88,9 +133,11 @@ public:
     /**
      * @brief Constructor with outgoing port (shared_ptr - shared ownership)
      * @param outgoing_port Port for sending processed data
+     * @param waitStrategy How the domain thread waits for data (blocking if null)
      */
     explicit TargetStatisticService(
-        std::shared_ptr<ports::outgoing::ITrackDataStatisticOutgoingPort> outgoing_port);
+        std::shared_ptr<ports::outgoing::ITrackDataStatisticOutgoingPort> outgoing_port,
+        std::shared_ptr<utils::WaitStrategy> waitStrategy = nullptr);
 
     /**
      * @brief Destructor - ensures graceful shutdown
@@ -107,7 +154,8 @@ public:
     /**
      * @brief Submit delay calculation data to event queue (non-blocking)
      * @param delayCalcData Input data to enqueue
-     * @details Enqueues message for background processing (~20ns latency)
+     * @details Enqueues message for background processing; ConflatingQueue::push()
+     *          serialises concurrent submitters
      */
     void submitDelayCalcTrackData(const DelayCalcTrackData& delayCalcData) override;
 
@@ -129,6 +177,57 @@ public:
      */
     [[nodiscard]] bool isRunning() const;
 
+    // ==================== Latency Histograms ====================
+    /**
+     * @brief Enable per-hop latency histograms with periodic snapshot export
+     * @param port Receives p50/p90/p99/p99.9/max snapshots once per interval
+     * @param rotationInterval Histogram interval length (> 0)
+     * @param maxTrackedTracks Tracks with their own histograms (others: global only)
+     * @return false if running, port is null or interval is not positive
+     * @details Replaces per-message INFO logging of hop delays (now DEBUG).
+     *          The last partial interval is exported on stop().
+     */
+    [[nodiscard]] bool enableLatencyStatistics(
+        std::shared_ptr<ports::outgoing::ILatencyStatisticsOutgoingPort> port,
+        std::chrono::milliseconds rotationInterval,
+        std::size_t maxTrackedTracks = LatencyStatistics::DEFAULT_MAX_TRACKED_TRACKS);
+
+    /**
+     * @brief Current-interval histograms (null when not enabled)
+     */
+    [[nodiscard]] const LatencyStatistics* latencyStatistics() const noexcept;
+
+    // ==================== TrackStatics ====================
+    /**
+     * @brief Enable per-track TrackStatics aggregation and periodic publishing
+     * @param port Receives one TrackStatics per track updated within the cadence
+     * @param cadence Publish period (> 0)
+     * @param maxTracks Tracks with accumulators (others are counted and ignored)
+     * @return false if running, port is null or cadence is not positive
+     * @details Pending updates are published once more on stop().
+     */
+    [[nodiscard]] bool enableTrackStatics(
+        std::shared_ptr<ports::outgoing::ITrackStaticsOutgoingPort> port,
+        std::chrono::milliseconds cadence,
+        std::size_t maxTracks = TrackStaticsAggregator::DEFAULT_MAX_TRACKS);
+
+    /**
+     * @brief Per-track accumulators (null when not enabled)
+     */
+    [[nodiscard]] const TrackStaticsAggregator* trackStaticsAggregator() const noexcept;
+
+    // ==================== Clock Correction ====================
+    /**
+     * @brief Correct second hop delays with b_hexagon's clock offset
+     * @param source Offset estimate of b_hexagon's clock (null disables;
+     *               must outlive the service)
+     * @return false if running
+     * @details secondHopSentTime is stamped on b_hexagon's clock; the local
+     *          processing time is converted to that clock before subtracting.
+     *          Without a valid estimate the delay stays uncorrected.
+     */
+    [[nodiscard]] bool setClockOffsetSource(const utils::ClockSyncClient* source);
+
 private:
     /**
      * @brief Background processing loop (dedicated thread)
@@ -138,6 +237,8 @@ private:
     /**
      * @brief Enqueue message for background processing
      * @param data Track data to queue
+     * @details Replaces a pending message of the same track; when every slot
+     *          holds another track, the track that has waited longest is evicted
      */
     void enqueueMessage(const DelayCalcTrackData& data);
 
@@ -148,6 +249,23 @@ private:
      */
     void processDelayCalcData(const DelayCalcTrackData& delayCalcData);
 
+    /**
+     * @brief Process the drained batch in inputBatch_
+     * @param count Number of valid entries in inputBatch_
+     * @details Reads the clock offset once for the batch and sends all results
+     *          with one outgoing port call
+     */
+    void processBatch(std::size_t count);
+
+    /**
+     * @brief Create one result and record it in the statistics (domain thread)
+     * @param delayCalcData Input data from B_hexagon
+     * @param clock Offset estimate of b_hexagon's clock
+     * @return Processed final track data, ready to send
+     */
+    FinalCalcTrackData finalizeTrack(const DelayCalcTrackData& delayCalcData,
+                                     const utils::ClockOffsetEstimate& clock);
+
     /**
      * @brief Create FinalCalcTrackData from DelayCalcTrackData with timing calculations
      * @param delayCalcData Input data from B_hexagon
@@ -155,11 +273,51 @@ private:
      */
     FinalCalcTrackData createFinalCalcTrackData(const DelayCalcTrackData& delayCalcData);
 
+    /**
+     * @brief Create FinalCalcTrackData with an already read clock offset estimate
+     * @param delayCalcData Input data from B_hexagon
+     * @param clock Offset estimate of b_hexagon's clock (invalid: uncorrected)
+     * @return Processed final track data with complete delay analysis
+     */
+    FinalCalcTrackData createFinalCalcTrackData(const DelayCalcTrackData& delayCalcData,
+                                                const utils::ClockOffsetEstimate& clock);
+
+    /**
+     * @brief Clamp a derived delay into the FinalCalcTrackData delay range
+     * @param delayUs Computed delay (μs)
+     * @return delayUs, or the nearest range bound (counted in domain.clamped_delays)
+     * @details Negative values come from clock skew larger than the hop delay.
+     */
+    [[nodiscard]] int64_t clampDelay(int64_t delayUs) noexcept;
+
+    /**
+     * @brief Current offset estimate of b_hexagon's clock (invalid without a source)
+     */
+    [[nodiscard]] utils::ClockOffsetEstimate clockEstimate() const noexcept;
+
     /**
      * @brief Log processing results for monitoring and debugging
      * @param finalData Final calculated track data to log
      */
     void logProcessingResults(const FinalCalcTrackData& finalData);
+
+    /**
+     * @brief Rotate the latency histograms if the interval elapsed (domain thread)
+     * @param force Rotate regardless of the deadline (shutdown flush)
+     */
+    void rotateLatencyStatistics(bool force);
+
+    /**
+     * @brief Publish TrackStatics if the cadence elapsed (domain thread)
+     * @param force Publish regardless of the deadline (shutdown flush)
+     */
+    void publishTrackStatics(bool force);
+
+    /**
+     * @brief Run the periodic exports that are due (domain thread)
+     * @param force Export regardless of the deadlines (shutdown flush)
+     */
+    void runPeriodicExports(bool force);
 };
 
 } // namespace logic
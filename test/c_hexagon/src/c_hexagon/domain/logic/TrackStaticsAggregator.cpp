@@ -0,0 +1,205 @@
+/**
+ * @file TrackStaticsAggregator.cpp
+ * @brief Implementation of the streaming per-track delay statistics
+ *
+ * @author c_hexagon Team
+ * @version 1.0
+ * @date 2025
+ *
+ * @note MISRA C++ 2023 compliant implementation
+ * @see TrackStaticsAggregator.hpp
+ */
+
+#include "TrackStaticsAggregator.hpp"
+#include <cmath>
+
+namespace domain {
+namespace logic {
+
+namespace {
+    /// @brief Smallest power of two >= value (value >= 1)
+    std::size_t nextPowerOfTwo(std::size_t value) noexcept {
+        std::size_t result = 1U;
+        while (result < value) {
+            result <<= 1U;
+        }
+        return result;
+    }
+}
+
+void TrackStaticsAggregator::RunningStats::add(double value) noexcept {
+    ++count;
+    if (count == 1U) {
+        mean = value;
+        m2 = 0.0;
+        min = value;
+        max = value;
+        return;
+    }
+
+    const double delta = value - mean;
+    mean += delta / static_cast<double>(count);
+    m2 += delta * (value - mean);
+    if (value < min) {
+        min = value;
+    }
+    if (value > max) {
+        max = value;
+    }
+}
+
+double TrackStaticsAggregator::RunningStats::stddev() const noexcept {
+    return (count < 2U) ? 0.0 : std::sqrt(m2 / static_cast<double>(count));
+}
+
+TrackStaticsAggregator::TrackStaticsAggregator(std::size_t maxTracks)
+    : slots_(nextPowerOfTwo(2U * ((maxTracks == 0U) ? 1U : maxTracks)))
+    , mask_(slots_.size() - 1U)
+    , maxTracks_(maxTracks) {
+}
+
+std::size_t TrackStaticsAggregator::slotIndex(int32_t trackId) const noexcept {
+    // Fibonacci hashing spreads sequential track IDs across the table
+    const uint64_t hash = static_cast<uint64_t>(static_cast<uint32_t>(trackId)) * 0x9E3779B97F4A7C15ULL;
+    return static_cast<std::size_t>(hash >> 32U) & mask_;
+}
+
+void TrackStaticsAggregator::eraseAt(std::size_t index) noexcept {
+    // Backward shift: pull later entries of the probe run into the hole unless
+    // their home slot lies between the hole and their current slot
+    std::size_t hole = index;
+    std::size_t next = (hole + 1U) & mask_;
+    while (slots_[next].occupied) {
+        const std::size_t home = slotIndex(slots_[next].trackId);
+        if (((next - home) & mask_) >= ((next - hole) & mask_)) {
+            slots_[hole] = slots_[next];
+            hole = next;
+        }
+        next = (next + 1U) & mask_;
+    }
+    slots_[hole] = Slot{};
+    --trackCount_;
+}
+
+void TrackStaticsAggregator::record(const ports::FinalCalcTrackData& data) noexcept {
+    const double firstHop = static_cast<double>(data.getFirstHopDelayTime());
+    const double secondHop = static_cast<double>(data.getSecondHopDelayTime());
+    const double totalHop = static_cast<double>(data.getTotalDelayTime());
+
+    // Samples inside the TrackStatics range keep mean/std/min/max inside it too
+    if (!ports::TrackStatics::isFirstHopDelayDataMinInRange(firstHop) ||
+        !ports::TrackStatics::isSecondHopDelayDataMinInRange(secondHop) ||
+        !ports::TrackStatics::isTotalHopDelayDataMinInRange(totalHop)) {
+        ++rejectedSamples_;
+        return;
+    }
+
+    const int32_t trackId = data.getTrackId();
+
+    // Load factor <= 0.5 guarantees an empty slot ends every probe
+    std::size_t index = slotIndex(trackId);
+    while (slots_[index].occupied && (slots_[index].trackId != trackId)) {
+        index = (index + 1U) & mask_;
+    }
+
+    Slot& slot = slots_[index];
+    if (!slot.occupied) {
+        if (trackCount_ >= maxTracks_) {
+            ++droppedSamples_;
+            return;
+        }
+        slot.occupied = true;
+        slot.trackId = trackId;
+        ++trackCount_;
+    }
+
+    slot.dirty = true;
+    slot.hops[static_cast<std::size_t>(ports::LatencyHop::FirstHop)].add(firstHop);
+    slot.hops[static_cast<std::size_t>(ports::LatencyHop::SecondHop)].add(secondHop);
+    slot.hops[static_cast<std::size_t>(ports::LatencyHop::Total)].add(totalHop);
+}
+
+std::size_t TrackStaticsAggregator::collect(int64_t updateTimeUs, std::vector<ports::TrackStatics>& out) {
+    std::size_t appended = 0U;
+    for (Slot& slot : slots_) {
+        if (!slot.dirty) {
+            if (slot.occupied) {
+                ++slot.idleCollects;
+            }
+            continue;
+        }
+        slot.dirty = false;
+        slot.idleCollects = 0U;
+
+        const RunningStats& first = slot.hops[static_cast<std::size_t>(ports::LatencyHop::FirstHop)];
+        const RunningStats& second = slot.hops[static_cast<std::size_t>(ports::LatencyHop::SecondHop)];
+        const RunningStats& total = slot.hops[static_cast<std::size_t>(ports::LatencyHop::Total)];
+
+        // Range check once here instead of throwing setters
+        const ports::TrackStatics statics(
+            ports::TrackStatics::UNCHECKED,
+            slot.trackId,
+            first.mean, first.stddev(), first.min, first.max,
+            second.mean, second.stddev(), second.min, second.max,
+            total.mean, total.stddev(), total.min, total.max,
+            updateTimeUs);
+        if (statics.validate() != 0U) {
+            ++invalidRecords_;
+            continue;
+        }
+
+        out.push_back(statics);
+        ++appended;
+    }
+
+    // Separate pass: erasing shifts entries, re-check the slot until it stays
+    for (std::size_t index = 0U; index < slots_.size(); ++index) {
+        while (slots_[index].occupied && (slots_[index].idleCollects >= TRACK_IDLE_COLLECTS_BEFORE_EVICTION)) {
+            eraseAt(index);
+            ++evictedTracks_;
+        }
+    }
+    return appended;
+}
+
+const TrackStaticsAggregator::RunningStats* TrackStaticsAggregator::find(
+    int32_t trackId, ports::LatencyHop hop) const noexcept {
+    if (static_cast<std::size_t>(hop) >= ports::LATENCY_HOP_COUNT) {
+        return nullptr;  // Second hop split is not kept per track
+    }
+    std::size_t index = slotIndex(trackId);
+    while (slots_[index].occupied) {
+        if (slots_[index].trackId == trackId) {
+            return &slots_[index].hops[static_cast<std::size_t>(hop)];
+        }
+        index = (index + 1U) & mask_;
+    }
+    return nullptr;
+}
+
+std::size_t TrackStaticsAggregator::trackCount() const noexcept {
+    return trackCount_;
+}
+
+std::size_t TrackStaticsAggregator::capacity() const noexcept {
+    return maxTracks_;
+}
+
+uint64_t TrackStaticsAggregator::droppedSampleCount() const noexcept {
+    return droppedSamples_;
+}
+
+uint64_t TrackStaticsAggregator::evictedTrackCount() const noexcept {
+    return evictedTracks_;
+}
+
+uint64_t TrackStaticsAggregator::rejectedSampleCount() const noexcept {
+    return rejectedSamples_;
+}
+
+uint64_t TrackStaticsAggregator::invalidRecordCount() const noexcept {
+    return invalidRecords_;
+}
+
+} // namespace logic
+} // namespace domain
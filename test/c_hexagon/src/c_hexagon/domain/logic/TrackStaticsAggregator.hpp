@@ -0,0 +1,140 @@
+/**
+ * @file TrackStaticsAggregator.hpp
+ * @brief Streaming per-track delay statistics for TrackStatics publishing
+ * @details Keeps Welford running mean/variance plus min/max of the three hop
+ *          delays for each track in a flat open-addressing table. record() is
+ *          O(1) and never allocates; collect() turns every track updated since
+ *          the previous call into one TrackStatics record and frees the slots
+ *          of tracks that stayed quiet for several calls.
+ *
+ * @author c_hexagon Team
+ * @version 1.0
+ * @date 2025
+ *
+ * @note MISRA C++ 2023 compliant implementation
+ * @note Not thread-safe: record() and collect() belong to the domain thread
+ * @see TrackStatics
+ */
+
+#pragma once
+
+#include "domain/ports/outgoing/FinalCalcTrackData.hpp"
+#include "domain/ports/outgoing/TrackStatics.hpp"
+#include "domain/ports/outgoing/LatencySnapshot.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace domain {
+namespace logic {
+
+/**
+ * @class TrackStaticsAggregator
+ * @brief Fixed-capacity table of per-track Welford accumulators
+ * @details Statistics accumulate from the first sample of a track until it
+ *          goes TRACK_IDLE_COLLECTS_BEFORE_EVICTION collect() calls without a
+ *          sample; its slot is then freed for new tracks (a track that comes
+ *          back starts over). Tracks beyond the capacity are counted and
+ *          ignored until a slot frees up.
+ *          Messages with a hop delay outside the TrackStatics range (negative
+ *          after clock correction, or a stall over 1 s) are rejected before
+ *          they reach the accumulators: one such sample would otherwise push
+ *          min/max out of range and keep the track unpublishable for good.
+ */
+class TrackStaticsAggregator final {
+public:
+    /// @brief Default bound on tracks with accumulators (~200 bytes each)
+    static constexpr std::size_t DEFAULT_MAX_TRACKS{1024U};
+
+    /// @brief Consecutive collect() calls without samples after which a track loses its slot
+    static constexpr uint32_t TRACK_IDLE_COLLECTS_BEFORE_EVICTION{5U};
+
+    /**
+     * @brief O(1) running statistics of one delay series (Welford)
+     */
+    struct RunningStats {
+        uint64_t count{0U};
+        double mean{0.0};
+        double m2{0.0};      ///< Sum of squared deviations from the mean
+        double min{0.0};
+        double max{0.0};
+
+        void add(double value) noexcept;
+
+        /// @brief Population standard deviation (0 below two samples)
+        [[nodiscard]] double stddev() const noexcept;
+    };
+
+    /**
+     * @brief Constructor
+     * @param maxTracks Tracks with accumulators; the table holds the next
+     *                  power of two >= 2 * maxTracks slots (load factor <= 0.5)
+     */
+    explicit TrackStaticsAggregator(std::size_t maxTracks = DEFAULT_MAX_TRACKS);
+
+    // Non-copyable, non-movable (sized once, owned by the domain service)
+    TrackStaticsAggregator(const TrackStaticsAggregator&) = delete;
+    TrackStaticsAggregator& operator=(const TrackStaticsAggregator&) = delete;
+    TrackStaticsAggregator(TrackStaticsAggregator&&) = delete;
+    TrackStaticsAggregator& operator=(TrackStaticsAggregator&&) = delete;
+    ~TrackStaticsAggregator() = default;
+
+    /**
+     * @brief Add the hop delays of one processed message
+     * @details The whole message is rejected (and counted) if any hop delay is
+     *          outside the TrackStatics range, so the three hops stay consistent
+     */
+    void record(const ports::FinalCalcTrackData& data) noexcept;
+
+    /**
+     * @brief Append one TrackStatics per track updated since the last call
+     * @details Also evicts tracks idle for TRACK_IDLE_COLLECTS_BEFORE_EVICTION calls
+     * @param updateTimeUs Stamped into every record
+     * @param out Receives the records; existing content is kept
+     * @return Records appended (records failing validate() are skipped and counted)
+     */
+    std::size_t collect(int64_t updateTimeUs, std::vector<ports::TrackStatics>& out);
+
+    /// @brief Accumulators of one track (null if unknown or a global-only hop)
+    [[nodiscard]] const RunningStats* find(int32_t trackId, ports::LatencyHop hop) const noexcept;
+
+    [[nodiscard]] std::size_t trackCount() const noexcept;
+    [[nodiscard]] std::size_t capacity() const noexcept;
+
+    /// @brief Samples of tracks that did not fit the table
+    [[nodiscard]] uint64_t droppedSampleCount() const noexcept;
+
+    /// @brief Tracks evicted by collect() after going quiet
+    [[nodiscard]] uint64_t evictedTrackCount() const noexcept;
+
+    /// @brief Messages rejected by record() for an out-of-range hop delay
+    [[nodiscard]] uint64_t rejectedSampleCount() const noexcept;
+
+    /// @brief Collected records skipped because validate() failed
+    [[nodiscard]] uint64_t invalidRecordCount() const noexcept;
+
+private:
+    struct Slot {
+        int32_t trackId{0};
+        bool occupied{false};
+        bool dirty{false};   ///< Updated since the last collect()
+        uint32_t idleCollects{0U};  ///< Consecutive collect() calls without samples
+        std::array<RunningStats, ports::LATENCY_HOP_COUNT> hops{};
+    };
+
+    [[nodiscard]] std::size_t slotIndex(int32_t trackId) const noexcept;
+    void eraseAt(std::size_t index) noexcept;
+
+    std::vector<Slot> slots_;        ///< Power-of-two table, linear probing, backward-shift erase
+    std::size_t mask_;               ///< slots_.size() - 1
+    std::size_t maxTracks_;          ///< Occupancy bound
+    std::size_t trackCount_{0U};     ///< Occupied slots
+    uint64_t droppedSamples_{0U};    ///< Samples of over-capacity tracks
+    uint64_t evictedTracks_{0U};     ///< Slots freed by idle eviction
+    uint64_t rejectedSamples_{0U};   ///< Samples with an out-of-range hop delay
+    uint64_t invalidRecords_{0U};    ///< Out-of-range statistics not published
+};
+
+} // namespace logic
+} // namespace domain
@@ -39,13 +39,108 @@ FinalCalcTrackData::FinalCalcTrackData() noexcept {
     thirdHopSentTime_ = static_cast<int64_t>(0);
 }
 
+// Unchecked constructor: caller guarantees the values are in range
+FinalCalcTrackData::FinalCalcTrackData(UncheckedInit,
+                                        int32_t trackId,
+                                        double xVelocityECEF,
+                                        double yVelocityECEF,
+                                        double zVelocityECEF,
+                                        double xPositionECEF,
+                                        double yPositionECEF,
+                                        double zPositionECEF,
+                                        int64_t originalUpdateTime,
+                                        int64_t updateTime,
+                                        int64_t firstHopSentTime,
+                                        int64_t firstHopDelayTime,
+                                        int64_t secondHopSentTime,
+                                        int64_t secondHopDelayTime,
+                                        int64_t totalDelayTime,
+                                        int64_t thirdHopSentTime) noexcept
+    : trackId_(trackId)
+    , xVelocityECEF_(xVelocityECEF)
+    , yVelocityECEF_(yVelocityECEF)
+    , zVelocityECEF_(zVelocityECEF)
+    , xPositionECEF_(xPositionECEF)
+    , yPositionECEF_(yPositionECEF)
+    , zPositionECEF_(zPositionECEF)
+    , originalUpdateTime_(originalUpdateTime)
+    , updateTime_(updateTime)
+    , firstHopSentTime_(firstHopSentTime)
+    , firstHopDelayTime_(firstHopDelayTime)
+    , secondHopSentTime_(secondHopSentTime)
+    , secondHopDelayTime_(secondHopDelayTime)
+    , totalDelayTime_(totalDelayTime)
+    , thirdHopSentTime_(thirdHopSentTime) {
+}
+
+// Range checks - noexcept, shared by setters and validate()
+bool FinalCalcTrackData::isTrackIdInRange(int32_t value) noexcept {
+    return (value >= 1LL) && (value <= 9999LL);
+}
+
+bool FinalCalcTrackData::isXVelocityECEFInRange(double value) noexcept {
+    return !std::isnan(value) && (value >= -1.0E+6) && (value <= 1.0E+6);
+}
+
+bool FinalCalcTrackData::isYVelocityECEFInRange(double value) noexcept {
+    return !std::isnan(value) && (value >= -1.0E+6) && (value <= 1.0E+6);
+}
+
+bool FinalCalcTrackData::isZVelocityECEFInRange(double value) noexcept {
+    return !std::isnan(value) && (value >= -1.0E+6) && (value <= 1.0E+6);
+}
+
+bool FinalCalcTrackData::isXPositionECEFInRange(double value) noexcept {
+    return !std::isnan(value) && (value >= -9.9E+10) && (value <= 9.9E+10);
+}
+
+bool FinalCalcTrackData::isYPositionECEFInRange(double value) noexcept {
+    return !std::isnan(value) && (value >= -9.9E+10) && (value <= 9.9E+10);
+}
+
+bool FinalCalcTrackData::isZPositionECEFInRange(double value) noexcept {
+    return !std::isnan(value) && (value >= -9.9E+10) && (value <= 9.9E+10);
+}
+
+bool FinalCalcTrackData::isOriginalUpdateTimeInRange(int64_t value) noexcept {
+    return (value >= 0LL) && (value <= 9223372036854775LL);
+}
+
+bool FinalCalcTrackData::isUpdateTimeInRange(int64_t value) noexcept {
+    return (value >= 0LL) && (value <= 9223372036854775LL);
+}
+
+bool FinalCalcTrackData::isFirstHopSentTimeInRange(int64_t value) noexcept {
+    return (value >= 0LL) && (value <= 9223372036854775LL);
+}
+
+bool FinalCalcTrackData::isFirstHopDelayTimeInRange(int64_t value) noexcept {
+    return (value >= 0LL) && (value <= 9223372036854775LL);
+}
+
+bool FinalCalcTrackData::isSecondHopSentTimeInRange(int64_t value) noexcept {
+    return (value >= 0LL) && (value <= 9223372036854775LL);
+}
+
+bool FinalCalcTrackData::isSecondHopDelayTimeInRange(int64_t value) noexcept {
+    return (value >= 0LL) && (value <= 9223372036854775LL);
+}
+
+bool FinalCalcTrackData::isTotalDelayTimeInRange(int64_t value) noexcept {
+    return (value >= 0LL) && (value <= 9223372036854775LL);
+}
+
+bool FinalCalcTrackData::isThirdHopSentTimeInRange(int64_t value) noexcept {
+    return (value >= 0LL) && (value <= 9223372036854775LL);
+}
+
 /**
  * @brief Validate TrackId value
  * @param value Value to validate
  * @throws std::out_of_range if value is not in range [1, 9999]
  */
     void FinalCalcTrackData::validateTrackId(int32_t value) const {
-        if (value < 1LL || value > 9999LL) {
+        if (!isTrackIdInRange(value)) {
             throw std::out_of_range("TrackId value is out of valid range: " + std::to_string(value));
         }
     }
@@ -56,7 +151,7 @@ FinalCalcTrackData::FinalCalcTrackData() noexcept {
  * @throws std::out_of_range if value is NaN or not in range [-1E+6, 1E+6]
  */
     void FinalCalcTrackData::validateXVelocityECEF(double value) const {
-        if (std::isnan(value) || value < -1.0E+6 || value > 1.0E+6) {
+        if (!isXVelocityECEFInRange(value)) {
             throw std::out_of_range("XVelocityECEF value is out of valid range: " + std::to_string(value));
         }
     }
@@ -67,7 +162,7 @@ FinalCalcTrackData::FinalCalcTrackData() noexcept {
  * @throws std::out_of_range if value is NaN or not in range [-1E+6, 1E+6]
  */
     void FinalCalcTrackData::validateYVelocityECEF(double value) const {
-        if (std::isnan(value) || value < -1.0E+6 || value > 1.0E+6) {
+        if (!isYVelocityECEFInRange(value)) {
             throw std::out_of_range("YVelocityECEF value is out of valid range: " + std::to_string(value));
         }
     }
@@ -78,7 +173,7 @@ FinalCalcTrackData::FinalCalcTrackData() noexcept {
  * @throws std::out_of_range if value is NaN or not in range [-1E+6, 1E+6]
  */
     void FinalCalcTrackData::validateZVelocityECEF(double value) const {
-        if (std::isnan(value) || value < -1.0E+6 || value > 1.0E+6) {
+        if (!isZVelocityECEFInRange(value)) {
             throw std::out_of_range("ZVelocityECEF value is out of valid range: " + std::to_string(value));
         }
     }
@@ -89,7 +184,7 @@ FinalCalcTrackData::FinalCalcTrackData() noexcept {
  * @throws std::out_of_range if value is NaN or not in range [-9.9E+10, 9.9E+10]
  */
     void FinalCalcTrackData::validateXPositionECEF(double value) const {
-        if (std::isnan(value) || value < -9.9E+10 || value > 9.9E+10) {
+        if (!isXPositionECEFInRange(value)) {
             throw std::out_of_range("XPositionECEF value is out of valid range: " + std::to_string(value));
         }
     }
@@ -100,7 +195,7 @@ FinalCalcTrackData::FinalCalcTrackData() noexcept {
  * @throws std::out_of_range if value is NaN or not in range [-9.9E+10, 9.9E+10]
  */
     void FinalCalcTrackData::validateYPositionECEF(double value) const {
-        if (std::isnan(value) || value < -9.9E+10 || value > 9.9E+10) {
+        if (!isYPositionECEFInRange(value)) {
             throw std::out_of_range("YPositionECEF value is out of valid range: " + std::to_string(value));
         }
     }
@@ -111,7 +206,7 @@ FinalCalcTrackData::FinalCalcTrackData() noexcept {
  * @throws std::out_of_range if value is NaN or not in range [-9.9E+10, 9.9E+10]
  */
     void FinalCalcTrackData::validateZPositionECEF(double value) const {
-        if (std::isnan(value) || value < -9.9E+10 || value > 9.9E+10) {
+        if (!isZPositionECEFInRange(value)) {
             throw std::out_of_range("ZPositionECEF value is out of valid range: " + std::to_string(value));
         }
     }
@@ -122,7 +217,7 @@ FinalCalcTrackData::FinalCalcTrackData() noexcept {
  * @throws std::out_of_range if value is negative or exceeds max valid time
  */
     void FinalCalcTrackData::validateOriginalUpdateTime(int64_t value) const {
-        if (value < 0LL || value > 9223372036854775LL) {
+        if (!isOriginalUpdateTimeInRange(value)) {
             throw std::out_of_range("OriginalUpdateTime value is out of valid range: " + std::to_string(value));
         }
     }
@@ -133,7 +228,7 @@ FinalCalcTrackData::FinalCalcTrackData() noexcept {
  * @throws std::out_of_range if value is negative or exceeds max valid time
  */
     void FinalCalcTrackData::validateUpdateTime(int64_t value) const {
-        if (value < 0LL || value > 9223372036854775LL) {
+        if (!isUpdateTimeInRange(value)) {
             throw std::out_of_range("UpdateTime value is out of valid range: " + std::to_string(value));
         }
     }
@@ -144,37 +239,37 @@ FinalCalcTrackData::FinalCalcTrackData() noexcept {
  * @throws std::out_of_range if value is negative or exceeds max valid time
  */
     void FinalCalcTrackData::validateFirstHopSentTime(int64_t value) const {
-        if (value < 0LL || value > 9223372036854775LL) {
+        if (!isFirstHopSentTimeInRange(value)) {
             throw std::out_of_range("FirstHopSentTime value is out of valid range: " + std::to_string(value));
         }
     }
 
     void FinalCalcTrackData::validateFirstHopDelayTime(int64_t value) const {
-        if (value < 0LL || value > 9223372036854775LL) {
+        if (!isFirstHopDelayTimeInRange(value)) {
             throw std::out_of_range("FirstHopDelayTime value is out of valid range: " + std::to_string(value));
         }
     }
 
     void FinalCalcTrackData::validateSecondHopSentTime(int64_t value) const {
-        if (value < 0LL || value > 9223372036854775LL) {
+        if (!isSecondHopSentTimeInRange(value)) {
             throw std::out_of_range("SecondHopSentTime value is out of valid range: " + std::to_string(value));
         }
     }
 
     void FinalCalcTrackData::validateSecondHopDelayTime(int64_t value) const {
-        if (value < 0LL || value > 9223372036854775LL) {
+        if (!isSecondHopDelayTimeInRange(value)) {
             throw std::out_of_range("SecondHopDelayTime value is out of valid range: " + std::to_string(value));
         }
     }
 
     void FinalCalcTrackData::validateTotalDelayTime(int64_t value) const {
-        if (value < 0LL || value > 9223372036854775LL) {
+        if (!isTotalDelayTimeInRange(value)) {
             throw std::out_of_range("TotalDelayTime value is out of valid range: " + std::to_string(value));
         }
     }
 
     void FinalCalcTrackData::validateThirdHopSentTime(int64_t value) const {
-        if (value < 0LL || value > 9223372036854775LL) {
+        if (!isThirdHopSentTimeInRange(value)) {
             throw std::out_of_range("ThirdHopSentTime value is out of valid range: " + std::to_string(value));
         }
     }
@@ -314,277 +409,138 @@ void FinalCalcTrackData::setThirdHopSentTime(const int64_t& value) {
     thirdHopSentTime_ = value;
 }
 
-bool FinalCalcTrackData::isValid() const noexcept {
-    try {
-        validateTrackId(trackId_);
-        validateXVelocityECEF(xVelocityECEF_);
-        validateYVelocityECEF(yVelocityECEF_);
-        validateZVelocityECEF(zVelocityECEF_);
-        validateXPositionECEF(xPositionECEF_);
-        validateYPositionECEF(yPositionECEF_);
-        validateZPositionECEF(zPositionECEF_);
-        validateOriginalUpdateTime(originalUpdateTime_);
-        validateUpdateTime(updateTime_);
-        validateFirstHopSentTime(firstHopSentTime_);
-        validateFirstHopDelayTime(firstHopDelayTime_);
-        validateSecondHopSentTime(secondHopSentTime_);
-        validateSecondHopDelayTime(secondHopDelayTime_);
-        validateTotalDelayTime(totalDelayTime_);
-        validateThirdHopSentTime(thirdHopSentTime_);
-        return true;
-    } catch (const std::exception&) {
-        return false;
-    }
+// Local fields: plain stores, outside validate() and the wire format
+int64_t FinalCalcTrackData::getSecondHopReceiveTime() const noexcept {
+    return secondHopReceiveTime_;
 }
 
-// MISRA C++ 2023 compliant Binary Serialization Implementation
-std::vector<uint8_t> FinalCalcTrackData::serialize() const {
-    std::vector<uint8_t> buffer;
-    buffer.reserve(getSerializedSize());
-    
-    // Serialize trackId_
-    {
-        const uint8_t* ptr = reinterpret_cast<const uint8_t*>(&trackId_);
-        buffer.insert(buffer.end(), ptr, ptr + sizeof(trackId_));
-    }
-    
-    // Serialize xVelocityECEF_
-    {
-        const uint8_t* ptr = reinterpret_cast<const uint8_t*>(&xVelocityECEF_);
-        buffer.insert(buffer.end(), ptr, ptr + sizeof(xVelocityECEF_));
-    }
-    
-    // Serialize yVelocityECEF_
-    {
-        const uint8_t* ptr = reinterpret_cast<const uint8_t*>(&yVelocityECEF_);
-        buffer.insert(buffer.end(), ptr, ptr + sizeof(yVelocityECEF_));
-    }
-    
-    // Serialize zVelocityECEF_
-    {
-        const uint8_t* ptr = reinterpret_cast<const uint8_t*>(&zVelocityECEF_);
-        buffer.insert(buffer.end(), ptr, ptr + sizeof(zVelocityECEF_));
-    }
-    
-    // Serialize xPositionECEF_
-    {
-        const uint8_t* ptr = reinterpret_cast<const uint8_t*>(&xPositionECEF_);
-        buffer.insert(buffer.end(), ptr, ptr + sizeof(xPositionECEF_));
-    }
-    
-    // Serialize yPositionECEF_
-    {
-        const uint8_t* ptr = reinterpret_cast<const uint8_t*>(&yPositionECEF_);
-        buffer.insert(buffer.end(), ptr, ptr + sizeof(yPositionECEF_));
-    }
-    
-    // Serialize zPositionECEF_
-    {
-        const uint8_t* ptr = reinterpret_cast<const uint8_t*>(&zPositionECEF_);
-        buffer.insert(buffer.end(), ptr, ptr + sizeof(zPositionECEF_));
-    }
-    
-    // Serialize originalUpdateTime_
-    {
-        const uint8_t* ptr = reinterpret_cast<const uint8_t*>(&originalUpdateTime_);
-        buffer.insert(buffer.end(), ptr, ptr + sizeof(originalUpdateTime_));
-    }
-    
-    // Serialize updateTime_
-    {
-        const uint8_t* ptr = reinterpret_cast<const uint8_t*>(&updateTime_);
-        buffer.insert(buffer.end(), ptr, ptr + sizeof(updateTime_));
-    }
-    
-    // Serialize firstHopSentTime_
-    {
-        const uint8_t* ptr = reinterpret_cast<const uint8_t*>(&firstHopSentTime_);
-        buffer.insert(buffer.end(), ptr, ptr + sizeof(firstHopSentTime_));
-    }
-    
-    // Serialize firstHopDelayTime_
-    {
-        const uint8_t* ptr = reinterpret_cast<const uint8_t*>(&firstHopDelayTime_);
-        buffer.insert(buffer.end(), ptr, ptr + sizeof(firstHopDelayTime_));
-    }
-    
-    // Serialize secondHopSentTime_
-    {
-        const uint8_t* ptr = reinterpret_cast<const uint8_t*>(&secondHopSentTime_);
-        buffer.insert(buffer.end(), ptr, ptr + sizeof(secondHopSentTime_));
-    }
-    
-    // Serialize secondHopDelayTime_
-    {
-        const uint8_t* ptr = reinterpret_cast<const uint8_t*>(&secondHopDelayTime_);
-        buffer.insert(buffer.end(), ptr, ptr + sizeof(secondHopDelayTime_));
-    }
-    
-    // Serialize totalDelayTime_
-    {
-        const uint8_t* ptr = reinterpret_cast<const uint8_t*>(&totalDelayTime_);
-        buffer.insert(buffer.end(), ptr, ptr + sizeof(totalDelayTime_));
-    }
-    
-    // Serialize thirdHopSentTime_
-    {
-        const uint8_t* ptr = reinterpret_cast<const uint8_t*>(&thirdHopSentTime_);
-        buffer.insert(buffer.end(), ptr, ptr + sizeof(thirdHopSentTime_));
-    }
-    
-    return buffer;
+void FinalCalcTrackData::setSecondHopReceiveTime(const int64_t& value) noexcept {
+    secondHopReceiveTime_ = value;
 }
 
-bool FinalCalcTrackData::deserialize(const std::vector<uint8_t>& data) noexcept {
-    if (data.size() < getSerializedSize()) {
-        return false;
+int64_t FinalCalcTrackData::getSecondHopClockOffset() const noexcept {
+    return secondHopClockOffset_;
+}
+
+void FinalCalcTrackData::setSecondHopClockOffset(const int64_t& value) noexcept {
+    secondHopClockOffset_ = value;
+}
+
+int64_t FinalCalcTrackData::getSecondHopClockErrorBound() const noexcept {
+    return secondHopClockErrorBound_;
+}
+
+void FinalCalcTrackData::setSecondHopClockErrorBound(const int64_t& value) noexcept {
+    secondHopClockErrorBound_ = value;
+}
+
+uint32_t FinalCalcTrackData::validate() const noexcept {
+    uint32_t errors = 0U;
+    if (!isTrackIdInRange(trackId_)) {
+        errors |= FIELD_TRACK_ID;
     }
-    
-    std::size_t offset = 0U;
-    
-    // Deserialize trackId_
-    if (offset + sizeof(trackId_) <= data.size()) {
-        std::memcpy(&trackId_, &data[offset], sizeof(trackId_));
-        offset += sizeof(trackId_);
-    } else {
-        return false;
+    if (!isXVelocityECEFInRange(xVelocityECEF_)) {
+        errors |= FIELD_X_VELOCITY_ECEF;
     }
-    
-    // Deserialize xVelocityECEF_
-    if (offset + sizeof(xVelocityECEF_) <= data.size()) {
-        std::memcpy(&xVelocityECEF_, &data[offset], sizeof(xVelocityECEF_));
-        offset += sizeof(xVelocityECEF_);
-    } else {
-        return false;
+    if (!isYVelocityECEFInRange(yVelocityECEF_)) {
+        errors |= FIELD_Y_VELOCITY_ECEF;
     }
-    
-    // Deserialize yVelocityECEF_
-    if (offset + sizeof(yVelocityECEF_) <= data.size()) {
-        std::memcpy(&yVelocityECEF_, &data[offset], sizeof(yVelocityECEF_));
-        offset += sizeof(yVelocityECEF_);
-    } else {
-        return false;
+    if (!isZVelocityECEFInRange(zVelocityECEF_)) {
+        errors |= FIELD_Z_VELOCITY_ECEF;
     }
-    
-    // Deserialize zVelocityECEF_
-    if (offset + sizeof(zVelocityECEF_) <= data.size()) {
-        std::memcpy(&zVelocityECEF_, &data[offset], sizeof(zVelocityECEF_));
-        offset += sizeof(zVelocityECEF_);
-    } else {
-        return false;
+    if (!isXPositionECEFInRange(xPositionECEF_)) {
+        errors |= FIELD_X_POSITION_ECEF;
     }
-    
-    // Deserialize xPositionECEF_
-    if (offset + sizeof(xPositionECEF_) <= data.size()) {
-        std::memcpy(&xPositionECEF_, &data[offset], sizeof(xPositionECEF_));
-        offset += sizeof(xPositionECEF_);
-    } else {
-        return false;
+    if (!isYPositionECEFInRange(yPositionECEF_)) {
+        errors |= FIELD_Y_POSITION_ECEF;
     }
-    
-    // Deserialize yPositionECEF_
-    if (offset + sizeof(yPositionECEF_) <= data.size()) {
-        std::memcpy(&yPositionECEF_, &data[offset], sizeof(yPositionECEF_));
-        offset += sizeof(yPositionECEF_);
-    } else {
-        return false;
+    if (!isZPositionECEFInRange(zPositionECEF_)) {
+        errors |= FIELD_Z_POSITION_ECEF;
     }
-    
-    // Deserialize zPositionECEF_
-    if (offset + sizeof(zPositionECEF_) <= data.size()) {
-        std::memcpy(&zPositionECEF_, &data[offset], sizeof(zPositionECEF_));
-        offset += sizeof(zPositionECEF_);
-    } else {
-        return false;
+    if (!isOriginalUpdateTimeInRange(originalUpdateTime_)) {
+        errors |= FIELD_ORIGINAL_UPDATE_TIME;
     }
-    
-    // Deserialize originalUpdateTime_
-    if (offset + sizeof(originalUpdateTime_) <= data.size()) {
-        std::memcpy(&originalUpdateTime_, &data[offset], sizeof(originalUpdateTime_));
-        offset += sizeof(originalUpdateTime_);
-    } else {
-        return false;
+    if (!isUpdateTimeInRange(updateTime_)) {
+        errors |= FIELD_UPDATE_TIME;
     }
-    
-    // Deserialize updateTime_
-    if (offset + sizeof(updateTime_) <= data.size()) {
-        std::memcpy(&updateTime_, &data[offset], sizeof(updateTime_));
-        offset += sizeof(updateTime_);
-    } else {
-        return false;
+    if (!isFirstHopSentTimeInRange(firstHopSentTime_)) {
+        errors |= FIELD_FIRST_HOP_SENT_TIME;
     }
-    
-    // Deserialize firstHopSentTime_
-    if (offset + sizeof(firstHopSentTime_) <= data.size()) {
-        std::memcpy(&firstHopSentTime_, &data[offset], sizeof(firstHopSentTime_));
-        offset += sizeof(firstHopSentTime_);
-    } else {
-        return false;
+    if (!isFirstHopDelayTimeInRange(firstHopDelayTime_)) {
+        errors |= FIELD_FIRST_HOP_DELAY_TIME;
     }
-    
-    // Deserialize firstHopDelayTime_
-    if (offset + sizeof(firstHopDelayTime_) <= data.size()) {
-        std::memcpy(&firstHopDelayTime_, &data[offset], sizeof(firstHopDelayTime_));
-        offset += sizeof(firstHopDelayTime_);
-    } else {
-        return false;
+    if (!isSecondHopSentTimeInRange(secondHopSentTime_)) {
+        errors |= FIELD_SECOND_HOP_SENT_TIME;
     }
-    
-    // Deserialize secondHopSentTime_
-    if (offset + sizeof(secondHopSentTime_) <= data.size()) {
-        std::memcpy(&secondHopSentTime_, &data[offset], sizeof(secondHopSentTime_));
-        offset += sizeof(secondHopSentTime_);
-    } else {
-        return false;
+    if (!isSecondHopDelayTimeInRange(secondHopDelayTime_)) {
+        errors |= FIELD_SECOND_HOP_DELAY_TIME;
     }
-    
-    // Deserialize secondHopDelayTime_
-    if (offset + sizeof(secondHopDelayTime_) <= data.size()) {
-        std::memcpy(&secondHopDelayTime_, &data[offset], sizeof(secondHopDelayTime_));
-        offset += sizeof(secondHopDelayTime_);
-    } else {
-        return false;
+    if (!isTotalDelayTimeInRange(totalDelayTime_)) {
+        errors |= FIELD_TOTAL_DELAY_TIME;
     }
-    
-    // Deserialize totalDelayTime_
-    if (offset + sizeof(totalDelayTime_) <= data.size()) {
-        std::memcpy(&totalDelayTime_, &data[offset], sizeof(totalDelayTime_));
-        offset += sizeof(totalDelayTime_);
-    } else {
-        return false;
+    if (!isThirdHopSentTimeInRange(thirdHopSentTime_)) {
+        errors |= FIELD_THIRD_HOP_SENT_TIME;
+    }
+    return errors;
+}
+
+bool FinalCalcTrackData::isValid() const noexcept {
+    return validate() == 0U;
+}
+
+// MISRA C++ 2023 compliant Binary Serialization Implementation
+// Layout: packed FinalCalcTrackData::Wire, kWireSize bytes, native byte order
+std::vector<uint8_t> FinalCalcTrackData::serialize() const {
+    std::vector<uint8_t> buffer(kWireSize);
+    static_cast<void>(serializeInto(buffer.data(), buffer.size()));
+    return buffer;
+}
+
+std::size_t FinalCalcTrackData::serializeInto(uint8_t* dst, std::size_t cap) const noexcept {
+    if ((dst == nullptr) || (cap < kWireSize)) {
+        return 0U;
     }
-    
-    // Deserialize thirdHopSentTime_
-    if (offset + sizeof(thirdHopSentTime_) <= data.size()) {
-        std::memcpy(&thirdHopSentTime_, &data[offset], sizeof(thirdHopSentTime_));
-        offset += sizeof(thirdHopSentTime_);
-    } else {
+
+    const Wire wire{trackId_, xVelocityECEF_, yVelocityECEF_, zVelocityECEF_, xPositionECEF_, yPositionECEF_, zPositionECEF_, originalUpdateTime_, updateTime_, firstHopSentTime_, firstHopDelayTime_, secondHopSentTime_, secondHopDelayTime_, totalDelayTime_, thirdHopSentTime_};
+    std::memcpy(dst, &wire, kWireSize);
+    return kWireSize;
+}
+
+bool FinalCalcTrackData::deserialize(const std::vector<uint8_t>& data) noexcept {
+    return deserialize(data.data(), data.size());
+}
+
+bool FinalCalcTrackData::deserialize(const uint8_t* data, std::size_t size) noexcept {
+    if ((data == nullptr) || (size < kWireSize)) {
         return false;
     }
-    
+
+    Wire wire;
+    std::memcpy(&wire, data, kWireSize);
+    trackId_ = wire.trackId;
+    xVelocityECEF_ = wire.xVelocityECEF;
+    yVelocityECEF_ = wire.yVelocityECEF;
+    zVelocityECEF_ = wire.zVelocityECEF;
+    xPositionECEF_ = wire.xPositionECEF;
+    yPositionECEF_ = wire.yPositionECEF;
+    zPositionECEF_ = wire.zPositionECEF;
+    originalUpdateTime_ = wire.originalUpdateTime;
+    updateTime_ = wire.updateTime;
+    firstHopSentTime_ = wire.firstHopSentTime;
+    firstHopDelayTime_ = wire.firstHopDelayTime;
+    secondHopSentTime_ = wire.secondHopSentTime;
+    secondHopDelayTime_ = wire.secondHopDelayTime;
+    totalDelayTime_ = wire.totalDelayTime;
+    thirdHopSentTime_ = wire.thirdHopSentTime;
+    // Local fields are never on the wire
+    secondHopReceiveTime_ = {};
+    secondHopClockOffset_ = {};
+    secondHopClockErrorBound_ = {};
     return true;
 }
 
 std::size_t FinalCalcTrackData::getSerializedSize() const noexcept {
-    std::size_t size = 0U;
-    
-    size += sizeof(trackId_);  // int32_t
-    size += sizeof(xVelocityECEF_);  // double
-    size += sizeof(yVelocityECEF_);  // double
-    size += sizeof(zVelocityECEF_);  // double
-    size += sizeof(xPositionECEF_);  // double
-    size += sizeof(yPositionECEF_);  // double
-    size += sizeof(zPositionECEF_);  // double
-    size += sizeof(originalUpdateTime_);  // int64_t
-    size += sizeof(updateTime_);  // int64_t
-    size += sizeof(firstHopSentTime_);  // int64_t
-    size += sizeof(firstHopDelayTime_);  // int64_t
-    size += sizeof(secondHopSentTime_);  // int64_t
-    size += sizeof(secondHopDelayTime_);  // int64_t
-    size += sizeof(totalDelayTime_);  // int64_t
-    size += sizeof(thirdHopSentTime_);  // int64_t
-    
-    return size;
+    return kWireSize;
 }
 
 } // namespace model
@@ -0,0 +1,438 @@
+/**
+ * @file TrackStatics.cpp
+ * @brief Implementation of TrackStatics model class
+ * @details Per-track delay statistics published by TrackStaticsAggregator.
+ *
+ * @author c_hexagon Team
+ * @version 1.0
+ * @date 2025
+ *
+ * @note MISRA C++ 2023 compliant implementation
+ * @see TrackStatics.hpp
+ */
+
+#include "domain/ports/outgoing/TrackStatics.hpp"
+
+namespace domain {
+namespace ports {
+
+// MISRA C++ 2023 compliant constructor implementation
+TrackStatics::TrackStatics() noexcept {
+    trackId_ = static_cast<int32_t>(0);
+    firstHopDelayDataMean_ = static_cast<double>(0);
+    firstHopDelayDataStd_ = static_cast<double>(0);
+    firstHopDelayDataMin_ = static_cast<double>(0);
+    firstHopDelayDataMax_ = static_cast<double>(0);
+    secondHopDelayDataMean_ = static_cast<double>(0);
+    secondHopDelayDataStd_ = static_cast<double>(0);
+    secondHopDelayDataMin_ = static_cast<double>(0);
+    secondHopDelayDataMax_ = static_cast<double>(0);
+    totalHopDelayDataMean_ = static_cast<double>(0);
+    totalHopDelayDataStd_ = static_cast<double>(0);
+    totalHopDelayDataMin_ = static_cast<double>(0);
+    totalHopDelayDataMax_ = static_cast<double>(0);
+    updateTime_ = static_cast<int64_t>(0);
+}
+
+// Unchecked constructor: caller guarantees the values are in range
+TrackStatics::TrackStatics(UncheckedInit,
+                           int32_t trackId,
+                           double firstHopDelayDataMean,
+                           double firstHopDelayDataStd,
+                           double firstHopDelayDataMin,
+                           double firstHopDelayDataMax,
+                           double secondHopDelayDataMean,
+                           double secondHopDelayDataStd,
+                           double secondHopDelayDataMin,
+                           double secondHopDelayDataMax,
+                           double totalHopDelayDataMean,
+                           double totalHopDelayDataStd,
+                           double totalHopDelayDataMin,
+                           double totalHopDelayDataMax,
+                           int64_t updateTime) noexcept
+    : trackId_(trackId)
+    , firstHopDelayDataMean_(firstHopDelayDataMean)
+    , firstHopDelayDataStd_(firstHopDelayDataStd)
+    , firstHopDelayDataMin_(firstHopDelayDataMin)
+    , firstHopDelayDataMax_(firstHopDelayDataMax)
+    , secondHopDelayDataMean_(secondHopDelayDataMean)
+    , secondHopDelayDataStd_(secondHopDelayDataStd)
+    , secondHopDelayDataMin_(secondHopDelayDataMin)
+    , secondHopDelayDataMax_(secondHopDelayDataMax)
+    , totalHopDelayDataMean_(totalHopDelayDataMean)
+    , totalHopDelayDataStd_(totalHopDelayDataStd)
+    , totalHopDelayDataMin_(totalHopDelayDataMin)
+    , totalHopDelayDataMax_(totalHopDelayDataMax)
+    , updateTime_(updateTime) {
+}
+
+// Range checks - noexcept, shared by setters and validate()
+bool TrackStatics::isTrackIdInRange(int32_t value) noexcept {
+    return (value >= 1LL) && (value <= 9999LL);
+}
+
+bool TrackStatics::isFirstHopDelayDataMeanInRange(double value) noexcept {
+    return !std::isnan(value) && (value >= 0) && (value <= 1000000);
+}
+
+bool TrackStatics::isFirstHopDelayDataStdInRange(double value) noexcept {
+    return !std::isnan(value) && (value >= 0) && (value <= 1000000);
+}
+
+bool TrackStatics::isFirstHopDelayDataMinInRange(double value) noexcept {
+    return !std::isnan(value) && (value >= 0) && (value <= 1000000);
+}
+
+bool TrackStatics::isFirstHopDelayDataMaxInRange(double value) noexcept {
+    return !std::isnan(value) && (value >= 0) && (value <= 1000000);
+}
+
+bool TrackStatics::isSecondHopDelayDataMeanInRange(double value) noexcept {
+    return !std::isnan(value) && (value >= 0) && (value <= 1000000);
+}
+
+bool TrackStatics::isSecondHopDelayDataStdInRange(double value) noexcept {
+    return !std::isnan(value) && (value >= 0) && (value <= 1000000);
+}
+
+bool TrackStatics::isSecondHopDelayDataMinInRange(double value) noexcept {
+    return !std::isnan(value) && (value >= 0) && (value <= 1000000);
+}
+
+bool TrackStatics::isSecondHopDelayDataMaxInRange(double value) noexcept {
+    return !std::isnan(value) && (value >= 0) && (value <= 1000000);
+}
+
+bool TrackStatics::isTotalHopDelayDataMeanInRange(double value) noexcept {
+    return !std::isnan(value) && (value >= 0) && (value <= 1000000);
+}
+
+bool TrackStatics::isTotalHopDelayDataStdInRange(double value) noexcept {
+    return !std::isnan(value) && (value >= 0) && (value <= 1000000);
+}
+
+bool TrackStatics::isTotalHopDelayDataMinInRange(double value) noexcept {
+    return !std::isnan(value) && (value >= 0) && (value <= 1000000);
+}
+
+bool TrackStatics::isTotalHopDelayDataMaxInRange(double value) noexcept {
+    return !std::isnan(value) && (value >= 0) && (value <= 1000000);
+}
+
+bool TrackStatics::isUpdateTimeInRange(int64_t value) noexcept {
+    return (value >= 0LL) && (value <= 9223372036854776LL);
+}
+
+    void TrackStatics::validateTrackId(int32_t value) const {
+        if (!isTrackIdInRange(value)) {
+            throw std::out_of_range("TrackId value is out of valid range: " + std::to_string(value));
+        }
+    }
+
+    void TrackStatics::validateFirstHopDelayDataMean(double value) const {
+        if (!isFirstHopDelayDataMeanInRange(value)) {
+            throw std::out_of_range("FirstHopDelayDataMean value is out of valid range: " + std::to_string(value));
+        }
+    }
+
+    void TrackStatics::validateFirstHopDelayDataStd(double value) const {
+        if (!isFirstHopDelayDataStdInRange(value)) {
+            throw std::out_of_range("FirstHopDelayDataStd value is out of valid range: " + std::to_string(value));
+        }
+    }
+
+    void TrackStatics::validateFirstHopDelayDataMin(double value) const {
+        if (!isFirstHopDelayDataMinInRange(value)) {
+            throw std::out_of_range("FirstHopDelayDataMin value is out of valid range: " + std::to_string(value));
+        }
+    }
+
+    void TrackStatics::validateFirstHopDelayDataMax(double value) const {
+        if (!isFirstHopDelayDataMaxInRange(value)) {
+            throw std::out_of_range("FirstHopDelayDataMax value is out of valid range: " + std::to_string(value));
+        }
+    }
+
+    void TrackStatics::validateSecondHopDelayDataMean(double value) const {
+        if (!isSecondHopDelayDataMeanInRange(value)) {
+            throw std::out_of_range("SecondHopDelayDataMean value is out of valid range: " + std::to_string(value));
+        }
+    }
+
+    void TrackStatics::validateSecondHopDelayDataStd(double value) const {
+        if (!isSecondHopDelayDataStdInRange(value)) {
+            throw std::out_of_range("SecondHopDelayDataStd value is out of valid range: " + std::to_string(value));
+        }
+    }
+
+    void TrackStatics::validateSecondHopDelayDataMin(double value) const {
+        if (!isSecondHopDelayDataMinInRange(value)) {
+            throw std::out_of_range("SecondHopDelayDataMin value is out of valid range: " + std::to_string(value));
+        }
+    }
+
+    void TrackStatics::validateSecondHopDelayDataMax(double value) const {
+        if (!isSecondHopDelayDataMaxInRange(value)) {
+            throw std::out_of_range("SecondHopDelayDataMax value is out of valid range: " + std::to_string(value));
+        }
+    }
+
+    void TrackStatics::validateTotalHopDelayDataMean(double value) const {
+        if (!isTotalHopDelayDataMeanInRange(value)) {
+            throw std::out_of_range("TotalHopDelayDataMean value is out of valid range: " + std::to_string(value));
+        }
+    }
+
+    void TrackStatics::validateTotalHopDelayDataStd(double value) const {
+        if (!isTotalHopDelayDataStdInRange(value)) {
+            throw std::out_of_range("TotalHopDelayDataStd value is out of valid range: " + std::to_string(value));
+        }
+    }
+
+    void TrackStatics::validateTotalHopDelayDataMin(double value) const {
+        if (!isTotalHopDelayDataMinInRange(value)) {
+            throw std::out_of_range("TotalHopDelayDataMin value is out of valid range: " + std::to_string(value));
+        }
+    }
+
+    void TrackStatics::validateTotalHopDelayDataMax(double value) const {
+        if (!isTotalHopDelayDataMaxInRange(value)) {
+            throw std::out_of_range("TotalHopDelayDataMax value is out of valid range: " + std::to_string(value));
+        }
+    }
+
+    void TrackStatics::validateUpdateTime(int64_t value) const {
+        if (!isUpdateTimeInRange(value)) {
+            throw std::out_of_range("UpdateTime value is out of valid range: " + std::to_string(value));
+        }
+    }
+
+int32_t TrackStatics::getTrackId() const noexcept {
+    return trackId_;
+}
+
+void TrackStatics::setTrackId(const int32_t& value) {
+    validateTrackId(value);
+    trackId_ = value;
+}
+
+double TrackStatics::getFirstHopDelayDataMean() const noexcept {
+    return firstHopDelayDataMean_;
+}
+
+void TrackStatics::setFirstHopDelayDataMean(const double& value) {
+    validateFirstHopDelayDataMean(value);
+    firstHopDelayDataMean_ = value;
+}
+
+double TrackStatics::getFirstHopDelayDataStd() const noexcept {
+    return firstHopDelayDataStd_;
+}
+
+void TrackStatics::setFirstHopDelayDataStd(const double& value) {
+    validateFirstHopDelayDataStd(value);
+    firstHopDelayDataStd_ = value;
+}
+
+double TrackStatics::getFirstHopDelayDataMin() const noexcept {
+    return firstHopDelayDataMin_;
+}
+
+void TrackStatics::setFirstHopDelayDataMin(const double& value) {
+    validateFirstHopDelayDataMin(value);
+    firstHopDelayDataMin_ = value;
+}
+
+double TrackStatics::getFirstHopDelayDataMax() const noexcept {
+    return firstHopDelayDataMax_;
+}
+
+void TrackStatics::setFirstHopDelayDataMax(const double& value) {
+    validateFirstHopDelayDataMax(value);
+    firstHopDelayDataMax_ = value;
+}
+
+double TrackStatics::getSecondHopDelayDataMean() const noexcept {
+    return secondHopDelayDataMean_;
+}
+
+void TrackStatics::setSecondHopDelayDataMean(const double& value) {
+    validateSecondHopDelayDataMean(value);
+    secondHopDelayDataMean_ = value;
+}
+
+double TrackStatics::getSecondHopDelayDataStd() const noexcept {
+    return secondHopDelayDataStd_;
+}
+
+void TrackStatics::setSecondHopDelayDataStd(const double& value) {
+    validateSecondHopDelayDataStd(value);
+    secondHopDelayDataStd_ = value;
+}
+
+double TrackStatics::getSecondHopDelayDataMin() const noexcept {
+    return secondHopDelayDataMin_;
+}
+
+void TrackStatics::setSecondHopDelayDataMin(const double& value) {
+    validateSecondHopDelayDataMin(value);
+    secondHopDelayDataMin_ = value;
+}
+
+double TrackStatics::getSecondHopDelayDataMax() const noexcept {
+    return secondHopDelayDataMax_;
+}
+
+void TrackStatics::setSecondHopDelayDataMax(const double& value) {
+    validateSecondHopDelayDataMax(value);
+    secondHopDelayDataMax_ = value;
+}
+
+double TrackStatics::getTotalHopDelayDataMean() const noexcept {
+    return totalHopDelayDataMean_;
+}
+
+void TrackStatics::setTotalHopDelayDataMean(const double& value) {
+    validateTotalHopDelayDataMean(value);
+    totalHopDelayDataMean_ = value;
+}
+
+double TrackStatics::getTotalHopDelayDataStd() const noexcept {
+    return totalHopDelayDataStd_;
+}
+
+void TrackStatics::setTotalHopDelayDataStd(const double& value) {
+    validateTotalHopDelayDataStd(value);
+    totalHopDelayDataStd_ = value;
+}
+
+double TrackStatics::getTotalHopDelayDataMin() const noexcept {
+    return totalHopDelayDataMin_;
+}
+
+void TrackStatics::setTotalHopDelayDataMin(const double& value) {
+    validateTotalHopDelayDataMin(value);
+    totalHopDelayDataMin_ = value;
+}
+
+double TrackStatics::getTotalHopDelayDataMax() const noexcept {
+    return totalHopDelayDataMax_;
+}
+
+void TrackStatics::setTotalHopDelayDataMax(const double& value) {
+    validateTotalHopDelayDataMax(value);
+    totalHopDelayDataMax_ = value;
+}
+
+int64_t TrackStatics::getUpdateTime() const noexcept {
+    return updateTime_;
+}
+
+void TrackStatics::setUpdateTime(const int64_t& value) {
+    validateUpdateTime(value);
+    updateTime_ = value;
+}
+
+uint32_t TrackStatics::validate() const noexcept {
+    uint32_t errors = 0U;
+    if (!isTrackIdInRange(trackId_)) {
+        errors |= FIELD_TRACK_ID;
+    }
+    if (!isFirstHopDelayDataMeanInRange(firstHopDelayDataMean_)) {
+        errors |= FIELD_FIRST_HOP_DELAY_DATA_MEAN;
+    }
+    if (!isFirstHopDelayDataStdInRange(firstHopDelayDataStd_)) {
+        errors |= FIELD_FIRST_HOP_DELAY_DATA_STD;
+    }
+    if (!isFirstHopDelayDataMinInRange(firstHopDelayDataMin_)) {
+        errors |= FIELD_FIRST_HOP_DELAY_DATA_MIN;
+    }
+    if (!isFirstHopDelayDataMaxInRange(firstHopDelayDataMax_)) {
+        errors |= FIELD_FIRST_HOP_DELAY_DATA_MAX;
+    }
+    if (!isSecondHopDelayDataMeanInRange(secondHopDelayDataMean_)) {
+        errors |= FIELD_SECOND_HOP_DELAY_DATA_MEAN;
+    }
+    if (!isSecondHopDelayDataStdInRange(secondHopDelayDataStd_)) {
+        errors |= FIELD_SECOND_HOP_DELAY_DATA_STD;
+    }
+    if (!isSecondHopDelayDataMinInRange(secondHopDelayDataMin_)) {
+        errors |= FIELD_SECOND_HOP_DELAY_DATA_MIN;
+    }
+    if (!isSecondHopDelayDataMaxInRange(secondHopDelayDataMax_)) {
+        errors |= FIELD_SECOND_HOP_DELAY_DATA_MAX;
+    }
+    if (!isTotalHopDelayDataMeanInRange(totalHopDelayDataMean_)) {
+        errors |= FIELD_TOTAL_HOP_DELAY_DATA_MEAN;
+    }
+    if (!isTotalHopDelayDataStdInRange(totalHopDelayDataStd_)) {
+        errors |= FIELD_TOTAL_HOP_DELAY_DATA_STD;
+    }
+    if (!isTotalHopDelayDataMinInRange(totalHopDelayDataMin_)) {
+        errors |= FIELD_TOTAL_HOP_DELAY_DATA_MIN;
+    }
+    if (!isTotalHopDelayDataMaxInRange(totalHopDelayDataMax_)) {
+        errors |= FIELD_TOTAL_HOP_DELAY_DATA_MAX;
+    }
+    if (!isUpdateTimeInRange(updateTime_)) {
+        errors |= FIELD_UPDATE_TIME;
+    }
+    return errors;
+}
+
+bool TrackStatics::isValid() const noexcept {
+    return validate() == 0U;
+}
+
+// MISRA C++ 2023 compliant Binary Serialization Implementation
+// Layout: packed TrackStatics::Wire, kWireSize bytes, native byte order
+std::vector<uint8_t> TrackStatics::serialize() const {
+    std::vector<uint8_t> buffer(kWireSize);
+    static_cast<void>(serializeInto(buffer.data(), buffer.size()));
+    return buffer;
+}
+
+std::size_t TrackStatics::serializeInto(uint8_t* dst, std::size_t cap) const noexcept {
+    if ((dst == nullptr) || (cap < kWireSize)) {
+        return 0U;
+    }
+
+    const Wire wire{trackId_, firstHopDelayDataMean_, firstHopDelayDataStd_, firstHopDelayDataMin_, firstHopDelayDataMax_, secondHopDelayDataMean_, secondHopDelayDataStd_, secondHopDelayDataMin_, secondHopDelayDataMax_, totalHopDelayDataMean_, totalHopDelayDataStd_, totalHopDelayDataMin_, totalHopDelayDataMax_, updateTime_};
+    std::memcpy(dst, &wire, kWireSize);
+    return kWireSize;
+}
+
+bool TrackStatics::deserialize(const std::vector<uint8_t>& data) noexcept {
+    return deserialize(data.data(), data.size());
+}
+
+bool TrackStatics::deserialize(const uint8_t* data, std::size_t size) noexcept {
+    if ((data == nullptr) || (size < kWireSize)) {
+        return false;
+    }
+
+    Wire wire;
+    std::memcpy(&wire, data, kWireSize);
+    trackId_ = wire.trackId;
+    firstHopDelayDataMean_ = wire.firstHopDelayDataMean;
+    firstHopDelayDataStd_ = wire.firstHopDelayDataStd;
+    firstHopDelayDataMin_ = wire.firstHopDelayDataMin;
+    firstHopDelayDataMax_ = wire.firstHopDelayDataMax;
+    secondHopDelayDataMean_ = wire.secondHopDelayDataMean;
+    secondHopDelayDataStd_ = wire.secondHopDelayDataStd;
+    secondHopDelayDataMin_ = wire.secondHopDelayDataMin;
+    secondHopDelayDataMax_ = wire.secondHopDelayDataMax;
+    totalHopDelayDataMean_ = wire.totalHopDelayDataMean;
+    totalHopDelayDataStd_ = wire.totalHopDelayDataStd;
+    totalHopDelayDataMin_ = wire.totalHopDelayDataMin;
+    totalHopDelayDataMax_ = wire.totalHopDelayDataMax;
+    updateTime_ = wire.updateTime;
+    return true;
+}
+
+std::size_t TrackStatics::getSerializedSize() const noexcept {
+    return kWireSize;
+}
+
+} // namespace ports
+} // namespace domain
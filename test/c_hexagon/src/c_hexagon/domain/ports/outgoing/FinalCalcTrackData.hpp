@@ -22,6 +22,8 @@
 #include <cmath>
 #include <vector>
 #include <cstring>
+#include <cstddef>
+#include <type_traits>
 
 namespace domain {
 namespace ports {
@@ -40,6 +42,32 @@ public:
     // MISRA C++ 2023 compliant constructors
     explicit FinalCalcTrackData() noexcept;
 
+    /// @brief Tag selecting the unchecked constructor
+    struct UncheckedInit final {};
+    static constexpr UncheckedInit UNCHECKED{};
+
+    /**
+     * @brief Construct from values that already passed validate() upstream
+     * @details No range checks: stage-to-stage copies cost one store per field.
+     *          Only use for data validated at the ingress boundary.
+     */
+    FinalCalcTrackData(UncheckedInit,
+                       int32_t trackId,
+                       double xVelocityECEF,
+                       double yVelocityECEF,
+                       double zVelocityECEF,
+                       double xPositionECEF,
+                       double yPositionECEF,
+                       double zPositionECEF,
+                       int64_t originalUpdateTime,
+                       int64_t updateTime,
+                       int64_t firstHopSentTime,
+                       int64_t firstHopDelayTime,
+                       int64_t secondHopSentTime,
+                       int64_t secondHopDelayTime,
+                       int64_t totalDelayTime,
+                       int64_t thirdHopSentTime) noexcept;
+
     // Copy constructor
     FinalCalcTrackData(const FinalCalcTrackData& other) = default;
 
@@ -101,12 +129,97 @@ public:
     int64_t getThirdHopSentTime() const noexcept;
     void setThirdHopSentTime(const int64_t& value);
 
-    // Validation - MISRA compliant
+    // Local fields - set in-process, not serialized or validated
+    /// @brief Arrival time at c_hexagon, kernel or userspace stamp (microseconds, 0 = unknown)
+    int64_t getSecondHopReceiveTime() const noexcept;
+    void setSecondHopReceiveTime(const int64_t& value) noexcept;
+
+    /// @brief Clock offset applied to secondHopDelayTime: b_hexagon clock - local clock (microseconds)
+    int64_t getSecondHopClockOffset() const noexcept;
+    void setSecondHopClockOffset(const int64_t& value) noexcept;
+
+    /// @brief Error bound of secondHopDelayTime after the offset (microseconds, 0 = uncorrected)
+    int64_t getSecondHopClockErrorBound() const noexcept;
+    void setSecondHopClockErrorBound(const int64_t& value) noexcept;
+
+    // Validation - MISRA compliant, exception free
+    /// @brief Field bits reported by validate()
+    static constexpr uint32_t FIELD_TRACK_ID{1U << 0U};
+    static constexpr uint32_t FIELD_X_VELOCITY_ECEF{1U << 1U};
+    static constexpr uint32_t FIELD_Y_VELOCITY_ECEF{1U << 2U};
+    static constexpr uint32_t FIELD_Z_VELOCITY_ECEF{1U << 3U};
+    static constexpr uint32_t FIELD_X_POSITION_ECEF{1U << 4U};
+    static constexpr uint32_t FIELD_Y_POSITION_ECEF{1U << 5U};
+    static constexpr uint32_t FIELD_Z_POSITION_ECEF{1U << 6U};
+    static constexpr uint32_t FIELD_ORIGINAL_UPDATE_TIME{1U << 7U};
+    static constexpr uint32_t FIELD_UPDATE_TIME{1U << 8U};
+    static constexpr uint32_t FIELD_FIRST_HOP_SENT_TIME{1U << 9U};
+    static constexpr uint32_t FIELD_FIRST_HOP_DELAY_TIME{1U << 10U};
+    static constexpr uint32_t FIELD_SECOND_HOP_SENT_TIME{1U << 11U};
+    static constexpr uint32_t FIELD_SECOND_HOP_DELAY_TIME{1U << 12U};
+    static constexpr uint32_t FIELD_TOTAL_DELAY_TIME{1U << 13U};
+    static constexpr uint32_t FIELD_THIRD_HOP_SENT_TIME{1U << 14U};
+
+    /**
+     * @brief Range-check every field without throwing
+     * @return 0 if valid, otherwise the FIELD_* bits of out-of-range fields
+     */
+    [[nodiscard]] uint32_t validate() const noexcept;
     [[nodiscard]] bool isValid() const noexcept;
 
+    // Per-field range checks (setters throw std::out_of_range when these fail)
+    [[nodiscard]] static bool isTrackIdInRange(int32_t value) noexcept;
+    [[nodiscard]] static bool isXVelocityECEFInRange(double value) noexcept;
+    [[nodiscard]] static bool isYVelocityECEFInRange(double value) noexcept;
+    [[nodiscard]] static bool isZVelocityECEFInRange(double value) noexcept;
+    [[nodiscard]] static bool isXPositionECEFInRange(double value) noexcept;
+    [[nodiscard]] static bool isYPositionECEFInRange(double value) noexcept;
+    [[nodiscard]] static bool isZPositionECEFInRange(double value) noexcept;
+    [[nodiscard]] static bool isOriginalUpdateTimeInRange(int64_t value) noexcept;
+    [[nodiscard]] static bool isUpdateTimeInRange(int64_t value) noexcept;
+    [[nodiscard]] static bool isFirstHopSentTimeInRange(int64_t value) noexcept;
+    [[nodiscard]] static bool isFirstHopDelayTimeInRange(int64_t value) noexcept;
+    [[nodiscard]] static bool isSecondHopSentTimeInRange(int64_t value) noexcept;
+    [[nodiscard]] static bool isSecondHopDelayTimeInRange(int64_t value) noexcept;
+    [[nodiscard]] static bool isTotalDelayTimeInRange(int64_t value) noexcept;
+    [[nodiscard]] static bool isThirdHopSentTimeInRange(int64_t value) noexcept;
+
     // Binary Serialization - MISRA compliant
+    /// @brief Fixed wire size in bytes (packed fields, native byte order)
+    static constexpr std::size_t kWireSize{116U};
+
+    /**
+     * @brief Packed wire image of the serialized fields
+     * @details Trivially copyable: encode and decode are one memcpy of kWireSize bytes
+     */
+#pragma pack(push, 1)
+    struct Wire final {
+        int32_t trackId;
+        double xVelocityECEF;
+        double yVelocityECEF;
+        double zVelocityECEF;
+        double xPositionECEF;
+        double yPositionECEF;
+        double zPositionECEF;
+        int64_t originalUpdateTime;
+        int64_t updateTime;
+        int64_t firstHopSentTime;
+        int64_t firstHopDelayTime;
+        int64_t secondHopSentTime;
+        int64_t secondHopDelayTime;
+        int64_t totalDelayTime;
+        int64_t thirdHopSentTime;
+    };
+#pragma pack(pop)
+
     [[nodiscard]] std::vector<uint8_t> serialize() const;
+    /**
+     * @brief Encode into a caller-provided (pooled or stack) buffer
+     * @return Bytes written (kWireSize), or 0 if dst is null or cap < kWireSize
+     */
+    [[nodiscard]] std::size_t serializeInto(uint8_t* dst, std::size_t cap) const noexcept;
     bool deserialize(const std::vector<uint8_t>& data) noexcept;
+    bool deserialize(const uint8_t* data, std::size_t size) noexcept;
     [[nodiscard]] std::size_t getSerializedSize() const noexcept;
 
 private:
@@ -141,6 +254,13 @@ private:
     int64_t totalDelayTime_;
     /// Third hop sent timestamp (microseconds)
     int64_t thirdHopSentTime_;
+    // Local fields (not serialized)
+    /// Arrival time at c_hexagon, kernel or userspace stamp (microseconds, 0 = unknown)
+    int64_t secondHopReceiveTime_{};
+    /// Clock offset applied to secondHopDelayTime: b_hexagon clock - local clock (microseconds)
+    int64_t secondHopClockOffset_{};
+    /// Error bound of secondHopDelayTime after the offset (microseconds, 0 = uncorrected)
+    int64_t secondHopClockErrorBound_{};
 
     // Validation functions - MISRA compliant
     void validateTrackId(int32_t value) const;
@@ -160,5 +280,8 @@ private:
     void validateThirdHopSentTime(int64_t value) const;
 };
 
+static_assert(sizeof(FinalCalcTrackData::Wire) == FinalCalcTrackData::kWireSize, "FinalCalcTrackData::Wire must have no padding");
+static_assert(std::is_trivially_copyable<FinalCalcTrackData::Wire>::value, "FinalCalcTrackData::Wire must be trivially copyable");
+
 } // namespace ports
 } // namespace domain
@@ -0,0 +1,50 @@
+/**
+ * @file ILatencyStatisticsOutgoingPort.hpp
+ * @brief Secondary port for exporting per-hop latency percentile snapshots
+ * @details Implemented by adapters that persist or forward the interval
+ *          summaries produced by TargetStatisticService.
+ *
+ * @author c_hexagon Team
+ * @version 1.0
+ * @date 2025
+ *
+ * @note MISRA C++ 2023 compliant implementation
+ * @see LatencySnapshot
+ * @see LatencySnapshotFileOutgoingAdapter
+ */
+
+#pragma once
+
+#include "domain/ports/outgoing/LatencySnapshot.hpp"
+#include <vector>
+
+namespace domain {
+namespace ports {
+namespace outgoing {
+
+/**
+ * @class ILatencyStatisticsOutgoingPort
+ * @brief Secondary Port interface for latency snapshot export
+ * @details Called from the domain thread once per rotation interval, never
+ *          per message. Implementations must not retain the vector.
+ */
+class ILatencyStatisticsOutgoingPort {
+public:
+    virtual ~ILatencyStatisticsOutgoingPort() = default;
+
+    /**
+     * @brief Export the snapshots of one closed interval
+     * @param snapshots Global snapshots first, then per-track ones
+     */
+    virtual void publishLatencySnapshots(const std::vector<LatencySnapshot>& snapshots) = 0;
+
+    /**
+     * @brief Check if the export target is ready
+     * @return true if snapshots can be published
+     */
+    virtual bool isReady() const = 0;
+};
+
+} // namespace outgoing
+} // namespace ports
+} // namespace domain
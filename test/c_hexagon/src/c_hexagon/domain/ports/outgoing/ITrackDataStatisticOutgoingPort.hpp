@@ -17,6 +17,7 @@
 #define FINAL_TRACK_DATA_OUTGOING_PORT_HPP
 
 #include "domain/ports/outgoing/FinalCalcTrackData.hpp"
+#include <vector>
 
 namespace domain {
 namespace ports {
@@ -65,6 +66,20 @@ public:
      */
     virtual void sendFinalTrackData(const domain::ports::FinalCalcTrackData& data) = 0;
     
+    /**
+     * @brief Send a batch of final calculated track data to external system
+     * 
+     * @param data Final calculated track data, in order
+     * @details The default sends each record on its own; adapters with a
+     *          queue override it to enqueue the batch under one lock
+     * @throws std::runtime_error if transmission fails
+     */
+    virtual void sendFinalTrackData(const std::vector<domain::ports::FinalCalcTrackData>& data) {
+        for (const domain::ports::FinalCalcTrackData& item : data) {
+            sendFinalTrackData(item);
+        }
+    }
+    
     /**
      * @brief Check if the outgoing connection is ready/healthy
      * 
@@ -0,0 +1,50 @@
+/**
+ * @file ITrackStaticsOutgoingPort.hpp
+ * @brief Secondary port for publishing per-track delay statistics
+ * @details Implemented by adapters that forward the TrackStatics summaries
+ *          produced by TargetStatisticService on its publish cadence.
+ *
+ * @author c_hexagon Team
+ * @version 1.0
+ * @date 2025
+ *
+ * @note MISRA C++ 2023 compliant implementation
+ * @see TrackStatics
+ * @see TrackStaticsZeroMQOutgoingAdapter
+ */
+
+#pragma once
+
+#include "domain/ports/outgoing/TrackStatics.hpp"
+#include <vector>
+
+namespace domain {
+namespace ports {
+namespace outgoing {
+
+/**
+ * @class ITrackStaticsOutgoingPort
+ * @brief Secondary Port interface for TrackStatics publishing
+ * @details Called from the domain thread once per cadence, never per message.
+ *          Implementations must not retain the vector.
+ */
+class ITrackStaticsOutgoingPort {
+public:
+    virtual ~ITrackStaticsOutgoingPort() = default;
+
+    /**
+     * @brief Publish the statistics of every track updated since the last call
+     * @param statics One record per track, validated
+     */
+    virtual void sendTrackStatics(const std::vector<TrackStatics>& statics) = 0;
+
+    /**
+     * @brief Check if the outgoing connection is ready
+     * @return true if statistics can be published
+     */
+    virtual bool isReady() const = 0;
+};
+
+} // namespace outgoing
+} // namespace ports
+} // namespace domain
@@ -0,0 +1,66 @@
+/**
+ * @file LatencySnapshot.hpp
+ * @brief Percentile summary of one latency histogram interval
+ * @details Exported by TargetStatisticService through
+ *          ILatencyStatisticsOutgoingPort once per rotation interval,
+ *          one record per (track, hop) plus one global record per hop.
+ *
+ * @author c_hexagon Team
+ * @version 1.0
+ * @date 2025
+ *
+ * @note MISRA C++ 2023 compliant implementation
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <type_traits>
+
+namespace domain {
+namespace ports {
+
+/**
+ * @brief Pipeline hop a latency sample belongs to
+ */
+enum class LatencyHop : uint8_t {
+    FirstHop = 0U,   ///< a_hexagon -> b_hexagon (FirstHopDelayTime)
+    SecondHop = 1U,  ///< b_hexagon -> c_hexagon (SecondHopDelayTime)
+    Total = 2U,      ///< End-to-end (TotalDelayTime)
+    SecondHopNetwork = 3U,   ///< b send -> c arrival (global only, kernel or adapter receive time)
+    SecondHopInProcess = 4U  ///< c arrival -> c processing (global only, kernel or adapter receive time)
+};
+
+/// @brief Number of hops recorded per track (FirstHop..Total)
+static constexpr uint8_t LATENCY_HOP_COUNT{3U};
+
+/// @brief Number of LatencyHop values (global snapshots may use all of them)
+static constexpr uint8_t LATENCY_GLOBAL_HOP_COUNT{5U};
+
+/// @brief trackId of the all-tracks snapshot
+static constexpr int32_t LATENCY_GLOBAL_TRACK_ID{-1};
+
+/**
+ * @struct LatencySnapshot
+ * @brief Fixed 80-byte interval summary (all values in microseconds)
+ */
+struct LatencySnapshot {
+    int64_t intervalStartUs{0};   ///< Wall clock at interval start
+    int64_t intervalEndUs{0};     ///< Wall clock at rotation
+    int32_t trackId{LATENCY_GLOBAL_TRACK_ID};  ///< Track or LATENCY_GLOBAL_TRACK_ID
+    uint8_t hop{0U};              ///< LatencyHop
+    uint8_t reserved[3]{};        ///< Zero
+    uint64_t count{0U};           ///< Samples in the interval
+    int64_t minUs{0};
+    int64_t p50Us{0};
+    int64_t p90Us{0};
+    int64_t p99Us{0};
+    int64_t p999Us{0};
+    int64_t maxUs{0};
+};
+
+static_assert(sizeof(LatencySnapshot) == 80U, "LatencySnapshot must be 80 bytes on disk");
+static_assert(std::is_trivially_copyable<LatencySnapshot>::value, "LatencySnapshot must be trivially copyable");
+
+} // namespace ports
+} // namespace domain
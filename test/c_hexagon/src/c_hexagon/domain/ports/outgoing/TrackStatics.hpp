@@ -0,0 +1,257 @@
+/**
+ * @file TrackStatics.hpp
+ * @brief Domain model for per-track delay statistics
+ * @details Running mean, standard deviation, min and max of the first-hop,
+ *          second-hop and total delay of one track. Auto-generated from TrackStatics.json.
+ *
+ * @author c_hexagon Team
+ * @version 1.0
+ * @date 2025
+ *
+ * @note MISRA C++ 2023 compliant implementation
+ * @note Auto-generated from JSON schema
+ * @see FinalCalcTrackData
+ */
+
+#pragma once
+
+// MISRA C++ 2023 compliant includes
+#include <string>
+#include <cstdint>
+#include <stdexcept>
+#include <cmath>
+#include <vector>
+#include <cstring>
+#include <cstddef>
+#include <type_traits>
+
+namespace domain {
+namespace ports {
+
+/**
+ * @brief Contains the statistical analysis (mean, standard deviation, min/max) of a track's multi-hop delays.
+ * Auto-generated from TrackStatics.json
+ * MISRA C++ 2023 compliant implementation
+ * Direction: outgoing
+ *
+ * @note Network configuration lives in the outgoing adapter to keep the
+ *       domain free of infrastructure details
+ */
+class TrackStatics final {
+public:
+    // MISRA C++ 2023 compliant constructors
+    explicit TrackStatics() noexcept;
+
+    /// @brief Tag selecting the unchecked constructor
+    struct UncheckedInit final {};
+    static constexpr UncheckedInit UNCHECKED{};
+
+    /**
+     * @brief Construct from values that already passed validate() upstream
+     * @details No range checks: stage-to-stage copies cost one store per field.
+     *          Only use for data validated at the ingress boundary.
+     */
+    TrackStatics(UncheckedInit,
+                 int32_t trackId,
+                 double firstHopDelayDataMean,
+                 double firstHopDelayDataStd,
+                 double firstHopDelayDataMin,
+                 double firstHopDelayDataMax,
+                 double secondHopDelayDataMean,
+                 double secondHopDelayDataStd,
+                 double secondHopDelayDataMin,
+                 double secondHopDelayDataMax,
+                 double totalHopDelayDataMean,
+                 double totalHopDelayDataStd,
+                 double totalHopDelayDataMin,
+                 double totalHopDelayDataMax,
+                 int64_t updateTime) noexcept;
+
+    // Copy constructor
+    TrackStatics(const TrackStatics& other) = default;
+
+    // Move constructor
+    TrackStatics(TrackStatics&& other) noexcept = default;
+
+    // Copy assignment operator
+    TrackStatics& operator=(const TrackStatics& other) = default;
+
+    // Move assignment operator
+    TrackStatics& operator=(TrackStatics&& other) noexcept = default;
+
+    // Destructor
+    ~TrackStatics() = default;
+
+    // Getters and Setters
+    int32_t getTrackId() const noexcept;
+    void setTrackId(const int32_t& value);
+
+    double getFirstHopDelayDataMean() const noexcept;
+    void setFirstHopDelayDataMean(const double& value);
+
+    double getFirstHopDelayDataStd() const noexcept;
+    void setFirstHopDelayDataStd(const double& value);
+
+    double getFirstHopDelayDataMin() const noexcept;
+    void setFirstHopDelayDataMin(const double& value);
+
+    double getFirstHopDelayDataMax() const noexcept;
+    void setFirstHopDelayDataMax(const double& value);
+
+    double getSecondHopDelayDataMean() const noexcept;
+    void setSecondHopDelayDataMean(const double& value);
+
+    double getSecondHopDelayDataStd() const noexcept;
+    void setSecondHopDelayDataStd(const double& value);
+
+    double getSecondHopDelayDataMin() const noexcept;
+    void setSecondHopDelayDataMin(const double& value);
+
+    double getSecondHopDelayDataMax() const noexcept;
+    void setSecondHopDelayDataMax(const double& value);
+
+    double getTotalHopDelayDataMean() const noexcept;
+    void setTotalHopDelayDataMean(const double& value);
+
+    double getTotalHopDelayDataStd() const noexcept;
+    void setTotalHopDelayDataStd(const double& value);
+
+    double getTotalHopDelayDataMin() const noexcept;
+    void setTotalHopDelayDataMin(const double& value);
+
+    double getTotalHopDelayDataMax() const noexcept;
+    void setTotalHopDelayDataMax(const double& value);
+
+    int64_t getUpdateTime() const noexcept;
+    void setUpdateTime(const int64_t& value);
+
+    // Validation - MISRA compliant, exception free
+    /// @brief Field bits reported by validate()
+    static constexpr uint32_t FIELD_TRACK_ID{1U << 0U};
+    static constexpr uint32_t FIELD_FIRST_HOP_DELAY_DATA_MEAN{1U << 1U};
+    static constexpr uint32_t FIELD_FIRST_HOP_DELAY_DATA_STD{1U << 2U};
+    static constexpr uint32_t FIELD_FIRST_HOP_DELAY_DATA_MIN{1U << 3U};
+    static constexpr uint32_t FIELD_FIRST_HOP_DELAY_DATA_MAX{1U << 4U};
+    static constexpr uint32_t FIELD_SECOND_HOP_DELAY_DATA_MEAN{1U << 5U};
+    static constexpr uint32_t FIELD_SECOND_HOP_DELAY_DATA_STD{1U << 6U};
+    static constexpr uint32_t FIELD_SECOND_HOP_DELAY_DATA_MIN{1U << 7U};
+    static constexpr uint32_t FIELD_SECOND_HOP_DELAY_DATA_MAX{1U << 8U};
+    static constexpr uint32_t FIELD_TOTAL_HOP_DELAY_DATA_MEAN{1U << 9U};
+    static constexpr uint32_t FIELD_TOTAL_HOP_DELAY_DATA_STD{1U << 10U};
+    static constexpr uint32_t FIELD_TOTAL_HOP_DELAY_DATA_MIN{1U << 11U};
+    static constexpr uint32_t FIELD_TOTAL_HOP_DELAY_DATA_MAX{1U << 12U};
+    static constexpr uint32_t FIELD_UPDATE_TIME{1U << 13U};
+
+    /**
+     * @brief Range-check every field without throwing
+     * @return 0 if valid, otherwise the FIELD_* bits of out-of-range fields
+     */
+    [[nodiscard]] uint32_t validate() const noexcept;
+    [[nodiscard]] bool isValid() const noexcept;
+
+    // Per-field range checks (setters throw std::out_of_range when these fail)
+    [[nodiscard]] static bool isTrackIdInRange(int32_t value) noexcept;
+    [[nodiscard]] static bool isFirstHopDelayDataMeanInRange(double value) noexcept;
+    [[nodiscard]] static bool isFirstHopDelayDataStdInRange(double value) noexcept;
+    [[nodiscard]] static bool isFirstHopDelayDataMinInRange(double value) noexcept;
+    [[nodiscard]] static bool isFirstHopDelayDataMaxInRange(double value) noexcept;
+    [[nodiscard]] static bool isSecondHopDelayDataMeanInRange(double value) noexcept;
+    [[nodiscard]] static bool isSecondHopDelayDataStdInRange(double value) noexcept;
+    [[nodiscard]] static bool isSecondHopDelayDataMinInRange(double value) noexcept;
+    [[nodiscard]] static bool isSecondHopDelayDataMaxInRange(double value) noexcept;
+    [[nodiscard]] static bool isTotalHopDelayDataMeanInRange(double value) noexcept;
+    [[nodiscard]] static bool isTotalHopDelayDataStdInRange(double value) noexcept;
+    [[nodiscard]] static bool isTotalHopDelayDataMinInRange(double value) noexcept;
+    [[nodiscard]] static bool isTotalHopDelayDataMaxInRange(double value) noexcept;
+    [[nodiscard]] static bool isUpdateTimeInRange(int64_t value) noexcept;
+
+    // Binary Serialization - MISRA compliant
+    /// @brief Fixed wire size in bytes (packed fields, native byte order)
+    static constexpr std::size_t kWireSize{108U};
+
+    /**
+     * @brief Packed wire image of the serialized fields
+     * @details Trivially copyable: encode and decode are one memcpy of kWireSize bytes
+     */
+#pragma pack(push, 1)
+    struct Wire final {
+        int32_t trackId;
+        double firstHopDelayDataMean;
+        double firstHopDelayDataStd;
+        double firstHopDelayDataMin;
+        double firstHopDelayDataMax;
+        double secondHopDelayDataMean;
+        double secondHopDelayDataStd;
+        double secondHopDelayDataMin;
+        double secondHopDelayDataMax;
+        double totalHopDelayDataMean;
+        double totalHopDelayDataStd;
+        double totalHopDelayDataMin;
+        double totalHopDelayDataMax;
+        int64_t updateTime;
+    };
+#pragma pack(pop)
+
+    [[nodiscard]] std::vector<uint8_t> serialize() const;
+    /**
+     * @brief Encode into a caller-provided (pooled or stack) buffer
+     * @return Bytes written (kWireSize), or 0 if dst is null or cap < kWireSize
+     */
+    [[nodiscard]] std::size_t serializeInto(uint8_t* dst, std::size_t cap) const noexcept;
+    bool deserialize(const std::vector<uint8_t>& data) noexcept;
+    bool deserialize(const uint8_t* data, std::size_t size) noexcept;
+    [[nodiscard]] std::size_t getSerializedSize() const noexcept;
+
+private:
+    // Member variables
+    /// Unique integer identifier for the track
+    int32_t trackId_;
+    /// Mean of first-hop delay (microseconds)
+    double firstHopDelayDataMean_;
+    /// Standard deviation of first-hop delay (microseconds)
+    double firstHopDelayDataStd_;
+    /// Minimum first-hop delay (microseconds)
+    double firstHopDelayDataMin_;
+    /// Maximum first-hop delay (microseconds)
+    double firstHopDelayDataMax_;
+    /// Mean of second-hop delay (microseconds)
+    double secondHopDelayDataMean_;
+    /// Standard deviation of second-hop delay (microseconds)
+    double secondHopDelayDataStd_;
+    /// Minimum second-hop delay (microseconds)
+    double secondHopDelayDataMin_;
+    /// Maximum second-hop delay (microseconds)
+    double secondHopDelayDataMax_;
+    /// Mean of total delay (microseconds)
+    double totalHopDelayDataMean_;
+    /// Standard deviation of total delay (microseconds)
+    double totalHopDelayDataStd_;
+    /// Minimum total delay (microseconds)
+    double totalHopDelayDataMin_;
+    /// Maximum total delay (microseconds)
+    double totalHopDelayDataMax_;
+    /// Last update time (microseconds)
+    int64_t updateTime_;
+
+    // Validation functions - MISRA compliant
+    void validateTrackId(int32_t value) const;
+    void validateFirstHopDelayDataMean(double value) const;
+    void validateFirstHopDelayDataStd(double value) const;
+    void validateFirstHopDelayDataMin(double value) const;
+    void validateFirstHopDelayDataMax(double value) const;
+    void validateSecondHopDelayDataMean(double value) const;
+    void validateSecondHopDelayDataStd(double value) const;
+    void validateSecondHopDelayDataMin(double value) const;
+    void validateSecondHopDelayDataMax(double value) const;
+    void validateTotalHopDelayDataMean(double value) const;
+    void validateTotalHopDelayDataStd(double value) const;
+    void validateTotalHopDelayDataMin(double value) const;
+    void validateTotalHopDelayDataMax(double value) const;
+    void validateUpdateTime(int64_t value) const;
+};
+
+static_assert(sizeof(TrackStatics::Wire) == TrackStatics::kWireSize, "TrackStatics::Wire must have no padding");
+static_assert(std::is_trivially_copyable<TrackStatics::Wire>::value, "TrackStatics::Wire must be trivially copyable");
+
+} // namespace ports
+} // namespace domain
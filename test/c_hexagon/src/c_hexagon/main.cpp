@@ -9,7 +9,15 @@
 #include "domain/logic/TargetStatisticService.hpp"
 #include "adapters/incoming/zeromq/TrackDataZeroMQIncomingAdapter.hpp"
 #include "adapters/outgoing/zeromq/FinalCalcTrackDataZeroMQOutgoingAdapter.hpp"
+#include "adapters/outgoing/zeromq/TrackStaticsZeroMQOutgoingAdapter.hpp"
+#include "adapters/outgoing/file/LatencySnapshotFileOutgoingAdapter.hpp"
+#include "adapters/common/ZmqContextRegistry.hpp"
 #include "utils/Logger.hpp"
+#include "utils/StageTraceAggregator.hpp"
+#include "utils/MetricsPublisher.hpp"
+#include "utils/FlightRecorder.hpp"
+#include "utils/ClockSync.hpp"
+#include "utils/InstrumentedWaitStrategy.hpp"
 #include <memory>
 #include <iostream>
 #include <thread>
@@ -30,6 +38,64 @@ static domain::logic::TargetStatisticService* g_domainService{nullptr};
 static adapters::incoming::zeromq::TrackDataZeroMQIncomingAdapter* g_incomingAdapter{nullptr};
 static adapters::outgoing::zeromq::FinalCalcTrackDataZeroMQOutgoingAdapter* g_outgoingAdapter{nullptr};
 
+// Shared ZeroMQ context settings
+static constexpr int32_t MESSAGING_IO_THREADS{1};
+static constexpr int32_t MESSAGING_IO_THREAD_CPU{0};
+
+// Incoming receive loop: Blocking frees the core at idle; AdaptiveSpin trades
+// SPIN_WINDOW of CPU after each message for lower latency inside bursts
+static constexpr adapters::incoming::zeromq::ReceiveMode INCOMING_RECEIVE_MODE{
+    adapters::incoming::zeromq::ReceiveMode::AdaptiveSpin};
+static constexpr int64_t INCOMING_SPIN_WINDOW_US{50};
+
+// Domain and outgoing publisher thread wait strategies: Blocking frees the core
+// at idle but pays a futex wake-up per burst; SpinThenPark spins
+// *_WAIT_SPIN_BUDGET_US first; BusySpin only on an isolated core. Wake-up
+// latency is logged at shutdown
+static constexpr utils::WaitStrategyKind DOMAIN_WAIT_STRATEGY{utils::WaitStrategyKind::Blocking};
+static constexpr int64_t DOMAIN_WAIT_SPIN_BUDGET_US{50};
+static constexpr utils::WaitStrategyKind OUTGOING_WAIT_STRATEGY{utils::WaitStrategyKind::Blocking};
+static constexpr int64_t OUTGOING_WAIT_SPIN_BUDGET_US{50};
+static constexpr bool WAKE_LATENCY_HISTOGRAMS_ENABLED{true};
+
+// Kernel RX timestamps: receive RADIO datagrams on a plain UDP socket so each
+// message carries its arrival time and the second hop splits into network and
+// in-process latency (hops 3 and 4 of the latency snapshots)
+static constexpr bool INCOMING_KERNEL_TIMESTAMPS{false};
+
+// Cross-node clock offset: ping b_hexagon's responder to correct the second
+// hop delay (offset and error bound travel with FinalCalcTrackData). The
+// b_hexagon responder defaults to this host; set HEXAGON_CLOCK_SYNC_B_ENDPOINT
+// when it runs elsewhere
+static constexpr bool CLOCK_SYNC_ENABLED{true};
+static constexpr const char* CLOCK_SYNC_UPSTREAM_ENV{"HEXAGON_CLOCK_SYNC_B_ENDPOINT"};
+static constexpr const char* CLOCK_SYNC_UPSTREAM_ENDPOINT{"udp://127.0.0.1:15101"};  // b_hexagon responder
+static constexpr int64_t CLOCK_SYNC_INTERVAL_MS{1000};
+
+// Per-hop latency histograms: percentile snapshots per interval instead of
+// one INFO line per message
+static constexpr int64_t LATENCY_ROTATION_INTERVAL_MS{1000};
+static constexpr const char* LATENCY_DUMP_PATH{"latency_snapshots.bin"};
+
+// Per-track TrackStatics: one summary per updated track per cadence instead
+// of the raw FinalCalcTrackData stream
+static constexpr int64_t TRACK_STATICS_CADENCE_MS{1000};
+
+// Intra-process stage tracing (receive/enqueue/dequeue/compute/send). Off by
+// default; when on, the main thread drains the trace rings every loop tick
+static constexpr bool STAGE_TRACING_ENABLED{false};
+static constexpr int64_t STAGE_TRACE_REPORT_INTERVAL_MS{5000};
+
+// Runtime counters (receive/drop/send) snapshot to the hexagon_metrics CLI
+static constexpr const char* METRICS_SOURCE_NAME{"c_hexagon"};
+static constexpr int64_t METRICS_PUBLISH_INTERVAL_MS{1000};
+
+// Flight recorder: last pipeline events per thread, dumped on SIGUSR1, fatal
+// signals and domain-thread stalls (kill -USR1 <pid> for a manual dump)
+static constexpr bool FLIGHT_RECORDER_ENABLED{true};
+static constexpr const char* FLIGHT_RECORDER_DIRECTORY{"/tmp"};
+static constexpr int64_t FLIGHT_RECORDER_STALL_TIMEOUT_MS{2000};
+
 /**
  * @brief Signal handler for graceful shutdown
  * @param signum Signal number received
@@ -50,6 +116,56 @@ void signalHandler(int signum) {
     }
 }
 
+/**
+ * @brief Log the per-segment latency breakdown of one report interval
+ * @param aggregator Segment histograms (reset afterwards)
+ */
+static void reportStageTrace(utils::StageTraceAggregator& aggregator) {
+    if (aggregator.completedCount() == 0U) {
+        return;
+    }
+    for (std::size_t i = 0U; i < utils::TRACE_SEGMENT_COUNT; ++i) {
+        const auto segment = static_cast<utils::TraceSegment>(i);
+        const utils::HdrHistogram& histogram = aggregator.segment(segment);
+        Logger::info("Stage {} | n={} | p50: {} ns | p99: {} ns | max: {} ns",
+                     utils::StageTraceAggregator::segmentName(segment), histogram.count(),
+                     histogram.valueAtPercentile(50.0), histogram.valueAtPercentile(99.0), histogram.max());
+    }
+    Logger::info("Stage trace: {} incomplete messages, {} events dropped",
+                 aggregator.abandonedCount(), utils::StageTracer::instance().droppedCount());
+    aggregator.reset();
+}
+
+/**
+ * @brief Create a worker thread's wait strategy
+ * @param kind Strategy selected in the configuration above
+ * @param spinBudgetUs Spin time before parking (SpinThenPark only)
+ * @param probe Receives the wake-up latency wrapper (null when histograms are off)
+ */
+static std::shared_ptr<utils::WaitStrategy> createWaitStrategy(
+    utils::WaitStrategyKind kind, int64_t spinBudgetUs,
+    std::shared_ptr<utils::InstrumentedWaitStrategy>& probe) {
+    std::shared_ptr<utils::WaitStrategy> strategy =
+        utils::makeWaitStrategy(kind, std::chrono::microseconds(spinBudgetUs));
+    if (WAKE_LATENCY_HISTOGRAMS_ENABLED) {
+        probe = std::make_shared<utils::InstrumentedWaitStrategy>(strategy);
+        strategy = probe;
+    }
+    return strategy;
+}
+
+/**
+ * @brief Log the signal-to-wake latency of one worker thread
+ * @param thread Thread label
+ * @param probe Wake-up latency wrapper of its wait strategy
+ */
+static void reportWakeLatency(const char* thread, const utils::InstrumentedWaitStrategy& probe) {
+    const utils::HdrHistogram& histogram = probe.wakeLatency();
+    Logger::info("Wake-up latency {} ({}) | n={} | p50: {} ns | p99: {} ns | max: {} ns",
+                 thread, probe.name(), histogram.count(), histogram.valueAtPercentile(50.0),
+                 histogram.valueAtPercentile(99.0), histogram.max());
+}
+
 /**
  * @brief Application entry point
  * 
@@ -91,29 +207,94 @@ int main() {
         
         Logger::info("Initializing application components...");
         
+        utils::StageTracer::instance().setEnabled(STAGE_TRACING_ENABLED);
+        
+        if (FLIGHT_RECORDER_ENABLED) {
+            if (utils::FlightRecorder::instance().enable(FLIGHT_RECORDER_DIRECTORY, METRICS_SOURCE_NAME) &&
+                utils::FlightRecorder::installSignalHandlers()) {
+                Logger::info("Flight recorder enabled (dump: kill -USR1 {})", ::getpid());
+            } else {
+                Logger::warn("Flight recorder could not be fully enabled");
+            }
+        }
+        
+        // ==================== Shared ZeroMQ Context ====================
+        // One context for all sockets; its I/O thread stays off the pipeline cores (2-4)
+        adapters::ZmqContextConfig zmqConfig;
+        zmqConfig.ioThreads = MESSAGING_IO_THREADS;
+        zmqConfig.ioThreadCpus = {MESSAGING_IO_THREAD_CPU};
+        static_cast<void>(adapters::ZmqContextRegistry::instance().configure(zmqConfig));
+        
         // ==================== Create Outgoing Adapter ====================
         Logger::info("Creating Outgoing Adapter...");
         Logger::debug("Creating FinalCalcTrackDataZeroMQOutgoingAdapter (RADIO socket)...");
-        auto outgoingAdapter = std::make_shared<adapters::outgoing::zeromq::FinalCalcTrackDataZeroMQOutgoingAdapter>();
+        std::shared_ptr<utils::InstrumentedWaitStrategy> outgoingWaitProbe;
+        auto outgoingAdapter = std::make_shared<adapters::outgoing::zeromq::FinalCalcTrackDataZeroMQOutgoingAdapter>(
+            createWaitStrategy(OUTGOING_WAIT_STRATEGY, OUTGOING_WAIT_SPIN_BUDGET_US, outgoingWaitProbe));
         g_outgoingAdapter = outgoingAdapter.get();
         
+        // ==================== Clock Synchronization ====================
+        // Best effort: without an estimate the second hop delay stays uncorrected
+        const utils::ClockSyncPeerEndpoint clockPeer =
+            utils::resolveClockSyncPeer(CLOCK_SYNC_UPSTREAM_ENV, CLOCK_SYNC_UPSTREAM_ENDPOINT);
+        utils::ClockSyncClient clockClient("b_hexagon", clockPeer.endpoint,
+                                           std::chrono::milliseconds(CLOCK_SYNC_INTERVAL_MS));
+        if (CLOCK_SYNC_ENABLED) {
+            if (clockPeer.invalidOverride) {
+                Logger::warn("Ignoring {}: not a udp://a.b.c.d:port endpoint", CLOCK_SYNC_UPSTREAM_ENV);
+            }
+            Logger::info("Clock sync peer b_hexagon: {} ({})", clockPeer.endpoint,
+                         clockPeer.fromEnvironment ? CLOCK_SYNC_UPSTREAM_ENV : "default");
+            if (!clockClient.start()) {
+                Logger::warn("Clock sync client unavailable, second hop delay uncorrected");
+            }
+        }
+        
         // ==================== Create Domain Service ====================
         Logger::debug("Creating TargetStatisticService with outgoing port...");
-        auto domainService = std::make_shared<domain::logic::TargetStatisticService>(outgoingAdapter);
+        std::shared_ptr<utils::InstrumentedWaitStrategy> domainWaitProbe;
+        auto domainService = std::make_shared<domain::logic::TargetStatisticService>(
+            outgoingAdapter,
+            createWaitStrategy(DOMAIN_WAIT_STRATEGY, DOMAIN_WAIT_SPIN_BUDGET_US, domainWaitProbe));
         g_domainService = domainService.get();
+        if (CLOCK_SYNC_ENABLED) {
+            static_cast<void>(domainService->setClockOffsetSource(&clockClient));
+        }
+        
+        Logger::debug("Creating TrackStaticsZeroMQOutgoingAdapter (RADIO socket)...");
+        auto trackStaticsAdapter = std::make_shared<adapters::outgoing::zeromq::TrackStaticsZeroMQOutgoingAdapter>();
+        static_cast<void>(domainService->enableTrackStatics(
+            trackStaticsAdapter, std::chrono::milliseconds(TRACK_STATICS_CADENCE_MS)));
+        
+        auto latencyDump = std::make_shared<adapters::outgoing::file::LatencySnapshotFileOutgoingAdapter>(
+            LATENCY_DUMP_PATH);
+        if (latencyDump->start()) {
+            static_cast<void>(domainService->enableLatencyStatistics(
+                latencyDump, std::chrono::milliseconds(LATENCY_ROTATION_INTERVAL_MS)));
+        } else {
+            Logger::warn("Latency snapshot dump unavailable, histograms disabled");
+        }
         
         // ==================== Create Incoming Adapter ====================
         Logger::debug("Creating TrackDataZeroMQIncomingAdapter (DISH socket)...");
         auto incomingAdapter = std::make_shared<adapters::incoming::zeromq::TrackDataZeroMQIncomingAdapter>(domainService);
         g_incomingAdapter = incomingAdapter.get();
+        static_cast<void>(incomingAdapter->setReceiveMode(
+            INCOMING_RECEIVE_MODE, std::chrono::microseconds(INCOMING_SPIN_WINDOW_US)));
+        if (INCOMING_KERNEL_TIMESTAMPS) {
+            static_cast<void>(incomingAdapter->setIngressMode(
+                adapters::incoming::zeromq::IngressMode::KernelTimestampedUdp));
+        }
         
         // ==================== System Information ====================
         Logger::info("=== System Configuration ===");
         Logger::info("Architecture: Thread-per-Type (3 threads + main)");
-        Logger::info("Messaging Input: ZeroMQ DISH (UDP multicast)");
+        Logger::info("Messaging Input: {}", INCOMING_KERNEL_TIMESTAMPS
+            ? "UDP with kernel RX timestamps (RADIO framing)" : "ZeroMQ DISH (UDP multicast)");
         Logger::info("Messaging Output: ZeroMQ RADIO (UDP multicast)");
         Logger::info("Input Group: DelayCalcTrackData");
         Logger::info("Output Group: FinalCalcTrackData");
+        Logger::info("Statistics Group: TrackStatics (every {} ms)", TRACK_STATICS_CADENCE_MS);
         Logger::info("Thread 1: Incoming Adapter (CPU 2, Priority 95)");
         Logger::info("Thread 2: Domain Service (CPU 3, Priority 90)");
         Logger::info("Thread 3: Outgoing Adapter (CPU 4, Priority 95)");
@@ -135,6 +316,10 @@ int main() {
             Logger::error("Failed to start outgoing adapter");
             return 1;
         }
+        if (!trackStaticsAdapter->start()) {
+            Logger::error("Failed to start TrackStatics adapter");
+            return 1;
+        }
         std::this_thread::sleep_for(std::chrono::milliseconds(100));  // Allow initialization
         
         // Step 2: Start domain service
@@ -152,10 +337,33 @@ int main() {
             return 1;
         }
         
+        // Metrics snapshots are best effort: the pipeline runs without them
+        utils::MetricsPublisher metricsPublisher(METRICS_SOURCE_NAME, utils::DEFAULT_METRICS_SOCKET_PATH,
+                                                 std::chrono::milliseconds(METRICS_PUBLISH_INTERVAL_MS));
+        if (!metricsPublisher.start()) {
+            Logger::warn("Metrics publisher unavailable, runtime counters not exported");
+        }
+        
+        utils::FlightRecorderWatchdog flightWatchdog{std::chrono::milliseconds(FLIGHT_RECORDER_STALL_TIMEOUT_MS)};
+        if (FLIGHT_RECORDER_ENABLED) {
+            static_cast<void>(flightWatchdog.start());
+        }
+        
         // ==================== Main Loop ====================
         Logger::info("All components running. Entering main loop...");
+        utils::StageTraceAggregator stageTrace;
+        auto nextStageReport = std::chrono::steady_clock::now() +
+                               std::chrono::milliseconds(STAGE_TRACE_REPORT_INTERVAL_MS);
         while (g_running.load()) {
             std::this_thread::sleep_for(std::chrono::milliseconds(100));
+            
+            if (STAGE_TRACING_ENABLED) {
+                static_cast<void>(stageTrace.collect(utils::StageTracer::instance()));
+                if (std::chrono::steady_clock::now() >= nextStageReport) {
+                    reportStageTrace(stageTrace);
+                    nextStageReport += std::chrono::milliseconds(STAGE_TRACE_REPORT_INTERVAL_MS);
+                }
+            }
         }
         
         // ==================== Graceful Shutdown ====================
@@ -169,6 +377,25 @@ int main() {
         incomingAdapter->stop();
         domainService->stop();
         outgoingAdapter->stop();
+        trackStaticsAdapter->stop();
+        latencyDump->stop();
+        metricsPublisher.stop();
+        flightWatchdog.stop();
+        if (flightWatchdog.stallCount() > 0U) {
+            Logger::warn("Flight recorder watchdog detected {} domain stall(s)", flightWatchdog.stallCount());
+        }
+        if (domainWaitProbe) {
+            reportWakeLatency("domain", *domainWaitProbe);
+        }
+        if (outgoingWaitProbe) {
+            reportWakeLatency("outgoing", *outgoingWaitProbe);
+        }
+        const utils::ClockOffsetEstimate clock = clockClient.estimate();
+        clockClient.stop();
+        if (clock.valid) {
+            Logger::info("Clock offset to b_hexagon: {} ± {} μs (rtt {} μs, {} samples)",
+                         clock.offsetUs, clock.errorBoundUs, clock.rttUs, clock.samples);
+        }
         
         // Clear global pointers
         g_incomingAdapter = nullptr;
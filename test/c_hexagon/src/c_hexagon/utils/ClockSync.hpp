@@ -0,0 +1,504 @@
+/**
+ * @file ClockSync.hpp
+ * @brief Ping-pong clock offset estimation between hexagons
+ * @details Hop delays subtract wall-clock timestamps taken by different
+ *          processes. On different hosts NTP skew (often hundreds of µs)
+ *          is added to every hop delay. A ClockSyncClient pings the upstream
+ *          hexagon's ClockSyncResponder over a UDP side channel and estimates
+ *          the peer's clock offset from NTP-style four timestamps:
+ *
+ * @code
+ *   t1 client send   t2 responder receive   t3 responder send   t4 client receive
+ *   offset = ((t2 - t1) + (t3 - t4)) / 2     (peer clock - local clock)
+ *   rtt    = (t4 - t1) - (t3 - t2)
+ * @endcode
+ *
+ *          The true offset lies within offset ± rtt/2. Queueing delay inflates
+ *          the RTT, so the filter keeps the last WINDOW samples and uses the
+ *          one with the smallest RTT (the NTP clock filter).
+ *
+ * Design:
+ * - The side channel is one 40-byte datagram each way per interval.
+ * - The estimate is published through a sequence lock: the domain thread
+ *   reads it without blocking the client thread.
+ * - Without replies for STALE_INTERVALS intervals the estimate turns invalid
+ *   and hop delays fall back to the uncorrected difference.
+ *
+ * @author c_hexagon Team
+ * @version 1.0
+ * @date 2025
+ *
+ * @note MISRA C++ 2023 compliant implementation
+ * @note Linux/POSIX only (UDP sockets, poll)
+ */
+
+#ifndef C_HEXAGON_UTILS_CLOCK_SYNC_HPP
+#define C_HEXAGON_UTILS_CLOCK_SYNC_HPP
+
+#include "utils/Metrics.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace utils {
+
+/// @brief "HCLK"
+static constexpr uint32_t CLOCK_SYNC_MAGIC{0x4B4C4348U};
+static constexpr uint16_t CLOCK_SYNC_VERSION{1U};
+
+/**
+ * @brief Side-channel message type
+ */
+enum class ClockSyncKind : uint16_t {
+    Request = 1U,  ///< Client -> responder, t1 set
+    Reply = 2U     ///< Responder -> client, t1 echoed, t2/t3 set
+};
+
+/**
+ * @struct ClockSyncPacket
+ * @brief Fixed 40-byte ping/pong datagram (host byte order, like the data path)
+ */
+struct ClockSyncPacket {
+    uint32_t magic{CLOCK_SYNC_MAGIC};
+    uint16_t version{CLOCK_SYNC_VERSION};
+    uint16_t kind{0U};          ///< ClockSyncKind
+    uint64_t sequence{0U};      ///< Matches a reply to its request
+    int64_t t1{0};              ///< Client send (client clock, µs)
+    int64_t t2{0};              ///< Responder receive (responder clock, µs)
+    int64_t t3{0};              ///< Responder send (responder clock, µs)
+};
+
+static_assert(sizeof(ClockSyncPacket) == 40U, "ClockSyncPacket must be 40 bytes on the wire");
+static_assert(std::is_trivially_copyable<ClockSyncPacket>::value, "ClockSyncPacket must be trivially copyable");
+
+/**
+ * @struct ClockOffsetEstimate
+ * @brief Offset of a peer's clock relative to ours
+ */
+struct ClockOffsetEstimate {
+    int64_t offsetUs{0};        ///< Peer clock - local clock
+    int64_t errorBoundUs{0};    ///< |true offset - offsetUs| <= errorBoundUs
+    int64_t rttUs{0};           ///< Round trip of the selected sample
+    uint64_t samples{0U};       ///< Samples accepted so far
+    bool valid{false};          ///< false until the first sample (or when stale)
+
+    /// @brief Convert a local timestamp to the peer's clock (unchanged if invalid)
+    [[nodiscard]] int64_t toPeerClock(int64_t localUs) const noexcept {
+        return valid ? (localUs + offsetUs) : localUs;
+    }
+};
+
+/**
+ * @class ClockOffsetFilter
+ * @brief Min-RTT selection over the last WINDOW four-timestamp samples
+ */
+class ClockOffsetFilter final {
+public:
+    /// @brief Samples considered (NTP uses 8)
+    static constexpr std::size_t WINDOW{8U};
+
+    /**
+     * @brief Add one exchange
+     * @return false if the sample is inconsistent (negative RTT) and was dropped
+     */
+    bool addSample(int64_t t1, int64_t t2, int64_t t3, int64_t t4) noexcept {
+        const int64_t rtt = (t4 - t1) - (t3 - t2);
+        if ((rtt < 0) || (t3 < t2)) {
+            return false;  // Local clock stepped during the exchange
+        }
+        Sample& slot = window_[accepted_ % WINDOW];
+        slot.offsetUs = ((t2 - t1) + (t3 - t4)) / 2;
+        slot.rttUs = rtt;
+        ++accepted_;
+        return true;
+    }
+
+    /**
+     * @brief Estimate from the smallest-RTT sample in the window
+     */
+    [[nodiscard]] ClockOffsetEstimate estimate() const noexcept {
+        ClockOffsetEstimate result;
+        const std::size_t count = (accepted_ < WINDOW) ? static_cast<std::size_t>(accepted_) : WINDOW;
+        if (count == 0U) {
+            return result;
+        }
+        const Sample* best = &window_[0U];
+        for (std::size_t i = 1U; i < count; ++i) {
+            if (window_[i].rttUs < best->rttUs) {
+                best = &window_[i];
+            }
+        }
+        result.offsetUs = best->offsetUs;
+        result.rttUs = best->rttUs;
+        result.errorBoundUs = (best->rttUs + 1) / 2;
+        result.samples = accepted_;
+        result.valid = true;
+        return result;
+    }
+
+    void reset() noexcept {
+        accepted_ = 0U;
+    }
+
+private:
+    struct Sample {
+        int64_t offsetUs{0};
+        int64_t rttUs{0};
+    };
+
+    std::array<Sample, WINDOW> window_{};   ///< Ring of recent samples
+    uint64_t accepted_{0U};                 ///< Samples added since reset
+};
+
+/**
+ * @brief Wall clock in microseconds (the clock the data timestamps use)
+ */
+inline int64_t clockSyncNowUs() noexcept {
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+/**
+ * @brief Parse "udp://a.b.c.d:port"
+ */
+inline bool parseClockSyncEndpoint(const std::string& endpoint, sockaddr_in& address) {
+    static const std::string scheme{"udp://"};
+    if (endpoint.compare(0U, scheme.size(), scheme) != 0) {
+        return false;
+    }
+    const std::size_t colon = endpoint.rfind(':');
+    if ((colon == std::string::npos) || (colon <= scheme.size())) {
+        return false;
+    }
+    const std::string host = endpoint.substr(scheme.size(), colon - scheme.size());
+    const std::string portText = endpoint.substr(colon + 1U);
+    if (portText.empty() || (portText.size() > 5U) ||
+        (portText.find_first_not_of("0123456789") != std::string::npos)) {
+        return false;
+    }
+    const unsigned long port = std::stoul(portText);
+    if ((port == 0UL) || (port > 65535UL)) {
+        return false;
+    }
+    address = sockaddr_in{};
+    address.sin_family = AF_INET;
+    address.sin_port = htons(static_cast<uint16_t>(port));
+    return ::inet_pton(AF_INET, host.c_str(), &address.sin_addr) == 1;
+}
+
+/**
+ * @brief Clock sync peer endpoint and where it came from
+ */
+struct ClockSyncPeerEndpoint {
+    std::string endpoint;          ///< "udp://a.b.c.d:port" to ping
+    bool fromEnvironment{false};   ///< Taken from the environment variable
+    bool invalidOverride{false};   ///< Variable set but not a valid endpoint (default used)
+};
+
+/**
+ * @brief Resolve a peer's responder endpoint: environment variable, else default
+ * @param variable Environment variable naming the peer's responder endpoint
+ * @param fallback Built-in endpoint
+ */
+inline ClockSyncPeerEndpoint resolveClockSyncPeer(const char* variable, const char* fallback) {
+    ClockSyncPeerEndpoint peer;
+    peer.endpoint = fallback;
+    const char* const value = std::getenv(variable);
+    if ((value == nullptr) || (value[0] == '\0')) {
+        return peer;
+    }
+    sockaddr_in address{};
+    if (!parseClockSyncEndpoint(value, address)) {
+        peer.invalidOverride = true;
+        return peer;
+    }
+    peer.endpoint = value;
+    peer.fromEnvironment = true;
+    return peer;
+}
+
+/**
+ * @class ClockSyncResponder
+ * @brief Answers clock sync requests from the downstream hexagon
+ */
+class ClockSyncResponder final {
+public:
+    /**
+     * @param endpoint Bind address, e.g. "udp://0.0.0.0:15101"
+     */
+    explicit ClockSyncResponder(std::string endpoint)
+        : endpoint_(std::move(endpoint)) {
+    }
+
+    // Non-copyable, non-movable (owns a thread)
+    ClockSyncResponder(const ClockSyncResponder&) = delete;
+    ClockSyncResponder& operator=(const ClockSyncResponder&) = delete;
+    ClockSyncResponder(ClockSyncResponder&&) = delete;
+    ClockSyncResponder& operator=(ClockSyncResponder&&) = delete;
+
+    ~ClockSyncResponder() {
+        stop();
+    }
+
+    /**
+     * @brief Bind the endpoint and start answering
+     * @return false if already running or the endpoint cannot be bound
+     */
+    [[nodiscard]] bool start() {
+        if (running_.load()) {
+            return false;
+        }
+        sockaddr_in address{};
+        if (!parseClockSyncEndpoint(endpoint_, address)) {
+            return false;
+        }
+        fd_ = ::socket(AF_INET, SOCK_DGRAM | SOCK_CLOEXEC, 0);
+        if (fd_ < 0) {
+            return false;
+        }
+        if (::bind(fd_, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0) {
+            static_cast<void>(::close(fd_));
+            fd_ = -1;
+            return false;
+        }
+        running_.store(true);
+        thread_ = std::thread([this]() { run(); });
+        return true;
+    }
+
+    void stop() {
+        if (!running_.exchange(false)) {
+            return;
+        }
+        if (thread_.joinable()) {
+            thread_.join();
+        }
+        static_cast<void>(::close(fd_));
+        fd_ = -1;
+    }
+
+    /// @brief Requests answered
+    [[nodiscard]] uint64_t answeredCount() const noexcept {
+        return answered_.load(std::memory_order_relaxed);
+    }
+
+private:
+    static constexpr int POLL_TIMEOUT_MS{100};  ///< Bounds stop() latency
+
+    void run() {
+        while (running_.load()) {
+            pollfd item{fd_, POLLIN, 0};
+            if (::poll(&item, 1U, POLL_TIMEOUT_MS) <= 0) {
+                continue;
+            }
+            ClockSyncPacket packet;
+            sockaddr_in peer{};
+            socklen_t peerSize = sizeof(peer);
+            const ssize_t received = ::recvfrom(fd_, &packet, sizeof(packet), MSG_DONTWAIT,
+                                                reinterpret_cast<sockaddr*>(&peer), &peerSize);
+            const int64_t t2 = clockSyncNowUs();
+            if ((received != static_cast<ssize_t>(sizeof(packet))) || (packet.magic != CLOCK_SYNC_MAGIC) ||
+                (packet.version != CLOCK_SYNC_VERSION) ||
+                (packet.kind != static_cast<uint16_t>(ClockSyncKind::Request))) {
+                continue;
+            }
+            packet.kind = static_cast<uint16_t>(ClockSyncKind::Reply);
+            packet.t2 = t2;
+            packet.t3 = clockSyncNowUs();
+            if (::sendto(fd_, &packet, sizeof(packet), MSG_DONTWAIT,
+                         reinterpret_cast<const sockaddr*>(&peer), peerSize) == static_cast<ssize_t>(sizeof(packet))) {
+                answered_.fetch_add(1U, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    std::string endpoint_;                   ///< Bind address
+    int fd_{-1};                             ///< UDP socket
+    std::thread thread_;                     ///< Answer thread
+    std::atomic<bool> running_{false};       ///< Lifecycle flag
+    std::atomic<uint64_t> answered_{0U};     ///< Replies sent
+};
+
+/**
+ * @class ClockSyncClient
+ * @brief Pings one upstream responder and publishes its clock offset
+ */
+class ClockSyncClient final {
+public:
+    /// @brief Intervals without an accepted sample before the estimate is dropped
+    static constexpr uint32_t STALE_INTERVALS{10U};
+
+    /**
+     * @param peer Peer name for metrics ("clock.<peer>.offset_us", ...)
+     * @param peerEndpoint Responder address, e.g. "udp://127.0.0.1:15100"
+     * @param interval Ping period (> 0)
+     */
+    ClockSyncClient(std::string peer, std::string peerEndpoint,
+                    std::chrono::milliseconds interval = std::chrono::milliseconds(1000))
+        : peer_(std::move(peer))
+        , peerEndpoint_(std::move(peerEndpoint))
+        , interval_((interval.count() > 0) ? interval : std::chrono::milliseconds(1000))
+        , metricOffset_(MetricsRegistry::instance().gauge("clock." + peer_ + ".offset_us"))
+        , metricErrorBound_(MetricsRegistry::instance().gauge("clock." + peer_ + ".error_bound_us"))
+        , metricRtt_(MetricsRegistry::instance().gauge("clock." + peer_ + ".rtt_us")) {
+    }
+
+    // Non-copyable, non-movable (owns a thread; readers hold a pointer)
+    ClockSyncClient(const ClockSyncClient&) = delete;
+    ClockSyncClient& operator=(const ClockSyncClient&) = delete;
+    ClockSyncClient(ClockSyncClient&&) = delete;
+    ClockSyncClient& operator=(ClockSyncClient&&) = delete;
+
+    ~ClockSyncClient() {
+        stop();
+    }
+
+    /**
+     * @brief Open the socket and start pinging
+     * @return false if already running or the endpoint is invalid
+     */
+    [[nodiscard]] bool start() {
+        if (running_.load() || !parseClockSyncEndpoint(peerEndpoint_, peerAddress_)) {
+            return false;
+        }
+        fd_ = ::socket(AF_INET, SOCK_DGRAM | SOCK_CLOEXEC, 0);
+        if (fd_ < 0) {
+            return false;
+        }
+        running_.store(true);
+        thread_ = std::thread([this]() { run(); });
+        return true;
+    }
+
+    void stop() {
+        if (!running_.exchange(false)) {
+            return;
+        }
+        if (thread_.joinable()) {
+            thread_.join();
+        }
+        static_cast<void>(::close(fd_));
+        fd_ = -1;
+    }
+
+    /**
+     * @brief Latest estimate (any thread, wait-free for the writer)
+     */
+    [[nodiscard]] ClockOffsetEstimate estimate() const noexcept {
+        ClockOffsetEstimate result;
+        uint32_t before = 0U;
+        do {
+            before = sequence_.load(std::memory_order_acquire);
+            result.offsetUs = offsetUs_.load(std::memory_order_relaxed);
+            result.errorBoundUs = errorBoundUs_.load(std::memory_order_relaxed);
+            result.rttUs = rttUs_.load(std::memory_order_relaxed);
+            result.samples = samples_.load(std::memory_order_relaxed);
+            result.valid = valid_.load(std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_acquire);
+        } while (((before & 1U) != 0U) || (before != sequence_.load(std::memory_order_relaxed)));
+        return result;
+    }
+
+    [[nodiscard]] const std::string& peer() const noexcept {
+        return peer_;
+    }
+
+    /**
+     * @brief Publish an estimate (client thread; public for tests)
+     */
+    void publish(const ClockOffsetEstimate& estimate) noexcept {
+        const uint32_t sequence = sequence_.load(std::memory_order_relaxed);
+        sequence_.store(sequence + 1U, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        offsetUs_.store(estimate.offsetUs, std::memory_order_relaxed);
+        errorBoundUs_.store(estimate.errorBoundUs, std::memory_order_relaxed);
+        rttUs_.store(estimate.rttUs, std::memory_order_relaxed);
+        samples_.store(estimate.samples, std::memory_order_relaxed);
+        valid_.store(estimate.valid, std::memory_order_relaxed);
+        sequence_.store(sequence + 2U, std::memory_order_release);
+
+        metricOffset_.set(estimate.offsetUs);
+        metricErrorBound_.set(estimate.errorBoundUs);
+        metricRtt_.set(estimate.rttUs);
+    }
+
+private:
+    void run() {
+        ClockOffsetFilter filter;
+        uint64_t sequence = 0U;
+        uint32_t missed = 0U;
+
+        while (running_.load()) {
+            const auto deadline = std::chrono::steady_clock::now() + interval_;
+            ClockSyncPacket request;
+            request.kind = static_cast<uint16_t>(ClockSyncKind::Request);
+            request.sequence = ++sequence;
+            request.t1 = clockSyncNowUs();
+            static_cast<void>(::sendto(fd_, &request, sizeof(request), MSG_DONTWAIT,
+                                       reinterpret_cast<const sockaddr*>(&peerAddress_), sizeof(peerAddress_)));
+
+            bool accepted = false;
+            for (auto now = std::chrono::steady_clock::now(); running_.load() && (now < deadline);
+                 now = std::chrono::steady_clock::now()) {
+                const auto remainingMs = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - now).count();
+                pollfd item{fd_, POLLIN, 0};
+                if (::poll(&item, 1U, static_cast<int>(std::min<int64_t>(remainingMs + 1, 100))) <= 0) {
+                    continue;
+                }
+                ClockSyncPacket reply;
+                const ssize_t received = ::recv(fd_, &reply, sizeof(reply), MSG_DONTWAIT);
+                const int64_t t4 = clockSyncNowUs();
+                // Late replies to earlier requests are ignored: their t4 includes our wait
+                if ((received == static_cast<ssize_t>(sizeof(reply))) && (reply.magic == CLOCK_SYNC_MAGIC) &&
+                    (reply.kind == static_cast<uint16_t>(ClockSyncKind::Reply)) && (reply.sequence == sequence) &&
+                    filter.addSample(reply.t1, reply.t2, reply.t3, t4)) {
+                    accepted = true;
+                    publish(filter.estimate());
+                }
+            }
+
+            missed = accepted ? 0U : (missed + 1U);
+            if ((missed == STALE_INTERVALS) && filter.estimate().valid) {
+                filter.reset();
+                publish(ClockOffsetEstimate{});
+            }
+        }
+    }
+
+    std::string peer_;                           ///< Peer name
+    std::string peerEndpoint_;                   ///< Responder address
+    std::chrono::milliseconds interval_;         ///< Ping period
+    sockaddr_in peerAddress_{};                  ///< Parsed responder address
+    int fd_{-1};                                 ///< UDP socket
+    std::thread thread_;                         ///< Ping thread
+    std::atomic<bool> running_{false};           ///< Lifecycle flag
+
+    // Sequence-locked estimate (odd sequence = write in progress)
+    std::atomic<uint32_t> sequence_{0U};
+    std::atomic<int64_t> offsetUs_{0};
+    std::atomic<int64_t> errorBoundUs_{0};
+    std::atomic<int64_t> rttUs_{0};
+    std::atomic<uint64_t> samples_{0U};
+    std::atomic<bool> valid_{false};
+
+    Metric& metricOffset_;                       ///< clock.<peer>.offset_us
+    Metric& metricErrorBound_;                   ///< clock.<peer>.error_bound_us
+    Metric& metricRtt_;                          ///< clock.<peer>.rtt_us
+};
+
+} // namespace utils
+
+#endif // C_HEXAGON_UTILS_CLOCK_SYNC_HPP
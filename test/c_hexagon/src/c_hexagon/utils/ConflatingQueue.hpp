@@ -0,0 +1,361 @@
+/**
+ * @file ConflatingQueue.hpp
+ * @brief Bounded per-track conflating queue between pipeline stages
+ * @details A FIFO ring evicts the globally oldest message on overflow, so a
+ *          burst from one chatty track can push out the only pending update
+ *          of another track. This queue keeps at most one pending message per
+ *          track: a newer message for a track that is still queued replaces
+ *          the older one in place and keeps its position. Under overload every
+ *          track is delivered with its latest state, and memory is bounded by
+ *          the number of tracks rather than by the burst size.
+ *
+ * Design:
+ * - Per-track slots are pre-allocated once (capacity = maximum pending
+ *   tracks); a ring of slot indices keeps the tracks in first-arrival order.
+ * - An open-addressing index (linear probing, backward-shift deletion) maps
+ *   trackId to its pending slot, so push/pop never allocate.
+ * - A new track arriving while all slots are pending evicts the oldest track.
+ * - A short spin lock guards producers and consumer, so push() needs no outer
+ *   lock even with several producers; waiting is delegated to a
+ *   utils::WaitStrategy.
+ * - Conflation and drop totals are kept by the queue itself;
+ *   ConflatingQueueCounters lets the consumer publish them as metrics.
+ *
+ * @author c_hexagon Team
+ * @version 1.0
+ * @date 2025
+ *
+ * @note MISRA C++ 2023 compliant implementation
+ * @note Elements are keyed by T::getTrackId()
+ * @see SpscRingBuffer.hpp
+ */
+
+#ifndef C_HEXAGON_UTILS_CONFLATING_QUEUE_HPP
+#define C_HEXAGON_UTILS_CONFLATING_QUEUE_HPP
+
+#include "utils/Metrics.hpp"
+#include "utils/SpinLock.hpp"
+#include "utils/WaitStrategy.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace utils {
+
+/**
+ * @brief Outcome of ConflatingQueue::push()
+ */
+enum class ConflateResult : uint8_t {
+    Queued = 0U,        ///< Track had nothing pending; appended to the FIFO
+    Replaced = 1U,      ///< Pending message of the same track overwritten in place
+    EvictedOldest = 2U  ///< All slots pending; the oldest track was dropped
+};
+
+/**
+ * @class ConflatingQueue
+ * @brief Bounded queue holding the latest pending message of each track
+ * @tparam T Copy-assignable element type with int32_t getTrackId() const
+ */
+template <typename T>
+class ConflatingQueue {
+    static_assert(std::is_copy_assignable<T>::value, "ConflatingQueue elements must be copy assignable");
+
+public:
+    /**
+     * @brief Constructor
+     * @param capacity Maximum number of tracks pending at once (> 0)
+     * @param waitStrategy Consumer wait policy (blocking if null)
+     * @throws std::invalid_argument if capacity is zero
+     */
+    explicit ConflatingQueue(std::size_t capacity,
+                             std::shared_ptr<WaitStrategy> waitStrategy = nullptr)
+        : capacity_(capacity)
+        , items_(capacity)
+        , keys_(capacity, 0)
+        , order_(capacity, 0U)
+        , freeSlots_()
+        , index_(indexSizeFor(capacity), EMPTY)
+        , indexMask_(indexSizeFor(capacity) - 1U)
+        , waitStrategy_(waitStrategy ? std::move(waitStrategy)
+                                     : std::make_shared<BlockingWaitStrategy>()) {
+        if (capacity == 0U) {
+            throw std::invalid_argument("ConflatingQueue capacity must be greater than zero");
+        }
+        freeSlots_.reserve(capacity);
+        for (std::size_t slot = capacity; slot > 0U; --slot) {
+            freeSlots_.push_back(static_cast<uint32_t>(slot - 1U));
+        }
+    }
+
+    // Non-copyable, non-movable (shared between two threads)
+    ConflatingQueue(const ConflatingQueue&) = delete;
+    ConflatingQueue& operator=(const ConflatingQueue&) = delete;
+    ConflatingQueue(ConflatingQueue&&) = delete;
+    ConflatingQueue& operator=(ConflatingQueue&&) = delete;
+    ~ConflatingQueue() = default;
+
+    // ==================== Producer Side ====================
+
+    /**
+     * @brief Queue an item, replacing a pending item of the same track
+     * @param item Item to copy into its track's slot
+     * @return How the item was stored
+     */
+    ConflateResult push(const T& item) noexcept {
+        const int32_t key = item.getTrackId();
+        ConflateResult result = ConflateResult::Queued;
+        {
+            std::lock_guard<SpinLock> guard(lock_);
+            const std::size_t position = findPosition(key);
+            if (index_[position] != EMPTY) {
+                items_[index_[position] - 1U] = item;
+                result = ConflateResult::Replaced;
+                conflated_.fetch_add(1U, std::memory_order_relaxed);
+            } else {
+                if (freeSlots_.empty()) {
+                    // All slots pending: drop the track that has waited longest
+                    const uint32_t oldest = order_[head_];
+                    head_ = (head_ + 1U) % capacity_;
+                    --count_;
+                    eraseKey(keys_[oldest]);
+                    freeSlots_.push_back(oldest);
+                    result = ConflateResult::EvictedOldest;
+                    dropped_.fetch_add(1U, std::memory_order_relaxed);
+                }
+                const uint32_t slot = freeSlots_.back();
+                freeSlots_.pop_back();
+                items_[slot] = item;
+                keys_[slot] = key;
+                index_[findPosition(key)] = slot + 1U;
+                order_[(head_ + count_) % capacity_] = slot;
+                ++count_;
+            }
+            pending_.store(count_, std::memory_order_release);
+        }
+        waitStrategy_->signal();
+        return result;
+    }
+
+    // ==================== Consumer Side ====================
+
+    /**
+     * @brief Pop the track that has waited longest, without waiting
+     * @param out Destination for that track's latest item
+     * @return true if an item was popped
+     */
+    bool tryPop(T& out) noexcept {
+        return tryPopBatch(&out, 1U) == 1U;
+    }
+
+    /**
+     * @brief Pop up to maxItems of the longest-waiting tracks under one lock
+     * @param out Destination for at least maxItems items
+     * @param maxItems Maximum number of tracks to pop
+     * @return Number of items popped (oldest track first)
+     */
+    std::size_t tryPopBatch(T* out, std::size_t maxItems) noexcept {
+        if ((maxItems == 0U) || (pending_.load(std::memory_order_acquire) == 0U)) {
+            return 0U;
+        }
+        std::lock_guard<SpinLock> guard(lock_);
+        std::size_t popped = 0U;
+        while ((popped < maxItems) && (count_ > 0U)) {
+            const uint32_t slot = order_[head_];
+            head_ = (head_ + 1U) % capacity_;
+            --count_;
+            out[popped] = items_[slot];
+            ++popped;
+            eraseKey(keys_[slot]);
+            freeSlots_.push_back(slot);
+        }
+        pending_.store(count_, std::memory_order_release);
+        return popped;
+    }
+
+    /**
+     * @brief Pop the oldest pending track, waiting up to timeout via the wait strategy
+     * @param out Destination for the popped item
+     * @param timeout Maximum wait
+     * @return true if an item was popped
+     */
+    bool waitPop(T& out, std::chrono::microseconds timeout) {
+        return waitPopBatch(&out, 1U, timeout) == 1U;
+    }
+
+    /**
+     * @brief Pop up to maxItems tracks, waiting up to timeout for the first one
+     * @param out Destination for at least maxItems items
+     * @param maxItems Maximum number of tracks to pop
+     * @param timeout Maximum wait while the queue is empty
+     * @return Number of items popped (0 on timeout or wakeConsumer())
+     */
+    std::size_t waitPopBatch(T* out, std::size_t maxItems, std::chrono::microseconds timeout) {
+        const std::size_t count = tryPopBatch(out, maxItems);
+        if (count > 0U) {
+            return count;
+        }
+        if (!waitStrategy_->waitFor([this]() { return !empty() || woken_.load(std::memory_order_acquire); },
+                                    timeout)) {
+            return 0U;
+        }
+        return tryPopBatch(out, maxItems);
+    }
+
+    /**
+     * @brief Wake a waiting consumer (e.g. on shutdown)
+     * @details The next waitFor() returns immediately until resetWake() is called.
+     */
+    void wakeConsumer() noexcept {
+        woken_.store(true, std::memory_order_release);
+        waitStrategy_->signalAll();
+    }
+
+    /**
+     * @brief Re-arm waiting after wakeConsumer() (e.g. on restart)
+     */
+    void resetWake() noexcept {
+        woken_.store(false, std::memory_order_release);
+    }
+
+    // ==================== Observers (any thread, approximate) ====================
+
+    /// @brief Tracks currently pending
+    [[nodiscard]] std::size_t size() const noexcept {
+        return pending_.load(std::memory_order_acquire);
+    }
+
+    [[nodiscard]] bool empty() const noexcept {
+        return size() == 0U;
+    }
+
+    [[nodiscard]] std::size_t capacity() const noexcept {
+        return capacity_;
+    }
+
+    /// @brief Items dropped because a new track found every slot pending
+    [[nodiscard]] uint64_t droppedCount() const noexcept {
+        return dropped_.load(std::memory_order_relaxed);
+    }
+
+    /// @brief Items overwritten by a newer item of the same track
+    [[nodiscard]] uint64_t conflatedCount() const noexcept {
+        return conflated_.load(std::memory_order_relaxed);
+    }
+
+    /// @brief Wait strategy in use
+    [[nodiscard]] const WaitStrategy& waitStrategy() const noexcept {
+        return *waitStrategy_;
+    }
+
+private:
+    static constexpr uint32_t EMPTY = 0U;  ///< Index entry: no slot (entries hold slot + 1)
+
+    /// @brief Power of two at least twice the capacity (load factor <= 0.5)
+    static std::size_t indexSizeFor(std::size_t capacity) noexcept {
+        std::size_t size = 2U;
+        while (size < (capacity * 2U)) {
+            size <<= 1U;
+        }
+        return size;
+    }
+
+    [[nodiscard]] std::size_t homeOf(int32_t key) const noexcept {
+        return static_cast<std::size_t>(static_cast<uint32_t>(key) * 2654435761U) & indexMask_;
+    }
+
+    /// @brief Index position holding key, or the empty position where it would go
+    [[nodiscard]] std::size_t findPosition(int32_t key) const noexcept {
+        std::size_t position = homeOf(key);
+        while ((index_[position] != EMPTY) && (keys_[index_[position] - 1U] != key)) {
+            position = (position + 1U) & indexMask_;
+        }
+        return position;
+    }
+
+    /// @brief Remove key from the index, shifting back later entries of its probe run
+    void eraseKey(int32_t key) noexcept {
+        std::size_t hole = findPosition(key);
+        if (index_[hole] == EMPTY) {
+            return;
+        }
+        std::size_t next = hole;
+        for (;;) {
+            next = (next + 1U) & indexMask_;
+            if (index_[next] == EMPTY) {
+                break;
+            }
+            const std::size_t home = homeOf(keys_[index_[next] - 1U]);
+            // Move the entry into the hole unless its home lies in (hole, next]
+            const bool homeBetween = (hole <= next) ? ((home > hole) && (home <= next))
+                                                    : ((home > hole) || (home <= next));
+            if (!homeBetween) {
+                index_[hole] = index_[next];
+                hole = next;
+            }
+        }
+        index_[hole] = EMPTY;
+    }
+
+    const std::size_t capacity_;
+    std::vector<T> items_;                  ///< Per-track pending item
+    std::vector<int32_t> keys_;             ///< trackId of each slot
+    std::vector<uint32_t> order_;           ///< FIFO ring of pending slots
+    std::vector<uint32_t> freeSlots_;       ///< Unused slots
+    std::vector<uint32_t> index_;           ///< trackId -> slot + 1
+    const std::size_t indexMask_;
+    std::size_t head_{0U};                  ///< First pending entry in order_
+    std::size_t count_{0U};                 ///< Pending entries in order_
+    SpinLock lock_;                         ///< Guards everything above
+    std::shared_ptr<WaitStrategy> waitStrategy_;
+
+    std::atomic<std::size_t> pending_{0U};  ///< count_ for lock-free observers
+    std::atomic<uint64_t> dropped_{0U};
+    std::atomic<uint64_t> conflated_{0U};
+    std::atomic<bool> woken_{false};
+};
+
+/**
+ * @class ConflatingQueueCounters
+ * @brief Publishes a queue's conflation and drop totals as counter metrics
+ * @details Producers push without touching a metric; the consumer calls
+ *          publish() after each drain and adds what changed since its previous
+ *          call, so a metric shared by re-created queues keeps counting.
+ * @note Consumer thread only
+ */
+class ConflatingQueueCounters final {
+public:
+    ConflatingQueueCounters(Metric& conflated, Metric& dropped) noexcept
+        : conflated_(conflated)
+        , dropped_(dropped) {
+    }
+
+    template <typename T>
+    void publish(const ConflatingQueue<T>& queue) noexcept {
+        const uint64_t conflated = queue.conflatedCount();
+        const uint64_t dropped = queue.droppedCount();
+        if (conflated != publishedConflated_) {
+            conflated_.add(conflated - publishedConflated_);
+            publishedConflated_ = conflated;
+        }
+        if (dropped != publishedDropped_) {
+            dropped_.add(dropped - publishedDropped_);
+            publishedDropped_ = dropped;
+        }
+    }
+
+private:
+    Metric& conflated_;                  ///< e.g. "domain.queue_conflated"
+    Metric& dropped_;                    ///< e.g. "domain.queue_drops"
+    uint64_t publishedConflated_{0U};    ///< Queue total at the last publish()
+    uint64_t publishedDropped_{0U};      ///< Queue total at the last publish()
+};
+
+} // namespace utils
+
+#endif // C_HEXAGON_UTILS_CONFLATING_QUEUE_HPP
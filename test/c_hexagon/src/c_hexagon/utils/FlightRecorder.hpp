@@ -0,0 +1,551 @@
+/**
+ * @file FlightRecorder.hpp
+ * @brief Always-on in-memory record of the last pipeline events per thread
+ * @details The async spdlog queue may never flush when the process hangs or
+ *          crashes, taking the context with it. The flight recorder keeps the
+ *          last FlightRing::CAPACITY receive/enqueue/dequeue/send events of
+ *          every thread in memory and writes them to
+ *          `<dir>/<source>_flight_<pid>.txt` on SIGUSR1, on fatal signals
+ *          (SIGSEGV, SIGBUS, SIGFPE, SIGILL, SIGABRT) and when the watchdog
+ *          sees the domain thread stall.
+ *
+ * Design:
+ * - record() is a clock read, a 24-byte store into the thread's own ring and
+ *   a relaxed counter store: no locks, no allocation after the first call.
+ * - Rings overwrite their oldest event and are never freed, so a signal
+ *   handler can always walk them.
+ * - dump() is async-signal-safe: it formats integers by hand and uses only
+ *   open/write/close. Events written while a dump runs may come out torn.
+ * - Dumps append; every dump starts with a "# flight recorder" header line.
+ *
+ * @author c_hexagon Team
+ * @version 1.0
+ * @date 2025
+ *
+ * @note MISRA C++ 2023 compliant implementation
+ * @note Linux/POSIX only (sigaction, gettid)
+ * @see StageTracer.hpp (same hook points, opt-in latency breakdown)
+ */
+
+#ifndef C_HEXAGON_UTILS_FLIGHT_RECORDER_HPP
+#define C_HEXAGON_UTILS_FLIGHT_RECORDER_HPP
+
+#include <array>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <condition_variable>
+#include <csignal>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <ctime>
+#include <mutex>
+#include <new>
+#include <string>
+#include <thread>
+#include <fcntl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace utils {
+
+/**
+ * @brief Recorded event kinds
+ */
+enum class FlightEventKind : uint8_t {
+    Receive = 0U,     ///< Message taken off the incoming socket
+    Enqueue = 1U,     ///< Pushed into the domain event queue
+    Dequeue = 2U,     ///< Popped by the domain thread
+    Send = 3U,        ///< Written to the outgoing socket
+    QueueDrop = 4U,   ///< Oldest queued message evicted
+    SendFailed = 5U,  ///< Outgoing socket refused the message
+    Conflated = 6U    ///< Pending message replaced by a newer one of the same track
+};
+
+inline constexpr std::size_t FLIGHT_EVENT_KIND_COUNT{7U};
+
+/**
+ * @struct FlightEvent
+ * @brief One recorded event (24 bytes)
+ */
+struct FlightEvent {
+    int64_t timestampNs{0};  ///< steady_clock nanoseconds
+    int64_t messageKey{0};   ///< Model updateTime (correlates with StageTracer)
+    int32_t trackId{0};      ///< Track of the message
+    uint8_t kind{0U};        ///< FlightEventKind
+};
+
+/**
+ * @class FlightRing
+ * @brief Fixed-capacity overwrite ring of one thread (single writer)
+ */
+class FlightRing final {
+public:
+    /// @brief Events kept per thread (power of two)
+    static constexpr std::size_t CAPACITY{1024U};
+
+    explicit FlightRing(int64_t threadId) noexcept
+        : threadId_(threadId) {
+    }
+
+    // Non-copyable, non-movable (walked by the dumper)
+    FlightRing(const FlightRing&) = delete;
+    FlightRing& operator=(const FlightRing&) = delete;
+    FlightRing(FlightRing&&) = delete;
+    FlightRing& operator=(FlightRing&&) = delete;
+    ~FlightRing() = default;
+
+    /**
+     * @brief Append one event, overwriting the oldest (owning thread only)
+     */
+    void push(const FlightEvent& event) noexcept {
+        const uint64_t written = written_.load(std::memory_order_relaxed);
+        slots_[static_cast<std::size_t>(written) & (CAPACITY - 1U)] = event;
+        written_.store(written + 1U, std::memory_order_release);
+        std::atomic<uint64_t>& count = kindCounts_[event.kind % FLIGHT_EVENT_KIND_COUNT];
+        count.store(count.load(std::memory_order_relaxed) + 1U, std::memory_order_relaxed);
+    }
+
+    /// @brief Events written since creation (not capped at CAPACITY)
+    [[nodiscard]] uint64_t writtenCount() const noexcept {
+        return written_.load(std::memory_order_acquire);
+    }
+
+    /// @brief Events of one kind written since creation
+    [[nodiscard]] uint64_t kindCount(FlightEventKind kind) const noexcept {
+        return kindCounts_[static_cast<std::size_t>(kind) % FLIGHT_EVENT_KIND_COUNT].load(std::memory_order_relaxed);
+    }
+
+    /// @brief Event with sequence @p sequence (caller keeps it within the last CAPACITY)
+    [[nodiscard]] const FlightEvent& at(uint64_t sequence) const noexcept {
+        return slots_[static_cast<std::size_t>(sequence) & (CAPACITY - 1U)];
+    }
+
+    [[nodiscard]] int64_t threadId() const noexcept {
+        return threadId_;
+    }
+
+private:
+    static_assert((CAPACITY & (CAPACITY - 1U)) == 0U, "CAPACITY must be a power of two");
+
+    std::array<FlightEvent, CAPACITY> slots_{};                           ///< Event storage
+    alignas(64) std::atomic<uint64_t> written_{0U};                       ///< Next sequence
+    std::array<std::atomic<uint64_t>, FLIGHT_EVENT_KIND_COUNT> kindCounts_{};  ///< Per-kind totals
+    int64_t threadId_;                                                    ///< Kernel thread id
+};
+
+/**
+ * @class FlightRecorder
+ * @brief Process-wide registry of per-thread flight rings and the dumper
+ */
+class FlightRecorder final {
+public:
+    /// @brief Threads that can own a ring; later threads are not recorded
+    static constexpr std::size_t MAX_THREADS{64U};
+
+    static FlightRecorder& instance() {
+        static FlightRecorder recorder;
+        return recorder;
+    }
+
+    // Non-copyable, non-movable (singleton)
+    FlightRecorder(const FlightRecorder&) = delete;
+    FlightRecorder& operator=(const FlightRecorder&) = delete;
+    FlightRecorder(FlightRecorder&&) = delete;
+    FlightRecorder& operator=(FlightRecorder&&) = delete;
+
+    /**
+     * @brief Set the dump file and enable recording
+     * @param directory Directory of the dump file
+     * @param source Process name (dump header and file name prefix)
+     * @return false if the resulting path does not fit
+     */
+    bool enable(const std::string& directory, const std::string& source) {
+        const std::string path = directory + "/" + source + "_flight_" + std::to_string(::getpid()) + ".txt";
+        if ((path.size() >= sizeof(path_)) || (source.size() >= sizeof(source_))) {
+            return false;
+        }
+        // Handlers read these only after enabled_ is set
+        std::memcpy(path_, path.c_str(), path.size() + 1U);
+        std::memcpy(source_, source.c_str(), source.size() + 1U);
+        enabled_.store(true, std::memory_order_release);
+        return true;
+    }
+
+    void disable() noexcept {
+        enabled_.store(false, std::memory_order_release);
+    }
+
+    [[nodiscard]] bool isEnabled() const noexcept {
+        return enabled_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Record one event of the calling thread
+     */
+    void record(FlightEventKind kind, int32_t trackId, int64_t messageKey) noexcept {
+        if (!isEnabled()) {
+            return;
+        }
+        FlightRing* ring = localRing();
+        if (ring != nullptr) {
+            ring->push(FlightEvent{nowNs(), messageKey, trackId, static_cast<uint8_t>(kind)});
+        }
+    }
+
+    /// @brief Events of one kind recorded by all threads
+    [[nodiscard]] uint64_t eventCount(FlightEventKind kind) const noexcept {
+        uint64_t total = 0U;
+        const std::size_t count = ringCount();
+        for (std::size_t index = 0U; index < count; ++index) {
+            const FlightRing* ring = rings_[index].load(std::memory_order_acquire);
+            if (ring != nullptr) {
+                total += ring->kindCount(kind);
+            }
+        }
+        return total;
+    }
+
+    /// @brief Threads that recorded without getting a ring
+    [[nodiscard]] uint64_t unregisteredThreadCount() const noexcept {
+        return unregistered_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Install the SIGUSR1 and fatal signal handlers
+     * @details SIGUSR1 dumps and continues. Fatal signals dump once, restore
+     *          the default action and re-raise so the core dump still happens.
+     * @return false if a handler could not be installed
+     */
+    static bool installSignalHandlers() noexcept {
+        struct sigaction action{};
+        sigemptyset(&action.sa_mask);
+        action.sa_handler = &FlightRecorder::onSignal;
+
+        action.sa_flags = SA_RESTART;
+        bool installed = (::sigaction(SIGUSR1, &action, nullptr) == 0);
+
+        action.sa_flags = SA_RESETHAND;
+        for (const int signum : {SIGSEGV, SIGBUS, SIGFPE, SIGILL, SIGABRT}) {
+            installed = (::sigaction(signum, &action, nullptr) == 0) && installed;
+        }
+        return installed;
+    }
+
+    /**
+     * @brief Append a dump to the configured file (async-signal-safe)
+     * @param reason Short reason written in the header line
+     * @return false if disabled, another dump is running, or the file cannot be opened
+     */
+    bool dumpToFile(const char* reason) noexcept {
+        if (!enabled_.load(std::memory_order_acquire)) {
+            return false;
+        }
+        const int fd = ::open(path_, O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+        if (fd < 0) {
+            return false;
+        }
+        const bool dumped = dump(fd, reason);
+        static_cast<void>(::close(fd));
+        return dumped;
+    }
+
+    /**
+     * @brief Write every ring, oldest event first, to @p fd (async-signal-safe)
+     * @details Format:
+     * @code
+     * # flight recorder <source> pid=<pid> reason=<reason> mono_ns=<now> wall_ns=<now>
+     * # thread <tid> events=<kept>/<written>
+     * <mono_ns> <Kind> track=<id> key=<updateTime>
+     * @endcode
+     * @return false if another dump is running (the request is skipped)
+     */
+    bool dump(int fd, const char* reason) noexcept {
+        if (dumping_.test_and_set(std::memory_order_acquire)) {
+            return false;
+        }
+        LineBuffer line;
+        line.append("# flight recorder ").append(source_).append(" pid=").append(static_cast<int64_t>(::getpid()))
+            .append(" reason=").append(reason).append(" mono_ns=").append(nowNs())
+            .append(" wall_ns=").append(wallNs()).append("\n");
+        line.flush(fd);
+
+        const std::size_t count = ringCount();
+        for (std::size_t index = 0U; index < count; ++index) {
+            const FlightRing* ring = rings_[index].load(std::memory_order_acquire);
+            if (ring == nullptr) {
+                continue;
+            }
+            const uint64_t written = ring->writtenCount();
+            const uint64_t first = (written > FlightRing::CAPACITY) ? (written - FlightRing::CAPACITY) : 0U;
+            line.append("# thread ").append(ring->threadId()).append(" events=")
+                .append(static_cast<int64_t>(written - first)).append("/").append(static_cast<int64_t>(written))
+                .append("\n");
+            line.flush(fd);
+
+            for (uint64_t sequence = first; sequence < written; ++sequence) {
+                const FlightEvent& event = ring->at(sequence);
+                line.append(event.timestampNs).append(" ").append(kindName(event.kind))
+                    .append(" track=").append(static_cast<int64_t>(event.trackId))
+                    .append(" key=").append(event.messageKey).append("\n");
+                line.flush(fd);
+            }
+        }
+        dumping_.clear(std::memory_order_release);
+        return true;
+    }
+
+    /// @brief Name used in dumps
+    static const char* kindName(uint8_t kind) noexcept {
+        switch (static_cast<FlightEventKind>(kind)) {
+            case FlightEventKind::Receive:    return "Receive";
+            case FlightEventKind::Enqueue:    return "Enqueue";
+            case FlightEventKind::Dequeue:    return "Dequeue";
+            case FlightEventKind::Send:       return "Send";
+            case FlightEventKind::QueueDrop:  return "QueueDrop";
+            case FlightEventKind::SendFailed: return "SendFailed";
+            case FlightEventKind::Conflated:  return "Conflated";
+            default:                          return "Unknown";
+        }
+    }
+
+    /// @brief Monotonic timestamp of every event (same clock as StageTracer)
+    [[nodiscard]] static int64_t nowNs() noexcept {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+private:
+    FlightRecorder() = default;
+    ~FlightRecorder() = default;
+
+    /**
+     * @class LineBuffer
+     * @brief Stack line formatter without locale, allocation or stdio
+     */
+    class LineBuffer final {
+    public:
+        LineBuffer& append(const char* text) noexcept {
+            for (const char* c = (text != nullptr) ? text : "?"; (*c != '\0') && (length_ < sizeof(data_)); ++c) {
+                data_[length_++] = *c;
+            }
+            return *this;
+        }
+
+        LineBuffer& append(int64_t value) noexcept {
+            char digits[20];
+            std::size_t count = 0U;
+            // Negate through uint64_t so INT64_MIN does not overflow
+            uint64_t magnitude = (value < 0) ? (0U - static_cast<uint64_t>(value)) : static_cast<uint64_t>(value);
+            do {
+                digits[count++] = static_cast<char>('0' + static_cast<int>(magnitude % 10U));
+                magnitude /= 10U;
+            } while (magnitude != 0U);
+            if ((value < 0) && (length_ < sizeof(data_))) {
+                data_[length_++] = '-';
+            }
+            while ((count > 0U) && (length_ < sizeof(data_))) {
+                data_[length_++] = digits[--count];
+            }
+            return *this;
+        }
+
+        void flush(int fd) noexcept {
+            std::size_t offset = 0U;
+            while (offset < length_) {
+                const ssize_t written = ::write(fd, data_ + offset, length_ - offset);
+                if (written < 0) {
+                    if (errno == EINTR) {
+                        continue;
+                    }
+                    break;
+                }
+                offset += static_cast<std::size_t>(written);
+            }
+            length_ = 0U;
+        }
+
+    private:
+        char data_[192];
+        std::size_t length_{0U};
+    };
+
+    static void onSignal(int signum) {
+        const int savedErrno = errno;
+        const char* reason = "signal";
+        switch (signum) {
+            case SIGUSR1: reason = "SIGUSR1"; break;
+            case SIGSEGV: reason = "SIGSEGV"; break;
+            case SIGBUS:  reason = "SIGBUS";  break;
+            case SIGFPE:  reason = "SIGFPE";  break;
+            case SIGILL:  reason = "SIGILL";  break;
+            case SIGABRT: reason = "SIGABRT"; break;
+            default: break;
+        }
+        static_cast<void>(instance().dumpToFile(reason));
+        errno = savedErrno;
+        if (signum != SIGUSR1) {
+            // SA_RESETHAND restored the default action
+            static_cast<void>(::raise(signum));
+        }
+    }
+
+    static int64_t wallNs() noexcept {
+        timespec ts{};
+        static_cast<void>(::clock_gettime(CLOCK_REALTIME, &ts));
+        return (static_cast<int64_t>(ts.tv_sec) * 1000000000LL) + static_cast<int64_t>(ts.tv_nsec);
+    }
+
+    [[nodiscard]] std::size_t ringCount() const noexcept {
+        const std::size_t count = claimed_.load(std::memory_order_acquire);
+        return (count < MAX_THREADS) ? count : MAX_THREADS;
+    }
+
+    /// @brief Ring of the calling thread, created on its first event
+    FlightRing* localRing() noexcept {
+        thread_local FlightRing* ring = nullptr;
+        thread_local bool attempted = false;
+        if (!attempted) {
+            attempted = true;
+            const std::size_t index = claimed_.fetch_add(1U, std::memory_order_acq_rel);
+            if (index < MAX_THREADS) {
+                // Never freed: a signal handler may walk it during exit
+                ring = new (std::nothrow) FlightRing(static_cast<int64_t>(::syscall(SYS_gettid)));
+                rings_[index].store(ring, std::memory_order_release);
+            }
+            if (ring == nullptr) {
+                unregistered_.fetch_add(1U, std::memory_order_relaxed);
+            }
+        }
+        return ring;
+    }
+
+    std::atomic<bool> enabled_{false};                             ///< Recording switch
+    std::atomic_flag dumping_ = ATOMIC_FLAG_INIT;                  ///< One dump at a time
+    std::array<std::atomic<FlightRing*>, MAX_THREADS> rings_{};    ///< Registered rings
+    std::atomic<std::size_t> claimed_{0U};                         ///< Ring slots handed out
+    std::atomic<uint64_t> unregistered_{0U};                       ///< Threads without a ring
+    char path_[256]{};                                             ///< Dump file
+    char source_[32]{};                                            ///< Process name
+};
+
+/**
+ * @class FlightRecorderWatchdog
+ * @brief Dumps the flight recorder when the domain thread stops dequeuing
+ * @details A stall is: a backlog (messages enqueued since the last dequeue)
+ *          has existed for the stall timeout without a dequeue. The backlog
+ *          clock starts when the enqueue count first moves after the last
+ *          progress, so the first message after an idle period is not a
+ *          stall. One dump per stall; the watchdog re-arms once dequeuing
+ *          resumes.
+ */
+class FlightRecorderWatchdog final {
+public:
+    /**
+     * @param stallTimeout Time without dequeue progress that counts as a stall (> 0)
+     */
+    explicit FlightRecorderWatchdog(std::chrono::milliseconds stallTimeout)
+        : stallTimeoutNs_(std::chrono::duration_cast<std::chrono::nanoseconds>(
+              (stallTimeout.count() > 0) ? stallTimeout : std::chrono::milliseconds(1000)).count()) {
+    }
+
+    // Non-copyable, non-movable (owns a thread)
+    FlightRecorderWatchdog(const FlightRecorderWatchdog&) = delete;
+    FlightRecorderWatchdog& operator=(const FlightRecorderWatchdog&) = delete;
+    FlightRecorderWatchdog(FlightRecorderWatchdog&&) = delete;
+    FlightRecorderWatchdog& operator=(FlightRecorderWatchdog&&) = delete;
+
+    ~FlightRecorderWatchdog() {
+        stop();
+    }
+
+    /**
+     * @brief Start checking every quarter of the stall timeout
+     * @return false if already running
+     */
+    bool start() {
+        if (running_.exchange(true)) {
+            return false;
+        }
+        thread_ = std::thread([this]() { run(); });
+        return true;
+    }
+
+    void stop() {
+        if (!running_.exchange(false)) {
+            return;
+        }
+        wakeCv_.notify_all();
+        if (thread_.joinable()) {
+            thread_.join();
+        }
+    }
+
+    /**
+     * @brief Evaluate the stall condition once (watchdog thread, or tests)
+     * @param nowNs Current steady_clock time
+     * @return true if a new stall was detected (and a dump requested)
+     */
+    bool check(int64_t nowNs) {
+        const FlightRecorder& recorder = FlightRecorder::instance();
+        const uint64_t enqueued = recorder.eventCount(FlightEventKind::Enqueue);
+        const uint64_t dequeued = recorder.eventCount(FlightEventKind::Dequeue);
+
+        if (!primed_ || (dequeued != lastDequeued_)) {
+            primed_ = true;
+            lastDequeued_ = dequeued;
+            enqueuedAtProgress_ = enqueued;
+            backlogPending_ = false;
+            stallReported_ = false;
+            return false;
+        }
+        if (enqueued == enqueuedAtProgress_) {
+            return false;  // Idle: nothing waiting
+        }
+        if (!backlogPending_) {
+            backlogPending_ = true;
+            backlogSinceNs_ = nowNs;
+            return false;
+        }
+        if (stallReported_ || ((nowNs - backlogSinceNs_) < stallTimeoutNs_)) {
+            return false;
+        }
+        stallReported_ = true;
+        stalls_.fetch_add(1U, std::memory_order_relaxed);
+        static_cast<void>(FlightRecorder::instance().dumpToFile("watchdog_stall"));
+        return true;
+    }
+
+    /// @brief Stalls detected so far
+    [[nodiscard]] uint64_t stallCount() const noexcept {
+        return stalls_.load(std::memory_order_relaxed);
+    }
+
+private:
+    void run() {
+        const auto period = std::chrono::nanoseconds(stallTimeoutNs_ / 4);
+        while (running_.load()) {
+            static_cast<void>(check(FlightRecorder::nowNs()));
+            std::unique_lock<std::mutex> lock(wakeMutex_);
+            static_cast<void>(wakeCv_.wait_for(lock, period, [this]() { return !running_.load(); }));
+        }
+    }
+
+    int64_t stallTimeoutNs_;                 ///< Stall threshold
+    bool primed_{false};                     ///< First check done
+    uint64_t lastDequeued_{0U};              ///< Dequeue total at the last progress
+    uint64_t enqueuedAtProgress_{0U};        ///< Enqueue total at the last progress
+    bool backlogPending_{false};             ///< Enqueues seen since the last progress
+    int64_t backlogSinceNs_{0};              ///< Time the backlog was first seen
+    bool stallReported_{false};              ///< Current stall already dumped
+    std::atomic<uint64_t> stalls_{0U};       ///< Stalls detected
+    std::thread thread_;                     ///< Watchdog thread
+    std::atomic<bool> running_{false};       ///< Lifecycle flag
+    std::mutex wakeMutex_;                   ///< Paired with wakeCv_
+    std::condition_variable wakeCv_;         ///< Early wake on stop()
+};
+
+} // namespace utils
+
+#endif // C_HEXAGON_UTILS_FLIGHT_RECORDER_HPP
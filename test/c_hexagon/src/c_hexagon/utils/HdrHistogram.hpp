@@ -0,0 +1,223 @@
+/**
+ * @file HdrHistogram.hpp
+ * @brief Fixed-footprint high dynamic range latency histogram
+ * @details Log-linear bucketing in the style of HdrHistogram: values below
+ *          SUB_BUCKET_COUNT are counted exactly, larger values fall into
+ *          buckets that keep SUB_BUCKET_BITS significant bits, so every
+ *          reported percentile is within 2^-(SUB_BUCKET_BITS-1) of the true
+ *          value: 1/64 (~1.6%, 1728 buckets) for HdrHistogram, 1/16 (~6%,
+ *          464 buckets) for CoarseHdrHistogram.
+ *
+ * Design:
+ * - All buckets are allocated once in the constructor; record() never allocates.
+ * - One writer thread records. Counters are atomics updated with relaxed
+ *   load+store (no locked RMW), so other threads may read a consistent-enough
+ *   snapshot without stopping the writer.
+ * - Values above MAX_TRACKABLE_VALUE are clamped into the last bucket, negative
+ *   values (clock skew between hosts) are clamped to zero and counted.
+ *
+ * @author c_hexagon Team
+ * @version 1.0
+ * @date 2025
+ *
+ * @note MISRA C++ 2023 compliant implementation
+ * @note Exactly one recording thread at a time
+ */
+
+#ifndef C_HEXAGON_UTILS_HDR_HISTOGRAM_HPP
+#define C_HEXAGON_UTILS_HDR_HISTOGRAM_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+
+namespace utils {
+
+/**
+ * @class BasicHdrHistogram
+ * @brief Single-writer log-linear histogram of non-negative int64 values
+ * @tparam SubBucketBits Significant bits kept per bucket; trades precision
+ *                       for footprint (BUCKET_COUNT * 8 bytes)
+ */
+template <uint32_t SubBucketBits>
+class BasicHdrHistogram final {
+public:
+    /// @brief Significant bits kept per bucket (relative error 2^-(bits-1))
+    static constexpr uint32_t SUB_BUCKET_BITS{SubBucketBits};
+    static constexpr uint64_t SUB_BUCKET_COUNT{1ULL << SUB_BUCKET_BITS};
+    static constexpr uint64_t SUB_BUCKET_HALF_COUNT{SUB_BUCKET_COUNT / 2U};
+
+    /// @brief Largest value with its own bucket (2^32 - 1 us, ~71 minutes)
+    static constexpr uint32_t MAX_VALUE_BITS{32U};
+    static constexpr int64_t MAX_TRACKABLE_VALUE{(1LL << MAX_VALUE_BITS) - 1};
+
+    /// @brief Total bucket count: exact range + one half-range per extra bit
+    static constexpr std::size_t BUCKET_COUNT{
+        static_cast<std::size_t>(SUB_BUCKET_COUNT +
+                                 (SUB_BUCKET_HALF_COUNT * (MAX_VALUE_BITS - SUB_BUCKET_BITS)))};
+
+    static_assert((SUB_BUCKET_BITS >= 2U) && (SUB_BUCKET_BITS < MAX_VALUE_BITS),
+                  "SubBucketBits must leave at least one exponent bit");
+
+    BasicHdrHistogram()
+        : counts_(std::make_unique<std::atomic<uint64_t>[]>(BUCKET_COUNT)) {
+        reset();
+    }
+
+    // Non-copyable, non-movable (readers may hold a reference)
+    BasicHdrHistogram(const BasicHdrHistogram&) = delete;
+    BasicHdrHistogram& operator=(const BasicHdrHistogram&) = delete;
+    BasicHdrHistogram(BasicHdrHistogram&&) = delete;
+    BasicHdrHistogram& operator=(BasicHdrHistogram&&) = delete;
+    ~BasicHdrHistogram() = default;
+
+    /**
+     * @brief Record one value (writer thread only, wait-free)
+     * @param value Sample, clamped to [0, MAX_TRACKABLE_VALUE]
+     */
+    void record(int64_t value) noexcept {
+        if (value < 0) {
+            bump(clamped_);
+            value = 0;
+        } else if (value > MAX_TRACKABLE_VALUE) {
+            bump(clamped_);
+            value = MAX_TRACKABLE_VALUE;
+        }
+
+        bump(counts_[indexOf(static_cast<uint64_t>(value))]);
+        bump(totalCount_);
+        if (value < min_.load(std::memory_order_relaxed)) {
+            min_.store(value, std::memory_order_relaxed);
+        }
+        if (value > max_.load(std::memory_order_relaxed)) {
+            max_.store(value, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @brief Clear all counts (writer thread only)
+     */
+    void reset() noexcept {
+        for (std::size_t i = 0U; i < BUCKET_COUNT; ++i) {
+            counts_[i].store(0U, std::memory_order_relaxed);
+        }
+        totalCount_.store(0U, std::memory_order_relaxed);
+        clamped_.store(0U, std::memory_order_relaxed);
+        min_.store(std::numeric_limits<int64_t>::max(), std::memory_order_relaxed);
+        max_.store(0, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] uint64_t count() const noexcept {
+        return totalCount_.load(std::memory_order_relaxed);
+    }
+
+    /// @brief Samples that were outside [0, MAX_TRACKABLE_VALUE]
+    [[nodiscard]] uint64_t clampedCount() const noexcept {
+        return clamped_.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] int64_t min() const noexcept {
+        return (count() == 0U) ? 0 : min_.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] int64_t max() const noexcept {
+        return max_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Value at one percentile
+     * @param percentile 0.0 - 100.0
+     */
+    [[nodiscard]] int64_t valueAtPercentile(double percentile) const noexcept {
+        int64_t value = 0;
+        valuesAtPercentiles(&percentile, 1U, &value);
+        return value;
+    }
+
+    /**
+     * @brief Values at several percentiles in one pass over the buckets
+     * @param percentiles Ascending percentiles (0.0 - 100.0)
+     * @param count Number of percentiles
+     * @param out Receives one value per percentile (highest value equivalent
+     *            to the bucket, capped at max())
+     */
+    void valuesAtPercentiles(const double* percentiles, std::size_t count,
+                             int64_t* out) const noexcept {
+        const uint64_t total = this->count();
+        std::size_t next = 0U;
+        if (total == 0U) {
+            std::fill(out, out + count, 0);
+            return;
+        }
+
+        const int64_t maxValue = max();
+        uint64_t cumulative = 0U;
+        for (std::size_t i = 0U; (i < BUCKET_COUNT) && (next < count); ++i) {
+            cumulative += counts_[i].load(std::memory_order_relaxed);
+            while ((next < count) && (cumulative >= rankOf(percentiles[next], total))) {
+                out[next] = std::min(highestEquivalentValue(i), maxValue);
+                ++next;
+            }
+        }
+        // Concurrent reader raced the writer: report the max for the rest
+        for (; next < count; ++next) {
+            out[next] = maxValue;
+        }
+    }
+
+private:
+    static void bump(std::atomic<uint64_t>& counter) noexcept {
+        counter.store(counter.load(std::memory_order_relaxed) + 1U, std::memory_order_relaxed);
+    }
+
+    static uint32_t highestBit(uint64_t value) noexcept {
+        return 63U - static_cast<uint32_t>(__builtin_clzll(value));
+    }
+
+    static std::size_t indexOf(uint64_t value) noexcept {
+        if (value < SUB_BUCKET_COUNT) {
+            return static_cast<std::size_t>(value);
+        }
+        // Keep the top SUB_BUCKET_BITS bits: sub in [HALF_COUNT, COUNT)
+        const uint32_t shift = highestBit(value) - (SUB_BUCKET_BITS - 1U);
+        const uint64_t sub = value >> shift;
+        return static_cast<std::size_t>(SUB_BUCKET_COUNT +
+                                        ((shift - 1U) * SUB_BUCKET_HALF_COUNT) +
+                                        (sub - SUB_BUCKET_HALF_COUNT));
+    }
+
+    static int64_t highestEquivalentValue(std::size_t index) noexcept {
+        if (index < SUB_BUCKET_COUNT) {
+            return static_cast<int64_t>(index);
+        }
+        const uint64_t offset = static_cast<uint64_t>(index) - SUB_BUCKET_COUNT;
+        const uint32_t shift = static_cast<uint32_t>(offset / SUB_BUCKET_HALF_COUNT) + 1U;
+        const uint64_t sub = (offset % SUB_BUCKET_HALF_COUNT) + SUB_BUCKET_HALF_COUNT;
+        return static_cast<int64_t>(((sub + 1U) << shift) - 1U);
+    }
+
+    static uint64_t rankOf(double percentile, uint64_t total) noexcept {
+        const double clamped = std::min(std::max(percentile, 0.0), 100.0);
+        const uint64_t rank = static_cast<uint64_t>((clamped / 100.0) * static_cast<double>(total) + 0.5);
+        return std::max<uint64_t>(rank, 1U);
+    }
+
+    std::unique_ptr<std::atomic<uint64_t>[]> counts_;  ///< BUCKET_COUNT counters
+    std::atomic<uint64_t> totalCount_{0U};             ///< Samples since reset()
+    std::atomic<uint64_t> clamped_{0U};                ///< Out-of-range samples
+    std::atomic<int64_t> min_{0};                      ///< Smallest recorded value
+    std::atomic<int64_t> max_{0};                      ///< Largest recorded value
+};
+
+/// @brief Full-resolution histogram (~1.6%, ~14 KB)
+using HdrHistogram = BasicHdrHistogram<7U>;
+
+/// @brief Reduced-resolution histogram for large per-key sets (~6%, ~3.7 KB)
+using CoarseHdrHistogram = BasicHdrHistogram<5U>;
+
+} // namespace utils
+
+#endif // C_HEXAGON_UTILS_HDR_HISTOGRAM_HPP
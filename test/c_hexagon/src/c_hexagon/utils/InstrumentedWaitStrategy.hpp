@@ -0,0 +1,112 @@
+/**
+ * @file InstrumentedWaitStrategy.hpp
+ * @brief Wait strategy decorator recording consumer wake-up latency
+ * @details Wraps any WaitStrategy and measures, for every wait that had to
+ *          wait, the time from the producer's first signal() to the consumer
+ *          returning from waitFor(). That is the latency a strategy adds on
+ *          top of the queue itself (futex + scheduler for blocking, a few
+ *          hundred nanoseconds for spinning), so deployments can compare
+ *          strategies per thread before trading CPU for microseconds.
+ *
+ * Design:
+ * - The producer only reads the clock while the consumer is waiting; a
+ *   publish to a busy consumer costs one extra relaxed load.
+ * - Waits satisfied without waiting and waits that time out record nothing.
+ * - Samples go into an HdrHistogram (nanoseconds) written by the consumer
+ *   thread only; other threads may read percentiles at any time.
+ *
+ * @author c_hexagon Team
+ * @version 1.0
+ * @date 2025
+ *
+ * @note MISRA C++ 2023 compliant implementation
+ * @note One consumer thread per instance (like the queues it is plugged into)
+ * @see WaitStrategy.hpp
+ */
+
+#ifndef C_HEXAGON_UTILS_INSTRUMENTED_WAIT_STRATEGY_HPP
+#define C_HEXAGON_UTILS_INSTRUMENTED_WAIT_STRATEGY_HPP
+
+#include "utils/HdrHistogram.hpp"
+#include "utils/WaitStrategy.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+namespace utils {
+
+/**
+ * @class InstrumentedWaitStrategy
+ * @brief Decorator adding a signal-to-wake latency histogram to a strategy
+ */
+class InstrumentedWaitStrategy final : public WaitStrategy {
+public:
+    /**
+     * @brief Constructor
+     * @param inner Strategy that does the actual waiting
+     * @throws std::invalid_argument if inner is null
+     */
+    explicit InstrumentedWaitStrategy(std::shared_ptr<WaitStrategy> inner)
+        : inner_(std::move(inner)) {
+        if (!inner_) {
+            throw std::invalid_argument("InstrumentedWaitStrategy requires a wait strategy");
+        }
+    }
+
+    bool waitFor(const std::function<bool()>& ready, std::chrono::microseconds timeout) override {
+        if (ready()) {
+            return true;
+        }
+        signalNs_.store(0, std::memory_order_relaxed);
+        waiting_.store(true, std::memory_order_seq_cst);
+        const bool result = inner_->waitFor(ready, timeout);
+        waiting_.store(false, std::memory_order_relaxed);
+
+        const int64_t signalNs = signalNs_.exchange(0, std::memory_order_relaxed);
+        if (result && (signalNs != 0)) {
+            wakeLatency_.record(nowNs() - signalNs);
+        }
+        return result;
+    }
+
+    void signal() noexcept override {
+        // Only the first signal of a wait is timestamped
+        if (waiting_.load(std::memory_order_relaxed) && (signalNs_.load(std::memory_order_relaxed) == 0)) {
+            int64_t expected = 0;
+            static_cast<void>(signalNs_.compare_exchange_strong(expected, nowNs(), std::memory_order_relaxed));
+        }
+        inner_->signal();
+    }
+
+    void signalAll() noexcept override {
+        inner_->signalAll();
+    }
+
+    [[nodiscard]] const char* name() const noexcept override {
+        return inner_->name();
+    }
+
+    /// @brief Signal-to-wake latency of the waits that had to wait (ns)
+    [[nodiscard]] const HdrHistogram& wakeLatency() const noexcept {
+        return wakeLatency_;
+    }
+
+private:
+    static int64_t nowNs() noexcept {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    std::shared_ptr<WaitStrategy> inner_;
+    std::atomic<bool> waiting_{false};   ///< Consumer is inside inner_->waitFor()
+    std::atomic<int64_t> signalNs_{0};   ///< First signal of the current wait (0 = none)
+    HdrHistogram wakeLatency_;           ///< Consumer thread writes
+};
+
+} // namespace utils
+
+#endif // C_HEXAGON_UTILS_INSTRUMENTED_WAIT_STRATEGY_HPP
@@ -0,0 +1,275 @@
+/**
+ * @file SpscRingBuffer.hpp
+ * @brief Bounded single-producer/single-consumer ring buffer
+ * @details Fixed-capacity ring used between pipeline stages. Keeps the
+ *          drop-oldest overflow semantics of the previous mutex/condvar queues:
+ *          when the ring holds `capacity` items, pushing evicts the oldest one.
+ *
+ * Design:
+ * - Storage is pre-allocated once (power-of-two slots >= capacity), so
+ *   push/pop never allocate.
+ * - head_ and tail_ live on separate cache lines; each side caches the other
+ *   side's index to avoid cross-core traffic while there is slack.
+ * - Lock-free on both sides. The consumer copies slots, then commits by
+ *   advancing head_ with a CAS. On overflow the producer evicts the oldest
+ *   item with a CAS on the same index before rewriting its slot, so a copy
+ *   that raced with an eviction fails its commit and is discarded: a dropped
+ *   item is never also delivered. Without overflow the CAS is uncontended.
+ * - Waiting is delegated to a utils::WaitStrategy.
+ *
+ * @author c_hexagon Team
+ * @version 1.0
+ * @date 2025
+ *
+ * @note MISRA C++ 2023 compliant implementation
+ * @note Exactly one producer thread and one consumer thread at a time
+ * @see WaitStrategy.hpp
+ */
+
+#ifndef C_HEXAGON_UTILS_SPSC_RING_BUFFER_HPP
+#define C_HEXAGON_UTILS_SPSC_RING_BUFFER_HPP
+
+#include "utils/WaitStrategy.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace utils {
+
+/// @brief Cache line size used for padding shared indices
+inline constexpr std::size_t CACHE_LINE_SIZE = 64U;
+
+/**
+ * @class SpscRingBuffer
+ * @brief Bounded SPSC queue with drop-oldest overflow policy
+ * @tparam T Trivially copyable element type
+ */
+template <typename T>
+class SpscRingBuffer {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "SpscRingBuffer elements must be trivially copyable");
+
+public:
+    /**
+     * @brief Constructor
+     * @param capacity Maximum number of queued items (> 0)
+     * @param waitStrategy Consumer wait policy (blocking if null)
+     * @throws std::invalid_argument if capacity is zero
+     */
+    explicit SpscRingBuffer(std::size_t capacity,
+                            std::shared_ptr<WaitStrategy> waitStrategy = nullptr)
+        : capacity_(capacity)
+        , mask_(slotCountFor(capacity) - 1U)
+        , slots_(slotCountFor(capacity))
+        , waitStrategy_(waitStrategy ? std::move(waitStrategy)
+                                     : std::make_shared<BlockingWaitStrategy>()) {
+        if (capacity == 0U) {
+            throw std::invalid_argument("SpscRingBuffer capacity must be greater than zero");
+        }
+    }
+
+    // Non-copyable, non-movable (shared between two threads)
+    SpscRingBuffer(const SpscRingBuffer&) = delete;
+    SpscRingBuffer& operator=(const SpscRingBuffer&) = delete;
+    SpscRingBuffer(SpscRingBuffer&&) = delete;
+    SpscRingBuffer& operator=(SpscRingBuffer&&) = delete;
+    ~SpscRingBuffer() = default;
+
+    // ==================== Producer Side ====================
+
+    /**
+     * @brief Publish an item, evicting the oldest one if the ring is full
+     * @param item Item to copy into the ring
+     * @return true if no item was dropped, false if the oldest was evicted
+     */
+    bool push(const T& item) noexcept {
+        const uint64_t tail = tail_.value.load(std::memory_order_relaxed);
+        bool dropped = false;
+
+        if ((tail - producerHeadCache_) >= capacity_) {
+            uint64_t head = head_.value.load(std::memory_order_acquire);
+            while ((tail - head) >= capacity_) {
+                // Full: claim the oldest item away from the consumer, then its
+                // slot may be rewritten (an in-flight consumer copy fails its CAS)
+                if (head_.value.compare_exchange_weak(head, head + 1U, std::memory_order_acq_rel,
+                                                      std::memory_order_acquire)) {
+                    ++head;
+                    dropped = true;
+                    dropCount_.value.fetch_add(1U, std::memory_order_relaxed);
+                }
+                // Otherwise head holds the consumer's new index; re-check
+            }
+            producerHeadCache_ = head;
+        }
+
+        slots_[static_cast<std::size_t>(tail & mask_)] = item;
+        tail_.value.store(tail + 1U, std::memory_order_release);
+        waitStrategy_->signal();
+        return !dropped;
+    }
+
+    // ==================== Consumer Side ====================
+
+    /**
+     * @brief Pop the oldest item without waiting
+     * @param out Destination for the popped item
+     * @return true if an item was popped
+     */
+    bool tryPop(T& out) noexcept {
+        return tryPopBatch(&out, 1U) == 1U;
+    }
+
+    /**
+     * @brief Pop up to maxItems of the oldest items with one claim, without waiting
+     * @details Copies the items, then claims them with one CAS on head_. The
+     *          CAS fails only if the producer evicted meanwhile; the copies may
+     *          then hold rewritten slots, so they are discarded and retried.
+     * @param out Destination for at least maxItems items
+     * @param maxItems Maximum number of items to pop
+     * @return Number of items popped (oldest first)
+     */
+    std::size_t tryPopBatch(T* out, std::size_t maxItems) noexcept {
+        if (maxItems == 0U) {
+            return 0U;
+        }
+        uint64_t head = head_.value.load(std::memory_order_acquire);
+        for (;;) {
+            if (head >= consumerTailCache_) {
+                consumerTailCache_ = tail_.value.load(std::memory_order_acquire);
+                if (head >= consumerTailCache_) {
+                    return 0U;
+                }
+            }
+
+            const uint64_t available = consumerTailCache_ - head;
+            const std::size_t count = (available < maxItems) ? static_cast<std::size_t>(available) : maxItems;
+            for (std::size_t i = 0U; i < count; ++i) {
+                out[i] = slots_[static_cast<std::size_t>((head + i) & mask_)];
+            }
+            // Release keeps the copies before the claim; on failure head holds
+            // the index after the producer's eviction
+            if (head_.value.compare_exchange_strong(head, head + count, std::memory_order_acq_rel,
+                                                    std::memory_order_acquire)) {
+                return count;
+            }
+        }
+    }
+
+    /**
+     * @brief Pop the oldest item, waiting up to timeout via the wait strategy
+     * @param out Destination for the popped item
+     * @param timeout Maximum wait
+     * @return true if an item was popped
+     */
+    bool waitPop(T& out, std::chrono::microseconds timeout) {
+        return waitPopBatch(&out, 1U, timeout) == 1U;
+    }
+
+    /**
+     * @brief Pop up to maxItems items, waiting up to timeout for the first one
+     * @details Drains everything already queued (up to maxItems) per wake-up,
+     *          so a consumer pays one wait and one claim per burst.
+     * @param out Destination for at least maxItems items
+     * @param maxItems Maximum number of items to pop
+     * @param timeout Maximum wait while the ring is empty
+     * @return Number of items popped (0 on timeout or wakeConsumer())
+     */
+    std::size_t waitPopBatch(T* out, std::size_t maxItems, std::chrono::microseconds timeout) {
+        const std::size_t count = tryPopBatch(out, maxItems);
+        if (count > 0U) {
+            return count;
+        }
+        if (!waitStrategy_->waitFor([this]() { return !empty() || woken_.load(std::memory_order_acquire); },
+                                    timeout)) {
+            return 0U;
+        }
+        return tryPopBatch(out, maxItems);
+    }
+
+    /**
+     * @brief Wake a waiting consumer (e.g. on shutdown)
+     * @details The next waitFor() returns immediately until resetWake() is called.
+     */
+    void wakeConsumer() noexcept {
+        woken_.store(true, std::memory_order_release);
+        waitStrategy_->signalAll();
+    }
+
+    /**
+     * @brief Re-arm waiting after wakeConsumer() (e.g. on restart)
+     */
+    void resetWake() noexcept {
+        woken_.store(false, std::memory_order_release);
+    }
+
+    // ==================== Observers (any thread, approximate) ====================
+
+    [[nodiscard]] std::size_t size() const noexcept {
+        const uint64_t head = head_.value.load(std::memory_order_acquire);
+        const uint64_t tail = tail_.value.load(std::memory_order_acquire);
+        return (tail > head) ? static_cast<std::size_t>(tail - head) : 0U;
+    }
+
+    [[nodiscard]] bool empty() const noexcept {
+        return size() == 0U;
+    }
+
+    [[nodiscard]] std::size_t capacity() const noexcept {
+        return capacity_;
+    }
+
+    /**
+     * @brief Total number of items evicted by overflow
+     */
+    [[nodiscard]] uint64_t droppedCount() const noexcept {
+        return dropCount_.value.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Wait strategy in use
+     */
+    [[nodiscard]] const WaitStrategy& waitStrategy() const noexcept {
+        return *waitStrategy_;
+    }
+
+private:
+    /**
+     * @brief Index padded to its own cache line
+     */
+    template <typename V>
+    struct alignas(CACHE_LINE_SIZE) PaddedAtomic {
+        std::atomic<V> value{0U};
+    };
+
+    /**
+     * @brief Smallest power of two not below capacity (at least 2)
+     */
+    static std::size_t slotCountFor(std::size_t capacity) noexcept {
+        std::size_t slots = 2U;
+        while (slots < capacity) {
+            slots <<= 1U;
+        }
+        return slots;
+    }
+
+    const std::size_t capacity_;
+    const uint64_t mask_;
+    std::vector<T> slots_;
+    std::shared_ptr<WaitStrategy> waitStrategy_;
+
+    PaddedAtomic<uint64_t> head_;                 ///< Next item to consume
+    alignas(CACHE_LINE_SIZE) uint64_t consumerTailCache_{0U};
+    PaddedAtomic<uint64_t> tail_;                 ///< Next slot to publish
+    alignas(CACHE_LINE_SIZE) uint64_t producerHeadCache_{0U};
+    PaddedAtomic<uint64_t> dropCount_;
+    std::atomic<bool> woken_{false};
+};
+
+} // namespace utils
+
+#endif // C_HEXAGON_UTILS_SPSC_RING_BUFFER_HPP
@@ -0,0 +1,104 @@
+/**
+ * @file UdpTimestampedReceiverTest.cpp
+ * @brief Unit tests for the kernel-timestamped UDP ingress
+ * @details Sends RADIO-framed datagrams over loopback the way a ZeroMQ RADIO
+ *          socket does and checks group filtering and kernel timestamps
+ */
+
+#include <gtest/gtest.h>
+#include "adapters/common/UdpTimestampedReceiver.hpp"
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using adapters::TimestampedDatagram;
+using adapters::UdpTimestampedReceiver;
+
+namespace {
+    const char* const kEndpoint = "udp://127.0.0.1:15902";
+    const char* const kGroup = "DelayCalcTrackData";
+
+    int64_t nowUs() {
+        return std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+    }
+
+    /// Send [group length][group][body] to the test endpoint
+    void sendRadio(const std::string& group, const std::vector<uint8_t>& body) {
+        sockaddr_in address{};
+        ASSERT_TRUE(UdpTimestampedReceiver::parseEndpoint(kEndpoint, address));
+        std::vector<uint8_t> datagram;
+        datagram.push_back(static_cast<uint8_t>(group.size()));
+        datagram.insert(datagram.end(), group.begin(), group.end());
+        datagram.insert(datagram.end(), body.begin(), body.end());
+
+        const int fd = ::socket(AF_INET, SOCK_DGRAM, 0);
+        ASSERT_GE(fd, 0);
+        EXPECT_EQ(::sendto(fd, datagram.data(), datagram.size(), 0,
+                           reinterpret_cast<const sockaddr*>(&address), sizeof(address)),
+                  static_cast<ssize_t>(datagram.size()));
+        ::close(fd);
+    }
+}
+
+TEST(UdpTimestampedReceiverTest, ParseEndpoint_AcceptsOnlyUdpIpv4WithPort) {
+    sockaddr_in address{};
+    ASSERT_TRUE(UdpTimestampedReceiver::parseEndpoint("udp://239.1.1.5:9595", address));
+    EXPECT_EQ(ntohs(address.sin_port), 9595U);
+    EXPECT_EQ(ntohl(address.sin_addr.s_addr), 0xEF010105U);
+
+    EXPECT_FALSE(UdpTimestampedReceiver::parseEndpoint("tcp://127.0.0.1:9000", address));
+    EXPECT_FALSE(UdpTimestampedReceiver::parseEndpoint("udp://127.0.0.1", address));
+    EXPECT_FALSE(UdpTimestampedReceiver::parseEndpoint("udp://127.0.0.1:0", address));
+    EXPECT_FALSE(UdpTimestampedReceiver::parseEndpoint("udp://127.0.0.1:70000", address));
+    EXPECT_FALSE(UdpTimestampedReceiver::parseEndpoint("udp://localhost:9000", address));
+}
+
+TEST(UdpTimestampedReceiverTest, ParseRadioDatagram_SplitsGroupAndBody) {
+    const uint8_t datagram[] = {2U, 'A', 'B', 7U, 8U};
+    const char* group = nullptr;
+    std::size_t groupSize = 0U;
+    const uint8_t* body = nullptr;
+    std::size_t bodySize = 0U;
+
+    ASSERT_TRUE(UdpTimestampedReceiver::parseRadioDatagram(datagram, sizeof(datagram), group, groupSize,
+                                                           body, bodySize));
+    EXPECT_EQ(std::string(group, groupSize), "AB");
+    ASSERT_EQ(bodySize, 2U);
+    EXPECT_EQ(body[0], 7U);
+
+    const uint8_t truncated[] = {5U, 'A'};
+    EXPECT_FALSE(UdpTimestampedReceiver::parseRadioDatagram(truncated, sizeof(truncated), group, groupSize,
+                                                            body, bodySize));
+}
+
+TEST(UdpTimestampedReceiverTest, Receive_FiltersGroupAndStampsArrival) {
+    UdpTimestampedReceiver receiver;
+    ASSERT_TRUE(receiver.open(kEndpoint, kGroup));
+
+    TimestampedDatagram datagram;
+    EXPECT_FALSE(receiver.tryReceive(datagram));
+
+    const int64_t before = nowUs();
+    sendRadio("OtherGroup", {1U, 2U, 3U});
+    sendRadio(kGroup, {4U, 5U, 6U, 7U});
+
+    ASSERT_TRUE(receiver.receive(1000, datagram));
+    ASSERT_EQ(datagram.size, 4U);
+    EXPECT_EQ(datagram.body[0], 4U);
+    EXPECT_EQ(receiver.skippedCount(), 1U);
+
+    // The kernel enables RX stamping lazily, so the first datagram may be unstamped (0)
+    if (receiver.hasKernelTimestamps() && (datagram.kernelReceiveTimeUs != 0)) {
+        EXPECT_GE(datagram.kernelReceiveTimeUs, before - 1000);
+        EXPECT_LE(datagram.kernelReceiveTimeUs, nowUs() + 1000);
+    }
+    EXPECT_FALSE(receiver.receive(10, datagram));
+}
+
+TEST(UdpTimestampedReceiverTest, Open_RejectsInvalidEndpoint) {
+    UdpTimestampedReceiver receiver;
+    EXPECT_FALSE(receiver.open("udp://not-an-address:9000", kGroup));
+    EXPECT_FALSE(receiver.isOpen());
+}
@@ -13,6 +13,8 @@
 #include "adapters/incoming/zeromq/TrackDataZeroMQIncomingAdapter.hpp"
 #include "domain/ports/incoming/IDelayCalcTrackDataIncomingPort.hpp"
 #include "utils/Logger.hpp"
+#include <zmq_config.hpp>
+#include <zmq.hpp>
 #include <memory>
 #include <thread>
 #include <chrono>
@@ -367,3 +369,121 @@ TEST_F(TrackDataZeroMQIncomingAdapterTest, Config_ReceiveTimeoutIsPositive) {
     
     EXPECT_FALSE(adapter->isRunning());
 }
+
+// ==================== Receive Mode Tests ====================
+
+TEST_F(TrackDataZeroMQIncomingAdapterTest, ReceiveMode_CannotChangeWhileRunning) {
+    std::string endpoint = getUniqueEndpoint();
+    auto adapter = std::make_shared<TrackDataZeroMQIncomingAdapter>(
+        mockPort_, endpoint, "TestData");
+    
+    EXPECT_TRUE(adapter->setReceiveMode(ReceiveMode::AdaptiveSpin, std::chrono::microseconds(20)));
+    adapter->start();
+    EXPECT_FALSE(adapter->setReceiveMode(ReceiveMode::BusyPoll));
+    adapter->stop();
+    
+    EXPECT_EQ(adapter->getReceiveStats().mode, ReceiveMode::AdaptiveSpin);
+}
+
+TEST_F(TrackDataZeroMQIncomingAdapterTest, ReceiveMode_IdleBlockingLoop_StopsAndReportsNoTraffic) {
+    std::string endpoint = getUniqueEndpoint();
+    auto adapter = std::make_shared<TrackDataZeroMQIncomingAdapter>(
+        mockPort_, endpoint, "TestData");
+    ASSERT_TRUE(adapter->setReceiveMode(ReceiveMode::Blocking));
+    
+    adapter->start();
+    std::this_thread::sleep_for(std::chrono::milliseconds(150));
+    adapter->stop();  // Bounded by the poll timeout
+    
+    const ReceiveStats stats = adapter->getReceiveStats();
+    EXPECT_FALSE(adapter->isRunning());
+    EXPECT_EQ(stats.messages, 0U);
+    EXPECT_EQ(stats.spin_time_us, 0U);
+}
+
+// ==================== Loopback Receive Tests ====================
+
+namespace {
+    DelayCalcTrackData makeLoopbackTrack(int32_t trackId) {
+        const int64_t now = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+        DelayCalcTrackData data;
+        data.setTrackId(trackId);
+        data.setUpdateTime(now);
+        data.setOriginalUpdateTime(now);
+        data.setFirstHopSentTime(now);
+        data.setFirstHopDelayTime(10);
+        data.setSecondHopSentTime(now);
+        return data;
+    }
+
+    /**
+     * @brief Publish one track from a RADIO socket until the adapter has it
+     * @details RADIO drops messages until the DISH join has propagated, so
+     *          the send is repeated; each repetition is spaced far enough apart
+     *          for the receive loop to go back to its blocking wait.
+     */
+    bool publishUntilReceived(const std::string& endpoint, const MockDelayCalcTrackDataPort& port) {
+        zmq::context_t context(1);
+        zmq::socket_t radio(context, zmq::socket_type::radio);
+        radio.set(zmq::sockopt::linger, 0);
+        radio.connect(endpoint);
+        for (int attempt = 0; attempt < 100; ++attempt) {
+            // Fresh send stamp per attempt: wake latency is measured from it
+            const std::vector<uint8_t> payload = makeLoopbackTrack(42).serialize();
+            zmq::message_t message(payload.data(), payload.size());
+            message.set_group("TestData");
+            static_cast<void>(radio.send(message, zmq::send_flags::none));
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+            if (port.getSubmitCount() > 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+}
+
+class TrackDataZeroMQIncomingAdapterLoopbackTest
+    : public TrackDataZeroMQIncomingAdapterTest
+    , public ::testing::WithParamInterface<ReceiveMode> {
+};
+
+TEST_P(TrackDataZeroMQIncomingAdapterLoopbackTest, Receive_DeliversTrackAndCountsWakeLatency) {
+    std::string endpoint = getUniqueEndpoint();
+    auto adapter = std::make_shared<TrackDataZeroMQIncomingAdapter>(
+        mockPort_, endpoint, "TestData");
+    ASSERT_TRUE(adapter->setReceiveMode(GetParam(), std::chrono::microseconds(20)));
+    ASSERT_TRUE(adapter->start());
+
+    const bool received = publishUntilReceived(endpoint, *mockPort_);
+    adapter->stop();
+    ASSERT_TRUE(received);
+    EXPECT_EQ(mockPort_->getLastData().getTrackId(), 42);
+
+    const ReceiveStats stats = adapter->getReceiveStats();
+    EXPECT_EQ(stats.mode, GetParam());
+    EXPECT_GE(stats.messages, 1U);
+    EXPECT_EQ(stats.messages, stats.ready_hits + stats.spin_hits + stats.wakeups);
+    if (GetParam() != ReceiveMode::AdaptiveSpin) {
+        // Only AdaptiveSpin spins
+        EXPECT_EQ(stats.spin_hits, 0U);
+    }
+    if (GetParam() == ReceiveMode::BusyPoll) {
+        // Never blocks, so nothing is a wake-up
+        EXPECT_EQ(stats.wakeups, 0U);
+    } else {
+        // The first message always arrives while the loop is blocked
+        EXPECT_GE(stats.wakeups, 1U);
+        EXPECT_GE(stats.wake_latency_max_ns, stats.wake_latency_avg_ns);
+        EXPECT_GE(stats.wake_latency_avg_ns, 0);
+        // Send stamp to wait return over loopback: well under the send spacing
+        EXPECT_LT(stats.wake_latency_max_ns, 20000000);
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(ReceiveModes, TrackDataZeroMQIncomingAdapterLoopbackTest,
+                         ::testing::Values(ReceiveMode::Blocking, ReceiveMode::AdaptiveSpin,
+                                           ReceiveMode::BusyPoll),
+                         [](const ::testing::TestParamInfo<ReceiveMode>& info) {
+                             return std::string(TrackDataZeroMQIncomingAdapter::receiveModeName(info.param));
+                         });
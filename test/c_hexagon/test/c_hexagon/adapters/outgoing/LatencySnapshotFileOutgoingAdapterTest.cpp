@@ -0,0 +1,61 @@
+/**
+ * @file LatencySnapshotFileOutgoingAdapterTest.cpp
+ * @brief Unit tests for the latency snapshot dump writer
+ */
+
+#include <gtest/gtest.h>
+#include "adapters/outgoing/file/LatencySnapshotFileOutgoingAdapter.hpp"
+#include <cstdio>
+#include <string>
+#include <vector>
+
+using adapters::outgoing::file::LatencySnapshotFileOutgoingAdapter;
+using domain::ports::LatencySnapshot;
+
+namespace {
+    std::string dumpPath() {
+        return ::testing::TempDir() + "latency_snapshot_test.bin";
+    }
+
+    LatencySnapshot makeSnapshot(int32_t trackId, int64_t p99) {
+        LatencySnapshot snapshot;
+        snapshot.trackId = trackId;
+        snapshot.count = 10U;
+        snapshot.p99Us = p99;
+        return snapshot;
+    }
+}
+
+TEST(LatencySnapshotFileOutgoingAdapterTest, Publish_AppendsAcrossRestarts) {
+    const std::string path = dumpPath();
+    std::remove(path.c_str());
+
+    {
+        LatencySnapshotFileOutgoingAdapter adapter(path);
+        EXPECT_FALSE(adapter.isReady());
+        ASSERT_TRUE(adapter.start());
+        adapter.publishLatencySnapshots({makeSnapshot(-1, 100), makeSnapshot(7, 200)});
+        EXPECT_EQ(adapter.writtenCount(), 2U);
+    }
+    {
+        LatencySnapshotFileOutgoingAdapter adapter(path);
+        ASSERT_TRUE(adapter.start());
+        adapter.publishLatencySnapshots({makeSnapshot(8, 300)});
+        adapter.stop();
+        EXPECT_FALSE(adapter.isReady());
+    }
+
+    std::vector<LatencySnapshot> records;
+    ASSERT_TRUE(LatencySnapshotFileOutgoingAdapter::readDump(path, records));
+    ASSERT_EQ(records.size(), 3U);
+    EXPECT_EQ(records[0].trackId, -1);
+    EXPECT_EQ(records[1].p99Us, 200);
+    EXPECT_EQ(records[2].trackId, 8);
+
+    std::remove(path.c_str());
+}
+
+TEST(LatencySnapshotFileOutgoingAdapterTest, ReadDump_MissingFile_ReturnsFalse) {
+    std::vector<LatencySnapshot> records;
+    EXPECT_FALSE(LatencySnapshotFileOutgoingAdapter::readDump(dumpPath() + ".missing", records));
+}
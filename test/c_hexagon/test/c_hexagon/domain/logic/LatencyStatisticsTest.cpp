@@ -0,0 +1,150 @@
+/**
+ * @file LatencyStatisticsTest.cpp
+ * @brief Unit tests for per-hop latency histograms and snapshot rotation
+ */
+
+#include <gtest/gtest.h>
+#include "domain/logic/LatencyStatistics.hpp"
+#include <vector>
+
+using namespace domain::logic;
+using namespace domain::ports;
+
+namespace {
+    FinalCalcTrackData makeFinal(int32_t trackId, int64_t firstHop, int64_t secondHop) {
+        FinalCalcTrackData data;
+        data.setTrackId(trackId);
+        data.setFirstHopDelayTime(firstHop);
+        data.setSecondHopDelayTime(secondHop);
+        data.setTotalDelayTime(firstHop + secondHop);
+        return data;
+    }
+}
+
+TEST(LatencyStatisticsTest, Rotate_EmitsGlobalThenPerTrackSnapshots) {
+    LatencyStatistics statistics(8U, 1000);
+    for (int64_t i = 1; i <= 100; ++i) {
+        statistics.record(makeFinal(1, i, 2 * i));
+        statistics.record(makeFinal(2, 10, 20));
+    }
+
+    std::vector<LatencySnapshot> snapshots;
+    statistics.rotate(2000, snapshots);
+
+    // 3 global + 3 per track
+    ASSERT_EQ(snapshots.size(), 9U);
+    for (std::size_t i = 0U; i < LATENCY_HOP_COUNT; ++i) {
+        EXPECT_EQ(snapshots[i].trackId, LATENCY_GLOBAL_TRACK_ID);
+        EXPECT_EQ(snapshots[i].count, 200U);
+        EXPECT_EQ(snapshots[i].intervalStartUs, 1000);
+        EXPECT_EQ(snapshots[i].intervalEndUs, 2000);
+    }
+
+    const LatencySnapshot* track1FirstHop = nullptr;
+    for (const LatencySnapshot& snapshot : snapshots) {
+        if ((snapshot.trackId == 1) && (snapshot.hop == static_cast<uint8_t>(LatencyHop::FirstHop))) {
+            track1FirstHop = &snapshot;
+        }
+    }
+    ASSERT_NE(track1FirstHop, nullptr);
+    EXPECT_EQ(track1FirstHop->count, 100U);
+    EXPECT_EQ(track1FirstHop->minUs, 1);
+    // Per-track sets are CoarseHdrHistogram: within 1/16 above the true value
+    EXPECT_GE(track1FirstHop->p50Us, 50);
+    EXPECT_LE(track1FirstHop->p50Us, 50 + (50 / 16));
+    EXPECT_GE(track1FirstHop->p99Us, 99);
+    EXPECT_LE(track1FirstHop->p99Us, 99 + (99 / 16));
+    EXPECT_EQ(track1FirstHop->maxUs, 100);
+
+    // Global set keeps full resolution (exact below 128)
+    const LatencySnapshot& globalFirstHop = snapshots[static_cast<std::size_t>(LatencyHop::FirstHop)];
+    EXPECT_EQ(globalFirstHop.p50Us, 10);
+    EXPECT_EQ(globalFirstHop.p99Us, 98);
+}
+
+TEST(LatencyStatisticsTest, Rotate_ResetsIntervalAndSkipsEmptyHistograms) {
+    LatencyStatistics statistics(8U, 0);
+    statistics.record(makeFinal(5, 10, 20));
+
+    std::vector<LatencySnapshot> snapshots;
+    statistics.rotate(100, snapshots);
+    snapshots.clear();
+    statistics.rotate(200, snapshots);
+
+    EXPECT_TRUE(snapshots.empty());
+    EXPECT_EQ(statistics.global(LatencyHop::Total).count(), 0U);
+    EXPECT_EQ(statistics.trackedTrackCount(), 1U);
+}
+
+TEST(LatencyStatisticsTest, Rotate_EvictsQuietTracksAndReusesTheirSlot) {
+    LatencyStatistics statistics(2U, 0);
+    statistics.record(makeFinal(1, 10, 10));
+    statistics.record(makeFinal(2, 10, 10));
+
+    std::vector<LatencySnapshot> snapshots;
+    int64_t nowUs = 0;
+    statistics.rotate(nowUs += 100, snapshots);
+    // Track 2 keeps reporting, track 1 goes quiet
+    for (uint32_t i = 0U; i < LatencyStatistics::TRACK_IDLE_INTERVALS_BEFORE_EVICTION; ++i) {
+        EXPECT_EQ(statistics.trackedTrackCount(), 2U);
+        statistics.record(makeFinal(2, 10, 10));
+        statistics.rotate(nowUs += 100, snapshots);
+    }
+    EXPECT_EQ(statistics.trackedTrackCount(), 1U);
+
+    // The freed slot goes to a new track, which starts from empty histograms
+    statistics.record(makeFinal(3, 7, 7));
+    EXPECT_EQ(statistics.trackedTrackCount(), 2U);
+    EXPECT_EQ(statistics.untrackedSampleCount(), 0U);
+
+    snapshots.clear();
+    statistics.rotate(nowUs += 100, snapshots);
+    std::size_t track3Snapshots = 0U;
+    for (const LatencySnapshot& snapshot : snapshots) {
+        EXPECT_NE(snapshot.trackId, 1);
+        if (snapshot.trackId == 3) {
+            ++track3Snapshots;
+            EXPECT_EQ(snapshot.count, 1U);
+            EXPECT_EQ(snapshot.minUs, snapshot.hop == static_cast<uint8_t>(LatencyHop::Total) ? 14 : 7);
+        }
+    }
+    EXPECT_EQ(track3Snapshots, LATENCY_HOP_COUNT);
+}
+
+TEST(LatencyStatisticsTest, TracksOverBound_FeedGlobalOnly) {
+    LatencyStatistics statistics(2U, 0);
+    statistics.record(makeFinal(1, 10, 10));
+    statistics.record(makeFinal(2, 10, 10));
+    statistics.record(makeFinal(3, 10, 10));
+
+    EXPECT_EQ(statistics.trackedTrackCount(), 2U);
+    EXPECT_EQ(statistics.untrackedSampleCount(), 1U);
+    EXPECT_EQ(statistics.global(LatencyHop::FirstHop).count(), 3U);
+}
+
+TEST(LatencyStatisticsTest, KernelReceiveTime_SplitsSecondHopInGlobalSnapshots) {
+    LatencyStatistics statistics(8U, 0);
+    FinalCalcTrackData data = makeFinal(1, 100, 300);
+    data.setSecondHopSentTime(1000);
+    data.setSecondHopReceiveTime(1250);
+    data.setThirdHopSentTime(1300);
+    statistics.record(data);
+    statistics.record(makeFinal(1, 100, 300));  // No kernel timestamp: no split
+
+    EXPECT_EQ(statistics.global(LatencyHop::SecondHopNetwork).count(), 1U);
+    EXPECT_EQ(statistics.global(LatencyHop::SecondHopNetwork).max(), 250);
+    EXPECT_EQ(statistics.global(LatencyHop::SecondHopInProcess).max(), 50);
+
+    std::vector<LatencySnapshot> snapshots;
+    statistics.rotate(100, snapshots);
+
+    // 5 global (split included) + 3 per track
+    ASSERT_EQ(snapshots.size(), 8U);
+    for (std::size_t i = 0U; i < LATENCY_GLOBAL_HOP_COUNT; ++i) {
+        EXPECT_EQ(snapshots[i].trackId, LATENCY_GLOBAL_TRACK_ID);
+        EXPECT_EQ(snapshots[i].hop, static_cast<uint8_t>(i));
+    }
+    EXPECT_EQ(snapshots[3U].count, 1U);
+    EXPECT_EQ(snapshots[4U].p50Us, 50);
+    EXPECT_EQ(statistics.global(LatencyHop::SecondHopNetwork).count(), 0U);
+}
@@ -0,0 +1,187 @@
+/**
+ * @file TrackStaticsAggregatorTest.cpp
+ * @brief Unit tests for per-track Welford accumulators and TrackStatics collection
+ */
+
+#include <gtest/gtest.h>
+#include "domain/logic/TrackStaticsAggregator.hpp"
+#include <vector>
+
+using namespace domain::logic;
+using namespace domain::ports;
+
+namespace {
+    FinalCalcTrackData makeFinal(int32_t trackId, int64_t firstHop, int64_t secondHop) {
+        FinalCalcTrackData data;
+        data.setTrackId(trackId);
+        data.setFirstHopDelayTime(firstHop);
+        data.setSecondHopDelayTime(secondHop);
+        data.setTotalDelayTime(firstHop + secondHop);
+        return data;
+    }
+
+    /// @brief Built like TargetStatisticService does: no range checks on the hop delays
+    FinalCalcTrackData makeUncheckedFinal(int32_t trackId, int64_t firstHop, int64_t secondHop) {
+        return FinalCalcTrackData(FinalCalcTrackData::UNCHECKED, trackId, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+                                  0, 0, 0, firstHop, 0, secondHop, firstHop + secondHop, 0);
+    }
+}
+
+TEST(TrackStaticsAggregatorTest, Collect_ReportsMeanStdMinMaxPerHop) {
+    TrackStaticsAggregator aggregator(16U);
+    // 2, 4, 4, 4, 5, 5, 7, 9: mean 5, population std 2
+    for (const int64_t value : {2, 4, 4, 4, 5, 5, 7, 9}) {
+        aggregator.record(makeFinal(42, value, 10 * value));
+    }
+
+    std::vector<TrackStatics> statics;
+    ASSERT_EQ(aggregator.collect(123456, statics), 1U);
+    ASSERT_EQ(statics.size(), 1U);
+
+    const TrackStatics& record = statics.front();
+    EXPECT_EQ(record.getTrackId(), 42);
+    EXPECT_DOUBLE_EQ(record.getFirstHopDelayDataMean(), 5.0);
+    EXPECT_DOUBLE_EQ(record.getFirstHopDelayDataStd(), 2.0);
+    EXPECT_DOUBLE_EQ(record.getFirstHopDelayDataMin(), 2.0);
+    EXPECT_DOUBLE_EQ(record.getFirstHopDelayDataMax(), 9.0);
+    EXPECT_DOUBLE_EQ(record.getSecondHopDelayDataMean(), 50.0);
+    EXPECT_DOUBLE_EQ(record.getSecondHopDelayDataStd(), 20.0);
+    EXPECT_DOUBLE_EQ(record.getTotalHopDelayDataMean(), 55.0);
+    EXPECT_DOUBLE_EQ(record.getTotalHopDelayDataMax(), 99.0);
+    EXPECT_EQ(record.getUpdateTime(), 123456);
+    EXPECT_TRUE(record.isValid());
+}
+
+TEST(TrackStaticsAggregatorTest, Collect_OnlyPublishesTracksUpdatedSinceLastCall) {
+    TrackStaticsAggregator aggregator(16U);
+    aggregator.record(makeFinal(1, 10, 20));
+    aggregator.record(makeFinal(2, 30, 40));
+
+    std::vector<TrackStatics> statics;
+    EXPECT_EQ(aggregator.collect(1, statics), 2U);
+
+    statics.clear();
+    EXPECT_EQ(aggregator.collect(2, statics), 0U);
+
+    // Statistics keep accumulating across collects
+    aggregator.record(makeFinal(2, 50, 40));
+    ASSERT_EQ(aggregator.collect(3, statics), 1U);
+    EXPECT_EQ(statics.front().getTrackId(), 2);
+    EXPECT_DOUBLE_EQ(statics.front().getFirstHopDelayDataMean(), 40.0);
+
+    const TrackStaticsAggregator::RunningStats* firstHop = aggregator.find(2, LatencyHop::FirstHop);
+    ASSERT_NE(firstHop, nullptr);
+    EXPECT_EQ(firstHop->count, 2U);
+}
+
+TEST(TrackStaticsAggregatorTest, Record_DropsTracksBeyondCapacity) {
+    TrackStaticsAggregator aggregator(4U);
+    for (int32_t trackId = 1; trackId <= 10; ++trackId) {
+        aggregator.record(makeFinal(trackId, 10, 20));
+    }
+    // Known tracks keep updating when the table is full
+    aggregator.record(makeFinal(1, 30, 20));
+
+    EXPECT_EQ(aggregator.trackCount(), 4U);
+    EXPECT_EQ(aggregator.droppedSampleCount(), 6U);
+    EXPECT_EQ(aggregator.find(7, LatencyHop::Total), nullptr);
+    ASSERT_NE(aggregator.find(1, LatencyHop::FirstHop), nullptr);
+    EXPECT_EQ(aggregator.find(1, LatencyHop::FirstHop)->count, 2U);
+
+    std::vector<TrackStatics> statics;
+    EXPECT_EQ(aggregator.collect(0, statics), 4U);
+}
+
+TEST(TrackStaticsAggregatorTest, Collect_EvictsIdleTracksAndFreesTheirSlots) {
+    TrackStaticsAggregator aggregator(4U);
+    for (int32_t trackId = 1; trackId <= 4; ++trackId) {
+        aggregator.record(makeFinal(trackId, 10, 20));
+    }
+    aggregator.record(makeFinal(5, 10, 20));
+    EXPECT_EQ(aggregator.droppedSampleCount(), 1U);
+
+    // Track 4 keeps reporting; tracks 1-3 go quiet
+    std::vector<TrackStatics> statics;
+    for (uint32_t call = 0U; call <= TrackStaticsAggregator::TRACK_IDLE_COLLECTS_BEFORE_EVICTION; ++call) {
+        aggregator.record(makeFinal(4, 30, 20));
+        statics.clear();
+        aggregator.collect(static_cast<int64_t>(call), statics);
+    }
+    EXPECT_EQ(aggregator.trackCount(), 1U);
+    EXPECT_EQ(aggregator.evictedTrackCount(), 3U);
+    EXPECT_EQ(aggregator.find(1, LatencyHop::Total), nullptr);
+    ASSERT_NE(aggregator.find(4, LatencyHop::FirstHop), nullptr);
+    EXPECT_EQ(aggregator.find(4, LatencyHop::FirstHop)->count,
+              TrackStaticsAggregator::TRACK_IDLE_COLLECTS_BEFORE_EVICTION + 2U);
+
+    // Freed slots take new tracks; a returning track starts over
+    for (int32_t trackId = 5; trackId <= 7; ++trackId) {
+        aggregator.record(makeFinal(trackId, 10, 20));
+    }
+    aggregator.record(makeFinal(1, 10, 20));
+    EXPECT_EQ(aggregator.trackCount(), 4U);
+    EXPECT_EQ(aggregator.droppedSampleCount(), 2U);
+    ASSERT_NE(aggregator.find(7, LatencyHop::Total), nullptr);
+    EXPECT_EQ(aggregator.find(7, LatencyHop::Total)->count, 1U);
+}
+
+TEST(TrackStaticsAggregatorTest, Collect_EvictionKeepsCollidingTracksReachable) {
+    // 64 tracks in a 128-slot table: plenty of shared probe runs
+    TrackStaticsAggregator aggregator(64U);
+    for (int32_t trackId = 1; trackId <= 64; ++trackId) {
+        aggregator.record(makeFinal(trackId, 10, 20));
+    }
+
+    std::vector<TrackStatics> statics;
+    for (uint32_t call = 0U; call <= TrackStaticsAggregator::TRACK_IDLE_COLLECTS_BEFORE_EVICTION; ++call) {
+        for (int32_t trackId = 2; trackId <= 64; trackId += 2) {
+            aggregator.record(makeFinal(trackId, 10, 20));
+        }
+        statics.clear();
+        aggregator.collect(0, statics);
+    }
+
+    EXPECT_EQ(aggregator.trackCount(), 32U);
+    for (int32_t trackId = 1; trackId <= 64; ++trackId) {
+        const bool expected = (trackId % 2) == 0;
+        EXPECT_EQ(aggregator.find(trackId, LatencyHop::Total) != nullptr, expected) << trackId;
+    }
+}
+
+TEST(TrackStaticsAggregatorTest, Record_RejectsOutOfRangeSamples) {
+    TrackStaticsAggregator aggregator(16U);
+    // A stalled hop (> 1 s) or a negative clock-corrected hop is outside the TrackStatics range
+    aggregator.record(makeFinal(3, 2000000, 20));
+    aggregator.record(makeUncheckedFinal(4, 5, -20));
+    aggregator.record(makeFinal(5, 5, 20));
+
+    EXPECT_EQ(aggregator.rejectedSampleCount(), 2U);
+    EXPECT_EQ(aggregator.find(3, LatencyHop::FirstHop), nullptr);
+    EXPECT_EQ(aggregator.find(4, LatencyHop::FirstHop), nullptr);
+
+    std::vector<TrackStatics> statics;
+    ASSERT_EQ(aggregator.collect(0, statics), 1U);
+    EXPECT_EQ(statics.front().getTrackId(), 5);
+    EXPECT_EQ(aggregator.invalidRecordCount(), 0U);
+}
+
+TEST(TrackStaticsAggregatorTest, Record_OutlierDoesNotStopPublishingTheTrack) {
+    TrackStaticsAggregator aggregator(16U);
+    aggregator.record(makeFinal(7, 100, 200));
+    aggregator.record(makeUncheckedFinal(7, 100, 2000000));
+    aggregator.record(makeFinal(7, 300, 400));
+
+    std::vector<TrackStatics> statics;
+    ASSERT_EQ(aggregator.collect(1, statics), 1U);
+    EXPECT_DOUBLE_EQ(statics.front().getSecondHopDelayDataMax(), 400.0);
+    EXPECT_DOUBLE_EQ(statics.front().getFirstHopDelayDataMean(), 200.0);
+    EXPECT_EQ(aggregator.rejectedSampleCount(), 1U);
+
+    // Later collects keep publishing the track
+    aggregator.record(makeFinal(7, 2000000, 10));
+    aggregator.record(makeFinal(7, 200, 300));
+    statics.clear();
+    ASSERT_EQ(aggregator.collect(2, statics), 1U);
+    EXPECT_TRUE(statics.front().isValid());
+    EXPECT_EQ(aggregator.invalidRecordCount(), 0U);
+}
@@ -188,6 +188,16 @@ TEST_F(DelayCalcTrackDataTest, SerializeDeserialize_RoundTrip) {
     EXPECT_EQ(deserialized.getSecondHopSentTime(), validData_.getSecondHopSentTime());
 }
 
+TEST_F(DelayCalcTrackDataTest, Deserialize_ResetsLocalReceiveTime) {
+    std::vector<uint8_t> serialized = validData_.serialize();
+    DelayCalcTrackData reused;
+    reused.setSecondHopReceiveTime(1234567890LL);
+
+    ASSERT_TRUE(reused.deserialize(serialized));
+    EXPECT_EQ(reused.getSecondHopReceiveTime(), 0);
+    EXPECT_EQ(serialized.size(), reused.getSerializedSize());  // Not on the wire
+}
+
 TEST_F(DelayCalcTrackDataTest, Deserialize_FailsWithEmptyData) {
     DelayCalcTrackData data;
     std::vector<uint8_t> emptyData;
@@ -0,0 +1,104 @@
+/**
+ * @file ClockSyncTest.cpp
+ * @brief Unit tests for the ping-pong clock offset estimator
+ */
+
+#include <gtest/gtest.h>
+#include "utils/ClockSync.hpp"
+#include <chrono>
+#include <cstdlib>
+#include <thread>
+
+using namespace utils;
+
+TEST(ClockSyncTest, Filter_ComputesNtpOffsetAndErrorBound) {
+    ClockOffsetFilter filter;
+    EXPECT_FALSE(filter.estimate().valid);
+
+    // Peer clock 500 us ahead, 100 us each way, 20 us turnaround
+    ASSERT_TRUE(filter.addSample(1000, 1600, 1620, 1220));
+    const ClockOffsetEstimate estimate = filter.estimate();
+    ASSERT_TRUE(estimate.valid);
+    EXPECT_EQ(estimate.offsetUs, 500);
+    EXPECT_EQ(estimate.rttUs, 200);
+    EXPECT_EQ(estimate.errorBoundUs, 100);
+    EXPECT_EQ(estimate.toPeerClock(10000), 10500);
+}
+
+TEST(ClockSyncTest, Filter_SelectsMinimumRttSample) {
+    ClockOffsetFilter filter;
+    // Queued reply: 900 us on the way back skews the offset by -400 us
+    ASSERT_TRUE(filter.addSample(0, 600, 600, 1000));
+    // Clean exchange: offset 500, rtt 200
+    ASSERT_TRUE(filter.addSample(2000, 2600, 2600, 2200));
+    EXPECT_EQ(filter.estimate().offsetUs, 500);
+    EXPECT_EQ(filter.estimate().rttUs, 200);
+
+    // The clean sample leaves the window after WINDOW newer ones
+    for (std::size_t i = 0U; i < ClockOffsetFilter::WINDOW; ++i) {
+        ASSERT_TRUE(filter.addSample(10000, 10700, 10700, 10400));
+    }
+    EXPECT_EQ(filter.estimate().rttUs, 400);
+    EXPECT_EQ(filter.estimate().offsetUs, 500);
+}
+
+TEST(ClockSyncTest, Filter_RejectsNegativeRtt) {
+    ClockOffsetFilter filter;
+    EXPECT_FALSE(filter.addSample(1000, 1100, 1300, 1100));
+    EXPECT_FALSE(filter.estimate().valid);
+}
+
+TEST(ClockSyncTest, Estimate_UncorrectedWhenInvalid) {
+    ClockOffsetEstimate estimate;
+    estimate.offsetUs = 123;
+    EXPECT_EQ(estimate.toPeerClock(1000), 1000);
+}
+
+TEST(ClockSyncTest, Loopback_ClientConvergesOnSameHost) {
+    ClockSyncResponder responder("udp://127.0.0.1:15910");
+    ASSERT_TRUE(responder.start());
+    ClockSyncClient client("test_peer", "udp://127.0.0.1:15910", std::chrono::milliseconds(20));
+    ASSERT_TRUE(client.start());
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+    while (!client.estimate().valid && (std::chrono::steady_clock::now() < deadline)) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    client.stop();
+    responder.stop();
+
+    const ClockOffsetEstimate estimate = client.estimate();
+    ASSERT_TRUE(estimate.valid);
+    EXPECT_GE(responder.answeredCount(), 1U);
+    // Same clock on both ends: the true offset (0) lies within the bound
+    EXPECT_LE(std::abs(estimate.offsetUs), estimate.errorBoundUs + 1);
+    EXPECT_EQ(MetricsRegistry::instance().gauge("clock.test_peer.rtt_us").value(), estimate.rttUs);
+}
+
+TEST(ClockSyncTest, ResolvePeer_PrefersValidEnvironmentEndpoint) {
+    const char* const variable = "HEXAGON_CLOCK_SYNC_TEST_ENDPOINT";
+    ::unsetenv(variable);
+    ClockSyncPeerEndpoint peer = resolveClockSyncPeer(variable, "udp://127.0.0.1:15101");
+    EXPECT_EQ(peer.endpoint, "udp://127.0.0.1:15101");
+    EXPECT_FALSE(peer.fromEnvironment);
+    EXPECT_FALSE(peer.invalidOverride);
+
+    ASSERT_EQ(::setenv(variable, "udp://10.0.0.2:15101", 1), 0);
+    peer = resolveClockSyncPeer(variable, "udp://127.0.0.1:15101");
+    EXPECT_EQ(peer.endpoint, "udp://10.0.0.2:15101");
+    EXPECT_TRUE(peer.fromEnvironment);
+
+    ASSERT_EQ(::setenv(variable, "tcp://host-b:15101", 1), 0);
+    peer = resolveClockSyncPeer(variable, "udp://127.0.0.1:15101");
+    EXPECT_EQ(peer.endpoint, "udp://127.0.0.1:15101");
+    EXPECT_FALSE(peer.fromEnvironment);
+    EXPECT_TRUE(peer.invalidOverride);
+    ::unsetenv(variable);
+}
+
+TEST(ClockSyncTest, Responder_RejectsInvalidEndpoint) {
+    ClockSyncResponder responder("tcp://127.0.0.1:15911");
+    EXPECT_FALSE(responder.start());
+    ClockSyncClient client("test_peer", "udp://not-an-address:1");
+    EXPECT_FALSE(client.start());
+}
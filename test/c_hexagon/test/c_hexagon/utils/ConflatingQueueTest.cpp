@@ -0,0 +1,167 @@
+/**
+ * @file ConflatingQueueTest.cpp
+ * @brief Unit tests for the per-track conflating queue
+ */
+
+#include <gtest/gtest.h>
+#include "utils/ConflatingQueue.hpp"
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <random>
+#include <thread>
+
+using namespace utils;
+
+namespace {
+    struct Sample {
+        int32_t trackId{0};
+        int64_t updateTime{0};
+
+        int32_t getTrackId() const noexcept {
+            return trackId;
+        }
+    };
+}
+
+TEST(ConflatingQueueTest, Constructor_ZeroCapacityThrows) {
+    EXPECT_THROW(ConflatingQueue<Sample>{0U}, std::invalid_argument);
+}
+
+TEST(ConflatingQueueTest, Push_SameTrackReplacesInPlaceAndKeepsPosition) {
+    ConflatingQueue<Sample> queue{8U};
+    EXPECT_EQ(queue.push(Sample{1, 10}), ConflateResult::Queued);
+    EXPECT_EQ(queue.push(Sample{2, 20}), ConflateResult::Queued);
+    EXPECT_EQ(queue.push(Sample{1, 11}), ConflateResult::Replaced);
+    EXPECT_EQ(queue.push(Sample{1, 12}), ConflateResult::Replaced);
+    EXPECT_EQ(queue.size(), 2U);
+    EXPECT_EQ(queue.conflatedCount(), 2U);
+
+    Sample out;
+    ASSERT_TRUE(queue.tryPop(out));
+    EXPECT_EQ(out.trackId, 1);
+    EXPECT_EQ(out.updateTime, 12);
+    ASSERT_TRUE(queue.tryPop(out));
+    EXPECT_EQ(out.trackId, 2);
+    EXPECT_FALSE(queue.tryPop(out));
+
+    // Popped tracks queue again instead of conflating
+    EXPECT_EQ(queue.push(Sample{1, 13}), ConflateResult::Queued);
+}
+
+TEST(ConflatingQueueTest, Push_BurstFromOneTrackDoesNotEvictOthers) {
+    ConflatingQueue<Sample> queue{2U};
+    ASSERT_EQ(queue.push(Sample{7, 1}), ConflateResult::Queued);
+    for (int64_t i = 0; i < 1000; ++i) {
+        ASSERT_NE(queue.push(Sample{9, i}), ConflateResult::EvictedOldest);
+    }
+    EXPECT_EQ(queue.droppedCount(), 0U);
+
+    Sample out;
+    ASSERT_TRUE(queue.tryPop(out));
+    EXPECT_EQ(out.trackId, 7);
+    ASSERT_TRUE(queue.tryPop(out));
+    EXPECT_EQ(out.trackId, 9);
+    EXPECT_EQ(out.updateTime, 999);
+}
+
+TEST(ConflatingQueueTest, Push_NewTrackWhenFullEvictsOldestTrack) {
+    ConflatingQueue<Sample> queue{2U};
+    ASSERT_EQ(queue.push(Sample{1, 1}), ConflateResult::Queued);
+    ASSERT_EQ(queue.push(Sample{2, 2}), ConflateResult::Queued);
+    EXPECT_EQ(queue.push(Sample{3, 3}), ConflateResult::EvictedOldest);
+    EXPECT_EQ(queue.droppedCount(), 1U);
+    // Track 1 left the index with its slot
+    EXPECT_EQ(queue.push(Sample{1, 4}), ConflateResult::EvictedOldest);
+
+    Sample out;
+    ASSERT_TRUE(queue.tryPop(out));
+    EXPECT_EQ(out.trackId, 3);
+    ASSERT_TRUE(queue.tryPop(out));
+    EXPECT_EQ(out.trackId, 1);
+    EXPECT_EQ(out.updateTime, 4);
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST(ConflatingQueueTest, TryPopBatch_DrainsOldestTracksFirst) {
+    ConflatingQueue<Sample> queue{8U};
+    for (int32_t trackId = 1; trackId <= 5; ++trackId) {
+        ASSERT_EQ(queue.push(Sample{trackId, trackId * 10}), ConflateResult::Queued);
+    }
+    ASSERT_EQ(queue.push(Sample{2, 21}), ConflateResult::Replaced);
+
+    Sample out[3];
+    EXPECT_EQ(queue.tryPopBatch(out, 0U), 0U);
+    ASSERT_EQ(queue.tryPopBatch(out, 3U), 3U);
+    EXPECT_EQ(out[0].trackId, 1);
+    EXPECT_EQ(out[1].trackId, 2);
+    EXPECT_EQ(out[1].updateTime, 21);
+    EXPECT_EQ(out[2].trackId, 3);
+    EXPECT_EQ(queue.size(), 2U);
+
+    // Popped tracks left the index: pushing one queues it behind the rest
+    EXPECT_EQ(queue.push(Sample{1, 11}), ConflateResult::Queued);
+    ASSERT_EQ(queue.tryPopBatch(out, 3U), 3U);
+    EXPECT_EQ(out[0].trackId, 4);
+    EXPECT_EQ(out[1].trackId, 5);
+    EXPECT_EQ(out[2].trackId, 1);
+    EXPECT_EQ(queue.waitPopBatch(out, 3U, std::chrono::milliseconds(5)), 0U);
+}
+
+TEST(ConflatingQueueTest, RandomChurn_MatchesReferenceModel) {
+    constexpr std::size_t capacity = 16U;
+    ConflatingQueue<Sample> queue{capacity};
+    std::deque<int32_t> order;
+    std::map<int32_t, int64_t> latest;
+    std::mt19937 random(42U);
+    // Colliding ids stress probing and backward-shift deletion
+    std::uniform_int_distribution<int32_t> trackIds(1, 40);
+
+    for (int64_t step = 0; step < 20000; ++step) {
+        if ((random() % 3U) != 0U) {
+            const int32_t trackId = trackIds(random) * 32;
+            const ConflateResult result = queue.push(Sample{trackId, step});
+            if (latest.count(trackId) != 0U) {
+                ASSERT_EQ(result, ConflateResult::Replaced);
+            } else if (order.size() == capacity) {
+                ASSERT_EQ(result, ConflateResult::EvictedOldest);
+                latest.erase(order.front());
+                order.pop_front();
+                order.push_back(trackId);
+            } else {
+                ASSERT_EQ(result, ConflateResult::Queued);
+                order.push_back(trackId);
+            }
+            latest[trackId] = step;
+        } else {
+            Sample out;
+            ASSERT_EQ(queue.tryPop(out), !order.empty());
+            if (!order.empty()) {
+                ASSERT_EQ(out.trackId, order.front());
+                ASSERT_EQ(out.updateTime, latest[out.trackId]);
+                latest.erase(out.trackId);
+                order.pop_front();
+            }
+        }
+        ASSERT_EQ(queue.size(), order.size());
+    }
+}
+
+TEST(ConflatingQueueTest, WaitPop_TimesOutAndWakesForProducer) {
+    ConflatingQueue<Sample> queue{4U};
+    Sample out;
+    EXPECT_FALSE(queue.waitPop(out, std::chrono::milliseconds(5)));
+
+    std::thread producer([&queue]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        static_cast<void>(queue.push(Sample{5, 50}));
+    });
+    EXPECT_TRUE(queue.waitPop(out, std::chrono::seconds(5)));
+    producer.join();
+    EXPECT_EQ(out.trackId, 5);
+
+    queue.wakeConsumer();
+    EXPECT_FALSE(queue.waitPop(out, std::chrono::seconds(5)));
+    queue.resetWake();
+}
@@ -0,0 +1,165 @@
+/**
+ * @file FlightRecorderTest.cpp
+ * @brief Unit tests for the flight recorder rings, dumps and stall watchdog
+ */
+
+#include <gtest/gtest.h>
+#include "utils/FlightRecorder.hpp"
+#include <chrono>
+#include <csignal>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <thread>
+#include <sys/wait.h>
+#include <unistd.h>
+
+using namespace utils;
+
+namespace {
+    const char* const kDirectory = "/tmp";
+    const char* const kSource = "c_hexagon_test";
+
+    std::string dumpPath() {
+        return std::string(kDirectory) + "/" + kSource + "_flight_" + std::to_string(::getpid()) + ".txt";
+    }
+
+    std::string readFile(const std::string& path) {
+        std::ifstream file(path);
+        return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+
+    /// Record from a fresh thread so the events land in a ring of their own
+    void recordOnNewThread(FlightEventKind kind, int32_t trackId, int64_t key) {
+        std::thread([=]() { FlightRecorder::instance().record(kind, trackId, key); }).join();
+    }
+}
+
+TEST(FlightRecorderTest, Ring_KeepsLastCapacityEventsAndCountsKinds) {
+    FlightRing ring(1);
+    const uint64_t total = FlightRing::CAPACITY + 10U;
+    for (uint64_t i = 0U; i < total; ++i) {
+        const auto kind = ((i % 2U) == 0U) ? FlightEventKind::Enqueue : FlightEventKind::Dequeue;
+        ring.push(FlightEvent{static_cast<int64_t>(i), static_cast<int64_t>(i), 7, static_cast<uint8_t>(kind)});
+    }
+
+    EXPECT_EQ(ring.writtenCount(), total);
+    EXPECT_EQ(ring.kindCount(FlightEventKind::Enqueue), total / 2U);
+    EXPECT_EQ(ring.kindCount(FlightEventKind::Dequeue), total / 2U);
+    // Oldest surviving event is sequence total - CAPACITY
+    EXPECT_EQ(ring.at(total - FlightRing::CAPACITY).messageKey, 10);
+    EXPECT_EQ(ring.at(total - 1U).messageKey, static_cast<int64_t>(total - 1U));
+}
+
+TEST(FlightRecorderTest, Disabled_RecordIsNoOp) {
+    FlightRecorder& recorder = FlightRecorder::instance();
+    recorder.disable();
+    const uint64_t before = recorder.eventCount(FlightEventKind::SendFailed);
+    recordOnNewThread(FlightEventKind::SendFailed, 1, 1);
+    EXPECT_EQ(recorder.eventCount(FlightEventKind::SendFailed), before);
+    EXPECT_FALSE(recorder.dumpToFile("disabled"));
+}
+
+TEST(FlightRecorderTest, DumpToFile_WritesHeaderAndEvents) {
+    FlightRecorder& recorder = FlightRecorder::instance();
+    ASSERT_TRUE(recorder.enable(kDirectory, kSource));
+    std::remove(dumpPath().c_str());
+
+    recordOnNewThread(FlightEventKind::Receive, 42, 1000);
+    recordOnNewThread(FlightEventKind::Send, -5, -1);
+    ASSERT_TRUE(recorder.dumpToFile("test"));
+
+    const std::string text = readFile(dumpPath());
+    EXPECT_EQ(text.rfind("# flight recorder c_hexagon_test pid=", 0), 0U);
+    EXPECT_NE(text.find(" reason=test "), std::string::npos);
+    EXPECT_NE(text.find(" Receive track=42 key=1000\n"), std::string::npos);
+    EXPECT_NE(text.find(" Send track=-5 key=-1\n"), std::string::npos);
+    EXPECT_NE(text.find("# thread "), std::string::npos);
+
+    recorder.disable();
+    std::remove(dumpPath().c_str());
+}
+
+TEST(FlightRecorderTest, Watchdog_DumpsOncePerStallAndRearms) {
+    FlightRecorder& recorder = FlightRecorder::instance();
+    ASSERT_TRUE(recorder.enable(kDirectory, kSource));
+    std::remove(dumpPath().c_str());
+
+    const int64_t timeoutNs = 1000000000;
+    FlightRecorderWatchdog watchdog{std::chrono::milliseconds(1000)};
+    EXPECT_FALSE(watchdog.check(0));
+
+    // Idle (nothing enqueued) is not a stall
+    EXPECT_FALSE(watchdog.check(timeoutNs * 2));
+
+    // The backlog clock starts when the enqueue is first seen
+    recordOnNewThread(FlightEventKind::Enqueue, 3, 30);
+    EXPECT_FALSE(watchdog.check(timeoutNs * 3));
+    EXPECT_FALSE(watchdog.check(timeoutNs * 4 - 1));
+    EXPECT_TRUE(watchdog.check(timeoutNs * 4));
+    EXPECT_FALSE(watchdog.check(timeoutNs * 5));
+    EXPECT_EQ(watchdog.stallCount(), 1U);
+    EXPECT_NE(readFile(dumpPath()).find("reason=watchdog_stall"), std::string::npos);
+
+    // Dequeue progress re-arms; a second backlog stalls again
+    recordOnNewThread(FlightEventKind::Dequeue, 3, 30);
+    EXPECT_FALSE(watchdog.check(timeoutNs * 6));
+    recordOnNewThread(FlightEventKind::Enqueue, 4, 40);
+    EXPECT_FALSE(watchdog.check(timeoutNs * 6 + 1));
+    EXPECT_FALSE(watchdog.check(timeoutNs * 7));
+    EXPECT_TRUE(watchdog.check(timeoutNs * 7 + 1));
+    EXPECT_EQ(watchdog.stallCount(), 2U);
+
+    recorder.disable();
+    std::remove(dumpPath().c_str());
+}
+
+TEST(FlightRecorderTest, Watchdog_IdleThenSingleMessageIsNotAStall) {
+    FlightRecorder& recorder = FlightRecorder::instance();
+    ASSERT_TRUE(recorder.enable(kDirectory, kSource));
+
+    const int64_t timeoutNs = 1000000000;
+    FlightRecorderWatchdog watchdog{std::chrono::milliseconds(1000)};
+    EXPECT_FALSE(watchdog.check(0));
+    recordOnNewThread(FlightEventKind::Enqueue, 5, 50);
+    recordOnNewThread(FlightEventKind::Dequeue, 5, 50);
+    EXPECT_FALSE(watchdog.check(timeoutNs / 4));
+
+    // Long idle, then one message that is handled within the timeout
+    EXPECT_FALSE(watchdog.check(timeoutNs * 60));
+    recordOnNewThread(FlightEventKind::Enqueue, 6, 60);
+    EXPECT_FALSE(watchdog.check(timeoutNs * 60 + (timeoutNs / 4)));
+    EXPECT_FALSE(watchdog.check(timeoutNs * 60 + (timeoutNs / 2)));
+    recordOnNewThread(FlightEventKind::Dequeue, 6, 60);
+    EXPECT_FALSE(watchdog.check(timeoutNs * 60 + (timeoutNs * 3 / 4)));
+    EXPECT_FALSE(watchdog.check(timeoutNs * 120));
+    EXPECT_EQ(watchdog.stallCount(), 0U);
+
+    recorder.disable();
+}
+
+TEST(FlightRecorderTest, FatalSignal_DumpsAndKeepsDefaultAction) {
+    const pid_t child = ::fork();
+    ASSERT_GE(child, 0);
+    if (child == 0) {
+        FlightRecorder& recorder = FlightRecorder::instance();
+        if (!recorder.enable(kDirectory, kSource) || !FlightRecorder::installSignalHandlers()) {
+            ::_exit(2);
+        }
+        recorder.record(FlightEventKind::Dequeue, 9, 900);
+        static_cast<void>(::raise(SIGSEGV));
+        ::_exit(3);  // Not reached: the default action terminates
+    }
+
+    int status = 0;
+    ASSERT_EQ(::waitpid(child, &status, 0), child);
+    ASSERT_TRUE(WIFSIGNALED(status));
+    EXPECT_EQ(WTERMSIG(status), SIGSEGV);
+
+    const std::string path = std::string(kDirectory) + "/" + kSource + "_flight_" + std::to_string(child) + ".txt";
+    const std::string text = readFile(path);
+    EXPECT_NE(text.find("reason=SIGSEGV"), std::string::npos);
+    EXPECT_NE(text.find(" Dequeue track=9 key=900\n"), std::string::npos);
+    std::remove(path.c_str());
+}
@@ -0,0 +1,98 @@
+/**
+ * @file HdrHistogramTest.cpp
+ * @brief Unit tests for the HdrHistogram latency histogram
+ */
+
+#include <gtest/gtest.h>
+#include "utils/HdrHistogram.hpp"
+#include <array>
+#include <cstdint>
+
+using utils::CoarseHdrHistogram;
+using utils::HdrHistogram;
+
+TEST(HdrHistogramTest, Empty_ReportsZero) {
+    HdrHistogram histogram;
+
+    EXPECT_EQ(histogram.count(), 0U);
+    EXPECT_EQ(histogram.min(), 0);
+    EXPECT_EQ(histogram.max(), 0);
+    EXPECT_EQ(histogram.valueAtPercentile(99.0), 0);
+}
+
+TEST(HdrHistogramTest, SmallValues_AreExact) {
+    HdrHistogram histogram;
+    for (int64_t v = 1; v <= 100; ++v) {
+        histogram.record(v);
+    }
+
+    EXPECT_EQ(histogram.count(), 100U);
+    EXPECT_EQ(histogram.min(), 1);
+    EXPECT_EQ(histogram.max(), 100);
+    EXPECT_EQ(histogram.valueAtPercentile(50.0), 50);
+    EXPECT_EQ(histogram.valueAtPercentile(90.0), 90);
+    EXPECT_EQ(histogram.valueAtPercentile(100.0), 100);
+}
+
+TEST(HdrHistogramTest, LargeValues_WithinRelativeError) {
+    HdrHistogram histogram;
+    for (int64_t v = 1; v <= 100000; ++v) {
+        histogram.record(v * 10);
+    }
+
+    const std::array<double, 4> percentiles{50.0, 90.0, 99.0, 99.9};
+    const std::array<int64_t, 4> expected{500000, 900000, 990000, 999000};
+    std::array<int64_t, 4> values{};
+    histogram.valuesAtPercentiles(percentiles.data(), percentiles.size(), values.data());
+
+    for (std::size_t i = 0U; i < values.size(); ++i) {
+        EXPECT_GE(values[i], expected[i]) << percentiles[i];
+        EXPECT_LE(values[i], expected[i] + (expected[i] / 64)) << percentiles[i];
+    }
+    EXPECT_EQ(histogram.max(), 1000000);
+}
+
+TEST(HdrHistogramTest, Coarse_WithinRelativeErrorAndSmaller) {
+    CoarseHdrHistogram histogram;
+    for (int64_t v = 1; v <= 100000; ++v) {
+        histogram.record(v * 10);
+    }
+
+    const std::array<double, 4> percentiles{50.0, 90.0, 99.0, 99.9};
+    const std::array<int64_t, 4> expected{500000, 900000, 990000, 999000};
+    std::array<int64_t, 4> values{};
+    histogram.valuesAtPercentiles(percentiles.data(), percentiles.size(), values.data());
+
+    for (std::size_t i = 0U; i < values.size(); ++i) {
+        EXPECT_GE(values[i], expected[i]) << percentiles[i];
+        EXPECT_LE(values[i], expected[i] + (expected[i] / 16)) << percentiles[i];
+    }
+    EXPECT_EQ(histogram.max(), 1000000);
+    EXPECT_EQ(CoarseHdrHistogram::MAX_TRACKABLE_VALUE, HdrHistogram::MAX_TRACKABLE_VALUE);
+    EXPECT_LT(CoarseHdrHistogram::BUCKET_COUNT * 3U, HdrHistogram::BUCKET_COUNT);
+}
+
+TEST(HdrHistogramTest, OutOfRange_IsClampedAndCounted) {
+    HdrHistogram histogram;
+    histogram.record(-5);
+    histogram.record(HdrHistogram::MAX_TRACKABLE_VALUE + 1);
+    histogram.record(10);
+
+    EXPECT_EQ(histogram.count(), 3U);
+    EXPECT_EQ(histogram.clampedCount(), 2U);
+    EXPECT_EQ(histogram.min(), 0);
+    EXPECT_EQ(histogram.max(), HdrHistogram::MAX_TRACKABLE_VALUE);
+    EXPECT_EQ(histogram.valueAtPercentile(100.0), HdrHistogram::MAX_TRACKABLE_VALUE);
+}
+
+TEST(HdrHistogramTest, Reset_ClearsCounts) {
+    HdrHistogram histogram;
+    histogram.record(42);
+    histogram.reset();
+
+    EXPECT_EQ(histogram.count(), 0U);
+    EXPECT_EQ(histogram.max(), 0);
+    histogram.record(7);
+    EXPECT_EQ(histogram.min(), 7);
+    EXPECT_EQ(histogram.valueAtPercentile(50.0), 7);
+}
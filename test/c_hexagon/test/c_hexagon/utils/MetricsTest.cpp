@@ -0,0 +1,152 @@
+/**
+ * @file MetricsTest.cpp
+ * @brief Unit tests for runtime metrics, the snapshot frame and the Unix socket publisher
+ */
+
+#include <gtest/gtest.h>
+#include "utils/MetricsPublisher.hpp"
+#include <chrono>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+using namespace utils;
+
+namespace {
+    /// @brief Find a record by name in an encoded frame
+    bool findRecord(const std::vector<uint8_t>& frame, const std::string& name, MetricRecord& out) {
+        MetricsFrameHeader header;
+        const int32_t count = parseMetricsFrame(frame.data(), frame.size(), header);
+        for (int32_t i = 0; i < count; ++i) {
+            std::memcpy(&out, frame.data() + sizeof(MetricsFrameHeader) + (static_cast<std::size_t>(i) * sizeof(MetricRecord)),
+                        sizeof(MetricRecord));
+            if (name == out.name) {
+                return true;
+            }
+        }
+        return false;
+    }
+}
+
+TEST(MetricsTest, Registry_ReturnsSameMetricForSameName) {
+    Metric& first = MetricsRegistry::instance().counter("test.registry.same");
+    Metric& second = MetricsRegistry::instance().counter("test.registry.same");
+
+    EXPECT_EQ(&first, &second);
+    EXPECT_EQ(first.kind(), MetricKind::Counter);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(&first) % 64U, 0U);
+}
+
+TEST(MetricsTest, CounterAndGauge_TrackValues) {
+    Metric& counter = MetricsRegistry::instance().counter("test.values.counter");
+    Metric& gauge = MetricsRegistry::instance().gauge("test.values.gauge");
+    const int64_t base = counter.value();
+
+    counter.add();
+    counter.add(41U);
+    gauge.set(17);
+    gauge.set(3);
+
+    EXPECT_EQ(counter.value() - base, 42);
+    EXPECT_EQ(gauge.value(), 3);
+    EXPECT_EQ(gauge.kind(), MetricKind::Gauge);
+}
+
+TEST(MetricsTest, Counter_ConcurrentAddsAreNotLost) {
+    Metric& counter = MetricsRegistry::instance().counter("test.values.concurrent");
+    const int64_t base = counter.value();
+    constexpr int THREADS = 4;
+    constexpr int ADDS_PER_THREAD = 100000;
+
+    std::vector<std::thread> writers;
+    for (int t = 0; t < THREADS; ++t) {
+        writers.emplace_back([&counter]() {
+            for (int i = 0; i < ADDS_PER_THREAD; ++i) {
+                counter.add();
+            }
+        });
+    }
+    for (std::thread& writer : writers) {
+        writer.join();
+    }
+
+    EXPECT_EQ(counter.value() - base, static_cast<int64_t>(THREADS) * ADDS_PER_THREAD);
+}
+
+TEST(MetricsTest, EncodeSnapshot_ReportsCounterRates) {
+    Metric& counter = MetricsRegistry::instance().counter("test.encode.counter");
+    MetricsPublisher publisher("unit_test");
+    std::vector<uint8_t> frame;
+
+    publisher.encodeSnapshot(1.0, frame);
+    counter.add(50U);
+    publisher.encodeSnapshot(0.5, frame);
+
+    MetricsFrameHeader header;
+    ASSERT_EQ(parseMetricsFrame(frame.data(), frame.size(), header),
+              static_cast<int32_t>(MetricsRegistry::instance().size()));
+    EXPECT_STREQ(header.source, "unit_test");
+
+    MetricRecord record;
+    ASSERT_TRUE(findRecord(frame, "test.encode.counter", record));
+    EXPECT_EQ(record.kind, static_cast<uint8_t>(MetricKind::Counter));
+    EXPECT_DOUBLE_EQ(record.ratePerSec, 100.0);
+}
+
+TEST(MetricsTest, ParseMetricsFrame_RejectsMalformedFrames) {
+    MetricsPublisher publisher("unit_test");
+    std::vector<uint8_t> frame;
+    publisher.encodeSnapshot(1.0, frame);
+
+    MetricsFrameHeader header;
+    EXPECT_EQ(parseMetricsFrame(frame.data(), frame.size() - 1U, header), -1);
+    frame[0] ^= 0xFFU;
+    EXPECT_EQ(parseMetricsFrame(frame.data(), frame.size(), header), -1);
+    EXPECT_EQ(parseMetricsFrame(nullptr, 0U, header), -1);
+}
+
+TEST(MetricsTest, Publisher_SendsSnapshotsToUnixSocket) {
+    const std::string path = "/tmp/c_hexagon_metrics_test_" + std::to_string(::getpid()) + ".sock";
+    ::unlink(path.c_str());
+
+    const int reader = ::socket(AF_UNIX, SOCK_DGRAM, 0);
+    ASSERT_GE(reader, 0);
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    std::strncpy(address.sun_path, path.c_str(), sizeof(address.sun_path) - 1U);
+    ASSERT_EQ(::bind(reader, reinterpret_cast<const sockaddr*>(&address), sizeof(address)), 0);
+    timeval timeout{2, 0};
+    ASSERT_EQ(::setsockopt(reader, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout)), 0);
+
+    MetricsRegistry::instance().counter("test.publisher.counter").add(7U);
+    MetricsPublisher publisher("unit_test", path, std::chrono::milliseconds(20));
+    ASSERT_TRUE(publisher.start());
+
+    std::vector<uint8_t> buffer(64U * 1024U);
+    const ssize_t received = ::recv(reader, buffer.data(), buffer.size(), 0);
+    publisher.stop();
+    ::close(reader);
+    ::unlink(path.c_str());
+
+    ASSERT_GT(received, 0);
+    buffer.resize(static_cast<std::size_t>(received));
+    MetricRecord record;
+    ASSERT_TRUE(findRecord(buffer, "test.publisher.counter", record));
+    EXPECT_GE(record.value, 7);
+    EXPECT_GE(publisher.publishedCount(), 1U);
+}
+
+TEST(MetricsTest, Publisher_WithoutReaderDoesNotFail) {
+    MetricsPublisher publisher("unit_test", "/tmp/c_hexagon_metrics_no_reader.sock",
+                               std::chrono::milliseconds(10));
+    ASSERT_TRUE(publisher.start());
+    std::this_thread::sleep_for(std::chrono::milliseconds(30));
+    publisher.stop();
+
+    EXPECT_FALSE(publisher.isRunning());
+    EXPECT_EQ(publisher.publishedCount(), 0U);
+}
@@ -0,0 +1,76 @@
+/**
+ * @file WaitStrategyTest.cpp
+ * @brief Unit tests for the selectable wait strategies and wake-up latency probe
+ */
+
+#include <gtest/gtest.h>
+#include "utils/InstrumentedWaitStrategy.hpp"
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <thread>
+
+using namespace utils;
+
+namespace {
+    /// Publish after a delay the way a queue producer does: data first, then signal()
+    void publishLater(std::atomic<bool>& flag, WaitStrategy& strategy, std::chrono::milliseconds delay) {
+        std::this_thread::sleep_for(delay);
+        flag.store(true, std::memory_order_release);
+        strategy.signal();
+    }
+}
+
+TEST(WaitStrategyTest, MakeWaitStrategy_CreatesEachKind) {
+    EXPECT_STREQ(makeWaitStrategy(WaitStrategyKind::Blocking)->name(), "blocking");
+    EXPECT_STREQ(makeWaitStrategy(WaitStrategyKind::Yielding)->name(), "yielding");
+    EXPECT_STREQ(makeWaitStrategy(WaitStrategyKind::SpinThenPark)->name(), "spin-then-park");
+    EXPECT_STREQ(makeWaitStrategy(WaitStrategyKind::BusySpin)->name(), "busy-spin");
+}
+
+TEST(WaitStrategyTest, SpinThenPark_NegativeBudgetParksImmediately) {
+    SpinThenParkWaitStrategy strategy{std::chrono::microseconds(-5)};
+    EXPECT_EQ(strategy.spinBudget().count(), 0);
+    EXPECT_FALSE(strategy.waitFor([]() { return false; }, std::chrono::milliseconds(2)));
+}
+
+TEST(WaitStrategyTest, SpinThenPark_TimesOutAndWakesAfterParking) {
+    SpinThenParkWaitStrategy strategy{std::chrono::microseconds(100)};
+    std::atomic<bool> ready{false};
+    const auto isReady = [&ready]() { return ready.load(std::memory_order_acquire); };
+
+    const auto start = std::chrono::steady_clock::now();
+    EXPECT_FALSE(strategy.waitFor(isReady, std::chrono::milliseconds(5)));
+    EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(5));
+
+    // Producer signals long after the spin budget: the consumer must be parked and woken
+    std::thread producer(publishLater, std::ref(ready), std::ref(strategy), std::chrono::milliseconds(20));
+    EXPECT_TRUE(strategy.waitFor(isReady, std::chrono::seconds(5)));
+    producer.join();
+}
+
+TEST(WaitStrategyTest, Instrumented_NullInnerThrows) {
+    EXPECT_THROW(InstrumentedWaitStrategy{nullptr}, std::invalid_argument);
+}
+
+TEST(WaitStrategyTest, Instrumented_RecordsOnlyWaitsThatWereSignalled) {
+    InstrumentedWaitStrategy probe{makeWaitStrategy(WaitStrategyKind::Blocking)};
+    EXPECT_STREQ(probe.name(), "blocking");
+
+    // Already ready and timed-out waits leave the histogram empty
+    EXPECT_TRUE(probe.waitFor([]() { return true; }, std::chrono::milliseconds(1)));
+    EXPECT_FALSE(probe.waitFor([]() { return false; }, std::chrono::milliseconds(2)));
+    EXPECT_EQ(probe.wakeLatency().count(), 0U);
+
+    std::atomic<bool> ready{false};
+    std::thread producer(publishLater, std::ref(ready), std::ref(probe), std::chrono::milliseconds(10));
+    EXPECT_TRUE(probe.waitFor([&ready]() { return ready.load(std::memory_order_acquire); },
+                              std::chrono::seconds(5)));
+    producer.join();
+
+    ASSERT_EQ(probe.wakeLatency().count(), 1U);
+    // Signal-to-wake, not the 10 ms the consumer spent waiting for data
+    EXPECT_LT(probe.wakeLatency().max(),
+              std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::milliseconds(10)).count());
+}
@@ -0,0 +1,202 @@
+/**
+ * @file main.cpp
+ * @brief Offline decoder for the a_hexagon binary event log
+ * @details Reads one or more per-thread ring files written by
+ *          utils/EventLog.hpp, recovers the surviving records of each ring
+ *          (the last `capacity` ones once it has wrapped), merges them by
+ *          timestamp and prints them as text or CSV.
+ *
+ * Usage: ./hexagon_eventlog [--csv] FILE...
+ *   --csv: Print wall_ns,thread,event,track_id,arg0,arg1,arg2,arg3 rows
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <iostream>
+#include <iomanip>
+#include <iterator>
+#include <string>
+#include <vector>
+
+/**
+ * @brief File format matching a_hexagon's utils/EventLog.hpp
+ * File: EventLogFileHeader + capacity * EventRecord
+ */
+static constexpr uint32_t EVENT_LOG_MAGIC = 0x4C564548U;  // "HEVL"
+static constexpr uint16_t EVENT_LOG_VERSION = 1U;
+
+struct EventLogFileHeader {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t recordSize;
+    uint32_t capacity;
+    uint32_t reserved;
+    uint64_t writeCount;
+    int64_t threadId;
+    int64_t wallBaseNs;
+    int64_t monoBaseNs;
+    char source[16];
+};
+
+struct EventRecord {
+    int64_t timestampNs;
+    uint16_t eventId;
+    uint16_t reserved;
+    int32_t trackId;
+    int64_t args[4];
+};
+
+static_assert(sizeof(EventLogFileHeader) == 64, "EventLogFileHeader must be 64 bytes");
+static_assert(sizeof(EventRecord) == 48, "EventRecord must be 48 bytes");
+
+/**
+ * @brief Event name and argument labels
+ */
+struct EventInfo {
+    const char* name;
+    const char* argNames[4];
+};
+
+static EventInfo eventInfo(uint16_t id) {
+    switch (id) {
+        case 1U: return {"TrackReceived", {"latency_us", "bytes", nullptr, nullptr}};
+        case 2U: return {"BurstReplaced", {"generation", nullptr, nullptr, nullptr}};
+        case 3U: return {"SampleExtrapolated", {"sample", "generation", nullptr, nullptr}};
+        case 4U: return {"TableExtrapolated", {"size", "time_us", nullptr, nullptr}};
+        case 5U: return {"RecordSent", {"bytes", nullptr, nullptr, nullptr}};
+        case 6U: return {"BatchSent", {"records", "bytes", "sequence", nullptr}};
+        case 7U: return {"QueueDrop", {"evicted", nullptr, nullptr, nullptr}};
+        case 8U: return {"SendFailed", {"records", nullptr, nullptr, nullptr}};
+        default: return {"Unknown", {"arg0", "arg1", "arg2", "arg3"}};
+    }
+}
+
+/**
+ * @brief One decoded event, timestamp already converted to wall time
+ */
+struct DecodedEvent {
+    int64_t wallNs;
+    int64_t threadId;
+    EventRecord record;
+};
+
+/**
+ * @brief Append the surviving records of one ring file
+ * @return false if the file is missing or not an event log
+ */
+bool loadFile(const std::string& path, std::vector<DecodedEvent>& events) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        std::cerr << path << ": cannot open" << std::endl;
+        return false;
+    }
+    const std::vector<char> bytes((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+    EventLogFileHeader header;
+    if (bytes.size() < sizeof(header)) {
+        std::cerr << path << ": too short for a header" << std::endl;
+        return false;
+    }
+    std::memcpy(&header, bytes.data(), sizeof(header));
+    if ((header.magic != EVENT_LOG_MAGIC) || (header.version != EVENT_LOG_VERSION) ||
+        (header.recordSize != sizeof(EventRecord)) || (header.capacity == 0U)) {
+        std::cerr << path << ": not an event log (bad magic/version/record size)" << std::endl;
+        return false;
+    }
+    if (bytes.size() < (sizeof(header) + (static_cast<std::size_t>(header.capacity) * sizeof(EventRecord)))) {
+        std::cerr << path << ": truncated ring" << std::endl;
+        return false;
+    }
+
+    // Sequences [writeCount - capacity, writeCount) survive once the ring has wrapped
+    const uint64_t first = (header.writeCount > header.capacity) ? (header.writeCount - header.capacity) : 0U;
+    for (uint64_t sequence = first; sequence < header.writeCount; ++sequence) {
+        DecodedEvent event;
+        std::memcpy(&event.record,
+                    bytes.data() + sizeof(header) + ((sequence % header.capacity) * sizeof(EventRecord)),
+                    sizeof(EventRecord));
+        event.wallNs = header.wallBaseNs + (event.record.timestampNs - header.monoBaseNs);
+        event.threadId = header.threadId;
+        events.push_back(event);
+    }
+
+    header.source[sizeof(header.source) - 1] = '\0';
+    std::cerr << path << ": " << header.source << " thread " << header.threadId << ", "
+              << (header.writeCount - first) << " of " << header.writeCount << " records" << std::endl;
+    return true;
+}
+
+/**
+ * @brief Print one event as "HH:MM:SS.nnnnnnnnn [tid] Name track=N label=value..."
+ */
+void printText(const DecodedEvent& event) {
+    const std::time_t seconds = static_cast<std::time_t>(event.wallNs / 1000000000LL);
+    char timeText[32] = {0};
+    std::strftime(timeText, sizeof(timeText), "%H:%M:%S", std::localtime(&seconds));
+
+    const EventInfo info = eventInfo(event.record.eventId);
+    std::cout << timeText << "." << std::setw(9) << std::setfill('0') << (event.wallNs % 1000000000LL)
+              << std::setfill(' ') << " [" << event.threadId << "] " << info.name;
+    if (event.record.trackId >= 0) {
+        std::cout << " track=" << event.record.trackId;
+    }
+    for (int i = 0; i < 4; ++i) {
+        if (info.argNames[i] != nullptr) {
+            std::cout << " " << info.argNames[i] << "=" << event.record.args[i];
+        }
+    }
+    std::cout << "\n";
+}
+
+void printCsv(const DecodedEvent& event) {
+    std::cout << event.wallNs << "," << event.threadId << "," << eventInfo(event.record.eventId).name << ","
+              << event.record.trackId << "," << event.record.args[0] << "," << event.record.args[1] << ","
+              << event.record.args[2] << "," << event.record.args[3] << "\n";
+}
+
+int main(int argc, char* argv[]) {
+    bool csv = false;
+    std::vector<std::string> paths;
+
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--csv") == 0) {
+            csv = true;
+        } else if (argv[i][0] == '-') {
+            paths.clear();
+            break;
+        } else {
+            paths.emplace_back(argv[i]);
+        }
+    }
+    if (paths.empty()) {
+        std::cerr << "Usage: " << argv[0] << " [--csv] FILE..." << std::endl;
+        return 1;
+    }
+
+    std::vector<DecodedEvent> events;
+    bool allLoaded = true;
+    for (const std::string& path : paths) {
+        allLoaded = loadFile(path, events) && allLoaded;
+    }
+
+    // Per-thread rings are already in order; merging threads needs a sort
+    std::stable_sort(events.begin(), events.end(),
+                     [](const DecodedEvent& a, const DecodedEvent& b) { return a.wallNs < b.wallNs; });
+
+    if (csv) {
+        std::cout << "wall_ns,thread,event,track_id,arg0,arg1,arg2,arg3\n";
+    }
+    for (const DecodedEvent& event : events) {
+        if (csv) {
+            printCsv(event);
+        } else {
+            printText(event);
+        }
+    }
+    std::cout.flush();
+
+    return allLoaded ? 0 : 1;
+}
@@ -0,0 +1,184 @@
+/**
+ * @file main.cpp
+ * @brief Live runtime metrics viewer for a_hexagon, b_hexagon and c_hexagon
+ * @details Binds the Unix datagram socket the hexagons publish their metric
+ *          snapshots to (once per second each) and prints one table per
+ *          publishing process: counter totals with their per-second rate and
+ *          gauge levels (queue depths).
+ * 
+ * Usage: ./hexagon_metrics [--socket PATH] [--once]
+ *   --socket PATH: Socket to bind (default: /tmp/hexagon_metrics.sock)
+ *   --once:        Print the first snapshot received and exit
+ */
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <iostream>
+#include <iomanip>
+#include <cstring>
+#include <csignal>
+#include <cstdint>
+#include <ctime>
+#include <map>
+#include <string>
+#include <vector>
+
+// Global flag for graceful shutdown
+static volatile bool g_running = true;
+
+void signalHandler(int) {
+    g_running = false;
+}
+
+/**
+ * @brief Snapshot wire format matching the hexagons' utils/Metrics.hpp
+ * One datagram: MetricsFrameHeader + recordCount * MetricRecord
+ */
+static constexpr uint32_t METRICS_FRAME_MAGIC = 0x484D5452U;  // "HMTR"
+static constexpr uint16_t METRICS_FRAME_VERSION = 1U;
+static constexpr const char* DEFAULT_SOCKET_PATH = "/tmp/hexagon_metrics.sock";
+
+struct MetricsFrameHeader {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t recordCount;
+    int64_t timestampUs;
+    char source[16];
+};
+
+struct MetricRecord {
+    char name[47];
+    uint8_t kind;              // 1 = counter, 2 = gauge
+    int64_t value;
+    double ratePerSec;
+};
+
+static_assert(sizeof(MetricsFrameHeader) == 32, "MetricsFrameHeader must be 32 bytes");
+static_assert(sizeof(MetricRecord) == 64, "MetricRecord must be 64 bytes");
+
+/**
+ * @brief Print one snapshot as a table
+ */
+void printSnapshot(const MetricsFrameHeader& header, const MetricRecord* records) {
+    const std::time_t seconds = static_cast<std::time_t>(header.timestampUs / 1000000);
+    char timeText[32] = {0};
+    std::strftime(timeText, sizeof(timeText), "%H:%M:%S", std::localtime(&seconds));
+    
+    std::cout << "\n[" << header.source << "] " << timeText
+              << " (" << header.recordCount << " metrics)" << std::endl;
+    std::cout << "  " << std::left << std::setw(32) << "name"
+              << std::right << std::setw(16) << "value"
+              << std::setw(14) << "rate/s" << std::endl;
+    
+    for (uint16_t i = 0; i < header.recordCount; ++i) {
+        MetricRecord record;
+        std::memcpy(&record, &records[i], sizeof(record));
+        record.name[sizeof(record.name) - 1] = '\0';
+        
+        std::cout << "  " << std::left << std::setw(32) << record.name
+                  << std::right << std::setw(16) << record.value;
+        if (record.kind == 1U) {
+            std::cout << std::setw(14) << std::fixed << std::setprecision(1) << record.ratePerSec;
+        } else {
+            std::cout << std::setw(14) << "(gauge)";
+        }
+        std::cout << std::endl;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    std::string socketPath = DEFAULT_SOCKET_PATH;
+    bool once = false;
+    
+    for (int i = 1; i < argc; ++i) {
+        if ((std::strcmp(argv[i], "--socket") == 0) && ((i + 1) < argc)) {
+            socketPath = argv[++i];
+        } else if (std::strcmp(argv[i], "--once") == 0) {
+            once = true;
+        } else {
+            std::cerr << "Usage: " << argv[0] << " [--socket PATH] [--once]" << std::endl;
+            return 1;
+        }
+    }
+    
+    // Setup signal handler
+    std::signal(SIGINT, signalHandler);
+    std::signal(SIGTERM, signalHandler);
+    
+    sockaddr_un address{};
+    if ((socketPath.size() + 1) > sizeof(address.sun_path)) {
+        std::cerr << "Socket path too long: " << socketPath << std::endl;
+        return 1;
+    }
+    address.sun_family = AF_UNIX;
+    std::memcpy(address.sun_path, socketPath.c_str(), socketPath.size() + 1);
+    
+    const int fd = ::socket(AF_UNIX, SOCK_DGRAM, 0);
+    if (fd < 0) {
+        std::cerr << "socket() failed: " << std::strerror(errno) << std::endl;
+        return 1;
+    }
+    
+    // A stale socket file from a previous run would make bind() fail
+    ::unlink(socketPath.c_str());
+    if (::bind(fd, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0) {
+        std::cerr << "bind(" << socketPath << ") failed: " << std::strerror(errno) << std::endl;
+        ::close(fd);
+        return 1;
+    }
+    
+    // Wake up periodically to check the shutdown flag
+    timeval timeout{};
+    timeout.tv_sec = 0;
+    timeout.tv_usec = 200000;
+    ::setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+    
+    std::cout << "=== hexagon_metrics ===" << std::endl;
+    std::cout << "Listening on: " << socketPath << std::endl;
+    std::cout << "Press Ctrl+C to stop" << std::endl;
+    
+    std::vector<uint8_t> buffer(64 * 1024);
+    std::map<std::string, uint64_t> snapshotsPerSource;
+    uint64_t rejected = 0;
+    
+    while (g_running) {
+        const ssize_t received = ::recv(fd, buffer.data(), buffer.size(), 0);
+        if (received < 0) {
+            continue;  // Timeout or EINTR
+        }
+        
+        MetricsFrameHeader header;
+        const std::size_t size = static_cast<std::size_t>(received);
+        if (size < sizeof(header)) {
+            ++rejected;
+            continue;
+        }
+        std::memcpy(&header, buffer.data(), sizeof(header));
+        if ((header.magic != METRICS_FRAME_MAGIC) || (header.version != METRICS_FRAME_VERSION) ||
+            (size != (sizeof(header) + (header.recordCount * sizeof(MetricRecord))))) {
+            ++rejected;
+            continue;
+        }
+        header.source[sizeof(header.source) - 1] = '\0';
+        
+        printSnapshot(header, reinterpret_cast<const MetricRecord*>(buffer.data() + sizeof(header)));
+        ++snapshotsPerSource[header.source];
+        
+        if (once) {
+            break;
+        }
+    }
+    
+    ::close(fd);
+    ::unlink(socketPath.c_str());
+    
+    std::cout << "\n=== Summary ===" << std::endl;
+    for (const auto& entry : snapshotsPerSource) {
+        std::cout << "  " << entry.first << ": " << entry.second << " snapshots" << std::endl;
+    }
+    std::cout << "  rejected frames: " << rejected << std::endl;
+    
+    return 0;
+}